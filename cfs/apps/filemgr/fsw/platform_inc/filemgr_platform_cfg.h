@@ -46,7 +46,9 @@
 */
 
 #define FILEMGR_DIR_LIST_PKT_ENTRIES     20
+#define FILEMGR_DIR_SNAP_ENTRIES       2048  /* Directory names cached per snapshot window for paging dir listings */
 #define FILEMGR_FILESYS_TBL_VOL_CNT       8
 #define FILEMGR_TASK_FILE_BLOCK_SIZE   2048  /* Chunk of file to work with for one iteration of a task like computing a CRC */
+#define FILEMGR_TASK_FILE_COPY_CHUNK  (1024*1024)  /* Max bytes per OS_CopyFileData() call when copying isn't rate limited */
 
 #endif /* _filemgr_platform_cfg_ */
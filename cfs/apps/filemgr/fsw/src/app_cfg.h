@@ -37,10 +37,12 @@
 **
 ** 1.0 - Initial refactoring of open source FM
 ** 1.1 - Moved childmgr utility into osk_c_fw, Moved perf & msg ids to ini file
+** 1.2 - Copy and concatenate use OS_CopyFileData() throttled by TASK_FILE_COPY_RATE
+** 1.3 - Added compress command, compress and decompress use the PSP gzip codec
 */
 
 #define  FILEMGR_MAJOR_VER      1
-#define  FILEMGR_MINOR_VER      1
+#define  FILEMGR_MINOR_VER      3
 
 
 /******************************************************************************
@@ -95,6 +97,8 @@
 #define CFG_TASK_FILE_BLOCK_DELAY  TASK_FILE_BLOCK_DELAY
 #define CFG_TASK_FILE_STAT_CNT     TASK_FILE_STAT_CNT
 #define CFG_TASK_FILE_STAT_DELAY   TASK_FILE_STAT_DELAY
+#define CFG_TASK_FILE_COPY_RATE    TASK_FILE_COPY_RATE
+#define CFG_TASK_FILE_COMPRESS_LEVEL  TASK_FILE_COMPRESS_LEVEL
 
 
 #define APP_CONFIG(XX) \
@@ -123,6 +127,8 @@
    XX(TASK_FILE_BLOCK_DELAY,uint32) \
    XX(TASK_FILE_STAT_CNT,uint32) \
    XX(TASK_FILE_STAT_DELAY,uint32) \
+   XX(TASK_FILE_COPY_RATE,uint32) \
+   XX(TASK_FILE_COMPRESS_LEVEL,int32) \
 
 DECLARE_ENUM(Config,APP_CONFIG)
 
@@ -156,6 +162,8 @@ DECLARE_ENUM(Config,APP_CONFIG)
 #define FILESYS_SEND_TBL_PKT_CMD_FC        (CMDMGR_APP_START_FC + 17)
 #define FILESYS_SET_TBL_STATE_CMD_FC       (CMDMGR_APP_START_FC + 18)
 
+#define FILE_COMPRESS_CMD_FC               (CMDMGR_APP_START_FC + 19) /* Child */
+
 /******************************************************************************
 ** Event Macros
 **
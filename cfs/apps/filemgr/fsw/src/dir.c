@@ -35,8 +35,8 @@ static DIR_Class*  Dir = NULL;
 ** Local Function Prototypes
 */
 
-static void LoadFileEntry(const char* PathFilename, DIR_FileEntry* FileEntry, uint16* TaskBlockCount, bool IncludeSizeTime);
-static bool WriteDirListToFile(const char* DirNameWithSep, osal_id_t DirId, int32 FileHandle, bool IncludeSizeTime);
+static void LoadFileEntry(const char* Filename, DIR_FileEntry* FileEntry, uint16* TaskBlockCount, bool IncludeSizeTime);
+static bool WriteDirListToFile(const char* DirNameWithSep, int32 FileHandle, bool IncludeSizeTime);
 
 /******************************************************************************
 ** Function: DIR_Constructor
@@ -51,6 +51,8 @@ void DIR_Constructor(DIR_Class*  DirPtr, INITBL_Class* IniTbl)
  
    Dir->IniTbl = IniTbl;
  
+   DIRSNAP_Constructor(&Dir->Snap);
+   
 } /* End DIR_Constructor() */
 
 
@@ -352,6 +354,8 @@ bool DIR_DeleteAllCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 **   1. TaskBlockCnt is the count of "task blocks" performed. A task block is 
 **      is group of instructions that is CPU intensive and may need to be 
 **      periodically suspended to prevent CPU hogging.
+**   2. The directory snapshot serves consecutive offsets without rereading
+**      the directory from the start for each packet.
 ** 
 */
 bool DIR_SendListPktCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
@@ -359,19 +363,17 @@ bool DIR_SendListPktCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    const DIR_SendListPktCmdMsg* SendListPktCmd = (const DIR_SendListPktCmdMsg *) SbBufPtr;
    
-   int32             SysStatus;
-   osal_id_t         DirId;
-   os_dirent_t       DirEntry;
-   FileUtil_FileInfo FileInfo;
+   int32                SysStatus;
+   const DIRSNAP_Entry* SnapEntry;
+   FileUtil_FileInfo    FileInfo;
    
    uint16 TaskBlockCnt = 0;    /* See prologue */
    uint16 FilenameLen;
    uint16 DirWithSepLen;
+   uint32 EntryIndex;
    char   DirWithSep[OS_MAX_PATH_LEN] = "\0";
-   char   PathFilename[OS_MAX_PATH_LEN] = "\0";
    
    bool RetStatus = false;
-   bool CreatingPkt;
    
    FileInfo = FileUtil_GetFileInfo(SendListPktCmd->DirName, OS_MAX_PATH_LEN, false);
 
@@ -385,68 +387,53 @@ bool DIR_SendListPktCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
       
          DirWithSepLen = strlen(DirWithSep);
          
-         SysStatus = OS_DirectoryOpen(&DirId, SendListPktCmd->DirName);
+         SysStatus = DIRSNAP_Open(&Dir->Snap, SendListPktCmd->DirName);
          if (SysStatus == OS_SUCCESS) {
             
             strncpy(Dir->ListPkt.DirName, SendListPktCmd->DirName, OS_MAX_PATH_LEN);
             Dir->ListPkt.DirListOffset = SendListPktCmd->DirListOffset;
 
-            CreatingPkt = true;
-            while (CreatingPkt) {
+            /* 
+            ** General logic 
+            ** - Snapshot doesn't include the "." and ".." directory entries 
+            ** - Start packet listing at command-specified offset
+            ** - Stop when telemetry packet is full
+            */      
+            EntryIndex = Dir->ListPkt.DirListOffset;
+            while ((Dir->ListPkt.PktFileCnt < FILEMGR_DIR_LIST_PKT_ENTRIES) &&
+                   ((SnapEntry = DIRSNAP_GetEntry(&Dir->Snap, EntryIndex)) != NULL)) {
         
-               SysStatus = OS_DirectoryRead(DirId, &DirEntry);
-               if (SysStatus != OS_SUCCESS) {
-            
-                  CreatingPkt = false;
-                  
-               }
-               else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_CURRENT_DIR) != 0) &&
-                        (strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_PARENT_DIR)  != 0)){
-            
-                  /* 
-                  ** General logic 
-                  ** - Do not count the "." and ".." directory entries 
-                  ** - Start packet listing at command-specified offset
-                  ** - Stop when telemetry packet is full
-                  */      
-                  ++Dir->ListPkt.DirFileCnt;
+               DIR_FileEntry* PktFileEntry = &Dir->ListPkt.File[Dir->ListPkt.PktFileCnt];
 
-                  if ((Dir->ListPkt.DirFileCnt > Dir->ListPkt.DirListOffset) &&
-                      (Dir->ListPkt.PktFileCnt < FILEMGR_DIR_LIST_PKT_ENTRIES)) {
-                
-                     DIR_FileEntry* PktFileEntry = &Dir->ListPkt.File[Dir->ListPkt.PktFileCnt];
+               FilenameLen = strlen(SnapEntry->Name);
 
-                     FilenameLen = strlen(OS_DIRENTRY_NAME(DirEntry));
+               /* Verify combined directory plus filename length */
+               if (!SnapEntry->NameTooLong &&
+                  ((DirWithSepLen + FilenameLen) < OS_MAX_PATH_LEN)) {
 
-                     /* Verify combined directory plus filename length */
-                     if ((FilenameLen < sizeof(PktFileEntry->Name)) &&
-                        ((DirWithSepLen + FilenameLen) < OS_MAX_PATH_LEN)) {
+                  strcpy(PktFileEntry->Name, SnapEntry->Name);
 
-                        strcpy(PktFileEntry->Name, OS_DIRENTRY_NAME(DirEntry));
+                  LoadFileEntry(SnapEntry->Name, PktFileEntry, &TaskBlockCnt, SendListPktCmd->IncludeSizeTime);
 
-                        strcpy(PathFilename, DirWithSep);
-                        strcat(PathFilename, OS_DIRENTRY_NAME(DirEntry));
-
-                        LoadFileEntry(PathFilename, PktFileEntry, &TaskBlockCnt, SendListPktCmd->IncludeSizeTime);
-
-                        ++Dir->ListPkt.PktFileCnt;
-                        
-                     }
-                     else {
-                        
-                        Dir->CmdWarningCnt++;
+                  ++Dir->ListPkt.PktFileCnt;
+                  
+               }
+               else {
+                  
+                  Dir->CmdWarningCnt++;
 
-                        CFE_EVS_SendEvent(DIR_SEND_LIST_PKT_WARN_EID, CFE_EVS_EventType_INFORMATION,
-                                          "Send dir list path/file len too long: Dir %s, File %s",
-                                          DirWithSep, OS_DIRENTRY_NAME(DirEntry));
-                     }
-                     
-                  } /* End if in range to fill packet */         
-               } /* End if not current or parent directory */
-            
+                  CFE_EVS_SendEvent(DIR_SEND_LIST_PKT_WARN_EID, CFE_EVS_EventType_INFORMATION,
+                                    "Send dir list path/file len too long: Dir %s, File %s",
+                                    DirWithSep, SnapEntry->Name);
+               }
+               
+               ++EntryIndex;
+               
             } /* End while creating packet */
 
-            OS_DirectoryClose(DirId);
+            Dir->ListPkt.DirFileCnt = Dir->Snap.DirEntryCnt;
+            
+            DIRSNAP_Close(&Dir->Snap);
 
             CFE_SB_TimeStampMsg(&(Dir->ListPkt.TlmHeader.Msg));
             CFE_SB_TransmitMsg(&(Dir->ListPkt.TlmHeader.Msg), true);
@@ -504,7 +491,6 @@ bool DIR_WriteListFileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
       
    osal_id_t    FileHandle;
    int32        SysStatus;
-   osal_id_t    DirId;
    char DirNameWithSep[OS_MAX_PATH_LEN] = "\0";
    char Filename[OS_MAX_PATH_LEN] = "\0";
    FileUtil_FileInfo FileInfo;
@@ -530,7 +516,7 @@ bool DIR_WriteListFileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
          strcpy(DirNameWithSep, WriteListFileCmd->DirName);
          if (FileUtil_AppendPathSep(DirNameWithSep, OS_MAX_PATH_LEN)) {
       
-            SysStatus = OS_DirectoryOpen(&DirId, WriteListFileCmd->DirName);
+            SysStatus = DIRSNAP_Open(&Dir->Snap, WriteListFileCmd->DirName);
       
             if (SysStatus == OS_SUCCESS) {
                
@@ -538,7 +524,7 @@ bool DIR_WriteListFileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
                    
                if (SysStatus == OS_SUCCESS) {
                   
-                  RetStatus = WriteDirListToFile(DirNameWithSep, DirId, FileHandle, WriteListFileCmd->IncludeSizeTime);
+                  RetStatus = WriteDirListToFile(DirNameWithSep, FileHandle, WriteListFileCmd->IncludeSizeTime);
                  
                   OS_close(FileHandle);
                   
@@ -555,7 +541,7 @@ bool DIR_WriteListFileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
            
                } /* End if error opening output file */
             
-               OS_DirectoryClose(DirId);
+               DIRSNAP_Close(&Dir->Snap);
             
             } /* Open dir */
             else {
@@ -610,27 +596,27 @@ bool DIR_WriteListFileCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 **   2. TaskBlockCnt is the count of "task blocks" performed. A task block is 
 **      is group of instructions that is CPU intensive and may need to be 
 **      periodically suspended to prevent CPU hogging.
+**   3. The directory snapshot must be open. It provides the total entry
+**      count so the directory isn't read past the last entry written.
 **
 */
-static bool WriteDirListToFile(const char* DirNameWithSep, osal_id_t DirId, int32 FileHandle, bool IncludeSizeTime)
+static bool WriteDirListToFile(const char* DirNameWithSep, int32 FileHandle, bool IncludeSizeTime)
 {
    
-   bool ReadingDir   = true;
    bool FileWriteErr = false;
    bool CreatedFile  = false;
      
    uint16 DirWithSepLen = strlen(DirNameWithSep);
    uint16 DirEntryLen   = 0;               /* Length of each directory entry */
-   uint16 DirEntryCnt   = 0;
+   uint32 DirEntryCnt   = 0;
+   uint32 EntryIndex    = 0;
    uint16 FileEntryCnt  = 0;
    uint16 FileEntryMax  = INITBL_GetIntConfig(Dir->IniTbl, CFG_DIR_LIST_FILE_ENTRIES);
    uint16 TaskBlockCnt  = 0;               /* See prologue */
    int32  BytesWritten;
-   char   PathFilename[OS_MAX_PATH_LEN] = "\0";   /* Combined directory path and entry filename */
  
-   int32            SysStatus;  
-   CFE_FS_Header_t  FileHeader;
-   os_dirent_t      DirEntry;
+   CFE_FS_Header_t      FileHeader;
+   const DIRSNAP_Entry* SnapEntry;
    uint16           DirFileStatsLen = sizeof(DIR_ListFilesStats);
    uint16           DirFileEntryLen = sizeof(DIR_FileEntry);
    DIR_FileEntry    DirFileEntry;
@@ -660,76 +646,59 @@ static bool WriteDirListToFile(const char* DirNameWithSep, osal_id_t DirId, int3
       BytesWritten = OS_write(FileHandle, &Dir->ListFileStats, DirFileStatsLen);      
       if (BytesWritten == DirFileStatsLen) {
       
-         while (ReadingDir && !FileWriteErr) {
+         /* 
+         ** General logic 
+         ** - Snapshot doesn't include the "." and ".." directory entries 
+         ** - Count all files, but limit file to FILEMGR_INI_DIR_LIST_FILE_ENTRIES
+         */      
+         while ((FileEntryCnt < FileEntryMax) && !FileWriteErr &&
+                ((SnapEntry = DIRSNAP_GetEntry(&Dir->Snap, EntryIndex)) != NULL)) {
         
-            SysStatus = OS_DirectoryRead(DirId, &DirEntry);
-            
-            if (SysStatus != OS_SUCCESS) {
+            ++EntryIndex;
+                     
+            DirEntryLen = strlen(SnapEntry->Name);
+
+            /* Verify combined directory plus filename length */
+            if (!SnapEntry->NameTooLong &&
+               ((DirWithSepLen + DirEntryLen) < OS_MAX_PATH_LEN)) {
+
+               /* Populate directory list file entry */
+               strncpy(DirFileEntry.Name, SnapEntry->Name, DirEntryLen);
+               DirFileEntry.Name[DirEntryLen] = '\0';
+       
+               LoadFileEntry(SnapEntry->Name, &DirFileEntry, &TaskBlockCnt, IncludeSizeTime);
+       
+               BytesWritten = OS_write(FileHandle, &DirFileEntry, DirFileEntryLen);
+               if (BytesWritten == DirFileEntryLen) {
+          
+                  ++FileEntryCnt;
+               
+               } /* End if sucessful file write */
+               else {
                   
-               ReadingDir = false;  /* Normal loop end - no more directory entries */
+                  FileWriteErr = true;
                
-            }
-            else if ((strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_CURRENT_DIR) != 0) &&
-                     (strcmp(OS_DIRENTRY_NAME(DirEntry), FILEUTIL_PARENT_DIR) != 0)) {
-            
-               /* 
-               ** General logic 
-               ** - Do not count the "." and ".." directory entries 
-               ** - Count all files, but limit file to FILEMGR_INI_DIR_LIST_FILE_ENTRIES
-               */      
+                  CFE_EVS_SendEvent(DIR_WRITE_LIST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                    "Write dir list file cmd failed: OS_write entry failed: result = %d, expected = %d",
+                                    (int)BytesWritten, (int)DirFileEntryLen);
+                 
+              } /* End if file write error */
+   
+            } /* End if file name lengths valid */
+            else {
+               
+               ++Dir->CmdWarningCnt;
                   
-               ++DirEntryCnt;
-
-               if (FileEntryCnt < FileEntryMax) {
-                     
-                  DirEntryLen = strlen(OS_DIRENTRY_NAME(DirEntry));
-
-                  /* Verify combined directory plus filename length */
-                  if ((DirEntryLen < sizeof(DirFileEntry.Name)) &&
-                     ((DirWithSepLen + DirEntryLen) < OS_MAX_PATH_LEN)) {
-
-                     strncpy(PathFilename, DirNameWithSep, DirWithSepLen);
-	        	         PathFilename[DirWithSepLen] = '\0';
-                     strncat(PathFilename, OS_DIRENTRY_NAME(DirEntry), (OS_MAX_PATH_LEN - DirWithSepLen));
-
-                     /* Populate directory list file entry */
-                     strncpy(DirFileEntry.Name, OS_DIRENTRY_NAME(DirEntry), DirEntryLen);
-		               DirFileEntry.Name[DirEntryLen] = '\0';
-          
-                     LoadFileEntry(PathFilename, &DirFileEntry, &TaskBlockCnt, IncludeSizeTime);
-          
-                     BytesWritten = OS_write(FileHandle, &DirFileEntry, DirFileEntryLen);
-                     if (BytesWritten == DirFileEntryLen) {
-                
-                        ++FileEntryCnt;
-                     
-                     } /* End if sucessful file write */
-                     else {
-                        
-                        FileWriteErr = true;
-                     
-                        CFE_EVS_SendEvent(DIR_WRITE_LIST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "Write dir list file cmd failed: OS_write entry failed: result = %d, expected = %d",
-                                          (int)BytesWritten, (int)DirFileEntryLen);
-                       
-                    } /* End if file write error */
-         
-                  } /* End if file name lengths valid */
-                  else {
-                     
-                     ++Dir->CmdWarningCnt;
-                        
-                     CFE_EVS_SendEvent(DIR_WRITE_LIST_FILE_WARN_EID, CFE_EVS_EventType_ERROR,
-                                       "Write dir list file cmd warning: Combined dir/entry name too long: dir = %s, entry = %s",
-                                       DirNameWithSep, OS_DIRENTRY_NAME(DirEntry));
-                     
-                  } /* End if invalid file entry name lengths */ 
-         
-
-               } /* End if within file entry write limit */
-            } /* End if not current/parent directory */ 
+               CFE_EVS_SendEvent(DIR_WRITE_LIST_FILE_WARN_EID, CFE_EVS_EventType_ERROR,
+                                 "Write dir list file cmd warning: Combined dir/entry name too long: dir = %s, entry = %s",
+                                 DirNameWithSep, SnapEntry->Name);
+               
+            } /* End if invalid file entry name lengths */ 
+   
          } /* End Reading Dir & Writing file loop */
 
+         DirEntryCnt = Dir->Snap.DirEntryCnt;
+
          /*
          ** Update directory statistics in output file
          ** - Update local stats data structure
@@ -789,17 +758,19 @@ static bool WriteDirListToFile(const char* DirNameWithSep, osal_id_t DirId, int3
 ** Function: LoadFileEntry
 **
 ** Notes:
-**   1. TaskBlockCnt is the count of "task blocks" performed. A task block is 
+**   1. Filename is relative to the open directory snapshot.
+**   2. Time is the file's modification time in seconds.
+**   3. TaskBlockCnt is the count of "task blocks" performed. A task block is 
 **      is group of instructions that is CPU intensive and may need to be 
 **      periodically suspended to prevent CPU hogging.
 ** 
 */
-static void LoadFileEntry(const char* PathFilename, DIR_FileEntry* FileEntry, uint16* TaskBlockCount, bool    IncludeSizeTime)
+static void LoadFileEntry(const char* Filename, DIR_FileEntry* FileEntry, uint16* TaskBlockCount, bool IncludeSizeTime)
 {
    
-   int32       SysStatus; 
-   os_fstat_t  FileStatus;
-   
+   FileEntry->Size = 0;
+   FileEntry->Time = 0;
+   FileEntry->Mode = 0;
    
    if (IncludeSizeTime) {
       
@@ -807,33 +778,10 @@ static void LoadFileEntry(const char* PathFilename, DIR_FileEntry* FileEntry, ui
                          INITBL_GetIntConfig(Dir->IniTbl, CFG_TASK_FILE_STAT_DELAY), 
                          INITBL_GetIntConfig(Dir->IniTbl, CFG_CHILD_TASK_PERF_ID));
       
-      CFE_PSP_MemSet(&FileStatus, 0, sizeof(os_fstat_t));
-      SysStatus = OS_stat(PathFilename, &FileStatus);
-      
-      if (SysStatus == OS_SUCCESS) {
-         
-         FileEntry->Size = FileStatus.FileSize;
-         FileEntry->Mode = FileStatus.FileModeBits;
-         FileEntry->Time = OS_GetLocalTime(&FileStatus.FileTime);
-        
-      }
-      else {
-         
-         FileEntry->Size = 0;
-         FileEntry->Time = 0;
-         FileEntry->Mode = 0;
-      
-      }
+      /* Entry is left zeroed if the file can't be accessed */
+      DIRSNAP_StatEntry(&Dir->Snap, Filename, &FileEntry->Size, &FileEntry->Time, &FileEntry->Mode);
       
    } /* End if include Size & Time */
-   else {
-         
-      FileEntry->Size = 0;
-      FileEntry->Time = 0;
-      FileEntry->Mode = 0;
-      
-   } /* End if don't include Size & Time */
-      
       
 } /* End LoadFileEntry() */
 
@@ -21,6 +21,7 @@
 */
 
 #include "app_cfg.h"
+#include "dirsnap.h"
 
 /*
 ** Event Message IDs
@@ -174,6 +175,12 @@ typedef struct {
 
    DIR_ListFilesStats  ListFileStats;
    
+   /*
+   ** Directory snapshot shared by the list commands
+   */
+   
+   DIRSNAP_Class  Snap;
+   
 } DIR_Class;
 
 
@@ -0,0 +1,316 @@
+/*
+** Purpose: Implement the directory snapshot class
+**
+** Notes:
+**   1. See header notes for the snapshot key and caching rules.
+**   2. readdir() reads the directory with getdents() in large blocks so a
+**      snapshot load is one pass over the directory with no per-entry
+**      system calls.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "dirsnap.h"
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static int32 LoadWindow(DIRSNAP_Class* DirSnap, uint32 WindowStart);
+static bool  KeyMatches(const DIRSNAP_Class* DirSnap, const char* DirName, const struct stat* DirStat);
+static void  SaveKey(DIRSNAP_Class* DirSnap, const char* DirName, const struct stat* DirStat);
+
+
+/******************************************************************************
+** Function: DIRSNAP_Constructor
+**
+*/
+void DIRSNAP_Constructor(DIRSNAP_Class* DirSnap)
+{
+
+   CFE_PSP_MemSet(DirSnap, 0, sizeof(DIRSNAP_Class));
+
+   DirSnap->DirStream = NULL;
+   DirSnap->DirFd     = -1;
+
+} /* End DIRSNAP_Constructor() */
+
+
+/******************************************************************************
+** Function: DIRSNAP_Open
+**
+*/
+int32 DIRSNAP_Open(DIRSNAP_Class* DirSnap, const char* DirName)
+{
+
+   int32  RetStatus = OS_ERROR;
+   DIR*   DirStream;
+   char   LocalPath[OS_MAX_LOCAL_PATH_LEN];
+   struct stat      DirStat;
+   struct timespec  Now;
+
+
+   if (OS_TranslatePath(DirName, LocalPath) == OS_SUCCESS) {
+
+      DirStream = opendir(LocalPath);
+
+      if (DirStream != NULL) {
+
+         if (fstat(dirfd(DirStream), &DirStat) == 0) {
+
+            DirSnap->DirStream = DirStream;
+            DirSnap->DirFd     = dirfd(DirStream);
+
+            if (DirSnap->Reusable && KeyMatches(DirSnap, DirName, &DirStat)) {
+
+               RetStatus = OS_SUCCESS;
+
+            }
+            else {
+
+               SaveKey(DirSnap, DirName, &DirStat);
+
+               RetStatus = LoadWindow(DirSnap, 0);
+
+               /* See header note: don't trust a key from the current second */
+               clock_gettime(CLOCK_REALTIME, &Now);
+               DirSnap->Reusable = (RetStatus == OS_SUCCESS) &&
+                                   (DirStat.st_mtime != Now.tv_sec) &&
+                                   (DirStat.st_ctime != Now.tv_sec);
+
+            }
+
+         } /* End if fstat() */
+
+         if (RetStatus != OS_SUCCESS) {
+
+            closedir(DirStream);
+            DirSnap->DirStream = NULL;
+            DirSnap->DirFd     = -1;
+
+         }
+
+      } /* End if opendir() */
+   } /* End if translated path */
+
+   return RetStatus;
+
+} /* End DIRSNAP_Open() */
+
+
+/******************************************************************************
+** Function: DIRSNAP_GetEntry
+**
+*/
+const DIRSNAP_Entry* DIRSNAP_GetEntry(DIRSNAP_Class* DirSnap, uint32 EntryIndex)
+{
+
+   const DIRSNAP_Entry* Entry = NULL;
+
+
+   if (EntryIndex < DirSnap->DirEntryCnt) {
+
+      if ((EntryIndex < DirSnap->WindowStart) ||
+          (EntryIndex >= (DirSnap->WindowStart + DirSnap->WindowCnt))) {
+
+         if ((DirSnap->DirStream == NULL) || (LoadWindow(DirSnap, EntryIndex) != OS_SUCCESS)) {
+
+            DirSnap->Reusable = false;
+
+         }
+      }
+
+      /* Window load may have found fewer entries if the directory changed */
+      if ((EntryIndex >= DirSnap->WindowStart) &&
+          (EntryIndex < (DirSnap->WindowStart + DirSnap->WindowCnt))) {
+
+         Entry = &DirSnap->Entry[EntryIndex - DirSnap->WindowStart];
+
+      }
+
+   } /* End if valid index */
+
+   return Entry;
+
+} /* End DIRSNAP_GetEntry() */
+
+
+/******************************************************************************
+** Function: DIRSNAP_StatEntry
+**
+** Notes:
+**   1. The mode bit logic matches OSAL's POSIX OS_FileStat_Impl().
+**
+*/
+int32 DIRSNAP_StatEntry(DIRSNAP_Class* DirSnap, const char* Name, uint32* Size, uint32* Time, uint32* Mode)
+{
+
+   int32   RetStatus = OS_ERROR;
+   mode_t  ReadBits  = S_IROTH;
+   mode_t  WriteBits = S_IWOTH;
+   mode_t  ExecBits  = S_IXOTH;
+   struct stat  FileStat;
+
+
+   *Size = 0;
+   *Time = 0;
+   *Mode = 0;
+
+   if ((DirSnap->DirFd >= 0) && (fstatat(DirSnap->DirFd, Name, &FileStat, 0) == 0)) {
+
+      if (FileStat.st_uid == geteuid()) {
+         ReadBits  |= S_IRUSR;
+         WriteBits |= S_IWUSR;
+         ExecBits  |= S_IXUSR;
+      }
+
+      if (FileStat.st_gid == getegid()) {
+         ReadBits  |= S_IRGRP;
+         WriteBits |= S_IWGRP;
+         ExecBits  |= S_IXGRP;
+      }
+
+      if (S_ISDIR(FileStat.st_mode))   *Mode |= OS_FILESTAT_MODE_DIR;
+      if (FileStat.st_mode & ReadBits)  *Mode |= OS_FILESTAT_MODE_READ;
+      if (FileStat.st_mode & WriteBits) *Mode |= OS_FILESTAT_MODE_WRITE;
+      if (FileStat.st_mode & ExecBits)  *Mode |= OS_FILESTAT_MODE_EXEC;
+
+      *Size = (uint32)FileStat.st_size;
+      *Time = (uint32)FileStat.st_mtime;
+
+      RetStatus = OS_SUCCESS;
+
+   }
+
+   return RetStatus;
+
+} /* End DIRSNAP_StatEntry() */
+
+
+/******************************************************************************
+** Function: DIRSNAP_Close
+**
+*/
+void DIRSNAP_Close(DIRSNAP_Class* DirSnap)
+{
+
+   if (DirSnap->DirStream != NULL) {
+
+      closedir((DIR*)DirSnap->DirStream);
+
+   }
+
+   DirSnap->DirStream = NULL;
+   DirSnap->DirFd     = -1;
+
+} /* End DIRSNAP_Close() */
+
+
+/******************************************************************************
+** Function: LoadWindow
+**
+** Read the whole directory, counting its entries and saving the names from
+** WindowStart up to the window size.
+**
+*/
+static int32 LoadWindow(DIRSNAP_Class* DirSnap, uint32 WindowStart)
+{
+
+   DIR*            DirStream  = (DIR*)DirSnap->DirStream;
+   uint32          EntryIndex = 0;
+   DIRSNAP_Entry*  Entry;
+   struct dirent*  DirEntry;
+
+
+   DirSnap->WindowStart = WindowStart;
+   DirSnap->WindowCnt   = 0;
+
+   rewinddir(DirStream);
+
+   errno = 0;
+   while ((DirEntry = readdir(DirStream)) != NULL) {
+
+      if ((strcmp(DirEntry->d_name, FILEUTIL_CURRENT_DIR) != 0) &&
+          (strcmp(DirEntry->d_name, FILEUTIL_PARENT_DIR)  != 0)) {
+
+         if ((EntryIndex >= WindowStart) && (DirSnap->WindowCnt < FILEMGR_DIR_SNAP_ENTRIES)) {
+
+            Entry = &DirSnap->Entry[DirSnap->WindowCnt++];
+
+            Entry->NameTooLong = (strlen(DirEntry->d_name) >= sizeof(Entry->Name));
+            strncpy(Entry->Name, DirEntry->d_name, sizeof(Entry->Name) - 1);
+            Entry->Name[sizeof(Entry->Name) - 1] = '\0';
+
+         }
+
+         ++EntryIndex;
+
+      } /* End if not current or parent directory */
+
+      errno = 0;
+
+   } /* End while reading directory */
+
+   DirSnap->DirEntryCnt = EntryIndex;
+   ++DirSnap->LoadCnt;
+
+   return (errno == 0) ? OS_SUCCESS : OS_ERROR;
+
+} /* End LoadWindow() */
+
+
+/******************************************************************************
+** Function: KeyMatches
+**
+*/
+static bool KeyMatches(const DIRSNAP_Class* DirSnap, const char* DirName, const struct stat* DirStat)
+{
+
+   return ((strncmp(DirSnap->DirName, DirName, OS_MAX_PATH_LEN) == 0) &&
+           (DirSnap->DirDev       == (uint64)DirStat->st_dev) &&
+           (DirSnap->DirIno       == (uint64)DirStat->st_ino) &&
+           (DirSnap->DirMtimeSec  == (int64)DirStat->st_mtim.tv_sec) &&
+           (DirSnap->DirMtimeNsec == (int64)DirStat->st_mtim.tv_nsec) &&
+           (DirSnap->DirCtimeSec  == (int64)DirStat->st_ctim.tv_sec) &&
+           (DirSnap->DirCtimeNsec == (int64)DirStat->st_ctim.tv_nsec));
+
+} /* End KeyMatches() */
+
+
+/******************************************************************************
+** Function: SaveKey
+**
+*/
+static void SaveKey(DIRSNAP_Class* DirSnap, const char* DirName, const struct stat* DirStat)
+{
+
+   strncpy(DirSnap->DirName, DirName, OS_MAX_PATH_LEN - 1);
+   DirSnap->DirName[OS_MAX_PATH_LEN - 1] = '\0';
+
+   DirSnap->DirDev       = (uint64)DirStat->st_dev;
+   DirSnap->DirIno       = (uint64)DirStat->st_ino;
+   DirSnap->DirMtimeSec  = (int64)DirStat->st_mtim.tv_sec;
+   DirSnap->DirMtimeNsec = (int64)DirStat->st_mtim.tv_nsec;
+   DirSnap->DirCtimeSec  = (int64)DirStat->st_ctim.tv_sec;
+   DirSnap->DirCtimeNsec = (int64)DirStat->st_ctim.tv_nsec;
+
+} /* End SaveKey() */
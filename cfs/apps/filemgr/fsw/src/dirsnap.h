@@ -0,0 +1,171 @@
+/*
+** Purpose: Define the directory snapshot class
+**
+** Notes:
+**   1. A snapshot holds a window of up to FILEMGR_DIR_SNAP_ENTRIES directory
+**      entry names plus the directory's total entry count. It lets the
+**      directory listing commands page through a directory without
+**      re-reading it from the start for every packet.
+**   2. A snapshot is keyed by the directory's device, inode, modification
+**      time and change time. Any entry that is created, deleted or renamed
+**      updates the directory's modification time so the next open rebuilds
+**      the snapshot. A directory modified in the same second the snapshot
+**      was taken is never reused because a coarse filesystem timestamp
+**      could hide a second change.
+**   3. Only names are cached. A file's size and time can change without
+**      touching its directory so they're read with fstatat() relative to
+**      the open directory each time an entry is reported.
+**   4. OSAL doesn't expose directory file descriptors so this class uses
+**      the native path from OS_TranslatePath(). The "." and ".." entries
+**      are never included.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _dirsnap_
+#define _dirsnap_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Snapshot entry
+**
+** Names that don't fit in Name are truncated and flagged so the caller can
+** report them.
+*/
+
+typedef struct {
+
+   char  Name[OS_MAX_PATH_LEN];
+   bool  NameTooLong;
+
+} DIRSNAP_Entry;
+
+
+/******************************************************************************
+** DIRSNAP_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Snapshot key
+   */
+
+   char    DirName[OS_MAX_PATH_LEN];
+   bool    Reusable;
+   uint64  DirDev;
+   uint64  DirIno;
+   int64   DirMtimeSec;
+   int64   DirMtimeNsec;
+   int64   DirCtimeSec;
+   int64   DirCtimeNsec;
+
+   /*
+   ** Snapshot contents
+   */
+
+   uint32  DirEntryCnt;      /* Number of entries in the directory      */
+   uint32  WindowStart;      /* Directory index of Entry[0]             */
+   uint32  WindowCnt;        /* Number of valid entries in Entry[]      */
+
+   DIRSNAP_Entry  Entry[FILEMGR_DIR_SNAP_ENTRIES];
+
+   /*
+   ** Open directory, only valid between DIRSNAP_Open() and DIRSNAP_Close()
+   */
+
+   void*  DirStream;
+   int    DirFd;
+
+   uint32 LoadCnt;           /* Number of directory passes, for debugging */
+
+} DIRSNAP_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: DIRSNAP_Constructor
+**
+** Initialize a snapshot to a known empty state.
+**
+*/
+void DIRSNAP_Constructor(DIRSNAP_Class* DirSnap);
+
+
+/******************************************************************************
+** Function: DIRSNAP_Open
+**
+** Open a directory and make sure the snapshot is current.
+**
+** Notes:
+**   1. If the cached snapshot doesn't match the directory, the directory is
+**      read once to count its entries and load the window at index 0.
+**   2. Returns OS_SUCCESS or OS_ERROR if the directory can't be opened or
+**      read. On success the caller must call DIRSNAP_Close().
+**
+*/
+int32 DIRSNAP_Open(DIRSNAP_Class* DirSnap, const char* DirName);
+
+
+/******************************************************************************
+** Function: DIRSNAP_GetEntry
+**
+** Return the entry at a directory index or NULL if EntryIndex is past the
+** end of the directory.
+**
+** Notes:
+**   1. If EntryIndex is outside the current window, the window is reloaded
+**      starting at EntryIndex so sequential access reads the directory once
+**      per FILEMGR_DIR_SNAP_ENTRIES entries.
+**   2. The returned pointer is only valid until the next call.
+**
+*/
+const DIRSNAP_Entry* DIRSNAP_GetEntry(DIRSNAP_Class* DirSnap, uint32 EntryIndex);
+
+
+/******************************************************************************
+** Function: DIRSNAP_StatEntry
+**
+** Get the size, modification time in seconds and OSAL mode bits of a file
+** in the open directory.
+**
+** Notes:
+**   1. Uses fstatat() relative to the open directory so the path isn't
+**      resolved again for each file.
+**   2. Mode bits are the OS_FILESTAT_MODE_* bits that OS_stat() reports.
+**
+*/
+int32 DIRSNAP_StatEntry(DIRSNAP_Class* DirSnap, const char* Name, uint32* Size, uint32* Time, uint32* Mode);
+
+
+/******************************************************************************
+** Function: DIRSNAP_Close
+**
+** Close the directory opened by DIRSNAP_Open(). The snapshot is retained.
+**
+*/
+void DIRSNAP_Close(DIRSNAP_Class* DirSnap);
+
+
+#endif /* _dirsnap_ */
@@ -42,7 +42,11 @@ static FILE_Class*  File = NULL;
 */
 
 static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const char* TargetFile);
+static int32 CopyFile(const char* SrcFile, const char* TargetFile);
+static int32 AppendFile(osal_id_t TargetFileHandle, const char* SrcFile);
+static int32 CopyFileData(osal_id_t TargetFileHandle, osal_id_t SrcFileHandle);
 static bool ComputeFileCrc(const char* CmdName, const char* Filename, uint32* Crc, uint8 CrcType);
+static void CodecYield(void* TaskBlockCnt);
 
 
 /******************************************************************************
@@ -61,6 +65,20 @@ void FILE_Constructor(FILE_Class*  FilePtr, INITBL_Class* IniTbl)
    CFE_MSG_Init(&File->InfoPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(File->IniTbl, CFG_FILE_INFO_TLM_MID), 
                 sizeof(FILE_InfoPkt));
 
+   File->CompressLevel = INITBL_GetInt32Config(File->IniTbl, CFG_TASK_FILE_COMPRESS_LEVEL);
+   
+   if (File->CompressLevel != CFE_PSP_COMPRESS_LEVEL_DEFAULT &&
+       (File->CompressLevel < FILE_COMPRESS_LEVEL_MIN || File->CompressLevel > FILE_COMPRESS_LEVEL_MAX)) {
+   
+      CFE_EVS_SendEvent(FILE_COMPRESS_LEVEL_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Invalid TASK_FILE_COMPRESS_LEVEL %d, must be %d (codec default) or %d to %d. Using the codec default",
+                        (int)File->CompressLevel, CFE_PSP_COMPRESS_LEVEL_DEFAULT,
+                        FILE_COMPRESS_LEVEL_MIN, FILE_COMPRESS_LEVEL_MAX);
+      
+      File->CompressLevel = CFE_PSP_COMPRESS_LEVEL_DEFAULT;
+   
+   }
+
 } /* End FILE_Constructor */
 
 
@@ -157,6 +175,74 @@ bool FILE_ConcatenateCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 } /* End of FILE_ConcatenateCmd() */
 
 
+/******************************************************************************
+** Function: FILE_CompressCmd
+**
+** Notes:
+**    1. FileUtil_GetFileInfo() verifies filename prior to checking state
+**    2. The PSP codec yields after each block it compresses so the child
+**       task pauses like other CPU intensive file tasks.
+*/
+bool FILE_CompressCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+   
+   const FILE_CompressCmdMsg* CompressCmd = (const FILE_CompressCmdMsg *) SbBufPtr;
+   FileUtil_FileInfo FileInfo;
+   int32  PspStatus;
+   uint16 TaskBlockCnt = 0;
+   bool   RetStatus = false;
+   
+
+   FileInfo = FileUtil_GetFileInfo(CompressCmd->SourceFilename, OS_MAX_PATH_LEN, false);
+   
+   if (FileInfo.State == FILEUTIL_FILE_CLOSED) {
+   
+      FileInfo = FileUtil_GetFileInfo(CompressCmd->TargetFilename, OS_MAX_PATH_LEN, false);
+   
+      if (FileInfo.State == FILEUTIL_FILE_NONEXISTENT) {
+          
+         PspStatus = CFE_PSP_CompressFile(CompressCmd->SourceFilename, CompressCmd->TargetFilename,
+                                          File->CompressLevel,
+                                          CodecYield, &TaskBlockCnt);
+
+         if (PspStatus == CFE_PSP_SUCCESS) {
+ 
+            RetStatus = true;
+            CFE_EVS_SendEvent(FILE_COMPRESS_EID, CFE_EVS_EventType_DEBUG,
+                              "%s compressed to %s",
+                              CompressCmd->SourceFilename, CompressCmd->TargetFilename);
+         }
+         else {
+
+            CFE_EVS_SendEvent(FILE_COMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error compressing %s to %s. PSP status = %d",
+                              CompressCmd->SourceFilename, CompressCmd->TargetFilename, (int)PspStatus);
+         }
+         
+      } /* End if target doesn't exist */ 
+      else {
+   
+         CFE_EVS_SendEvent(FILE_COMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Compress file cmd error: Target file %s already exists",
+                           CompressCmd->TargetFilename);
+                           
+      } /* End if target does exist */
+   
+   } /* End if source exists and is closed */
+   else {
+   
+      CFE_EVS_SendEvent(FILE_COMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Compress file cmd error: Source file must exist and be closed. Source file %s state is %s",
+                        CompressCmd->SourceFilename, FileUtil_FileStateStr(FileInfo.State) );
+   
+   } /* End if source file not an existing file that is closed */ 
+    
+   
+   return RetStatus;
+
+} /* End of FILE_CompressCmd() */
+
+
 /******************************************************************************
 ** Function: FILE_CopyCmd
 **
@@ -232,7 +318,7 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
    if (PerformCopy) {
       
-      SysStatus = OS_cp(CopyCmd->SourceFilename, CopyCmd->TargetFilename);
+      SysStatus = CopyFile(CopyCmd->SourceFilename, CopyCmd->TargetFilename);
 
       if (SysStatus == OS_SUCCESS) {
       
@@ -243,7 +329,7 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
       else {
          
          CFE_EVS_SendEvent(FILE_COPY_ERR_EID, CFE_EVS_EventType_ERROR,
-            "Copy file from %s to %s failed: Parameters validated but OS_cp() failed with status=%d",
+            "Copy file from %s to %s failed: Parameters validated but copy failed with status=%d",
             CopyCmd->SourceFilename, CopyCmd->TargetFilename, (int)SysStatus);
       }
       
@@ -259,13 +345,15 @@ bool FILE_CopyCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 **
 ** Notes:
 **    1. FileUtil_GetFileInfo() verifies filename prior to checking state
+**    2. See FILE_CompressCmd() for pausing.
 */
 bool FILE_DecompressCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
 {
    
-   FILE_DecompressCmdMsg* DecompressCmd = (FILE_DecompressCmdMsg *) SbBufPtr;  /* CFE_PSP_Decompress() doesn't use const */
+   const FILE_DecompressCmdMsg* DecompressCmd = (const FILE_DecompressCmdMsg *) SbBufPtr;
    FileUtil_FileInfo FileInfo;
-   int32  CfeStatus;
+   int32  PspStatus;
+   uint16 TaskBlockCnt = 0;
    bool   RetStatus = false;
    
 
@@ -277,9 +365,10 @@ bool FILE_DecompressCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
    
       if (FileInfo.State == FILEUTIL_FILE_NONEXISTENT) {
           
-         CfeStatus = CFE_PSP_Decompress(DecompressCmd->SourceFilename, DecompressCmd->TargetFilename);
+         PspStatus = CFE_PSP_DecompressFile(DecompressCmd->SourceFilename, DecompressCmd->TargetFilename,
+                                            CodecYield, &TaskBlockCnt);
 
-         if (CfeStatus == CFE_SUCCESS) {
+         if (PspStatus == CFE_PSP_SUCCESS) {
  
             RetStatus = true;
             CFE_EVS_SendEvent(FILE_DECOMPRESS_EID, CFE_EVS_EventType_DEBUG,
@@ -289,8 +378,8 @@ bool FILE_DecompressCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr)
          else {
 
             CFE_EVS_SendEvent(FILE_DECOMPRESS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Error decompressing %s to %s. CFE status = 0x%04X",
-                              DecompressCmd->SourceFilename, DecompressCmd->TargetFilename, CfeStatus);
+                              "Error decompressing %s to %s. PSP status = %d",
+                              DecompressCmd->SourceFilename, DecompressCmd->TargetFilename, (int)PspStatus);
          }
          
       } /* End if target doesn't exist */ 
@@ -682,93 +771,51 @@ static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const c
 {
    
    int32      SysStatus;
-   osal_id_t  SourceFileHandle;
    osal_id_t  TargetFileHandle;
-   int32      BytesRead;
-   int32      BytesWritten;
       
    char    EventErrStr[256] = "\0";
-   uint16  TaskBlockCnt = 0;
-   bool    PerformingCatenation = true;
-   bool    ConcatenatedFiles    = false;
+   bool    ConcatenatedFiles = false;
   
    sprintf(EventErrStr,"Unhandled concatenate file error");
   
-   SysStatus = OS_cp(SrcFile1, TargetFile);
+   SysStatus = OS_OpenCreate(&TargetFileHandle, TargetFile, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+   
    if (SysStatus == OS_SUCCESS) {
    
-      SysStatus = OS_OpenCreate(&SourceFileHandle, SrcFile2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+      SysStatus = AppendFile(TargetFileHandle, SrcFile1);
       
       if (SysStatus == OS_SUCCESS) {
    
-         SysStatus = OS_OpenCreate(&TargetFileHandle, SrcFile2, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+         SysStatus = AppendFile(TargetFileHandle, SrcFile2);
    
          if (SysStatus == OS_SUCCESS) {
          
-            OS_lseek(TargetFileHandle, 0, OS_SEEK_END);
-        
-            while (PerformingCatenation) {
-               
-               BytesRead = OS_read(SourceFileHandle, File->FileTaskBuf, FILEMGR_TASK_FILE_BLOCK_SIZE);
-               if (BytesRead == 0) {
-               
-                  PerformingCatenation = false;
-                  ConcatenatedFiles    = true;
-               
-               }
-               else if (BytesRead < 0) {
-                  
-                  PerformingCatenation = false;
-
-                  sprintf(EventErrStr,"Concatenate file cmd error: File read error. OS_read status = %d", BytesRead);
-
-               }
-               else {
-                  
-                  BytesWritten = OS_write(TargetFileHandle, File->FileTaskBuf, BytesRead);
-
-                  if (BytesWritten != BytesRead) {
-
-                     PerformingCatenation = false;
-                     sprintf(EventErrStr,"Concatenate file cmd error: File read/write error. BytesRead %d  not equal to BytesWritten %d",
-                             BytesRead, BytesWritten);
-                  
-                  }
-           
-                  CHILDMGR_PauseTask(&TaskBlockCnt, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT), 
-                                     INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY),
-                                     INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
-               
-               }
-               
-            } /* End while performing concatenation */
-
-            OS_close(TargetFileHandle);
+            ConcatenatedFiles = true;
             
-         } /* End if opened target file */
+         }
          else {
                         
-            sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %d", SrcFile2, SysStatus);
+            sprintf(EventErrStr,"Concatenate file cmd error: Error appending second source file %s to target file. Status %d", SrcFile2, SysStatus);
             
-         } /* End if  failed to open target file */
-         
-         OS_close(SourceFileHandle);
+         }
          
-      } /* End if opened source file */
+      } /* End if copied first source file */
       else {
          
-         sprintf(EventErrStr,"Concatenate file cmd error: Error opening source file %s. Open status %d", SrcFile2, SysStatus);
+         sprintf(EventErrStr,"Concatenate file cmd error: Error copying first source file %s to target file. Status %d", SrcFile1, SysStatus);
          
-      } /* End if  failed to open source file */
+      }
   
+      OS_close(TargetFileHandle);
+      
       if (ConcatenatedFiles == false) OS_remove(TargetFile);  /* remove partial target file */
  
-   } /* End if copied first source file to target */
+   } /* End if opened target file */
    else {
       
-      sprintf(EventErrStr,"Concatenate file cmd error: Error copying first source file to target file. OS_cp status %d", SysStatus);
+      sprintf(EventErrStr,"Concatenate file cmd error: Error opening target file %s. Open status %d", TargetFile, SysStatus);
       
-   } /* End if failed to copy first source file to target */
+   }
 
    if (ConcatenatedFiles == false) CFE_EVS_SendEvent(FILE_CONCATENATE_ERR_EID, CFE_EVS_EventType_ERROR,"%s",EventErrStr);
    
@@ -777,6 +824,139 @@ static bool ConcatenateFiles(const char* SrcFile1, const char* SrcFile2, const c
 } /* End of ConcatenateFiles() */
 
 
+/******************************************************************************
+** Function: CopyFile
+**
+** Create or truncate TargetFile and copy SrcFile into it. 
+**
+** Notes:
+**   1. Replaces OS_cp() so copies are rate limited like other child task
+**      file operations.
+**
+*/
+static int32 CopyFile(const char* SrcFile, const char* TargetFile)
+{
+
+   int32      SysStatus;
+   osal_id_t  TargetFileHandle;
+   
+   SysStatus = OS_OpenCreate(&TargetFileHandle, TargetFile, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+   
+   if (SysStatus == OS_SUCCESS) {
+      
+      SysStatus = AppendFile(TargetFileHandle, SrcFile);
+      
+      OS_close(TargetFileHandle);
+      
+      if (SysStatus != OS_SUCCESS) OS_remove(TargetFile);  /* remove partial target file */
+   
+   }
+   
+   return SysStatus;
+
+} /* End of CopyFile() */
+
+
+/******************************************************************************
+** Function: AppendFile
+**
+** Copy SrcFile to the current position of an open target file.
+**
+*/
+static int32 AppendFile(osal_id_t TargetFileHandle, const char* SrcFile)
+{
+
+   int32      SysStatus;
+   osal_id_t  SrcFileHandle;
+   
+   SysStatus = OS_OpenCreate(&SrcFileHandle, SrcFile, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+   
+   if (SysStatus == OS_SUCCESS) {
+      
+      SysStatus = CopyFileData(TargetFileHandle, SrcFileHandle);
+      
+      OS_close(SrcFileHandle);
+   
+   }
+   
+   return SysStatus;
+
+} /* End of AppendFile() */
+
+
+/******************************************************************************
+** Function: CopyFileData
+**
+** Copy the rest of an open source file to an open target file at no more
+** than TASK_FILE_COPY_RATE bytes per second.
+**
+** Notes:
+**   1. OS_CopyFileData() lets the OS move the data (copy_file_range() on
+**      Linux) so the child task isn't spending CPU cycles on each block.
+**   2. Each TASK_FILE_BLOCK_DELAY period copies up to a period's share of
+**      the rate and the task sleeps for whatever is left of the period.
+**      A zero rate copies without pausing.
+**
+*/
+static int32 CopyFileData(osal_id_t TargetFileHandle, osal_id_t SrcFileHandle)
+{
+
+   uint32     CopyRate  = INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_COPY_RATE);
+   uint32     PeriodMs  = INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY);
+   uint32     PerfId    = INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID);
+   size_t     PeriodBytes;
+   size_t     RemainingBytes;
+   int32      CopyStatus;
+   int64      ElapsedMs;
+   OS_time_t  PeriodStart;
+   OS_time_t  PeriodEnd;
+   
+   if (CopyRate == 0) {
+      
+      PeriodBytes = FILEMGR_TASK_FILE_COPY_CHUNK;
+   
+   }
+   else {
+   
+      PeriodBytes = ((uint64)CopyRate * PeriodMs) / 1000;
+      if (PeriodBytes == 0) PeriodBytes = 1;
+      if (PeriodBytes > FILEMGR_TASK_FILE_COPY_CHUNK) PeriodBytes = FILEMGR_TASK_FILE_COPY_CHUNK;
+   
+   }
+   
+   do {
+      
+      CFE_PSP_GetTime(&PeriodStart);
+      
+      RemainingBytes = PeriodBytes;
+      do {
+         
+         CopyStatus = OS_CopyFileData(SrcFileHandle, TargetFileHandle, RemainingBytes);
+         if (CopyStatus > 0) RemainingBytes -= CopyStatus;
+      
+      } while (CopyStatus > 0 && RemainingBytes > 0);
+      
+      if (CopyStatus > 0 && CopyRate != 0) {
+         
+         CFE_PSP_GetTime(&PeriodEnd);
+         ElapsedMs = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(PeriodEnd, PeriodStart));
+         
+         if (ElapsedMs < PeriodMs) {
+         
+            CFE_ES_PerfLogExit(PerfId);
+            OS_TaskDelay(PeriodMs - (uint32)ElapsedMs);
+            CFE_ES_PerfLogEntry(PerfId);
+      
+         }
+      } /* End if throttling */
+      
+   } while (CopyStatus > 0);
+   
+   return (CopyStatus == 0) ? OS_SUCCESS : CopyStatus;
+
+} /* End of CopyFileData() */
+
+
 /******************************************************************************
 ** Function: ComputeFileCrc
 **
@@ -853,3 +1033,18 @@ static bool ComputeFileCrc(const char* CmdName, const char* Filename, uint32* Cr
 } /* End ComputeCrc() */
 
 
+/******************************************************************************
+** Function: CodecYield
+**
+** Yield callback for the PSP file codec. Each codec block counts as a task
+** block.
+**
+*/
+static void CodecYield(void* TaskBlockCnt)
+{
+
+   CHILDMGR_PauseTask((uint16*)TaskBlockCnt, INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_CNT),
+                      INITBL_GetIntConfig(File->IniTbl, CFG_TASK_FILE_BLOCK_DELAY), 
+                      INITBL_GetIntConfig(File->IniTbl, CFG_CHILD_TASK_PERF_ID));
+
+} /* End of CodecYield() */
@@ -28,6 +28,10 @@
 
 #define FILE_IGNORE_CRC  0
 
+/* gzip levels accepted for TASK_FILE_COMPRESS_LEVEL besides CFE_PSP_COMPRESS_LEVEL_DEFAULT */
+#define FILE_COMPRESS_LEVEL_MIN  1
+#define FILE_COMPRESS_LEVEL_MAX  9
+
 
 /*
 ** Event Message IDs
@@ -50,6 +54,9 @@
 #define FILE_SET_PERMISSIONS_EID      (FILE_BASE_EID + 14)
 #define FILE_SET_PERMISSIONS_ERR_EID  (FILE_BASE_EID + 15)
 #define FILE_COMPUTE_FILE_CRC_ERR_EID (FILE_BASE_EID + 16)
+#define FILE_COMPRESS_EID             (FILE_BASE_EID + 17)
+#define FILE_COMPRESS_ERR_EID         (FILE_BASE_EID + 18)
+#define FILE_COMPRESS_LEVEL_ERR_EID   (FILE_BASE_EID + 19)
 
 /**********************/
 /** Type Definitions **/
@@ -117,6 +124,17 @@ typedef struct {
 #define FILE_DECOMPRESS_CMD_DATA_LEN  (sizeof(FILE_DecompressCmdMsg) - CFE_SB_CMD_HDR_SIZE)
 
 
+typedef struct {
+
+   CFE_MSG_CommandHeader_t CmdHeader;
+   
+   char SourceFilename[OS_MAX_PATH_LEN];
+   char TargetFilename[OS_MAX_PATH_LEN];
+
+} FILE_CompressCmdMsg;
+#define FILE_COMPRESS_CMD_DATA_LEN  (sizeof(FILE_CompressCmdMsg) - CFE_SB_CMD_HDR_SIZE)
+
+
 typedef struct {
 
    CFE_MSG_CommandHeader_t CmdHeader;
@@ -194,6 +212,7 @@ typedef struct {
    */
 
    uint16  CmdWarningCnt;
+   int32   CompressLevel;
 
    char FileTaskBuf[FILEMGR_TASK_FILE_BLOCK_SIZE];
    
@@ -248,6 +267,16 @@ void FILE_ResetStatus(void);
 bool FILE_ConcatenateCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr);
 
 
+/******************************************************************************
+** Function: FILE_CompressCmd
+**
+** Notes:
+**   1. Creates a gzip file using TASK_FILE_COMPRESS_LEVEL. The constructor
+**      replaces an out of range level with CFE_PSP_COMPRESS_LEVEL_DEFAULT.
+*/
+bool FILE_CompressCmd(void* DataObjPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
 /******************************************************************************
 ** Function: FILE_DecompressCmd
 **
@@ -227,6 +227,7 @@ static int32 InitApp(void)
 
 
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_CONCAT_CMD_FC,    CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_CONCATENATE_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_COMPRESS_CMD_FC,  CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_COMPRESS_CMD_DATA_LEN);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_COPY_CMD_FC,      CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_COPY_CMD_DATA_LEN);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_DECOMPRESS_CMD_FC,CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_DECOMPRESS_CMD_DATA_LEN);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_DELETE_CMD_FC,    CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_DELETE_CMD_DATA_LEN);
@@ -235,6 +236,7 @@ static int32 InitApp(void)
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_SEND_INFO_CMD_FC, CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_SEND_INFO_PKT_CMD_DATA_LEN);
       CMDMGR_RegisterFunc(CMDMGR_OBJ, FILE_SET_PERMISSIONS_CMD_FC, CHILDMGR_OBJ, CHILDMGR_InvokeChildCmd, FILE_SET_PERMISSIONS_CMD_DATA_LEN);
       CHILDMGR_RegisterFunc(CHILDMGR_OBJ, FILE_CONCAT_CMD_FC,    FILE_OBJ, FILE_ConcatenateCmd);
+      CHILDMGR_RegisterFunc(CHILDMGR_OBJ, FILE_COMPRESS_CMD_FC,  FILE_OBJ, FILE_CompressCmd);
       CHILDMGR_RegisterFunc(CHILDMGR_OBJ, FILE_COPY_CMD_FC,      FILE_OBJ, FILE_CopyCmd);
       CHILDMGR_RegisterFunc(CHILDMGR_OBJ, FILE_DECOMPRESS_CMD_FC,FILE_OBJ, FILE_DecompressCmd);
       CHILDMGR_RegisterFunc(CHILDMGR_OBJ, FILE_DELETE_CMD_FC,    FILE_OBJ, FILE_DeleteCmd);
@@ -43,6 +43,10 @@ static uint32  GetCurrentSlotNumber(void);
 static uint32  GetMETSlotNumber(void);
 static int32   ProcessNextSlot(void);
 static bool    SendTblEntryTlm(uint16 SchTblIndex, uint16 MsgTblIndex, bool    UseSchTblIndex);
+static void    CompileSchTbl(void);
+static void    ResetTimingStats(void);
+static uint32  TimeHistBin(uint32 Usec);
+static void    StampWakeupTime(void);
 
 /**********************/
 /** Global File Data **/
@@ -91,6 +95,10 @@ void SCHEDULER_Constructor(SCHEDULER_Class* ObjPtr)
    Scheduler->ValidMajorFrameCount        = 0;
    Scheduler->WorstCaseSlotsPerMinorFrame = 1;
 
+   StampWakeupTime();
+   ResetTimingStats();
+   CompileSchTbl();
+
    /*
    ** Configure Major Frame and Minor Frame sources
    */
@@ -170,6 +178,8 @@ void SCHEDULER_ResetStatus()
    Scheduler->ConsecutiveNoisyFrameCounter = 0;
    Scheduler->IgnoreMajorFrame             = false;
 
+   ResetTimingStats();
+
 } /* End SCHEDULER_ResetStatus() */
 
 
@@ -213,6 +223,7 @@ bool SCHEDULER_ConfigSchEntryCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufP
          if (RetStatus == true) {
             
             Scheduler->SchTbl.Entry[Index].Enabled = ConfigSchEntryCmd->Enabled;
+            CompileSchTbl();
             CFE_EVS_SendEvent(SCHEDULER_CMD_SUCCESS_EID, CFE_EVS_EventType_INFORMATION, 
                               "Configured scheduler table slot %d activity %d to %s",
                               ConfigSchEntryCmd->Slot, ConfigSchEntryCmd->Activity,
@@ -259,6 +270,7 @@ bool SCHEDULER_LoadSchEntryCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr
          Entry->Period      = LoadSchEntryCmd->Period;
          Entry->Offset      = LoadSchEntryCmd->Offset;
          Entry->MsgTblIndex = LoadSchEntryCmd->MsgTblIndex;
+         CompileSchTbl();
          RetStatus = true;
          
          CFE_EVS_SendEvent(SCHEDULER_CMD_SUCCESS_EID, CFE_EVS_EventType_INFORMATION, 
@@ -498,6 +510,16 @@ bool SCHEDULER_SendDiagTlmCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
       DiagPkt->MajorFrameSource = Scheduler->MajorFrameSource;
       DiagPkt->Spare            = 0;
 
+      DiagPkt->SlotOverrunCount  = Scheduler->SlotOverrunCount;
+      DiagPkt->MaxWakeupLateUsec = Scheduler->MaxWakeupLateUsec;
+      DiagPkt->MaxSlotExecUsec   = Scheduler->MaxSlotExecUsec;
+      CFE_PSP_MemCpy(DiagPkt->WakeupLateHist, Scheduler->WakeupLateHist, sizeof(DiagPkt->WakeupLateHist));
+      CFE_PSP_MemCpy(DiagPkt->SlotExecHist,   Scheduler->SlotExecHist,   sizeof(DiagPkt->SlotExecHist));
+      CFE_PSP_MemCpy(DiagPkt->CatchUpHist,    Scheduler->CatchUpHist,    sizeof(DiagPkt->CatchUpHist));
+
+      DiagPkt->SlotActiveCnt = Scheduler->SlotFirst[SendDiagTlmCmd->Slot+1] - Scheduler->SlotFirst[SendDiagTlmCmd->Slot];
+      DiagPkt->Spare2        = 0;
+
       for (Activity=0; Activity < SCHTBL_ACTIVITIES_PER_SLOT; Activity++) {
 
          DiagPkt->SchTblSlot[Activity] = Scheduler->SchTbl.Entry[SCHTBL_INDEX(SendDiagTlmCmd->Slot,Activity)];
@@ -601,6 +623,7 @@ const SCHTBL_Tbl* SCHEDULER_GetSchTblPtr()
 ** Notes:
 **   1. No validity checks are performed on the table data.
 **   2. Function signature must match SCHTBL_LoadTbl
+**   3. The active activity list is recompiled from the new table.
 **
 */
 bool SCHEDULER_LoadSchTbl(SCHTBL_Tbl* NewTbl)
@@ -608,6 +631,8 @@ bool SCHEDULER_LoadSchTbl(SCHTBL_Tbl* NewTbl)
 
    CFE_PSP_MemCpy(&(Scheduler->SchTbl), NewTbl, sizeof(SCHTBL_Tbl));       
 
+   CompileSchTbl();
+
    return true;
 
 } /* End SCHEDULER_LoadSchTbl() */
@@ -621,6 +646,7 @@ bool SCHEDULER_LoadSchTbl(SCHTBL_Tbl* NewTbl)
 ** Notes:
 **   1. Range checking is not performed on the parameters.
 **   2. Function signature must match SCHTBL_LoadTblEntry
+**   3. The active activity list is recompiled from the updated table.
 **
 */
 bool SCHEDULER_LoadSchTblEntry(uint16 EntryId, SCHTBL_Entry* NewEntry)
@@ -628,6 +654,8 @@ bool SCHEDULER_LoadSchTblEntry(uint16 EntryId, SCHTBL_Entry* NewEntry)
 
    CFE_PSP_MemCpy(&(Scheduler->SchTbl.Entry[EntryId]),NewEntry,sizeof(SCHTBL_Entry));
 
+   CompileSchTbl();
+
    return true;
 
 } /* End SCHEDULER_LoadSchTblEntry() */
@@ -679,15 +707,31 @@ int32 SCHEDULER_StartTimers(void)
 bool SCHEDULER_Execute(void)
 {
    
-   uint32  CurrentSlot;
-   uint32  ProcessCount;
-   int32   Result = CFE_SUCCESS;
+   uint32     CurrentSlot;
+   uint32     ProcessCount;
+   uint32     Usec;
+   int64      DeltaUsec;
+   int32      Result = CFE_SUCCESS;
+   OS_time_t  WakeTime;
+   OS_time_t  WakeupTime;
+   OS_time_t  DoneTime;
 
    /* Wait for the next slot (Major or Minor Frame) */
    Result = OS_BinSemTake(Scheduler->TimeSemaphore);
 
    if (Result == OS_SUCCESS) {
 
+      /*
+      ** Wakeup lateness is measured from the frame callback that gave the
+      ** semaphore so it includes the task dispatch latency
+      */
+      CFE_PSP_GetTime(&WakeTime);
+      __atomic_load(&Scheduler->WakeupTime, &WakeupTime, __ATOMIC_ACQUIRE);
+      DeltaUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(WakeTime, WakeupTime));
+      Usec = (DeltaUsec < 0) ? 0 : ((DeltaUsec > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)DeltaUsec);
+      Scheduler->WakeupLateHist[TimeHistBin(Usec)]++;
+      if (Usec > Scheduler->MaxWakeupLateUsec) Scheduler->MaxWakeupLateUsec = Usec;
+
       CFE_EVS_SendEvent(SCHEDULER_DEBUG_EID, CFE_EVS_EventType_DEBUG, "ProcessTable::OS_BinSemTake() success");
 
       if (Scheduler->IgnoreMajorFrame) {
@@ -831,6 +875,8 @@ bool SCHEDULER_Execute(void)
       } /* End if ProcessCount > 1) */
 
       CFE_EVS_SendEvent(SCHEDULER_DEBUG_EID, CFE_EVS_EventType_DEBUG, "ProcessTable::Final ProcessCount=%d", ProcessCount);
+      Scheduler->CatchUpHist[ProcessCount]++;
+
       /* Process the slots (most often this will be just one) */
       while ((ProcessCount != 0) && (Result == CFE_SUCCESS))
       {
@@ -838,6 +884,13 @@ bool SCHEDULER_Execute(void)
          ProcessCount--;
       }
 
+      CFE_PSP_GetTime(&DoneTime);
+      DeltaUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(DoneTime, WakeTime));
+      Usec = (DeltaUsec > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)DeltaUsec;
+      Scheduler->SlotExecHist[TimeHistBin(Usec)]++;
+      if (Usec > Scheduler->MaxSlotExecUsec) Scheduler->MaxSlotExecUsec = Usec;
+      if (Usec > SCHEDULER_NORMAL_SLOT_PERIOD) Scheduler->SlotOverrunCount++;
+
    } /* End Semaphore */
 
    return(Result == CFE_SUCCESS);
@@ -953,6 +1006,7 @@ static void MajorFrameCallback(void)
          /*
          ** Give "wakeup SCH" semaphore
          */
+         StampWakeupTime();
          OS_BinSemGive(Scheduler->TimeSemaphore);
 
       } /* End if IgnoreMajorFrame == FLASE */
@@ -1086,6 +1140,7 @@ static void MinorFrameCallback(uint32 TimerId)
    /*
    ** Give "wakeup SCH" semaphore
    */
+   StampWakeupTime();
    OS_BinSemGive(Scheduler->TimeSemaphore);
 
    return;
@@ -1186,62 +1241,67 @@ static uint32 GetMETSlotNumber(void)
 /******************************************************************************
 ** Function: ProcessNextSlot
 **
+** Notes:
+**   1. Only the slot's compiled active activities are visited. An activity
+**      whose message can't be sent is disabled in the scheduler table and
+**      the active list is recompiled after the slot is processed.
+**
 */
 static int32 ProcessNextSlot(void)
 {
     
    int32  Result = CFE_SUCCESS; /* TODO - Fix after resolve ground command processing */
-   int32  EntryNumber;
-   int32  SlotIndex;
-   uint32 Remainder;
-   SCHTBL_Entry *NextEntry;
-   uint16 *MsgPtr;
+   uint16 ActiveIdx;
+   uint16 ActiveEnd;
+   bool   Recompile = false;
+   SCHEDULER_ActiveEntry *NextEntry;
    int32  MsgSendStatus;
 
-   SlotIndex = Scheduler->NextSlotNumber * SCHTBL_ACTIVITIES_PER_SLOT;
-   NextEntry = &Scheduler->SchTbl.Entry[SlotIndex];
+   ActiveIdx = Scheduler->SlotFirst[Scheduler->NextSlotNumber];
+   ActiveEnd = Scheduler->SlotFirst[Scheduler->NextSlotNumber+1];
+   NextEntry = &Scheduler->ActiveList[ActiveIdx];
 
    /* Process each enabled entry in the schedule table slot */
-   for (EntryNumber = 0; EntryNumber < SCHTBL_ACTIVITIES_PER_SLOT; EntryNumber++) {
+   for ( ; ActiveIdx < ActiveEnd; ActiveIdx++) {
       
-      if (NextEntry->Enabled == true) {
-
-         Remainder = Scheduler->TablePassCount % NextEntry->Period;
-
-         if (Remainder == NextEntry->Offset) {
+      if ((Scheduler->TablePassCount % NextEntry->Period) == NextEntry->Offset) {
 
-            CFE_EVS_SendEvent(SCHEDULER_DEBUG_EID, CFE_EVS_EventType_DEBUG,"Scheduler ProcessNextSlot(): slot %d, entry %d, msgid %d", Scheduler->NextSlotNumber, EntryNumber, NextEntry->MsgTblIndex);
-             
-            MsgSendStatus = CFE_SB_NO_MESSAGE;  /* use any non-success error code */
-            if (MSGTBL_GetMsgPtr(NextEntry->MsgTblIndex, &MsgPtr)) {
-               
-               MsgSendStatus = CFE_SB_TransmitMsg((CFE_MSG_Message_t *)MsgPtr, true);
-
-            } /* End if got msg ptr */ 
-
-            if (MsgSendStatus == CFE_SUCCESS) {
-               
-               Scheduler->ScheduleActivitySuccessCount++;
+         CFE_EVS_SendEvent(SCHEDULER_DEBUG_EID, CFE_EVS_EventType_DEBUG,"Scheduler ProcessNextSlot(): slot %d, entry %d", Scheduler->NextSlotNumber, NextEntry->Activity);
+          
+         MsgSendStatus = CFE_SB_NO_MESSAGE;  /* use any non-success error code */
+         if (NextEntry->MsgPtr != NULL) {
             
-            }
-            else {
-                  
-               NextEntry->Enabled = false;
-               Scheduler->ScheduleActivityFailureCount++;
+            MsgSendStatus = CFE_SB_TransmitMsg((CFE_MSG_Message_t *)NextEntry->MsgPtr, true);
+
+         } /* End if valid msg ptr */ 
 
-               CFE_EVS_SendEvent(SCHEDULER_PACKET_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
-                                 "Activity error: slot = %d, entry = %d, err = 0x%08X",
-                                 Scheduler->NextSlotNumber, EntryNumber, MsgSendStatus);
+         if (MsgSendStatus == CFE_SUCCESS) {
             
-            } /* End if msg send error */
+            Scheduler->ScheduleActivitySuccessCount++;
          
-         } /* End if offset met */
+         }
+         else {
+               
+            Scheduler->SchTbl.Entry[SCHTBL_INDEX(Scheduler->NextSlotNumber,NextEntry->Activity)].Enabled = false;
+            Scheduler->ScheduleActivityFailureCount++;
+            Recompile = true;
 
-      } /* End if entry is enabled */
+            CFE_EVS_SendEvent(SCHEDULER_PACKET_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Activity error: slot = %d, entry = %d, err = 0x%08X",
+                              Scheduler->NextSlotNumber, NextEntry->Activity, MsgSendStatus);
+         
+         } /* End if msg send error */
+      
+      } /* End if offset met */
 
       NextEntry++;
 
-   } /* Entries per slot loop */
+   } /* Active entries per slot loop */
+
+   if (Recompile) {
+      
+      CompileSchTbl();
+   }
 
    /*
    ** Process ground commands in the slot reserved for time synch
@@ -1333,3 +1393,115 @@ static bool SendTblEntryTlm(uint16 SchTblIndex, uint16 MsgTblIndex, bool UseSchT
 
 } /* End SendTblEntryTlm() */
 
+
+/******************************************************************************
+** Function: CompileSchTbl
+**
+** Compile the enabled scheduler table entries into the active activity list.
+**
+** Notes:
+**   1. Entries are compiled in slot and activity order so the send order
+**      within a slot is unchanged.
+**   2. Messages are sent from the scheduler's message table so message table
+**      loads don't require a recompile. An entry with an invalid message
+**      table index is kept with a NULL message pointer so it fails and is
+**      disabled the first time it's due, the same as an unsendable message.
+**   3. An enabled entry with a zero period can never be due so it isn't
+**      compiled.
+**
+*/
+static void CompileSchTbl(void)
+{
+
+   uint16 Slot;
+   uint16 Activity;
+   uint16 ActiveCnt = 0;
+   SCHTBL_Entry* SchEntry = Scheduler->SchTbl.Entry;
+   SCHEDULER_ActiveEntry* ActiveEntry;
+
+   for (Slot=0; Slot < SCHTBL_SLOTS; Slot++) {
+
+      Scheduler->SlotFirst[Slot] = ActiveCnt;
+
+      for (Activity=0; Activity < SCHTBL_ACTIVITIES_PER_SLOT; Activity++) {
+
+         if (SchEntry->Enabled == true && SchEntry->Period > 0) {
+
+            ActiveEntry = &Scheduler->ActiveList[ActiveCnt++];
+
+            ActiveEntry->MsgPtr   = (SchEntry->MsgTblIndex < MSGTBL_MAX_ENTRIES) ?
+                                    Scheduler->MsgTbl.Entry[SchEntry->MsgTblIndex].Buffer : NULL;
+            ActiveEntry->Period   = SchEntry->Period;
+            ActiveEntry->Offset   = SchEntry->Offset;
+            ActiveEntry->Activity = Activity;
+            ActiveEntry->Spare    = 0;
+
+         } /* End if enabled */
+
+         SchEntry++;
+
+      } /* End activity loop */
+   } /* End slot loop */
+
+   Scheduler->SlotFirst[SCHTBL_SLOTS] = ActiveCnt;
+
+} /* End CompileSchTbl() */
+
+
+/******************************************************************************
+** Function: ResetTimingStats
+**
+*/
+static void ResetTimingStats(void)
+{
+
+   Scheduler->SlotOverrunCount  = 0;
+   Scheduler->MaxWakeupLateUsec = 0;
+   Scheduler->MaxSlotExecUsec   = 0;
+
+   CFE_PSP_MemSet(Scheduler->WakeupLateHist, 0, sizeof(Scheduler->WakeupLateHist));
+   CFE_PSP_MemSet(Scheduler->SlotExecHist,   0, sizeof(Scheduler->SlotExecHist));
+   CFE_PSP_MemSet(Scheduler->CatchUpHist,    0, sizeof(Scheduler->CatchUpHist));
+
+} /* End ResetTimingStats() */
+
+
+/******************************************************************************
+** Function: StampWakeupTime
+**
+** Record the time a frame callback gives the semaphore. The callbacks run in
+** the timer and time tone contexts while SCHEDULER_Execute() reads the time
+** from the app task, so the 64-bit value is accessed atomically.
+**
+*/
+static void StampWakeupTime(void)
+{
+
+   OS_time_t Now;
+
+   CFE_PSP_GetTime(&Now);
+   __atomic_store(&Scheduler->WakeupTime, &Now, __ATOMIC_RELEASE);
+
+} /* End StampWakeupTime() */
+
+
+/******************************************************************************
+** Function: TimeHistBin
+**
+** Return the log2 histogram bin for a microsecond duration. The bin is the
+** bit length of the duration, saturating at the last bin.
+**
+*/
+static uint32 TimeHistBin(uint32 Usec)
+{
+
+   uint32 Bin = 0;
+
+   while (Usec != 0 && Bin < (SCHEDULER_TIME_HIST_BINS - 1)) {
+      Usec >>= 1;
+      Bin++;
+   }
+
+   return Bin;
+
+} /* End TimeHistBin() */
@@ -88,6 +88,18 @@
 
 #define SCHEDULER_MAX_SYNC_ATTEMPTS   (SCHTBL_SLOTS * 3)
 
+/*
+** Timing histograms reported in the diagnostic packet. The wakeup lateness
+** and slot execution time histograms use log2 microsecond bins: bin 0 counts
+** 0 usec and bin n counts [2^(n-1), 2^n) usec with the last bin saturating
+** (>= 2^18 usec covers a full 250 msec slot). The catch-up histogram is
+** indexed by the number of slots processed on a wakeup, 0 being a wakeup in
+** the same slot.
+*/
+
+#define SCHEDULER_TIME_HIST_BINS      20
+#define SCHEDULER_CATCH_UP_HIST_BINS  (SCHEDULER_MAX_SLOTS_PER_WAKEUP + 1)
+
 /*
 ** Event Message IDs
 */
@@ -226,17 +238,51 @@ typedef struct {
    uint8   SyncToMET;
    uint8   MajorFrameSource;
    uint8   Spare;
+
+   /*
+   ** Timing statistics since the last reset
+   */
+
+   uint32  SlotOverrunCount;
+   uint32  MaxWakeupLateUsec;
+   uint32  MaxSlotExecUsec;
+   uint32  WakeupLateHist[SCHEDULER_TIME_HIST_BINS];
+   uint32  SlotExecHist[SCHEDULER_TIME_HIST_BINS];
+   uint32  CatchUpHist[SCHEDULER_CATCH_UP_HIST_BINS];
    
    /*
-   ** Send all the activities for the command-specified slot
+   ** Send all the activities for the command-specified slot and the number
+   ** of them that are compiled into the slot's active list
    */
    
+   uint16  SlotActiveCnt;
+   uint16  Spare2;
    SCHTBL_Entry SchTblSlot[SCHTBL_ACTIVITIES_PER_SLOT];
 
 } SCHEDULER_DiagPkt;
 #define SCHEDULER_DIAG_TLM_LEN sizeof (SCHEDULER_DiagPkt)
 
 
+/******************************************************************************
+** Active Activity List
+**
+** The scheduler table is compiled into a list of the enabled activities
+** ordered by slot. A slot's activities are ActiveList[SlotFirst[Slot]] up to
+** ActiveList[SlotFirst[Slot+1]-1] so a slot with no enabled activities costs
+** one comparison.
+*/
+
+typedef struct {
+
+   uint16* MsgPtr;         /* Scheduler's message table entry, NULL if MsgTblIndex invalid */
+   uint16  Period;
+   uint16  Offset;
+   uint16  Activity;       /* Index within the slot, used for events and to disable the entry */
+   uint16  Spare;
+
+} SCHEDULER_ActiveEntry;
+
+
 /******************************************************************************
 ** Scheduler Class
 */
@@ -277,6 +323,23 @@ typedef struct {
    uint32  ClockAccuracy;                 /* Accuracy of Minor Frame Timer */
    uint32  WorstCaseSlotsPerMinorFrame;   /* When syncing to MET, worst case # of slots that may need */
 
+   /*
+   ** Timing statistics
+   */
+   OS_time_t  WakeupTime;                 /* Time a frame callback last gave the semaphore, accessed atomically */
+   uint32     SlotOverrunCount;           /* Wakeups whose slot processing took longer than a slot period */
+   uint32     MaxWakeupLateUsec;
+   uint32     MaxSlotExecUsec;
+   uint32     WakeupLateHist[SCHEDULER_TIME_HIST_BINS];
+   uint32     SlotExecHist[SCHEDULER_TIME_HIST_BINS];
+   uint32     CatchUpHist[SCHEDULER_CATCH_UP_HIST_BINS];
+
+   /*
+   ** Active activity list compiled from SchTbl
+   */
+   uint16                 SlotFirst[SCHTBL_SLOTS+1];
+   SCHEDULER_ActiveEntry  ActiveList[SCHTBL_MAX_ENTRIES];
+
    /*
    ** Telemetry Packets
    */
@@ -319,6 +382,7 @@ void SCHEDULER_Constructor(SCHEDULER_Class* ObjPtr);
 **
 ** Notes:
 **   1. See the SCHEDULER_Class definition for the effected data.
+**   2. The timing histograms are also cleared.
 **
 */
 void SCHEDULER_ResetStatus(void);
@@ -390,6 +454,7 @@ const SCHTBL_Tbl* SCHEDULER_GetSchTblPtr(void);
 ** Notes:
 **   1. No validity checks are performed on the table data.
 **   2. Function signature must match SCHTBL_LoadTbl
+**   3. The active activity list is recompiled from the new table.
 **
 */
 bool SCHEDULER_LoadSchTbl(SCHTBL_Tbl* NewTbl);
@@ -403,6 +468,7 @@ bool SCHEDULER_LoadSchTbl(SCHTBL_Tbl* NewTbl);
 ** Notes:
 **   1. Range checking is not performed on the parameters.
 **   2. Function signature must match SCHTBL_LoadTblEntry
+**   3. The active activity list is recompiled from the updated table.
 **
 */
 bool SCHEDULER_LoadSchTblEntry(uint16 EntryId, SCHTBL_Entry* NewEntry);
@@ -471,6 +537,9 @@ bool SCHEDULER_SendMsgEntryCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr
 /******************************************************************************
 ** Function: SCHEDULER_SendDiagTlmCmd
 **
+** Send the diagnostic packet with the timing histograms and the activities
+** for the command-specified slot.
+**
 ** Notes:
 **   1. Function signature must match the CMDMGR_CmdFuncPtr definition
 **
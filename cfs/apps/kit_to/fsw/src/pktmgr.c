@@ -26,6 +26,7 @@
 #include <unistd.h>
 
 #include "osapi-network.h"
+#include "cfe_msg_inline.h"
 #include "app_cfg.h"
 #include "pktmgr.h"
 
@@ -42,6 +43,7 @@ static PKTMGR_Class*  PktMgr = NULL;
 static void  DestructorCallback(void);
 static void  FlushTlmPipe(void);
 static int32 SubscribeNewPkt(PKTTBL_Pkt* NewPkt);
+static void  LoadSbFilter(CFE_SB_Filter_t* SbFilter, uint16 FilterType, const PktUtil_FilterParam* FilterParam);
 static void  ComputeStats(uint16 PktsSent, uint32 BytesSent);
 
 
@@ -136,7 +138,6 @@ uint16 PKTMGR_OutputTelemetry(void)
    int32            SbStatus;
    size_t           MsgSize;
    CFE_SB_Buffer_t *SbBufPtr;
-   CFE_MSG_ApId_t   ApId;
    uint16           NumPktsOutput  = 0;
    uint32           NumBytesOutput = 0;
    
@@ -152,20 +153,15 @@ uint16 PKTMGR_OutputTelemetry(void)
 
       if ( (SbStatus == CFE_SUCCESS) && (PktMgr->SuppressSend == false) ) {
            
-         CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgSize);
+         MsgSize = CFE_MSG_FastGetSize(&SbBufPtr->Msg);
 
          if(PktMgr->DownlinkOn) {
             
-            CFE_MSG_GetApId(&(SbBufPtr->Msg), &ApId);
-            
-            if (!PktUtil_IsPacketFiltered(SbBufPtr, &(PktMgr->Tbl.Pkt[ApId].Filter))) {
-               
-               OsStatus = OS_SocketSendTo(PktMgr->TlmSockId, SbBufPtr, MsgSize, &SockAddr);
-          
-               ++NumPktsOutput;
-               NumBytesOutput += MsgSize;
-
-            } /* End if packet is not filtered */
+            /* Packet filters are applied by the software bus before queueing */
+            OsStatus = OS_SocketSendTo(PktMgr->TlmSockId, SbBufPtr, MsgSize, &SockAddr);
+       
+            ++NumPktsOutput;
+            NumBytesOutput += MsgSize;
 
          }
          else {
@@ -531,14 +527,18 @@ bool PKTMGR_SendPktTblTlmCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 ** Notes:
 **   1. Command rejected if ApId packet entry has not been loaded 
 **   2. The filter type is verified but the filter parameter values are not 
+**   3. The filter is programmed into the software bus subscription and the
+**      table is only updated if that succeeds
 ** 
 */
 bool PKTMGR_UpdateFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
 {
 
    const PKTMGR_UpdateFilterCmdMsg *UpdateFilterCmd = (const PKTMGR_UpdateFilterCmdMsg *) SbBufPtr;
-   bool           RetStatus = false;
-   CFE_MSG_ApId_t ApId;
+   bool            RetStatus = false;
+   int32           Status;
+   CFE_MSG_ApId_t  ApId;
+   CFE_SB_Filter_t SbFilter;
 
    
    ApId = UpdateFilterCmd->StreamId & PKTTBL_APP_ID_MASK;
@@ -549,17 +549,30 @@ bool PKTMGR_UpdateFilterCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
         
          PktUtil_Filter* TblFilter = &(PktMgr->Tbl.Pkt[ApId].Filter);
          
-         CFE_EVS_SendEvent(PKTMGR_UPDATE_FILTER_CMD_SUCCESS_EID, CFE_EVS_EventType_INFORMATION,
-                           "Successfully changed 0x%04X's filter (Type,N,X,O) from (%d,%d,%d,%d) to (%d,%d,%d,%d)",
-                           UpdateFilterCmd->StreamId,
-                           TblFilter->Type, TblFilter->Param.N, TblFilter->Param.X, TblFilter->Param.O,
-                           UpdateFilterCmd->FilterType,   UpdateFilterCmd->FilterParam.N,
-                           UpdateFilterCmd->FilterParam.X,UpdateFilterCmd->FilterParam.O);
-                           
-         TblFilter->Type  = UpdateFilterCmd->FilterType;
-         TblFilter->Param = UpdateFilterCmd->FilterParam;         
-        
-         RetStatus = true;
+         LoadSbFilter(&SbFilter, UpdateFilterCmd->FilterType, &(UpdateFilterCmd->FilterParam));
+         Status = CFE_SB_SetSubscriptionFilter(PktMgr->Tbl.Pkt[ApId].StreamId, PktMgr->TlmPipe, &SbFilter);
+         
+         if (Status == CFE_SUCCESS) {
+            
+            CFE_EVS_SendEvent(PKTMGR_UPDATE_FILTER_CMD_SUCCESS_EID, CFE_EVS_EventType_INFORMATION,
+                              "Successfully changed 0x%04X's filter (Type,N,X,O) from (%d,%d,%d,%d) to (%d,%d,%d,%d)",
+                              UpdateFilterCmd->StreamId,
+                              TblFilter->Type, TblFilter->Param.N, TblFilter->Param.X, TblFilter->Param.O,
+                              UpdateFilterCmd->FilterType,   UpdateFilterCmd->FilterParam.N,
+                              UpdateFilterCmd->FilterParam.X,UpdateFilterCmd->FilterParam.O);
+                              
+            TblFilter->Type  = UpdateFilterCmd->FilterType;
+            TblFilter->Param = UpdateFilterCmd->FilterParam;         
+           
+            RetStatus = true;
+         
+         }
+         else {
+         
+            CFE_EVS_SendEvent(PKTMGR_UPDATE_FILTER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error updating filter for packet 0x%04X. Software Bus status 0x%08X",
+                              UpdateFilterCmd->StreamId, (unsigned int)Status);
+         }
       
       } /* End if valid packet filter type */
       else {
@@ -630,14 +643,36 @@ static int32 SubscribeNewPkt(PKTTBL_Pkt* NewPkt)
 {
 
    int32 Status;
+   CFE_SB_Filter_t SbFilter;
 
-   Status = CFE_SB_SubscribeEx(NewPkt->StreamId, PktMgr->TlmPipe, NewPkt->Qos, NewPkt->BufLim);
+   LoadSbFilter(&SbFilter, NewPkt->Filter.Type, &(NewPkt->Filter.Param));
+   
+   Status = CFE_SB_SubscribeFiltered(NewPkt->StreamId, PktMgr->TlmPipe, NewPkt->Qos, NewPkt->BufLim, &SbFilter);
 
    return Status;
 
 } /* End SubscribeNewPkt(() */
 
 
+/******************************************************************************
+** Function: LoadSbFilter
+**
+** Notes:
+**   1. The PktUtil filter types share their values with the SB filter types
+*/
+static void LoadSbFilter(CFE_SB_Filter_t* SbFilter, uint16 FilterType, const PktUtil_FilterParam* FilterParam)
+{
+
+   memset(SbFilter, 0, sizeof(CFE_SB_Filter_t));
+   
+   SbFilter->Type = (CFE_SB_FilterType_Enum_t)FilterType;
+   SbFilter->N    = FilterParam->N;
+   SbFilter->X    = FilterParam->X;
+   SbFilter->O    = FilterParam->O;
+
+} /* End LoadSbFilter() */
+
+
 /******************************************************************************
 ** Function:  ComputeStats
 **
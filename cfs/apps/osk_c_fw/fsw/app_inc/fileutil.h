@@ -161,8 +161,12 @@ const char* FileUtil_FileStateStr(FileUtil_FileState  FileState);
 **
 ** Read a line from a text file.
 **
+** Notes:
+**   1. Reader must be initialized with CFE_FS_TextReaderInit() after the
+**      file is opened.
+**
 */
-bool FileUtil_ReadLine (int FileHandle, char* DestBuf, int MaxChar);
+bool FileUtil_ReadLine (CFE_FS_TextReader_t* Reader, char* DestBuf, int MaxChar);
 
 
 /******************************************************************************
@@ -20,6 +20,7 @@
 
 
 #define INILIB_TYPE_INT  "uint32"
+#define INILIB_TYPE_INT32 "int32"
 #define INILIB_TYPE_STR  "char*"
 
 
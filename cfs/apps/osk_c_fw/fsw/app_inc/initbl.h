@@ -53,7 +53,8 @@ typedef enum {
    
    INITBL_UNDEF  = 0,
    INITBL_UINT32 = 1,
-   INITBL_STR    = 2
+   INITBL_STR    = 2,
+   INITBL_INT32  = 3
    
 } INITBL_Type;
 
@@ -62,7 +63,7 @@ typedef struct {
    
    bool        Initialized;
    INITBL_Type Type;
-   uint32      Int;
+   uint32      Int;             /* INITBL_INT32 values are stored as their two's complement */
    char        Str[OS_MAX_PATH_LEN];
 
 } INITBL_CfgItem;
@@ -110,6 +111,17 @@ bool    INITBL_Constructor(INITBL_Class* IniTbl, const char* IniFile,
 uint32 INITBL_GetIntConfig(INITBL_Class*  IniTbl, uint16 Param);
 
 
+/******************************************************************************
+** Function: INITBL_GetInt32Config
+**
+** Notes:
+**    1. Same as INITBL_GetIntConfig() for parameters declared as int32 so
+**       negative values can be configured.
+**
+*/
+int32 INITBL_GetInt32Config(INITBL_Class*  IniTbl, uint16 Param);
+
+
 /******************************************************************************
 ** Function: INITBL_GetStrConfig
 **
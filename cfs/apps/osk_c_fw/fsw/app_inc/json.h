@@ -41,6 +41,13 @@
 #define JSON_MAX_CONTAINER_TOKENS   256
 #define JSON_MAX_STR_LEN             32
 #define JSON_MAX_OBJ_NAME_CHAR       32
+#define JSON_KEY_INDEX_SIZE        4096      /* Power of 2, at least twice the max object keys (JSON_MAX_FILE_TOKENS/2) */
+
+#define JSON_MAX_INDEX_DEPTH         32      /* Deeper files use linear key searches */
+
+#if (JSON_MAX_FILE_TOKENS > 32767)
+   #error JSON_MAX_FILE_TOKENS must fit in the int16 key index entries
+#endif
 
 #define JSON_UNDEF_STATUS_STR  "Undefined"   /* Status used in ground reporting */
 #define JSON_UNDEF_VAL_STR     "undefined"   /* JSON property value */
@@ -62,6 +69,7 @@
 #define JSON_DBG_OPEN_FILE_EID       (JSON_BASE_EID + 10)
 #define JSON_DBG_REG_CALLBACK_EID    (JSON_BASE_EID + 11)
 #define JSON_DBG_PROC_TOKENS_EID     (JSON_BASE_EID + 12)
+#define JSON_DBG_LOAD_FILE_EID       (JSON_BASE_EID + 13)
 
 /*
 ** Type Definitions
@@ -93,10 +101,23 @@ typedef struct {
 } JSON_ContainerCallBack;
 
 
+/*
+** Key index entry. A file's object keys are hashed by their container token
+** index and key string so JSON_GetValxxx() lookups don't scan the container.
+*/
+typedef struct {
+
+  int16  KeyToken;      /* Token index of the key, -1 if the entry is empty */
+  int16  ContainToken;  /* Token index of the object containing the key     */
+
+} JSON_KeyIndexEntry;
+
+
 typedef struct {
 
    JSON_FILE_STATUS FileStatus;
    char*       FileBuf;
+   int         FileLen;         /* Characters read into FileBuf */
 
    int         ContainerDepth;  /* Recursive token container call depth */
    int         FileObjTokens;   /* Number of tokens in the file level object */
@@ -107,6 +128,11 @@ typedef struct {
    int         CallBackIdx;
    JSON_ContainerCallBack ContainerCallBack[JSON_MAX_CONTAINER_TOKENS];
 
+   bool        KeyIndexValid;   /* False if the file was too deeply nested to index */
+   int         KeyCnt;          /* Number of keys in KeyIndex */
+   uint32      LoadUsec;        /* Time to read, tokenize and index the last file */
+   JSON_KeyIndexEntry KeyIndex[JSON_KEY_INDEX_SIZE];
+
 } JSON_Class;
 
 /*
@@ -171,8 +197,13 @@ void JSON_Constructor(JSON_Class* Json, char* FileBuf, jsmntok_t* FileTokens);
 /******************************************************************************
 ** Function: JSON_OpenFile
 **
+** Read a JSON file into the file buffer, tokenize it and index the object
+** keys.
+**
 ** Notes:
-**    
+**   1. The file is read with as few OS_read() calls as possible. A file that
+**      doesn't fit in JSON_MAX_FILE_CHAR-1 characters is rejected.
+**   2. The load time is reported in a debug event and saved in LoadUsec.
 **
 */
 bool    JSON_OpenFile(JSON_Class* Json, const char* FileName);
@@ -251,7 +282,7 @@ int JSON_GetContainerSize(JSON_Class* Json, int ContainTokenIdx);
 ** Function: JSON_GetValBool
 **
 ** Notes:
-**    
+**   1. Key is looked up in ContainTokenIdx's object using the key index.
 */
 bool    JSON_GetValBool(JSON_Class* Json, int ContainTokenIdx, const char* Key, bool   * BoolVal);
 
@@ -260,7 +291,7 @@ bool    JSON_GetValBool(JSON_Class* Json, int ContainTokenIdx, const char* Key,
 ** Function: JSON_GetValShortInt
 **
 ** Notes:
-**    
+**   1. Key is looked up in ContainTokenIdx's object using the key index.
 */
 bool    JSON_GetValShortInt(JSON_Class* Json, int ContainTokenIdx, const char* Key, int* IntVal);
 
@@ -269,7 +300,7 @@ bool    JSON_GetValShortInt(JSON_Class* Json, int ContainTokenIdx, const char* K
 ** Function: JSON_GetValUint32
 **
 ** Notes:
-**    
+**   1. Key is looked up in ContainTokenIdx's object using the key index.
 */
 bool    JSON_GetValUint32(JSON_Class* Json, int ContainTokenIdx, const char* Key, uint32* Uint32Val);
 
@@ -278,7 +309,7 @@ bool    JSON_GetValUint32(JSON_Class* Json, int ContainTokenIdx, const char* Key
 ** Function: JSON_GetValStr
 **
 ** Notes:
-**    
+**   1. Key is looked up in ContainTokenIdx's object using the key index.
 */
 bool    JSON_GetValStr(JSON_Class* Json, int ContainTokenIdx, const char* Key, char* StrVal);
 
@@ -287,7 +318,7 @@ bool    JSON_GetValStr(JSON_Class* Json, int ContainTokenIdx, const char* Key, c
 ** Function: JSON_GetValDouble
 **
 ** Notes:
-**    
+**   1. Key is looked up in ContainTokenIdx's object using the key index.
 */
 bool    JSON_GetValDouble(JSON_Class* Json, int ContainTokenIdx, const char* Key, double* DoubleVal);
 
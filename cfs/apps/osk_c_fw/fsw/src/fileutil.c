@@ -203,32 +203,25 @@ uint16 FileUtil_GetOpenFileList(FileUtil_OpenFileList *OpenFileList)
 **
 ** Read a line from a text file.
 **
+** Notes:
+**   1. The reader buffers the file in blocks so a line no longer costs one
+**      OS_read() per character.
+**   2. Returns true only if a complete newline terminated line was read.
+**
 */
-bool FileUtil_ReadLine (int FileHandle, char* DestBuf, int MaxChar) 
+bool FileUtil_ReadLine (CFE_FS_TextReader_t* Reader, char* DestBuf, int MaxChar) 
 {
 
-   char    c, *DestPtr;
    int32   ReadStatus;
    bool    RetStatus = false;
    
-   /* Decrement MaxChar to leave space for termination character */
-   for (DestPtr = DestBuf, MaxChar--; MaxChar > 0; MaxChar--) {
-      
-	  ReadStatus = OS_read(FileHandle, &c, 1);
-	  
-	  if (ReadStatus == 0  || ReadStatus == OS_ERROR)
-         break;
-      
-	  *DestPtr++ = c;
-      
-	  if (c == '\n') {
-         RetStatus = true;
-         break;
-      }
+   ReadStatus = CFE_FS_TextReadLine(Reader, DestBuf, MaxChar);
    
-   } /* End for loop */
+   if (ReadStatus > 0) {
+      
+      RetStatus = (DestBuf[ReadStatus-1] == '\n');
    
-   *DestPtr = 0;
+   }
 
    return RetStatus;
    
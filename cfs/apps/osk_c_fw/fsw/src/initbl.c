@@ -109,6 +109,30 @@ uint32 INITBL_GetIntConfig(INITBL_Class* IniTbl, uint16 Param)
 } /* INITBL_GetIntConfig() */
 
 
+/******************************************************************************
+** Function: INITBL_GetInt32Config
+**
+** Notes:
+**    1. Same as INITBL_GetIntConfig() for parameters declared as int32 so
+**       negative values can be configured.
+**
+*/
+int32 INITBL_GetInt32Config(INITBL_Class* IniTbl, uint16 Param)
+{
+   
+   int32 RetValue = 0;
+   
+   if (ValidConfigParam(IniTbl, Param, INITBL_INT32)) {
+   
+      RetValue = (int32)IniTbl->CfgItem[Param].Int;
+      
+   }
+   
+   return RetValue;
+   
+} /* INITBL_GetInt32Config() */
+
+
 /******************************************************************************
 ** Function: INITBL_GetStrConfig
 **
@@ -198,12 +222,13 @@ static const char* ConfigTypeStr(INITBL_Type Type)
    static const char* TypeStr[] = {
       "UNDEF",
       "UINT32",
-      "STRING"
+      "STRING",
+      "INT32"
    };
 
    uint8 i = 0;
    
-   if (Type == INITBL_UINT32 || Type == INITBL_STR) {
+   if (Type == INITBL_UINT32 || Type == INITBL_STR || Type == INITBL_INT32) {
    
       i = Type;
    
@@ -233,6 +258,7 @@ static bool ConfigCallback (void* UserData, int TokenIdx)
    INITBL_Class* IniTbl = (INITBL_Class*)UserData;
    int    Param;
    uint32 JsonIntData;
+   int    JsonInt32Data;
    char   JsonStrData[OS_MAX_PATH_LEN] = "\0";
    const char *CfgStrPtr;
    const char *CfgTypePtr;
@@ -257,6 +283,18 @@ static bool ConfigCallback (void* UserData, int TokenIdx)
          }
          
       } /* End if uint32 */
+      else if (!strcmp(INILIB_TYPE_INT32,CfgTypePtr)) {
+      
+         if (JSON_GetValShortInt(&(IniTbl->Json), TokenIdx, CfgStrPtr, &JsonInt32Data)) {
+            ++IniTbl->JsonVarCnt; 
+            IniTbl->CfgItem[Param].Initialized = true;
+            IniTbl->CfgItem[Param].Type   = INITBL_INT32;
+            IniTbl->CfgItem[Param].Int    = (uint32)(int32)JsonInt32Data;
+            IniTbl->CfgItem[Param].Str[0] = '\0';
+            if (DBG_INITBL) OS_printf("IniTbl->CfgItem[%d].Int=%d\n", Param, (int)JsonInt32Data);
+         }
+         
+      } /* End if int32 */
       else {
       
          if (JSON_GetValStr(&(IniTbl->Json), TokenIdx, CfgStrPtr, JsonStrData)) { 
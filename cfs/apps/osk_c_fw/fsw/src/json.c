@@ -83,7 +83,9 @@ static const char* JsonFileStatusStr[] = {
 /** File Function Prototypes **/
 /******************************/
 
-static size_t StrLen(const char *Str, size_t MaxLen);
+static void   BuildKeyIndex(JSON_Class* Json);
+static int    FindKey(JSON_Class* Json, int ContainTokenIdx, const char* Key);
+static uint32 KeyHash(const char* Str, int Len, int ContainTokenIdx);
 
 /******************************************************************************
 ** Function: ProcessContainerToken
@@ -158,84 +160,61 @@ void JSON_Constructor(JSON_Class* Json, char* FileBuf, jsmntok_t* FileTokens) {
 ** Function: JSON_OpenFile
 **
 ** Notes:
-**    1. Logic assumes JSON_MAX_FILE_CHAR > JSON_MAX_FILE_LINE_CHAR
+**   1. The file is read in as few OS_read() calls as possible. The previous
+**      line by line read made one OS_read() call per character.
+**   2. One extra character is read when the buffer is full to distinguish
+**      a file that exactly fits from one that is too long.
 **
 */
 bool JSON_OpenFile(JSON_Class* Json, const char* Filename)
 {
   
    bool RetStatus = false;
-   bool LowFileMem = false, ReadingFile = true;
   
-   osal_id_t     FileHandle;
-   int32         OsStatus;
-   char          LowMemBuf[JSON_MAX_FILE_LINE_CHAR];
-   unsigned int  Indx = 0, Len = 0, Line = 1;
+   osal_id_t  FileHandle;
+   int32      OsStatus;
+   int32      ReadStatus = 0;
+   int        MaxLen = JSON_MAX_FILE_CHAR - 1;  /* Leave room for the string terminator */
+   char       ExtraChar;
+   OS_time_t  StartTime;
+   OS_time_t  StopTime;
    
+   CFE_PSP_GetTime(&StartTime);
+
+   Json->FileLen       = 0;
    Json->FileObjTokens = 0;
-   Json->FileStatus = JSON_FILE_UNDEF; /* Internally used as a valid file read flag */
+   Json->FileStatus    = JSON_FILE_UNDEF; /* Internally used as a valid file read flag */
+   Json->KeyIndexValid = false;
+   Json->KeyCnt        = 0;
    CFE_PSP_MemSet(&(Json->JsmnParser), 0, sizeof(jsmn_parser));
    
-   OsStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_WRITE);
+   OsStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
    CFE_EVS_SendEvent(JSON_DBG_OPEN_FILE_EID,CFE_EVS_EventType_DEBUG,"JSON: OS_open(%s) returned FileHamdle = %d",Filename, FileHandle);
    
    if (OsStatus == OS_SUCCESS) {
   
-      while (ReadingFile) {
+      do {
+         
+         ReadStatus = OS_read(FileHandle, &(Json->FileBuf[Json->FileLen]), MaxLen - Json->FileLen);
+         if (ReadStatus > 0) Json->FileLen += ReadStatus;
+      
+      } while (ReadStatus > 0 && Json->FileLen < MaxLen);
       
-         Len = JSON_MAX_FILE_LINE_CHAR;
+      if (ReadStatus < 0) {
          
-         if (!LowFileMem) {
-            
-            if (FileUtil_ReadLine (FileHandle, &(Json->FileBuf[Indx]), JSON_MAX_FILE_LINE_CHAR)) {
-               Len = StrLen(&(Json->FileBuf[Indx]),JSON_MAX_FILE_LINE_CHAR);
-            }
-            else {
-               
-               ReadingFile = false;
-            }
-         } /* End if !LowFileMem */
-         else {
-            
-            if (FileUtil_ReadLine (FileHandle, LowMemBuf, JSON_MAX_FILE_LINE_CHAR)) {
-               Len = StrLen(LowMemBuf,JSON_MAX_FILE_LINE_CHAR);
-               if ( (Indx+Len) >= JSON_MAX_FILE_CHAR) {
-                  Json->FileStatus = JSON_FILE_CHAR_ERR;
-                  ReadingFile = false;
-               }
-               else {
-                  strcpy(&(Json->FileBuf[Indx]),LowMemBuf);
-               }
-            }
-            else {
-               ReadingFile = false;
-            }
-         } /* End if LowFileMem */ 
-            
-         //if (DBG_JSON) OS_printf("Line %d, Length = %d\n", Line, Len);
-    
-         if (ReadingFile) {
-            if (Len < JSON_MAX_FILE_LINE_CHAR) {
-               
-               //if (DBG_JSON) OS_printf("%s",&Json->FileBuf[Indx]);
-               Indx += Len; /* Don't skip over '\0'. Start next line on '\0' */
-               Line++;
-            }
-            else { 
-               
-               /* No '\0' found before hit max length */
-               Json->FileStatus = JSON_FILE_LINE_CHAR_ERR;
-               ReadingFile = false;
-            } /* End if valid line length */
-         } /* End if ReadingFile */
+         Json->FileStatus = JSON_FILE_OPEN_ERR;
+      }
+      else if (Json->FileLen == MaxLen) {
          
-         /* Set if remaining file buffer is less than the maxmimum char per file line */
-         LowFileMem = ((Indx+JSON_MAX_FILE_LINE_CHAR) > JSON_MAX_FILE_LINE_CHAR);
-        
-      } /* End while reading file */
+         if (OS_read(FileHandle, &ExtraChar, 1) > 0) {
+            Json->FileStatus = JSON_FILE_CHAR_ERR;
+         }
+      }
       
       OS_close(FileHandle);
 
+      Json->FileBuf[Json->FileLen] = '\0';
+
       if (DBG_JSON) OS_printf("JSON_OpenFile(): OS_\n\n%s\n\n",Json->FileBuf);
 
       if (Json->FileStatus == JSON_FILE_UNDEF) {
@@ -244,6 +223,7 @@ bool JSON_OpenFile(JSON_Class* Json, const char* Filename)
 
           if (Json->JsmnStatus == JSMN_SUCCESS) {
              
+             BuildKeyIndex(Json);
              RetStatus = true   ;
              Json->FileStatus = JSON_FILE_VALID;
           }
@@ -260,6 +240,14 @@ bool JSON_OpenFile(JSON_Class* Json, const char* Filename)
          
    } /* End if fopen() error */
    
+   CFE_PSP_GetTime(&StopTime);
+   Json->LoadUsec = (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(StopTime, StartTime));
+
+   CFE_EVS_SendEvent(JSON_DBG_LOAD_FILE_EID,CFE_EVS_EventType_DEBUG,
+                     "JSON: Loaded %s in %u usec. %d chars, %d tokens, %d keys, status = %s",
+                     Filename, (unsigned int)Json->LoadUsec, Json->FileLen, Json->JsmnParser.toknext,
+                     Json->KeyCnt, JSON_GetFileStatusStr(Json->FileStatus));
+
    return RetStatus;
        
 } /* End JSON_OpenFile() */
@@ -390,45 +378,37 @@ bool JSON_GetValBool(JSON_Class* Json, int ContainTokenIdx, const char* Key, boo
 
    int    i;
    char*  TokenStr;
-   jsmntok_t* ContainToken;
 
-   ContainToken = &(Json->FileTokens[ContainTokenIdx]);
+   i = FindKey(Json, ContainTokenIdx, Key);
    
-   for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+ContainToken->size); i++) {
-      
-      if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) {
+   if (i >= 0) {
 
-         TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
-         if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
-			
-            if (strcmp(TokenStr,"true") == 0) {
-               
-               *BoolVal = true;
-               return true;
-            }		
+      TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
+      if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
 			
-            if (strcmp(TokenStr,"false") == 0) {
-               
-               *BoolVal = false;
-               return true;
-            }		
+         if (strcmp(TokenStr,"true") == 0) {
             
-            CFE_EVS_SendEvent(JSON_INVLD_BOOL_VAL_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid bool    string %s for key %s at container token index %d",
-                              TokenStr, Key, ContainTokenIdx);
-			
-            return false;
+            *BoolVal = true;
+            return true;
+         }		
 			
-         } /* End if primitive */
-         else {
+         if (strcmp(TokenStr,"false") == 0) {
             
-            CFE_EVS_SendEvent(JSON_INVLD_BOOL_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid bool    type %s for key %s at container token index %d. Must be a primitive.",
-                              JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
-            break;
-         }
-     
-      } /* End if found key */
+            *BoolVal = false;
+            return true;
+         }		
+         
+         CFE_EVS_SendEvent(JSON_INVLD_BOOL_VAL_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid bool    string %s for key %s at container token index %d",
+                           TokenStr, Key, ContainTokenIdx);
+			
+      } /* End if primitive */
+      else {
+         
+         CFE_EVS_SendEvent(JSON_INVLD_BOOL_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid bool    type %s for key %s at container token index %d. Must be a primitive.",
+                           JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
+      }
 
-   } /* End container token loop */
+   } /* End if found key */
 
    return false;
 
@@ -446,48 +426,30 @@ bool JSON_GetValShortInt(JSON_Class* Json, int ContainTokenIdx, const char* Key,
 
    int    i;
    char   *TokenStr, *ErrCheck;
-   jsmntok_t  *ContainToken;
 
-   ContainToken = &(Json->FileTokens[ContainTokenIdx]);
-   if (DBG_JSON) OS_printf("JSON_GetValShortInt() for token %d with size %d\n",ContainTokenIdx,ContainToken->size);
+   if (DBG_JSON) OS_printf("JSON_GetValShortInt() for token %d with size %d\n",ContainTokenIdx,Json->FileTokens[ContainTokenIdx].size);
    
-   /* TODO - This logic doesn't allow a value to have a keyword */
-   /* TODO - Protect against exceeding the array length */ 
-   for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+ContainToken->size); i++) {
-      
-      //printf("JSON_GetValShortInt() loop %d for key %s\n",i,Key);
-      //Token = &Json->FileTokens[i];
-      //printf("Token[%d] = (%d,%d,%d,%d)\n", i, 
-      //Token->type, Token->start, Token->end, Token->size);
-      //printf("              %s\n", JSON_TokenToStr(Json->FileBuf, Token));
-
-      if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) {
+   i = FindKey(Json, ContainTokenIdx, Key);
+   
+   if (i >= 0) {
  
-         TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
-         //printf("JSON_GetValShortInt() Found key %s\n",Key);
-         if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
+      TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
+      if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
+         
+         *IntVal = (int)strtol(TokenStr, &ErrCheck, 10);
+         if (ErrCheck != TokenStr) return true;
             
-            ///*IntVal = atoi(TokenStr);
-			   *IntVal = (int)strtol(TokenStr, &ErrCheck, 10);
-			   if (ErrCheck == TokenStr) {
-               
-               CFE_EVS_SendEvent(JSON_INT_CONV_ERR_EID,CFE_EVS_EventType_ERROR,"JSON short int conversion error for key %s token %s at container token index %d.",
-                                 Key, TokenStr, ContainTokenIdx);
-               break;
-            }
-            return true   ;
+         CFE_EVS_SendEvent(JSON_INT_CONV_ERR_EID,CFE_EVS_EventType_ERROR,"JSON short int conversion error for key %s token %s at container token index %d.",
+                           Key, TokenStr, ContainTokenIdx);
 
-         } /* End if primitive */
-         else {
-            
-            CFE_EVS_SendEvent(JSON_INVLD_INT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid short int type %s for key %s at container token index %d. Must be a primitive.",
-                              JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
-            break;
-         }
+      } /* End if primitive */
+      else {
+         
+         CFE_EVS_SendEvent(JSON_INVLD_INT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid short int type %s for key %s at container token index %d. Must be a primitive.",
+                           JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
+      }
      
-      } /* End if found key */
-
-   } /* End container token loop */
+   } /* End if found key */
 
    return false;
 
@@ -506,39 +468,28 @@ bool JSON_GetValUint32(JSON_Class* Json, int ContainTokenIdx, const char* Key, u
 
    int    i;
    char   *TokenStr, *StrEndPtr;
-   jsmntok_t  *ContainToken;
    
-   ContainToken = &(Json->FileTokens[ContainTokenIdx]);
-   if (DBG_JSON) OS_printf("JSON_GetValUint32() for token %d with size %d\n",ContainTokenIdx,ContainToken->size);
+   if (DBG_JSON) OS_printf("JSON_GetValUint32() for token %d with size %d\n",ContainTokenIdx,Json->FileTokens[ContainTokenIdx].size);
    
-   for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+ContainToken->size); i++) {
-      
-      if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) {
+   i = FindKey(Json, ContainTokenIdx, Key);
+   
+   if (i >= 0) {
  
-         TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
-         if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
-            
-			   *Uint32Val = (uint32)strtoul(TokenStr, &StrEndPtr, 10);
-			   /* NOt sure how to check for error. strtoul() returns 0 for an error and that's a legit value 
-            if (*Uint32Val == 0) {
-               CFE_EVS_SendEvent(JSON_INT_CONV_ERR_EID,CFE_EVS_EventType_ERROR,"JSON long int conversion error for key %s token %s at container token index %d.",
-                                 Key, TokenStr, ContainTokenIdx);
-               break;
-            }
-            */
-            return true;
+      TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
+      if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
+         
+         /* Not sure how to check for error. strtoul() returns 0 for an error and that's a legit value */
+         *Uint32Val = (uint32)strtoul(TokenStr, &StrEndPtr, 10);
+         return true;
 
-         } /* End if primitive */
-         else {
-            
-            CFE_EVS_SendEvent(JSON_INVLD_INT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid long int type %s for key %s at container token index %d. Must be a primitive.",
-                              JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
-            break;
-         }
+      } /* End if primitive */
+      else {
+         
+         CFE_EVS_SendEvent(JSON_INVLD_INT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid long int type %s for key %s at container token index %d. Must be a primitive.",
+                           JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
+      }
      
-      } /* End if found key */
-
-   } /* End container token loop */
+   } /* End if found key */
 
    return false;
 
@@ -555,30 +506,23 @@ bool JSON_GetValUint32(JSON_Class* Json, int ContainTokenIdx, const char* Key, u
 bool JSON_GetValStr(JSON_Class* Json, int ContainTokenIdx, const char* Key, char* StrVal) {
    
    int i;
-   jsmntok_t* ContainToken;
 
-   ContainToken = &(Json->FileTokens[ContainTokenIdx]);
+   i = FindKey(Json, ContainTokenIdx, Key);
    
-   /* TODO - This logic doesn't allow a value to have a keyword */
-   /* TODO - Protect against exceeding the array length */ 
-   for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+ContainToken->size); i++) {
-      
-      if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) {
+   if (i >= 0) {
 
-         if (Json->FileTokens[i+1].type == JSMN_STRING) {
-            
-            strcpy(StrVal, JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]));
-            return true;
-         }
-         else {
-			   CFE_EVS_SendEvent(JSON_INVLD_STR_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid string type %s for key %s at container token index %d. Must be a string.",
-                              JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
-            break;
-         }
+      if (Json->FileTokens[i+1].type == JSMN_STRING) {
+         
+         strcpy(StrVal, JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]));
+         return true;
+      }
+      else {
+         
+         CFE_EVS_SendEvent(JSON_INVLD_STR_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid string type %s for key %s at container token index %d. Must be a string.",
+                           JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
+      }
      
-      } /* End if found key */
-
-   } /* End container token loop */
+   } /* End if found key */
 
    return false;
 
@@ -597,37 +541,28 @@ bool JSON_GetValDouble(JSON_Class* Json, int ContainTokenIdx, const char* Key, d
 
    int    i;
    char   *TokenStr, *ErrCheck;
-   jsmntok_t  *ContainToken;
 
-   ContainToken = &(Json->FileTokens[ContainTokenIdx]);
+   i = FindKey(Json, ContainTokenIdx, Key);
  
-   for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+ContainToken->size); i++) {
-      
-      if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) {
+   if (i >= 0) {
  
-         TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
-         if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
+      TokenStr = JSON_TokenToStr(Json->FileBuf, &Json->FileTokens[i+1]);
+      if (Json->FileTokens[i+1].type == JSMN_PRIMITIVE) {
+         
+         *DoubleVal = strtod(TokenStr, &ErrCheck);
+         if (ErrCheck != TokenStr) return true;
             
-            *DoubleVal = strtod(TokenStr, &ErrCheck);
-            if (ErrCheck == TokenStr) {
-               
-               CFE_EVS_SendEvent(JSON_FLT_CONV_ERR_EID,CFE_EVS_EventType_ERROR,"JSON float conversion error for key %s token %s at container token index %d.",
-			      Key, TokenStr, ContainTokenIdx);
-               break;
-            }
-            return true;
+         CFE_EVS_SendEvent(JSON_FLT_CONV_ERR_EID,CFE_EVS_EventType_ERROR,"JSON float conversion error for key %s token %s at container token index %d.",
+                           Key, TokenStr, ContainTokenIdx);
 			
-         } /* End if primitive */
-         else {
-            
-            CFE_EVS_SendEvent(JSON_INVLD_FLT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid float type %s for key %s at container token index %d. Must be a primitive.",
-                              JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
-            break;
-         }
+      } /* End if primitive */
+      else {
+         
+         CFE_EVS_SendEvent(JSON_INVLD_FLT_TYPE_ERR_EID,CFE_EVS_EventType_ERROR,"JSON invalid float type %s for key %s at container token index %d. Must be a primitive.",
+                           JSON_GetJsmnTypeStr(Json->FileTokens[i+1].type), Key, ContainTokenIdx);
+      }
      
-      } /* End if found key */
-
-   } /* End container token loop */
+   } /* End if found key */
 
    return false;
 
@@ -834,16 +769,159 @@ static int ProcessContainerToken(JSON_Class* Json, int TokenId) {
 
 
 /******************************************************************************
-** Function: StrLen
+** Function: BuildKeyIndex
+**
+** Hash each object key by its container token index and key string.
 **
 ** Notes:
-**   1. Was sing strnlen but wrote my own to avoid compiler warning. I wanted
-**      the length protection because reading JSON data from a file 
+**   1. JSMN tokens are in file order and a container's size is its number
+**      of direct children. Object children alternate between key and value
+**      so even numbered string children are keys.
+**   2. The first occurrence of a duplicate key is indexed, which matches the
+**      previous linear search.
+**   3. If a file is nested deeper than JSON_MAX_INDEX_DEPTH the index isn't
+**      used and FindKey() searches the container's tokens.
 */
-static size_t StrLen(const char *Str, size_t MaxLen)
+static void BuildKeyIndex(JSON_Class* Json)
 {
-     size_t i;
-     for(i = 0; i < MaxLen && Str[i]; i++);
-     return i;
-     
-}
+
+   int  TokenCnt = Json->JsmnParser.toknext;
+   int  TokenIdx;
+   int  Depth = 0;
+   int  Container[JSON_MAX_INDEX_DEPTH];
+   int  ChildCnt[JSON_MAX_INDEX_DEPTH];
+   int  Remaining[JSON_MAX_INDEX_DEPTH];
+   int  KeyLen;
+   uint32 Hash;
+   jsmntok_t* Token;
+   JSON_KeyIndexEntry* Entry;
+
+   memset(Json->KeyIndex, 0xFF, sizeof(Json->KeyIndex));  /* All entries -1 */
+   Json->KeyCnt = 0;
+
+   for (TokenIdx=0; TokenIdx < TokenCnt; TokenIdx++) {
+
+      Token = &Json->FileTokens[TokenIdx];
+
+      if (Depth > 0) {
+
+         if (Json->FileTokens[Container[Depth-1]].type == JSMN_OBJECT &&
+             (ChildCnt[Depth-1] % 2) == 0 && Token->type == JSMN_STRING) {
+
+            KeyLen = Token->end - Token->start;
+            Hash   = KeyHash(&Json->FileBuf[Token->start], KeyLen, Container[Depth-1]);
+
+            Entry = &Json->KeyIndex[Hash & (JSON_KEY_INDEX_SIZE-1)];
+            while (Entry->KeyToken >= 0) {
+               
+               if (Entry->ContainToken == Container[Depth-1] &&
+                   (Json->FileTokens[Entry->KeyToken].end - Json->FileTokens[Entry->KeyToken].start) == KeyLen &&
+                   strncmp(&Json->FileBuf[Json->FileTokens[Entry->KeyToken].start], &Json->FileBuf[Token->start], KeyLen) == 0) break;
+
+               Hash++;
+               Entry = &Json->KeyIndex[Hash & (JSON_KEY_INDEX_SIZE-1)];
+            }
+
+            if (Entry->KeyToken < 0) {
+               
+               Entry->KeyToken     = (int16)TokenIdx;
+               Entry->ContainToken = (int16)Container[Depth-1];
+               Json->KeyCnt++;
+            }
+
+         } /* End if key */
+
+         ChildCnt[Depth-1]++;
+         Remaining[Depth-1]--;
+
+      } /* End if in a container */
+
+      if ((Token->type == JSMN_OBJECT || Token->type == JSMN_ARRAY) && Token->size > 0) {
+
+         if (Depth == JSON_MAX_INDEX_DEPTH) return;
+
+         Container[Depth] = TokenIdx;
+         ChildCnt[Depth]  = 0;
+         Remaining[Depth] = Token->size;
+         Depth++;
+      }
+
+      while (Depth > 0 && Remaining[Depth-1] == 0) Depth--;
+
+   } /* End token loop */
+
+   Json->KeyIndexValid = true;
+
+} /* End BuildKeyIndex() */
+
+
+/******************************************************************************
+** Function: FindKey
+**
+** Return the token index of Key in the ContainTokenIdx object or -1 if the
+** key isn't found.
+**
+** Notes:
+**   1. The fallback linear search has the original limitations. It only
+**      checks the next container size tokens and it may match a value.
+*/
+static int FindKey(JSON_Class* Json, int ContainTokenIdx, const char* Key)
+{
+
+   int    i;
+   uint32 Hash;
+   JSON_KeyIndexEntry* Entry;
+
+   if (Json->KeyIndexValid) {
+
+      Hash  = KeyHash(Key, strlen(Key), ContainTokenIdx);
+      Entry = &Json->KeyIndex[Hash & (JSON_KEY_INDEX_SIZE-1)];
+
+      while (Entry->KeyToken >= 0) {
+
+         if (Entry->ContainToken == ContainTokenIdx &&
+             JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[Entry->KeyToken], Key)) {
+            return Entry->KeyToken;
+         }
+
+         Hash++;
+         Entry = &Json->KeyIndex[Hash & (JSON_KEY_INDEX_SIZE-1)];
+      }
+
+   } /* End if key index valid */
+   else {
+
+      for (i=(ContainTokenIdx+1); i <= (ContainTokenIdx+Json->FileTokens[ContainTokenIdx].size); i++) {
+
+         if (JSON_TokenStrEq(Json->FileBuf, &Json->FileTokens[i], Key)) return i;
+
+      }
+   }
+
+   return -1;
+
+} /* End FindKey() */
+
+
+/******************************************************************************
+** Function: KeyHash
+**
+** FNV-1a hash of the key string mixed with its container token index.
+**
+*/
+static uint32 KeyHash(const char* Str, int Len, int ContainTokenIdx)
+{
+
+   int    i;
+   uint32 Hash = 2166136261u;
+
+   for (i=0; i < Len; i++) {
+      Hash ^= (uint8)Str[i];
+      Hash *= 16777619u;
+   }
+
+   Hash ^= (uint32)ContainTokenIdx * 2654435761u;
+
+   return Hash ^ (Hash >> 16);
+
+} /* End KeyHash() */
@@ -0,0 +1,20 @@
+/*
+** Purpose: Define mission configurations for the SB Bridge application
+**
+** Notes:
+**   None
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL). 
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+#ifndef _sb_bridge_mission_cfg_
+#define _sb_bridge_mission_cfg_
+
+
+#endif /* _sb_bridge_mission_cfg_ */
@@ -0,0 +1,38 @@
+/*
+** Purpose: Define platform configurations for the SB Bridge application
+**
+** Notes:
+**   1. Each cFS instance sharing a bridge region needs its own ini file
+**      with a unique INSTANCE_ID and the opposite SHM_TX_RING. The
+**      native SIM build loads the ini file from its own /cf directory so
+**      two SIM instances on one host only differ in their ini files.
+**
+** License:
+**   Written by David McComas and licensed under the GNU
+**   Lesser General Public License (LGPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+
+#ifndef _sb_bridge_platform_cfg_
+#define _sb_bridge_platform_cfg_
+
+/*
+** Includes
+*/
+
+#include "sb_bridge_mission_cfg.h"
+
+
+/******************************************************************************
+** Platform Deployment Configurations
+*/
+
+#define SB_BRIDGE_PLATFORM_REV   0
+#define SB_BRIDGE_INI_FILENAME   "/cf/sb_bridge_ini.json"
+
+
+#endif /* _sb_bridge_platform_cfg_ */
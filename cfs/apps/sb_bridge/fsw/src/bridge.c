@@ -0,0 +1,359 @@
+/*
+** Purpose: Implement the SB Bridge class
+**
+** Notes:
+**   1. See header notes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "bridge.h"
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static BRIDGE_Class*  Bridge = NULL;
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void ForwardMsg(const CFE_SB_Buffer_t* SbBufPtr);
+static bool InjectFrame(const SHMRING_FrameHdr* FrameHdr);
+
+
+/******************************************************************************
+** Function: BRIDGE_Constructor
+**
+*/
+void BRIDGE_Constructor(BRIDGE_Class *BridgePtr, INITBL_Class* IniTbl)
+{
+
+   int32 SbStatus;
+
+   Bridge = BridgePtr;
+
+   CFE_PSP_MemSet((void*)Bridge, 0, sizeof(BRIDGE_Class));
+   FWDTBL_SetTblToUnused(&Bridge->Tbl);
+
+   Bridge->FwdPipeTimeout = INITBL_GetIntConfig(IniTbl, CFG_FWD_PIPE_TIMEOUT);
+   Bridge->RxPollDelay    = INITBL_GetIntConfig(IniTbl, CFG_RX_POLL_DELAY);
+   Bridge->InstanceId     = (uint8)INITBL_GetIntConfig(IniTbl, CFG_INSTANCE_ID);
+
+   SbStatus = CFE_SB_CreatePipe(&Bridge->FwdPipe, INITBL_GetIntConfig(IniTbl, CFG_FWD_PIPE_DEPTH),
+                                INITBL_GetStrConfig(IniTbl, CFG_FWD_PIPE_NAME));
+
+   /* Never forward what the child task injected from the peer */
+   if (SbStatus == CFE_SUCCESS) {
+      SbStatus = CFE_SB_SetPipeOpts(Bridge->FwdPipe, CFE_SB_PIPEOPTS_IGNOREMINE);
+   }
+
+   if (SbStatus != CFE_SUCCESS) {
+
+      CFE_EVS_SendEvent(BRIDGE_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating forward pipe %s, status 0x%08X",
+                        INITBL_GetStrConfig(IniTbl, CFG_FWD_PIPE_NAME), SbStatus);
+
+   }
+
+   SHMRING_Constructor(&Bridge->ShmRing, INITBL_GetStrConfig(IniTbl, CFG_SHM_NAME),
+                       INITBL_GetIntConfig(IniTbl, CFG_SHM_RING_BYTES),
+                       (uint8)INITBL_GetIntConfig(IniTbl, CFG_SHM_TX_RING));
+
+   CFE_EVS_SendEvent(BRIDGE_CONSTRUCTOR_EID, CFE_EVS_EventType_INFORMATION,
+                     "Bridge instance %d constructed. Shared memory %s",
+                     Bridge->InstanceId, Bridge->ShmRing.IsMapped ? "mapped" : "unavailable");
+
+} /* End BRIDGE_Constructor() */
+
+
+/******************************************************************************
+** Function: BRIDGE_ResetStatus
+**
+*/
+void BRIDGE_ResetStatus(void)
+{
+
+   Bridge->TxDropReported = false;
+   Bridge->RxLoopReported = false;
+   Bridge->RxErrReported  = false;
+
+   Bridge->TxPktCnt      = 0;
+   Bridge->TxDropCnt     = 0;
+   Bridge->RxPktCnt      = 0;
+   Bridge->RxLoopDropCnt = 0;
+   Bridge->RxErrCnt      = 0;
+
+} /* End BRIDGE_ResetStatus() */
+
+
+/******************************************************************************
+** Function: BRIDGE_GetTblPtr
+**
+*/
+const FWDTBL_Tbl* BRIDGE_GetTblPtr(void)
+{
+
+   return &(Bridge->Tbl);
+
+} /* End BRIDGE_GetTblPtr() */
+
+
+/******************************************************************************
+** Function: BRIDGE_LoadTbl
+**
+** Notes:
+**   1. All current subscriptions are removed before the new table is
+**      subscribed so a MsgId dropped from the table stops being forwarded.
+**
+*/
+bool BRIDGE_LoadTbl(FWDTBL_Tbl* NewTbl)
+{
+
+   bool   RetStatus = true;
+   uint16 i;
+   int32  SbStatus;
+
+   for (i=0; i < Bridge->Tbl.EntryCnt; i++) {
+
+      CFE_SB_Unsubscribe(Bridge->Tbl.Entry[i].MsgId, Bridge->FwdPipe);
+
+   }
+
+   CFE_PSP_MemCpy(&(Bridge->Tbl), NewTbl, sizeof(FWDTBL_Tbl));
+
+   for (i=0; i < Bridge->Tbl.EntryCnt; i++) {
+
+      SbStatus = CFE_SB_SubscribeEx(Bridge->Tbl.Entry[i].MsgId, Bridge->FwdPipe,
+                                    CFE_SB_DEFAULT_QOS, Bridge->Tbl.Entry[i].BufLim);
+
+      if (SbStatus != CFE_SUCCESS) {
+
+         RetStatus = false;
+         CFE_EVS_SendEvent(BRIDGE_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error subscribing forward MsgId 0x%04X, status 0x%08X",
+                           (unsigned int)CFE_SB_MsgIdToValue(Bridge->Tbl.Entry[i].MsgId), SbStatus);
+
+      }
+
+   } /* End entry loop */
+
+   CFE_EVS_SendEvent(BRIDGE_LOAD_TBL_EID, CFE_EVS_EventType_INFORMATION,
+                     "Forwarding %d MsgIds to the peer instance", Bridge->Tbl.EntryCnt);
+
+   return RetStatus;
+
+} /* End BRIDGE_LoadTbl() */
+
+
+/******************************************************************************
+** Function: BRIDGE_ForwardMsgs
+**
+** Notes:
+**   1. Only the initial pend is bracketed by performance log markers. The
+**      drain that follows polls the pipe.
+**   2. A pipe error delays for the pipe timeout so the caller's loop keeps
+**      its command processing rate without spinning.
+**
+*/
+void BRIDGE_ForwardMsgs(uint32 PerfId)
+{
+
+   int32            SbStatus;
+   CFE_SB_Buffer_t* SbBufPtr;
+
+
+   CFE_ES_PerfLogExit(PerfId);
+   SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, Bridge->FwdPipe, Bridge->FwdPipeTimeout);
+   CFE_ES_PerfLogEntry(PerfId);
+
+   while (SbStatus == CFE_SUCCESS) {
+
+      ForwardMsg(SbBufPtr);
+
+      SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, Bridge->FwdPipe, CFE_SB_POLL);
+
+   }
+
+   if (SbStatus != CFE_SB_TIME_OUT && SbStatus != CFE_SB_NO_MESSAGE) {
+
+      OS_TaskDelay(Bridge->FwdPipeTimeout);
+
+   }
+
+} /* End BRIDGE_ForwardMsgs() */
+
+
+/******************************************************************************
+** Function: BRIDGE_RxChildTask
+**
+** Notes:
+**   1. Drains the RX ring each time it is called and only sleeps when the
+**      ring is empty, so a burst from the peer is injected back to back.
+**
+*/
+bool BRIDGE_RxChildTask(CHILDMGR_Class* ChildMgr)
+{
+
+   const SHMRING_FrameHdr* FrameHdr = SHMRING_Peek(&Bridge->ShmRing);
+
+   if (FrameHdr == NULL) {
+
+      OS_TaskDelay(Bridge->RxPollDelay);
+
+   }
+
+   while (FrameHdr != NULL) {
+
+      if (!InjectFrame(FrameHdr)) break;
+
+      SHMRING_Release(&Bridge->ShmRing, FrameHdr);
+      FrameHdr = SHMRING_Peek(&Bridge->ShmRing);
+
+   }
+
+   return true;
+
+} /* End BRIDGE_RxChildTask() */
+
+
+/******************************************************************************
+** Function: ForwardMsg
+**
+** Copy one SB message into the TX ring.
+**
+** Notes:
+**   1. A full ring drops the message rather than blocking the forward pipe.
+**      One event is sent per run of drops.
+**
+*/
+static void ForwardMsg(const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CFE_MSG_Size_t MsgSize = 0;
+
+   CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgSize);
+
+   if (SHMRING_Write(&Bridge->ShmRing, Bridge->InstanceId, SbBufPtr, (uint32)MsgSize)) {
+
+      Bridge->TxPktCnt++;
+      Bridge->TxDropReported = false;
+
+   }
+   else {
+
+      Bridge->TxDropCnt++;
+
+      if (!Bridge->TxDropReported) {
+
+         Bridge->TxDropReported = true;
+         CFE_EVS_SendEvent(BRIDGE_TX_DROP_EID, CFE_EVS_EventType_ERROR,
+                           "Dropping forwarded messages, TX ring %s. Verify the peer instance is running",
+                           Bridge->ShmRing.IsMapped ? "full" : "unmapped");
+
+      }
+   }
+
+} /* End ForwardMsg() */
+
+
+/******************************************************************************
+** Function: InjectFrame
+**
+** Inject one RX frame into the local SB.
+**
+** Notes:
+**   1. Returns false if the frame is corrupt. The RX ring is flushed in that
+**      case because the frame length can't be trusted to find the next one.
+**   2. The sequence count written by the originating instance is preserved.
+**
+*/
+static bool InjectFrame(const SHMRING_FrameHdr* FrameHdr)
+{
+
+   int32            SbStatus;
+   CFE_SB_Buffer_t* SbBufPtr;
+
+
+   if ((FrameHdr->Len < sizeof(CFE_MSG_Message_t)) || (FrameHdr->Len > CFE_MISSION_SB_MAX_SB_MSG_SIZE)) {
+
+      Bridge->RxErrCnt++;
+      SHMRING_Flush(&Bridge->ShmRing);
+
+      CFE_EVS_SendEvent(BRIDGE_RX_FRAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Invalid RX frame length %u from instance %d, flushed RX ring",
+                        FrameHdr->Len, FrameHdr->Origin);
+      return false;
+
+   }
+
+   if (FrameHdr->Origin == Bridge->InstanceId) {
+
+      Bridge->RxLoopDropCnt++;
+
+      if (!Bridge->RxLoopReported) {
+
+         Bridge->RxLoopReported = true;
+         CFE_EVS_SendEvent(BRIDGE_RX_LOOP_EID, CFE_EVS_EventType_ERROR,
+                           "Dropping RX frames sent by this instance (%d). Verify INSTANCE_ID and SHM_TX_RING differ in the peer",
+                           Bridge->InstanceId);
+
+      }
+
+      return true;
+
+   }
+
+   SbBufPtr = CFE_SB_AllocateMessageBuffer(FrameHdr->Len);
+
+   if (SbBufPtr != NULL) {
+
+      memcpy(SbBufPtr, &FrameHdr[1], FrameHdr->Len);
+
+      SbStatus = CFE_SB_TransmitBuffer(SbBufPtr, false);
+
+      if (SbStatus == CFE_SUCCESS) {
+
+         Bridge->RxPktCnt++;
+         Bridge->RxErrReported = false;
+         return true;
+
+      }
+
+      CFE_SB_ReleaseMessageBuffer(SbBufPtr);
+
+   }
+   else {
+
+      SbStatus = CFE_SB_BUF_ALOC_ERR;
+
+   }
+
+   Bridge->RxErrCnt++;
+
+   if (!Bridge->RxErrReported) {
+
+      Bridge->RxErrReported = true;
+      CFE_EVS_SendEvent(BRIDGE_RX_INJECT_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error injecting RX message from instance %d, status 0x%08X",
+                        FrameHdr->Origin, SbStatus);
+
+   }
+
+   return true;
+
+} /* End InjectFrame() */
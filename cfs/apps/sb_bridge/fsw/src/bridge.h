@@ -0,0 +1,164 @@
+/*
+** Purpose: Define the SB Bridge class
+**
+** Notes:
+**   1. The parent task owns the TX direction. It pends on the forward pipe
+**      and copies each message into the shared memory TX ring. The child
+**      task owns the RX direction. It drains the RX ring and injects each
+**      message into the local SB with CFE_SB_TransmitBuffer(). Each ring
+**      therefore has exactly one producer and one consumer.
+**   2. Loop prevention:
+**      - The forward pipe is created with CFE_SB_PIPEOPTS_IGNOREMINE so
+**        messages injected by the child task (same app) are never delivered
+**        back to the forward pipe, even when the peer exports a MsgId this
+**        instance also forwards.
+**      - Every frame carries the INSTANCE_ID of the bridge that wrote it and
+**        frames with the local INSTANCE_ID are dropped and reported. This
+**        flags a peer ini file that was copied without changing its
+**        INSTANCE_ID and SHM_TX_RING.
+**   3. Injected messages keep their original sequence counts.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _bridge_
+#define _bridge_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "fwdtbl.h"
+#include "shmring.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define BRIDGE_CONSTRUCTOR_EID   (BRIDGE_BASE_EID + 0)
+#define BRIDGE_PIPE_ERR_EID      (BRIDGE_BASE_EID + 1)
+#define BRIDGE_SUBSCRIBE_ERR_EID (BRIDGE_BASE_EID + 2)
+#define BRIDGE_LOAD_TBL_EID      (BRIDGE_BASE_EID + 3)
+#define BRIDGE_TX_DROP_EID       (BRIDGE_BASE_EID + 4)
+#define BRIDGE_RX_FRAME_ERR_EID  (BRIDGE_BASE_EID + 5)
+#define BRIDGE_RX_LOOP_EID       (BRIDGE_BASE_EID + 6)
+#define BRIDGE_RX_INJECT_ERR_EID (BRIDGE_BASE_EID + 7)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** BRIDGE_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Class State Data
+   */
+
+   CFE_SB_PipeId_t  FwdPipe;
+   uint32           FwdPipeTimeout;   /* Milliseconds */
+   uint32           RxPollDelay;      /* Milliseconds */
+   uint8            InstanceId;
+
+   bool             TxDropReported;
+   bool             RxLoopReported;
+   bool             RxErrReported;
+
+   uint32           TxPktCnt;
+   uint32           TxDropCnt;
+   uint32           RxPktCnt;
+   uint32           RxLoopDropCnt;
+   uint32           RxErrCnt;
+
+   FWDTBL_Tbl       Tbl;
+   SHMRING_Class    ShmRing;
+
+} BRIDGE_Class;
+
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: BRIDGE_Constructor
+**
+** Initialize the bridge object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. A shared memory mapping failure is not fatal. The bridge runs without
+**      forwarding so the failure is visible in housekeeping telemetry.
+**
+*/
+void BRIDGE_Constructor(BRIDGE_Class *BridgePtr, INITBL_Class* IniTbl);
+
+
+/******************************************************************************
+** Function: BRIDGE_ResetStatus
+**
+** Reset counters and status flags to a known reset state.
+**
+** Notes:
+**   1. Any counter or variable that is reported in HK telemetry that doesn't
+**      change the functional behavior should be reset.
+**
+*/
+void BRIDGE_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: BRIDGE_GetTblPtr
+**
+** Return a pointer to the forwarding table currently in use.
+**
+*/
+const FWDTBL_Tbl* BRIDGE_GetTblPtr(void);
+
+
+/******************************************************************************
+** Function: BRIDGE_LoadTbl
+**
+** Replace the forwarding table and resubscribe the forward pipe.
+**
+*/
+bool BRIDGE_LoadTbl(FWDTBL_Tbl* NewTbl);
+
+
+/******************************************************************************
+** Function: BRIDGE_ForwardMsgs
+**
+** Pend on the forward pipe for up to FWD_PIPE_TIMEOUT milliseconds and copy
+** every queued message into the TX ring.
+**
+*/
+void BRIDGE_ForwardMsgs(uint32 PerfId);
+
+
+/******************************************************************************
+** Function: BRIDGE_RxChildTask
+**
+*/
+bool BRIDGE_RxChildTask(CHILDMGR_Class* ChildMgr);
+
+
+#endif /* _bridge_ */
@@ -0,0 +1,309 @@
+/*
+** Purpose: SB Bridge Forwarding Table.
+**
+** Notes:
+**   None
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "fwdtbl.h"
+
+
+#define  JSON  &(FwdTbl->Json)  /* Convenience macro */
+
+
+/*
+** Global File Data
+*/
+
+static FWDTBL_Class* FwdTbl = NULL;
+
+
+/*
+** Local File Function Prototypes
+*/
+
+/******************************************************************************
+** Function: FwdCallback
+**
+** Notes:
+**   1. This function must have the same function signature as
+**      JSON_ContainerFuncPtr.
+*/
+static bool FwdCallback (void* UserData, int TokenIdx);
+
+
+/******************************************************************************
+** Function: FWDTBL_Constructor
+**
+** Notes:
+**    1. This must be called prior to any other functions
+**
+*/
+void FWDTBL_Constructor(FWDTBL_Class*    ObjPtr,
+                        FWDTBL_GetTblPtr GetTblPtrFunc,
+                        FWDTBL_LoadTbl   LoadTblFunc)
+{
+
+   FwdTbl = ObjPtr;
+
+   CFE_PSP_MemSet(FwdTbl, 0, sizeof(FWDTBL_Class));
+   FWDTBL_SetTblToUnused(&(FwdTbl->Tbl));
+
+   FwdTbl->GetTblPtrFunc = GetTblPtrFunc;
+   FwdTbl->LoadTblFunc   = LoadTblFunc;
+
+   JSON_Constructor(JSON, FwdTbl->JsonFileBuf, FwdTbl->JsonFileTokens);
+
+   JSON_ObjConstructor(&(FwdTbl->JsonObj[FWDTBL_OBJ_FWD]),
+                       FWDTBL_OBJ_NAME_FWD,
+                       FwdCallback,
+                       (void *)&(FwdTbl->Tbl));
+
+   JSON_RegContainerCallback(JSON, &(FwdTbl->JsonObj[FWDTBL_OBJ_FWD]));
+
+} /* End FWDTBL_Constructor() */
+
+
+/******************************************************************************
+** Function: FWDTBL_SetTblToUnused
+**
+*/
+void FWDTBL_SetTblToUnused(FWDTBL_Tbl* TblPtr)
+{
+
+   uint16 i;
+
+   CFE_PSP_MemSet(TblPtr, 0, sizeof(FWDTBL_Tbl));
+
+   for (i=0; i < FWDTBL_MAX_ENTRIES; i++) {
+
+      TblPtr->Entry[i].MsgId = FWDTBL_UNUSED_MSG_ID;
+
+   }
+
+} /* End FWDTBL_SetTblToUnused() */
+
+
+/******************************************************************************
+** Function: FWDTBL_ResetStatus
+**
+*/
+void FWDTBL_ResetStatus(void)
+{
+
+   FwdTbl->LastLoadStatus = TBLMGR_STATUS_UNDEF;
+   FwdTbl->AttrErrCnt     = 0;
+
+   JSON_ObjArrayReset (FwdTbl->JsonObj, FWDTBL_OBJ_CNT);
+
+} /* End FWDTBL_ResetStatus() */
+
+
+/******************************************************************************
+** Function: FWDTBL_LoadCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+*/
+bool FWDTBL_LoadCmd(TBLMGR_Tbl *Tbl, uint8 LoadType, const char* Filename)
+{
+
+   FWDTBL_ResetStatus();
+
+   FWDTBL_SetTblToUnused(&(FwdTbl->Tbl));
+
+   if (LoadType != TBLMGR_LOAD_TBL_REPLACE) {
+
+      CFE_EVS_SendEvent(FWDTBL_LOAD_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Load forwarding table rejected. Invalid table command load type %d", LoadType);
+
+   } /* End if invalid command option */
+   else if (JSON_OpenFile(JSON, Filename)) {
+
+      JSON_ProcessTokens(JSON);
+
+      /*
+      ** No need to send an event message if there are attribute errors since
+      ** events are sent for each error. An empty table is valid JSON but it
+      ** is rejected because it silently stops all forwarding.
+      */
+      if (FwdTbl->AttrErrCnt == 0) {
+
+         if (FwdTbl->Tbl.EntryCnt > 0) {
+
+            FwdTbl->LastLoadStatus = ((FwdTbl->LoadTblFunc)(&(FwdTbl->Tbl)) == true) ? TBLMGR_STATUS_VALID : TBLMGR_STATUS_INVALID;
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(FWDTBL_LOAD_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Load forwarding table command rejected. %s didn't contain any forward definitions", Filename);
+
+         }
+
+      } /* End if no attribute errors */
+
+   } /* End if valid file */
+   else {
+
+      CFE_EVS_SendEvent(FWDTBL_LOAD_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Load forwarding table open failure for file %s. File Status = %s JSMN Status = %s",
+                        Filename, JSON_GetFileStatusStr(FwdTbl->Json.FileStatus), JSON_GetJsmnErrStr(FwdTbl->Json.JsmnStatus));
+
+   } /* End if file processing error */
+
+   return (FwdTbl->LastLoadStatus == TBLMGR_STATUS_VALID);
+
+} /* End of FWDTBL_LoadCmd() */
+
+
+/******************************************************************************
+** Function: FWDTBL_DumpCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**  3. DumpType is unused.
+**  4. File is formatted so it can be used as a load file. It does not follow
+**     the cFE table file format.
+**  5. Creates a new dump file, overwriting anything that may have existed
+**     previously
+*/
+bool FWDTBL_DumpCmd(TBLMGR_Tbl *Tbl, uint8 DumpType, const char* Filename)
+{
+
+   bool              RetStatus = false;
+   uint16            i;
+   int32             OsStatus;
+   osal_id_t         FileHandle;
+   char              DumpRecord[256];
+   const FWDTBL_Tbl* FwdTblPtr;
+   char              SysTimeStr[64];
+
+   OsStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+   if (OsStatus == OS_SUCCESS) {
+
+      FwdTblPtr = (FwdTbl->GetTblPtrFunc)();
+
+      sprintf(DumpRecord,"\n{\n\"name\": \"SB Bridge (SB_BRIDGE) Forwarding Table\",\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      CFE_TIME_Print(SysTimeStr, CFE_TIME_GetTime());
+
+      sprintf(DumpRecord,"\"description\": \"SB_BRIDGE dumped at %s\",\n",SysTimeStr);
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      sprintf(DumpRecord,"\"forward-array\": [\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      for (i=0; i < FwdTblPtr->EntryCnt; i++) {
+
+         sprintf(DumpRecord,"%s   {\"forward\": { \"dec-id\": %d, \"buf-limit\": %d }}",
+                 (i == 0) ? "" : ",\n",
+                 (int)CFE_SB_MsgIdToValue(FwdTblPtr->Entry[i].MsgId), FwdTblPtr->Entry[i].BufLim);
+         OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      }
+
+      sprintf(DumpRecord,"\n]}\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      RetStatus = true;
+
+      OS_close(FileHandle);
+
+   } /* End if file create */
+   else {
+
+      CFE_EVS_SendEvent(FWDTBL_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating dump file '%s', Status=0x%08X", Filename, OsStatus);
+
+   } /* End if file create error */
+
+   return RetStatus;
+
+} /* End of FWDTBL_DumpCmd() */
+
+
+/******************************************************************************
+** Function: FwdCallback
+**
+** Process a forwarding table entry.
+**
+** Notes:
+**   1. This must have the same function signature as JSON_ContainerFuncPtr.
+**   2. UserData is unused.
+**   3. A MsgId may only appear once because it maps to one subscription.
+*/
+static bool FwdCallback (void* UserData, int TokenIdx)
+{
+
+   int          AttributeCnt = 0;
+   int          JsonIntData;
+   uint16       i;
+   FWDTBL_Entry Entry;
+
+   FwdTbl->JsonObj[FWDTBL_OBJ_FWD].Modified = false;
+
+   Entry.MsgId  = FWDTBL_UNUSED_MSG_ID;
+   Entry.BufLim = 0;
+
+   if (JSON_GetValShortInt(JSON, TokenIdx, "dec-id",    &JsonIntData)) { AttributeCnt++; Entry.MsgId  = CFE_SB_ValueToMsgId(JsonIntData); }
+   if (JSON_GetValShortInt(JSON, TokenIdx, "buf-limit", &JsonIntData) && JsonIntData > 0) { AttributeCnt++; Entry.BufLim = (uint16)JsonIntData; }
+
+   if (AttributeCnt != 2) {
+
+      ++FwdTbl->AttrErrCnt;
+      CFE_EVS_SendEvent(FWDTBL_LOAD_ATTR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Invalid number of forward attributes %d. Should be 2.", AttributeCnt);
+      return false;
+
+   }
+
+   if (FwdTbl->Tbl.EntryCnt >= FWDTBL_MAX_ENTRIES) {
+
+      ++FwdTbl->AttrErrCnt;
+      CFE_EVS_SendEvent(FWDTBL_LOAD_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Forward entry for MsgId 0x%04X exceeds table limit of %d entries",
+                        (unsigned int)CFE_SB_MsgIdToValue(Entry.MsgId), FWDTBL_MAX_ENTRIES);
+      return false;
+
+   }
+
+   for (i=0; i < FwdTbl->Tbl.EntryCnt; i++) {
+
+      if (CFE_SB_MsgId_Equal(FwdTbl->Tbl.Entry[i].MsgId, Entry.MsgId)) {
+
+         ++FwdTbl->AttrErrCnt;
+         CFE_EVS_SendEvent(FWDTBL_LOAD_DUPLICATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Duplicate forward entry for MsgId 0x%04X",
+                           (unsigned int)CFE_SB_MsgIdToValue(Entry.MsgId));
+         return false;
+
+      }
+   }
+
+   FwdTbl->Tbl.Entry[FwdTbl->Tbl.EntryCnt++] = Entry;
+   FwdTbl->JsonObj[FWDTBL_OBJ_FWD].Modified = true;
+
+   return FwdTbl->JsonObj[FWDTBL_OBJ_FWD].Modified;
+
+} /* FwdCallback() */
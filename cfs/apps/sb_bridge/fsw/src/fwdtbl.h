@@ -0,0 +1,181 @@
+/*
+** Purpose: SB Bridge Forwarding Table
+**
+** Notes:
+**   1. Use the Singleton design pattern. A pointer to the table object
+**      is passed to the constructor and saved for all other operations.
+**      This is a table-specific file so it doesn't need to be re-entrant.
+**   2. The table file is a JSON text file. Each entry is a MsgId that is
+**      forwarded from the local SB to the peer instance. Messages received
+**      from the peer are always injected into the local SB so each instance
+**      owns the list of MsgIds it exports.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+#ifndef _fwdtbl_
+#define _fwdtbl_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "json.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define FWDTBL_UNUSED_MSG_ID (CFE_SB_INVALID_MSG_ID)
+
+/*
+** Event Message IDs
+*/
+
+#define FWDTBL_CREATE_FILE_ERR_EID    (FWDTBL_BASE_EID + 0)
+#define FWDTBL_LOAD_TYPE_ERR_EID      (FWDTBL_BASE_EID + 1)
+#define FWDTBL_LOAD_EMPTY_ERR_EID     (FWDTBL_BASE_EID + 2)
+#define FWDTBL_LOAD_OPEN_ERR_EID      (FWDTBL_BASE_EID + 3)
+#define FWDTBL_LOAD_ATTR_ERR_EID      (FWDTBL_BASE_EID + 4)
+#define FWDTBL_LOAD_FULL_ERR_EID      (FWDTBL_BASE_EID + 5)
+#define FWDTBL_LOAD_DUPLICATE_ERR_EID (FWDTBL_BASE_EID + 6)
+
+/*
+** Table Structure Objects
+*/
+
+#define  FWDTBL_OBJ_FWD       0
+#define  FWDTBL_OBJ_CNT       1
+
+#define  FWDTBL_OBJ_NAME_FWD  "forward"
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Table -  Local table copy used for table loads
+**
+*/
+
+typedef struct {
+
+   CFE_SB_MsgId_t   MsgId;
+   uint16           BufLim;
+
+} FWDTBL_Entry;
+
+
+typedef struct {
+
+   uint16        EntryCnt;
+   FWDTBL_Entry  Entry[FWDTBL_MAX_ENTRIES];
+
+} FWDTBL_Tbl;
+
+
+/*
+** Table Owner Callback Functions
+*/
+
+/* Return pointer to owner's table data */
+typedef const FWDTBL_Tbl* (*FWDTBL_GetTblPtr)(void);
+
+/* Table Owner's function to load all table data */
+typedef bool    (*FWDTBL_LoadTbl)(FWDTBL_Tbl* NewTbl);
+
+
+typedef struct {
+
+   uint8    LastLoadStatus;
+   uint16   AttrErrCnt;
+
+   FWDTBL_Tbl Tbl;
+
+   FWDTBL_GetTblPtr    GetTblPtrFunc;
+   FWDTBL_LoadTbl      LoadTblFunc;
+
+   JSON_Class Json;
+   JSON_Obj   JsonObj[FWDTBL_OBJ_CNT];
+   char       JsonFileBuf[JSON_MAX_FILE_CHAR];
+   jsmntok_t  JsonFileTokens[JSON_MAX_FILE_TOKENS];
+
+} FWDTBL_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: FWDTBL_Constructor
+**
+** Initialize the Forwarding Table object.
+**
+** Notes:
+**   1. The table values are not populated. This is done when the table is
+**      registered with the table manager.
+*/
+void FWDTBL_Constructor(FWDTBL_Class*    ObjPtr,
+                        FWDTBL_GetTblPtr GetTblPtrFunc,
+                        FWDTBL_LoadTbl   LoadTblFunc);
+
+
+/******************************************************************************
+** Function: FWDTBL_SetTblToUnused
+**
+*/
+void FWDTBL_SetTblToUnused(FWDTBL_Tbl* TblPtr);
+
+
+/******************************************************************************
+** Function: FWDTBL_ResetStatus
+**
+** Reset counters and status flags to a known reset state.  The behavior of
+** the table manager should not be impacted. The intent is to clear counters
+** and flags to a known default state for telemetry.
+**
+*/
+void FWDTBL_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: FWDTBL_LoadCmd
+**
+** Command to load the table.
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager.
+**  3. Only TBLMGR_LOAD_TBL_REPLACE is supported because the bridge
+**     resubscribes its forward pipe for every load.
+**
+*/
+bool FWDTBL_LoadCmd(TBLMGR_Tbl *Tbl, uint8 LoadType, const char* Filename);
+
+
+/******************************************************************************
+** Function: FWDTBL_DumpCmd
+**
+** Command to dump the table.
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager.
+**
+*/
+bool FWDTBL_DumpCmd(TBLMGR_Tbl *Tbl, uint8 DumpType, const char* Filename);
+
+#endif /* _fwdtbl_ */
@@ -0,0 +1,325 @@
+/*
+** Purpose: Implement the SB Bridge application
+**
+** Notes:
+**   1. See header notes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Includes
+*/
+
+#include <string.h>
+#include "sb_bridge_app.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/* Convenience macros */
+#define  INITBL_OBJ    (&(SbBridge.IniTbl))
+#define  CMDMGR_OBJ    (&(SbBridge.CmdMgr))
+#define  TBLMGR_OBJ    (&(SbBridge.TblMgr))
+#define  CHILDMGR_OBJ  (&(SbBridge.ChildMgr))
+#define  FWDTBL_OBJ    (&(SbBridge.FwdTbl))
+#define  BRIDGE_OBJ    (&(SbBridge.Bridge))
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static int32 InitApp(void);
+static int32 ProcessCommands(void);
+
+
+/**********************/
+/** File Global Data **/
+/**********************/
+
+/*
+** Must match DECLARE ENUM() declaration in app_cfg.h
+** Defines "static INILIB_CfgEnum IniCfgEnum"
+*/
+DEFINE_ENUM(Config,APP_CONFIG)
+
+
+/*****************/
+/** Global Data **/
+/*****************/
+
+SB_BRIDGE_Class  SbBridge;
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_AppMain
+**
+*/
+void SB_BRIDGE_AppMain(void)
+{
+
+   uint32 RunStatus = CFE_ES_RunStatus_APP_ERROR;
+
+
+   CFE_EVS_Register(NULL, 0, CFE_EVS_NO_FILTER);
+
+   if (InitApp() == CFE_SUCCESS) {  /* Performs initial CFE_ES_PerfLogEntry() call */
+
+      RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+   }
+
+   /*
+   ** Main process loop
+   */
+   while (CFE_ES_RunLoop(&RunStatus)) {
+
+      BRIDGE_ForwardMsgs(SbBridge.PerfId);  /* Pends up to FWD_PIPE_TIMEOUT & manages CFE_ES_PerfLogEntry() calls */
+
+      RunStatus = ProcessCommands();
+
+   } /* End CFE_ES_RunLoop */
+
+   CFE_ES_WriteToSysLog("SB_BRIDGE App terminating, err = 0x%08X\n", RunStatus);   /* Use SysLog, events may not be working */
+
+   CFE_EVS_SendEvent(SB_BRIDGE_EXIT_EID, CFE_EVS_EventType_CRITICAL, "SB_BRIDGE App terminating, err = 0x%08X", RunStatus);
+
+   CFE_ES_ExitApp(RunStatus);  /* Let cFE kill the task (and any child tasks) */
+
+} /* End of SB_BRIDGE_AppMain() */
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_NoOpCmd
+**
+*/
+
+bool SB_BRIDGE_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CFE_EVS_SendEvent (SB_BRIDGE_NOOP_EID, CFE_EVS_EventType_INFORMATION,
+                      "No operation command received for SB_BRIDGE App version %d.%d.%d",
+                      SB_BRIDGE_MAJOR_VER, SB_BRIDGE_MINOR_VER, SB_BRIDGE_PLATFORM_REV);
+
+   return true;
+
+
+} /* End SB_BRIDGE_NoOpCmd() */
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_ResetAppCmd
+**
+** Notes:
+**   1. No need to pass an object reference to contained objects becuase they
+**      already have a reference from when they were constructed
+**
+*/
+
+bool SB_BRIDGE_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CMDMGR_ResetStatus(CMDMGR_OBJ);
+   TBLMGR_ResetStatus(TBLMGR_OBJ);
+   CHILDMGR_ResetStatus(CHILDMGR_OBJ);
+
+   BRIDGE_ResetStatus();
+
+   return true;
+
+} /* End SB_BRIDGE_ResetAppCmd() */
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_SendHousekeepingPkt
+**
+*/
+void SB_BRIDGE_SendHousekeepingPkt(void)
+{
+
+   SbBridge.HkPkt.ValidCmdCnt   = SbBridge.CmdMgr.ValidCmdCnt;
+   SbBridge.HkPkt.InvalidCmdCnt = SbBridge.CmdMgr.InvalidCmdCnt;
+
+   /*
+   ** Forwarding Table
+   */
+
+   SbBridge.HkPkt.FwdTblLastLoadStatus = SbBridge.FwdTbl.LastLoadStatus;
+   SbBridge.HkPkt.FwdTblEntryCnt       = (uint8)SbBridge.Bridge.Tbl.EntryCnt;
+   SbBridge.HkPkt.FwdTblAttrErrCnt     = SbBridge.FwdTbl.AttrErrCnt;
+
+   /*
+   ** Bridge
+   */
+
+   SbBridge.HkPkt.ShmMapped     = SbBridge.Bridge.ShmRing.IsMapped;
+   SbBridge.HkPkt.InstanceId    = SbBridge.Bridge.InstanceId;
+   SbBridge.HkPkt.TxRing        = SbBridge.Bridge.ShmRing.TxRing;
+
+   SbBridge.HkPkt.TxPktCnt      = SbBridge.Bridge.TxPktCnt;
+   SbBridge.HkPkt.TxDropCnt     = SbBridge.Bridge.TxDropCnt;
+   SbBridge.HkPkt.TxRingFill    = SHMRING_GetTxFill(&SbBridge.Bridge.ShmRing);
+   SbBridge.HkPkt.RxPktCnt      = SbBridge.Bridge.RxPktCnt;
+   SbBridge.HkPkt.RxLoopDropCnt = SbBridge.Bridge.RxLoopDropCnt;
+   SbBridge.HkPkt.RxErrCnt      = SbBridge.Bridge.RxErrCnt;
+
+   CFE_SB_TimeStampMsg(&(SbBridge.HkPkt.TlmHeader.Msg));
+   CFE_SB_TransmitMsg(&(SbBridge.HkPkt.TlmHeader.Msg), true);
+
+} /* End SB_BRIDGE_SendHousekeepingPkt() */
+
+
+/******************************************************************************
+** Function: InitApp
+**
+** Notes:
+**   1. The bridge is constructed before the child task is started because
+**      the child task immediately starts draining the RX ring.
+**
+*/
+static int32 InitApp(void)
+{
+
+   int32 Status = OSK_C_FW_CFS_ERROR;
+
+   CHILDMGR_TaskInit ChildTaskInit;
+
+   /*
+   ** Initialize objects
+   */
+
+   if (INITBL_Constructor(&SbBridge.IniTbl, SB_BRIDGE_INI_FILENAME, &IniCfgEnum)) {
+
+      SbBridge.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_APP_PERF_ID);
+      SbBridge.CmdMid    = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_MID);
+      SbBridge.SendHkMid = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_SEND_HK_MID);
+      CFE_ES_PerfLogEntry(SbBridge.PerfId);
+
+      BRIDGE_Constructor(BRIDGE_OBJ, INITBL_OBJ);
+
+      /* Constructor sends error events */
+      ChildTaskInit.TaskName  = INITBL_GetStrConfig(INITBL_OBJ, CFG_CHILD_NAME);
+      ChildTaskInit.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PERF_ID);
+      ChildTaskInit.StackSize = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_STACK_SIZE);
+      ChildTaskInit.Priority  = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PRIORITY);
+      Status = CHILDMGR_Constructor(CHILDMGR_OBJ,
+                                    ChildMgr_TaskMainCallback,
+                                    BRIDGE_RxChildTask,
+                                    &ChildTaskInit);
+
+   } /* End if INITBL Constructed */
+
+   if (Status == CFE_SUCCESS) {
+
+      /*
+      ** Initialize app level interfaces
+      */
+
+      CFE_SB_CreatePipe(&SbBridge.CmdPipe, INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_PIPE_DEPTH), INITBL_GetStrConfig(INITBL_OBJ, CFG_CMD_PIPE_NAME));
+      CFE_SB_Subscribe(SbBridge.CmdMid,    SbBridge.CmdPipe);
+      CFE_SB_Subscribe(SbBridge.SendHkMid, SbBridge.CmdPipe);
+
+      CMDMGR_Constructor(CMDMGR_OBJ);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_NOOP_CMD_FC,   NULL, SB_BRIDGE_NoOpCmd,     0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_RESET_CMD_FC,  NULL, SB_BRIDGE_ResetAppCmd, 0);
+
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_BRIDGE_FWD_TBL_LOAD_CMD_FC, TBLMGR_OBJ, TBLMGR_LoadTblCmd, TBLMGR_LOAD_TBL_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_BRIDGE_FWD_TBL_DUMP_CMD_FC, TBLMGR_OBJ, TBLMGR_DumpTblCmd, TBLMGR_DUMP_TBL_CMD_DATA_LEN);
+
+      FWDTBL_Constructor(FWDTBL_OBJ, BRIDGE_GetTblPtr, BRIDGE_LoadTbl);
+
+      TBLMGR_Constructor(TBLMGR_OBJ);
+      TBLMGR_RegisterTblWithDef(TBLMGR_OBJ, FWDTBL_LoadCmd, FWDTBL_DumpCmd, INITBL_GetStrConfig(INITBL_OBJ, CFG_FWD_TBL_FILENAME));
+
+      CFE_MSG_Init(&SbBridge.HkPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_HK_TLM_MID), SB_BRIDGE_TLM_HK_LEN);
+
+      /*
+      ** Application startup event message
+      */
+      CFE_EVS_SendEvent(SB_BRIDGE_INIT_APP_EID, CFE_EVS_EventType_INFORMATION,
+                        "SB_BRIDGE App Initialized. Version %d.%d.%d",
+                        SB_BRIDGE_MAJOR_VER, SB_BRIDGE_MINOR_VER, SB_BRIDGE_PLATFORM_REV);
+
+   } /* End if CHILDMGR constructed */
+
+   return(Status);
+
+} /* End of InitApp() */
+
+
+/******************************************************************************
+** Function: ProcessCommands
+**
+** Notes:
+**   1. Polls the command pipe until it is empty. The forward pipe pend in
+**      the main loop sets the command processing rate.
+**
+*/
+static int32 ProcessCommands(void)
+{
+
+   int32  RetStatus = CFE_ES_RunStatus_APP_RUN;
+   int32  SysStatus;
+   int32  MsgStatus;
+   int32  MsgInt;
+
+   CFE_SB_Buffer_t* SbBufPtr;
+   CFE_SB_MsgId_t   MsgId = CFE_SB_INVALID_MSG_ID;
+
+
+   SysStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, SbBridge.CmdPipe, CFE_SB_POLL);
+
+   while (SysStatus == CFE_SUCCESS) {
+
+      MsgStatus = CFE_MSG_GetMsgId(&SbBufPtr->Msg, &MsgId);
+
+      if (MsgStatus == CFE_SUCCESS) {
+
+         MsgInt = CFE_SB_MsgIdToValue(MsgId);
+
+         if (MsgInt == SbBridge.CmdMid) {
+
+            CMDMGR_DispatchFunc(CMDMGR_OBJ, SbBufPtr);
+
+         }
+         else if (MsgInt == SbBridge.SendHkMid) {
+
+            SB_BRIDGE_SendHousekeepingPkt();
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(SB_BRIDGE_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                              "Received invalid command packet, MID = 0x%08X", MsgInt);
+         }
+
+      }
+      else {
+
+         CFE_EVS_SendEvent(SB_BRIDGE_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                           "CFE couldn't retrieve message ID from the message, Status = %d", MsgStatus);
+      }
+
+      SysStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, SbBridge.CmdPipe, CFE_SB_POLL);
+
+   } /* End while command messages */
+
+   if (SysStatus != CFE_SB_NO_MESSAGE) {
+
+      CFE_ES_WriteToSysLog("SB_BRIDGE software bus error. Status = 0x%08X\n", SysStatus);   /* Use SysLog, events may not be working */
+      RetStatus = CFE_ES_RunStatus_APP_ERROR;
+
+   }
+
+   return RetStatus;
+
+} /* ProcessCommands() */
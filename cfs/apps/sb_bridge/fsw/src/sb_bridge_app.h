@@ -0,0 +1,175 @@
+/*
+** Purpose: Define the SB Bridge application
+**
+** Notes:
+**   1. Forwards software bus messages between cFS instances on the same host
+**      through a POSIX shared memory region. See bridge.h for the data flow
+**      and loop prevention.
+**   2. The main loop pends on the forward pipe so forwarding latency isn't
+**      tied to the command rate. The command pipe is polled after each
+**      forward pipe wake up or timeout.
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+*/
+#ifndef _sb_bridge_app_
+#define _sb_bridge_app_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "childmgr.h"
+#include "initbl.h"
+#include "bridge.h"
+#include "fwdtbl.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/*
+** Events
+*/
+
+#define SB_BRIDGE_INIT_APP_EID    (SB_BRIDGE_BASE_EID + 0)
+#define SB_BRIDGE_NOOP_EID        (SB_BRIDGE_BASE_EID + 1)
+#define SB_BRIDGE_EXIT_EID        (SB_BRIDGE_BASE_EID + 2)
+#define SB_BRIDGE_INVALID_MID_EID (SB_BRIDGE_BASE_EID + 3)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+
+/******************************************************************************
+** Telemetry Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_TelemetryHeader_t TlmHeader;
+
+   /*
+   ** Framework Status
+   */
+
+   uint16   ValidCmdCnt;
+   uint16   InvalidCmdCnt;
+
+   /*
+   ** Forwarding Table
+   */
+
+   uint8    FwdTblLastLoadStatus;
+   uint8    FwdTblEntryCnt;
+   uint16   FwdTblAttrErrCnt;
+
+   /*
+   ** Bridge
+   */
+
+   uint8    ShmMapped;
+   uint8    InstanceId;
+   uint8    TxRing;
+   uint8    BridgeSpare;
+
+   uint32   TxPktCnt;
+   uint32   TxDropCnt;
+   uint32   TxRingFill;      /* Bytes queued for the peer */
+   uint32   RxPktCnt;
+   uint32   RxLoopDropCnt;
+   uint32   RxErrCnt;
+
+} SB_BRIDGE_HkPkt;
+#define SB_BRIDGE_TLM_HK_LEN sizeof (SB_BRIDGE_HkPkt)
+
+
+/******************************************************************************
+** SB_BRIDGE_Class
+*/
+typedef struct {
+
+   /*
+   ** App Framework
+   */
+
+   INITBL_Class    IniTbl;
+   CFE_SB_PipeId_t CmdPipe;
+   CMDMGR_Class    CmdMgr;
+   TBLMGR_Class    TblMgr;
+   CHILDMGR_Class  ChildMgr;
+
+   /*
+   ** Telemetry Packets
+   */
+
+   SB_BRIDGE_HkPkt  HkPkt;
+
+   /*
+   ** App State & Objects
+   */
+
+   uint32           PerfId;
+   CFE_SB_MsgId_t   CmdMid;
+   CFE_SB_MsgId_t   SendHkMid;
+
+   FWDTBL_Class     FwdTbl;
+   BRIDGE_Class     Bridge;
+
+} SB_BRIDGE_Class;
+
+
+/*******************/
+/** Exported Data **/
+/*******************/
+
+extern SB_BRIDGE_Class  SbBridge;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_AppMain
+**
+*/
+void SB_BRIDGE_AppMain(void);
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_NoOpCmd
+**
+*/
+bool SB_BRIDGE_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_ResetAppCmd
+**
+*/
+bool SB_BRIDGE_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_BRIDGE_SendHousekeepingPkt
+**
+*/
+void SB_BRIDGE_SendHousekeepingPkt(void);
+
+
+#endif /* _sb_bridge_app_ */
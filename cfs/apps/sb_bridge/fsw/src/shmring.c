@@ -0,0 +1,316 @@
+/*
+** Purpose: Implement the shared memory ring class
+**
+** Notes:
+**   1. See header notes for the region layout.
+**   2. The GCC __atomic builtins provide the acquire/release ordering. They
+**      are lock-free for 32-bit operands on every target this app is built
+**      for, which is required because the indices are shared between
+**      processes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "shmring.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define FRAME_BYTES(MsgLen)  (((uint32)sizeof(SHMRING_FrameHdr) + (MsgLen) + (SHMRING_FRAME_ALIGN-1)) & ~(uint32)(SHMRING_FRAME_ALIGN-1))
+
+
+/******************************************************************************
+** Function: SHMRING_Constructor
+**
+*/
+bool SHMRING_Constructor(SHMRING_Class* ShmRingPtr, const char* ShmName,
+                         uint32 RingBytes, uint8 TxRing)
+{
+
+   bool         RetStatus = false;
+   uint32       Expected  = 0;
+   uint8        Ring;
+   struct stat  ShmStat;
+   void*        MapAddr;
+
+
+   CFE_PSP_MemSet(ShmRingPtr, 0, sizeof(SHMRING_Class));
+   ShmRingPtr->Fd = -1;
+
+   if ((RingBytes < 4*CFE_MISSION_SB_MAX_SB_MSG_SIZE) || ((RingBytes & (RingBytes-1)) != 0) || (TxRing >= SHMRING_CNT)) {
+
+      CFE_EVS_SendEvent(SHMRING_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Invalid bridge ring configuration: %u bytes must be a power of 2 >= %u and TX ring %d must be less than %d",
+                        RingBytes, 4*CFE_MISSION_SB_MAX_SB_MSG_SIZE, TxRing, SHMRING_CNT);
+      return RetStatus;
+
+   }
+
+   ShmRingPtr->TxRing      = TxRing;
+   ShmRingPtr->RxRing      = (TxRing + 1) % SHMRING_CNT;
+   ShmRingPtr->RingBytes   = RingBytes;
+   ShmRingPtr->RingMask    = RingBytes - 1;
+   ShmRingPtr->RegionBytes = sizeof(SHMRING_Region) + SHMRING_CNT*(size_t)RingBytes;
+
+   ShmRingPtr->Fd = shm_open(ShmName, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+
+   if (ShmRingPtr->Fd < 0) {
+
+      CFE_EVS_SendEvent(SHMRING_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error opening bridge shared memory %s, errno %d", ShmName, errno);
+      return RetStatus;
+
+   }
+
+   /* The first instance to get here sizes the region; the kernel zero fills it */
+   if (fstat(ShmRingPtr->Fd, &ShmStat) == 0 && ShmStat.st_size == 0) {
+
+      if (ftruncate(ShmRingPtr->Fd, (off_t)ShmRingPtr->RegionBytes) == 0) {
+         fstat(ShmRingPtr->Fd, &ShmStat);
+      }
+
+   }
+
+   if (ShmStat.st_size != (off_t)ShmRingPtr->RegionBytes) {
+
+      CFE_EVS_SendEvent(SHMRING_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Bridge shared memory %s is %ld bytes, expected %lu. Check SHM_RING_BYTES in both instances",
+                        ShmName, (long)ShmStat.st_size, (unsigned long)ShmRingPtr->RegionBytes);
+      SHMRING_Destructor(ShmRingPtr);
+      return RetStatus;
+
+   }
+
+   MapAddr = mmap(NULL, ShmRingPtr->RegionBytes, PROT_READ | PROT_WRITE, MAP_SHARED, ShmRingPtr->Fd, 0);
+
+   if (MapAddr == MAP_FAILED) {
+
+      CFE_EVS_SendEvent(SHMRING_MAP_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error mapping bridge shared memory %s, errno %d", ShmName, errno);
+      SHMRING_Destructor(ShmRingPtr);
+      return RetStatus;
+
+   }
+
+   ShmRingPtr->Region   = (SHMRING_Region*)MapAddr;
+   ShmRingPtr->IsMapped = true;
+
+   for (Ring=0; Ring < SHMRING_CNT; Ring++) {
+      ShmRingPtr->RingData[Ring] = (uint8*)MapAddr + sizeof(SHMRING_Region) + Ring*(size_t)RingBytes;
+   }
+
+   if (__atomic_compare_exchange_n(&ShmRingPtr->Region->Magic, &Expected, SHMRING_MAGIC,
+                                   false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+
+      ShmRingPtr->Region->RingBytes = RingBytes;
+
+   }
+   else if (Expected != SHMRING_MAGIC) {
+
+      CFE_EVS_SendEvent(SHMRING_MAGIC_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Bridge shared memory %s has invalid magic 0x%08X, it is not a bridge region",
+                        ShmName, Expected);
+      SHMRING_Destructor(ShmRingPtr);
+      return RetStatus;
+
+   }
+
+   RetStatus = true;
+
+   CFE_EVS_SendEvent(SHMRING_CONSTRUCTOR_EID, CFE_EVS_EventType_INFORMATION,
+                     "Mapped bridge shared memory %s: %u byte rings, TX ring %d, RX ring %d",
+                     ShmName, RingBytes, ShmRingPtr->TxRing, ShmRingPtr->RxRing);
+
+   return RetStatus;
+
+} /* End SHMRING_Constructor() */
+
+
+/******************************************************************************
+** Function: SHMRING_Destructor
+**
+*/
+void SHMRING_Destructor(SHMRING_Class* ShmRingPtr)
+{
+
+   if (ShmRingPtr->IsMapped) {
+
+      munmap(ShmRingPtr->Region, ShmRingPtr->RegionBytes);
+      ShmRingPtr->Region   = NULL;
+      ShmRingPtr->IsMapped = false;
+
+   }
+
+   if (ShmRingPtr->Fd >= 0) {
+
+      close(ShmRingPtr->Fd);
+      ShmRingPtr->Fd = -1;
+
+   }
+
+} /* End SHMRING_Destructor() */
+
+
+/******************************************************************************
+** Function: SHMRING_Write
+**
+** Notes:
+**   1. The Tail acquire load pairs with the consumer's release store so the
+**      consumer is done with the space before it is overwritten. The Head
+**      release store publishes the frame contents to the consumer.
+**
+*/
+bool SHMRING_Write(SHMRING_Class* ShmRingPtr, uint8 Origin, const void* MsgPtr, uint32 MsgLen)
+{
+
+   SHMRING_Ctrl*     Ctrl;
+   SHMRING_FrameHdr* FrameHdr;
+   uint8*            RingData;
+   uint32            Head;
+   uint32            Tail;
+   uint32            Offset;
+   uint32            Contig;
+   uint32            FrameBytes;
+   uint32            NeedBytes;
+
+
+   if (!ShmRingPtr->IsMapped) return false;
+
+   Ctrl     = &ShmRingPtr->Region->Ctrl[ShmRingPtr->TxRing];
+   RingData = ShmRingPtr->RingData[ShmRingPtr->TxRing];
+
+   FrameBytes = FRAME_BYTES(MsgLen);
+   Head       = __atomic_load_n(&Ctrl->Head, __ATOMIC_RELAXED);
+   Tail       = __atomic_load_n(&Ctrl->Tail, __ATOMIC_ACQUIRE);
+   Offset     = Head & ShmRingPtr->RingMask;
+   Contig     = ShmRingPtr->RingBytes - Offset;
+
+   NeedBytes = (Contig < FrameBytes) ? (FrameBytes + Contig) : FrameBytes;
+
+   if ((ShmRingPtr->RingBytes - (Head - Tail)) < NeedBytes) return false;
+
+   if (Contig < FrameBytes) {
+
+      FrameHdr = (SHMRING_FrameHdr*)&RingData[Offset];
+      FrameHdr->Len = SHMRING_WRAP_MARKER;
+      Head  += Contig;
+      Offset = 0;
+
+   }
+
+   FrameHdr = (SHMRING_FrameHdr*)&RingData[Offset];
+   FrameHdr->Len    = MsgLen;
+   FrameHdr->Origin = Origin;
+   memcpy(&FrameHdr[1], MsgPtr, MsgLen);
+
+   __atomic_store_n(&Ctrl->Head, Head + FrameBytes, __ATOMIC_RELEASE);
+
+   return true;
+
+} /* End SHMRING_Write() */
+
+
+/******************************************************************************
+** Function: SHMRING_Peek
+**
+*/
+const SHMRING_FrameHdr* SHMRING_Peek(SHMRING_Class* ShmRingPtr)
+{
+
+   SHMRING_Ctrl*     Ctrl;
+   SHMRING_FrameHdr* FrameHdr;
+   uint32            Head;
+   uint32            Tail;
+   uint32            Offset;
+
+
+   if (!ShmRingPtr->IsMapped) return NULL;
+
+   Ctrl = &ShmRingPtr->Region->Ctrl[ShmRingPtr->RxRing];
+   Tail = __atomic_load_n(&Ctrl->Tail, __ATOMIC_RELAXED);
+   Head = __atomic_load_n(&Ctrl->Head, __ATOMIC_ACQUIRE);
+
+   if (Head == Tail) return NULL;
+
+   Offset   = Tail & ShmRingPtr->RingMask;
+   FrameHdr = (SHMRING_FrameHdr*)&ShmRingPtr->RingData[ShmRingPtr->RxRing][Offset];
+
+   if (FrameHdr->Len == SHMRING_WRAP_MARKER) {
+
+      /* The producer always writes a frame after a wrap marker so the ring can't be empty */
+      Tail += ShmRingPtr->RingBytes - Offset;
+      __atomic_store_n(&Ctrl->Tail, Tail, __ATOMIC_RELEASE);
+
+      FrameHdr = (SHMRING_FrameHdr*)ShmRingPtr->RingData[ShmRingPtr->RxRing];
+
+   }
+
+   return FrameHdr;
+
+} /* End SHMRING_Peek() */
+
+
+/******************************************************************************
+** Function: SHMRING_Release
+**
+*/
+void SHMRING_Release(SHMRING_Class* ShmRingPtr, const SHMRING_FrameHdr* FrameHdr)
+{
+
+   SHMRING_Ctrl* Ctrl = &ShmRingPtr->Region->Ctrl[ShmRingPtr->RxRing];
+   uint32        Tail = __atomic_load_n(&Ctrl->Tail, __ATOMIC_RELAXED);
+
+   __atomic_store_n(&Ctrl->Tail, Tail + FRAME_BYTES(FrameHdr->Len), __ATOMIC_RELEASE);
+
+} /* End SHMRING_Release() */
+
+
+/******************************************************************************
+** Function: SHMRING_Flush
+**
+*/
+void SHMRING_Flush(SHMRING_Class* ShmRingPtr)
+{
+
+   SHMRING_Ctrl* Ctrl = &ShmRingPtr->Region->Ctrl[ShmRingPtr->RxRing];
+
+   __atomic_store_n(&Ctrl->Tail, __atomic_load_n(&Ctrl->Head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+
+} /* End SHMRING_Flush() */
+
+
+/******************************************************************************
+** Function: SHMRING_GetTxFill
+**
+*/
+uint32 SHMRING_GetTxFill(const SHMRING_Class* ShmRingPtr)
+{
+
+   const SHMRING_Ctrl* Ctrl;
+
+   if (!ShmRingPtr->IsMapped) return 0;
+
+   Ctrl = &ShmRingPtr->Region->Ctrl[ShmRingPtr->TxRing];
+
+   return __atomic_load_n(&Ctrl->Head, __ATOMIC_RELAXED) - __atomic_load_n(&Ctrl->Tail, __ATOMIC_ACQUIRE);
+
+} /* End SHMRING_GetTxFill() */
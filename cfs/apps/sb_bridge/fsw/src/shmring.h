@@ -0,0 +1,210 @@
+/*
+** Purpose: Define the shared memory ring class
+**
+** Notes:
+**   1. A bridge region is a POSIX shared memory object holding two single
+**      producer/single consumer rings, one per direction. Each cFS instance
+**      writes to its TX ring and reads from the other one so the only
+**      synchronization is the acquire/release ordering of the Head and Tail
+**      indices; no locks are shared between processes.
+**   2. Both instances map the region with O_CREAT. A freshly sized region is
+**      zero filled which is a valid empty ring, so there is no creator/user
+**      ordering requirement. The ring size must match in both ini files and
+**      is verified against the region size when it is mapped.
+**   3. Frames are an SHMRING_FrameHdr followed by the raw SB message, padded
+**      to SHMRING_FRAME_ALIGN. A frame never straddles the end of the ring;
+**      the producer writes a wrap marker and restarts at offset 0 instead.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _shmring_
+#define _shmring_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define SHMRING_MAGIC        0x53425247   /* "SBRG" */
+#define SHMRING_CNT          2
+#define SHMRING_FRAME_ALIGN  8
+#define SHMRING_WRAP_MARKER  0xFFFFFFFF   /* FrameHdr.Len value that sends the reader back to offset 0 */
+#define SHMRING_CACHE_LINE   64
+
+/*
+** Event Message IDs
+*/
+
+#define SHMRING_CONSTRUCTOR_EID  (SHMRING_BASE_EID + 0)
+#define SHMRING_OPEN_ERR_EID     (SHMRING_BASE_EID + 1)
+#define SHMRING_SIZE_ERR_EID     (SHMRING_BASE_EID + 2)
+#define SHMRING_MAP_ERR_EID      (SHMRING_BASE_EID + 3)
+#define SHMRING_MAGIC_ERR_EID    (SHMRING_BASE_EID + 4)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Shared memory layout
+**
+** Head and Tail are free running byte counters, masked with the ring size to
+** get an offset. Each one lives on its own cache line because they are
+** written by different processes.
+*/
+
+typedef struct {
+
+   uint32  Len;      /* SB message length in bytes or SHMRING_WRAP_MARKER */
+   uint8   Origin;   /* Instance ID of the bridge that wrote the frame    */
+   uint8   Spare[3];
+
+} SHMRING_FrameHdr;
+
+
+typedef struct {
+
+   volatile uint32 Head;   /* Only written by the producer */
+   uint8           HeadPad[SHMRING_CACHE_LINE - sizeof(uint32)];
+   volatile uint32 Tail;   /* Only written by the consumer */
+   uint8           TailPad[SHMRING_CACHE_LINE - sizeof(uint32)];
+
+} SHMRING_Ctrl;
+
+
+typedef struct {
+
+   volatile uint32 Magic;
+   uint32          RingBytes;
+   uint8           Pad[SHMRING_CACHE_LINE - 2*sizeof(uint32)];
+
+   SHMRING_Ctrl    Ctrl[SHMRING_CNT];
+
+   /* SHMRING_CNT rings of RingBytes each follow the header */
+
+} SHMRING_Region;
+
+
+/******************************************************************************
+** SHMRING_Class
+*/
+
+typedef struct {
+
+   bool             IsMapped;
+   uint8            TxRing;
+   uint8            RxRing;
+   int              Fd;
+   uint32           RingBytes;
+   uint32           RingMask;
+   size_t           RegionBytes;
+
+   SHMRING_Region*  Region;
+   uint8*           RingData[SHMRING_CNT];
+
+} SHMRING_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: SHMRING_Constructor
+**
+** Open (creating if needed) and map the named bridge region.
+**
+** Notes:
+**   1. RingBytes must be a power of 2 and at least 4 maximum size SB
+**      messages so a maximum size frame always fits after a wrap.
+**   2. TxRing selects which of the two rings this instance writes. The peer
+**      instance must use the other ring.
+**   3. Returns false and sends an error event if the region can't be mapped.
+**
+*/
+bool SHMRING_Constructor(SHMRING_Class* ShmRingPtr, const char* ShmName,
+                         uint32 RingBytes, uint8 TxRing);
+
+
+/******************************************************************************
+** Function: SHMRING_Destructor
+**
+** Unmap the region. The shared memory object is not unlinked because the
+** peer instance may still be using it.
+**
+*/
+void SHMRING_Destructor(SHMRING_Class* ShmRingPtr);
+
+
+/******************************************************************************
+** Function: SHMRING_Write
+**
+** Copy a message into the TX ring.
+**
+** Notes:
+**   1. Only one task per instance may call this function.
+**   2. Returns false without writing anything if the ring doesn't have room
+**      for the frame.
+**
+*/
+bool SHMRING_Write(SHMRING_Class* ShmRingPtr, uint8 Origin, const void* MsgPtr, uint32 MsgLen);
+
+
+/******************************************************************************
+** Function: SHMRING_Peek
+**
+** Return a pointer to the oldest unread RX frame or NULL if the ring is empty.
+**
+** Notes:
+**   1. Only one task per instance may call this function.
+**   2. The frame stays valid until SHMRING_Release() is called. The message
+**      data immediately follows the returned frame header.
+**
+*/
+const SHMRING_FrameHdr* SHMRING_Peek(SHMRING_Class* ShmRingPtr);
+
+
+/******************************************************************************
+** Function: SHMRING_Release
+**
+** Return the frame returned by the previous SHMRING_Peek() to the producer.
+**
+*/
+void SHMRING_Release(SHMRING_Class* ShmRingPtr, const SHMRING_FrameHdr* FrameHdr);
+
+
+/******************************************************************************
+** Function: SHMRING_Flush
+**
+** Discard every unread RX frame. Used to resynchronize after a corrupt frame.
+**
+*/
+void SHMRING_Flush(SHMRING_Class* ShmRingPtr);
+
+
+/******************************************************************************
+** Function: SHMRING_GetTxFill
+**
+** Return the number of bytes currently queued in the TX ring.
+**
+*/
+uint32 SHMRING_GetTxFill(const SHMRING_Class* ShmRingPtr);
+
+
+#endif /* _shmring_ */
@@ -0,0 +1,37 @@
+/*
+** Purpose: Define platform configurations for the SB Recorder application
+**
+** Notes:
+**   1. Segment sizes, the segment directory and the number of segments kept
+**      on the file system are defined in the ini file so they can be tuned
+**      to the storage device without rebuilding the app.
+**
+** License:
+**   Written by David McComas and licensed under the GNU
+**   Lesser General Public License (LGPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+
+#ifndef _sb_rec_platform_cfg_
+#define _sb_rec_platform_cfg_
+
+/*
+** Includes
+*/
+
+#include "sb_rec_mission_cfg.h"
+
+
+/******************************************************************************
+** Platform Deployment Configurations
+*/
+
+#define SB_REC_PLATFORM_REV   0
+#define SB_REC_INI_FILENAME   "/cf/sb_rec_ini.json"
+
+
+#endif /* _sb_rec_platform_cfg_ */
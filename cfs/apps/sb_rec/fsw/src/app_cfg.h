@@ -0,0 +1,159 @@
+/*
+** Purpose: Define application configurations for the SB Recorder
+**          application
+**
+** Notes:
+**   1. These macros can only be built with the application and can't
+**      have a platform scope because the same app_cfg.h filename is used for
+**      all applications following the object-based application design.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+#ifndef _app_cfg_
+#define _app_cfg_
+
+/*
+** Includes
+*/
+
+#include "sb_rec_platform_cfg.h"
+#include "osk_c_fw.h"
+
+
+/******************************************************************************
+** Application Macros
+*/
+
+/*
+** Versions:
+**
+** 1.0 - Initial release
+*/
+
+#define  SB_REC_MAJOR_VER   1
+#define  SB_REC_MINOR_VER   0
+
+
+/******************************************************************************
+** Init File declarations create:
+**
+**  typedef enum {
+**     CMD_PIPE_DEPTH,
+**     CMD_PIPE_NAME
+**  } INITBL_ConfigEnum;
+**
+**  typedef struct {
+**     CMD_PIPE_DEPTH,
+**     CMD_PIPE_NAME
+**  } INITBL_ConfigStruct;
+**
+**   const char *GetConfigStr(value);
+**   ConfigEnum GetConfigVal(const char *str);
+**
+** XX(name,type)
+*/
+
+#define CFG_APP_CFE_NAME       APP_CFE_NAME
+#define CFG_APP_PERF_ID        APP_PERF_ID
+
+#define CFG_CHILD_NAME         CHILD_NAME
+#define CFG_CHILD_PERF_ID      CHILD_PERF_ID
+#define CFG_CHILD_STACK_SIZE   CHILD_STACK_SIZE
+#define CFG_CHILD_PRIORITY     CHILD_PRIORITY
+#define CFG_CHILD_POLL_DELAY   CHILD_POLL_DELAY
+
+#define CFG_CMD_PIPE_NAME      CMD_PIPE_NAME
+#define CFG_CMD_PIPE_DEPTH     CMD_PIPE_DEPTH
+
+#define CFG_CMD_MID            CMD_MID
+#define CFG_SEND_HK_MID        SEND_HK_MID
+#define CFG_HK_TLM_MID         HK_TLM_MID
+
+#define CFG_REC_PIPE_NAME      REC_PIPE_NAME
+#define CFG_REC_PIPE_DEPTH     REC_PIPE_DEPTH
+#define CFG_REC_PIPE_TIMEOUT   REC_PIPE_TIMEOUT
+#define CFG_REC_TBL_FILENAME   REC_TBL_FILENAME
+#define CFG_REC_START_SET_MASK REC_START_SET_MASK
+
+#define CFG_SEG_DIR            SEG_DIR
+#define CFG_SEG_BASE_NAME      SEG_BASE_NAME
+#define CFG_SEG_DATA_BYTES     SEG_DATA_BYTES
+#define CFG_SEG_INDEX_ENTRIES  SEG_INDEX_ENTRIES
+#define CFG_SEG_FILE_CNT       SEG_FILE_CNT
+#define CFG_SEG_SYNC_BYTES     SEG_SYNC_BYTES
+#define CFG_SEG_DATA_SUBTYPE   SEG_DATA_SUBTYPE
+#define CFG_SEG_INDEX_SUBTYPE  SEG_INDEX_SUBTYPE
+
+#define APP_CONFIG(XX) \
+   XX(APP_CFE_NAME,char*) \
+   XX(APP_PERF_ID,uint32) \
+   XX(CHILD_NAME,char*) \
+   XX(CHILD_PERF_ID,uint32) \
+   XX(CHILD_STACK_SIZE,uint32) \
+   XX(CHILD_PRIORITY,uint32) \
+   XX(CHILD_POLL_DELAY,uint32) \
+   XX(CMD_PIPE_NAME,char*) \
+   XX(CMD_PIPE_DEPTH,uint32) \
+   XX(CMD_MID,uint32) \
+   XX(SEND_HK_MID,uint32) \
+   XX(HK_TLM_MID,uint32) \
+   XX(REC_PIPE_NAME,char*) \
+   XX(REC_PIPE_DEPTH,uint32) \
+   XX(REC_PIPE_TIMEOUT,uint32) \
+   XX(REC_TBL_FILENAME,char*) \
+   XX(REC_START_SET_MASK,uint32) \
+   XX(SEG_DIR,char*) \
+   XX(SEG_BASE_NAME,char*) \
+   XX(SEG_DATA_BYTES,uint32) \
+   XX(SEG_INDEX_ENTRIES,uint32) \
+   XX(SEG_FILE_CNT,uint32) \
+   XX(SEG_SYNC_BYTES,uint32) \
+   XX(SEG_DATA_SUBTYPE,uint32) \
+   XX(SEG_INDEX_SUBTYPE,uint32) \
+
+DECLARE_ENUM(Config,APP_CONFIG)
+
+
+/******************************************************************************
+** Command Macros
+*/
+
+#define SB_REC_REC_TBL_LOAD_CMD_FC  (CMDMGR_APP_START_FC + 0)
+#define SB_REC_REC_TBL_DUMP_CMD_FC  (CMDMGR_APP_START_FC + 1)
+#define SB_REC_START_REC_CMD_FC     (CMDMGR_APP_START_FC + 2)
+#define SB_REC_STOP_REC_CMD_FC      (CMDMGR_APP_START_FC + 3)
+
+
+/******************************************************************************
+** Event Macros
+**
+** Define the base event message IDs used by each object/component used by the
+** application. There are no automated checks to ensure an ID range is not
+** exceeded so it is the developer's responsibility to verify the ranges.
+*/
+
+#define SB_REC_BASE_EID     (OSK_C_FW_APP_BASE_EID +  0)
+#define RECTBL_BASE_EID     (OSK_C_FW_APP_BASE_EID + 20)
+#define RECORDER_BASE_EID   (OSK_C_FW_APP_BASE_EID + 40)
+#define RECSEG_BASE_EID     (OSK_C_FW_APP_BASE_EID + 60)
+
+
+/******************************************************************************
+** Record Table
+**
+** RECTBL_MAX_ENTRIES bounds the number of MsgIds the recorder can subscribe
+** to. Each entry belongs to one of RECTBL_SET_CNT sets and the start record
+** command selects the sets with a bit mask.
+*/
+
+#define RECTBL_MAX_ENTRIES  64
+#define RECTBL_SET_CNT       8
+
+
+#endif /* _app_cfg_ */
@@ -0,0 +1,450 @@
+/*
+** Purpose: Implement the SB Recorder class
+**
+** Notes:
+**   1. See header notes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "recorder.h"
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static RECORDER_Class*  Recorder = NULL;
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void   SubscribeSets(uint8 SetMask);
+static void   UnsubscribeSets(uint8 SetMask);
+static uint32 DrainRecPipe(uint32 MaxMsgs);
+static void   RecordMsg(const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: RECORDER_Constructor
+**
+*/
+void RECORDER_Constructor(RECORDER_Class *RecorderPtr, INITBL_Class* IniTbl)
+{
+
+   int32 SbStatus;
+
+   Recorder = RecorderPtr;
+
+   CFE_PSP_MemSet((void*)Recorder, 0, sizeof(RECORDER_Class));
+   RECTBL_SetTblToUnused(&Recorder->Tbl);
+
+   Recorder->RecPipeTimeout = INITBL_GetIntConfig(IniTbl, CFG_REC_PIPE_TIMEOUT);
+   Recorder->RecPipeDepth   = INITBL_GetIntConfig(IniTbl, CFG_REC_PIPE_DEPTH);
+   Recorder->ChildPollDelay = INITBL_GetIntConfig(IniTbl, CFG_CHILD_POLL_DELAY);
+
+   SbStatus = CFE_SB_CreatePipe(&Recorder->RecPipe, Recorder->RecPipeDepth,
+                                INITBL_GetStrConfig(IniTbl, CFG_REC_PIPE_NAME));
+
+   if (SbStatus != CFE_SUCCESS) {
+
+      CFE_EVS_SendEvent(RECORDER_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating record pipe %s, status 0x%08X",
+                        INITBL_GetStrConfig(IniTbl, CFG_REC_PIPE_NAME), SbStatus);
+
+   }
+
+   RECSEG_Constructor(&Recorder->RecSeg, IniTbl);
+
+} /* End RECORDER_Constructor() */
+
+
+/******************************************************************************
+** Function: RECORDER_ResetStatus
+**
+*/
+void RECORDER_ResetStatus(void)
+{
+
+   Recorder->DropReported = false;
+
+   Recorder->PktCnt  = 0;
+   Recorder->DropCnt = 0;
+   Recorder->ByteCnt = 0;
+
+   RECSEG_ResetStatus(&Recorder->RecSeg);
+
+} /* End RECORDER_ResetStatus() */
+
+
+/******************************************************************************
+** Function: RECORDER_GetTblPtr
+**
+*/
+const RECTBL_Tbl* RECORDER_GetTblPtr(void)
+{
+
+   return &(Recorder->Tbl);
+
+} /* End RECORDER_GetTblPtr() */
+
+
+/******************************************************************************
+** Function: RECORDER_LoadTbl
+**
+** Notes:
+**   1. The current sets are unsubscribed before the new table is copied so
+**      a MsgId dropped from the table stops being recorded.
+**
+*/
+bool RECORDER_LoadTbl(RECTBL_Tbl* NewTbl)
+{
+
+   if (Recorder->Recording) {
+
+      UnsubscribeSets(Recorder->SetMask);
+
+   }
+
+   CFE_PSP_MemCpy(&(Recorder->Tbl), NewTbl, sizeof(RECTBL_Tbl));
+
+   if (Recorder->Recording) {
+
+      SubscribeSets(Recorder->SetMask);
+
+   }
+
+   CFE_EVS_SendEvent(RECORDER_LOAD_TBL_EID, CFE_EVS_EventType_INFORMATION,
+                     "Loaded %d record table entries, recording %d MsgIds",
+                     Recorder->Tbl.EntryCnt, Recorder->SubscribedCnt);
+
+   return true;
+
+} /* End RECORDER_LoadTbl() */
+
+
+/******************************************************************************
+** Function: RECORDER_StartRec
+**
+*/
+bool RECORDER_StartRec(uint8 SetMask)
+{
+
+   if (SetMask == 0) {
+
+      CFE_EVS_SendEvent(RECORDER_START_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Start record command rejected. The set mask must select at least one set");
+      return false;
+
+   }
+
+   if (Recorder->Recording) {
+
+      UnsubscribeSets(Recorder->SetMask);
+
+   }
+
+   SubscribeSets(SetMask);
+
+   Recorder->SetMask   = SetMask;
+   Recorder->Recording = true;
+
+   CFE_EVS_SendEvent(RECORDER_START_REC_EID, CFE_EVS_EventType_INFORMATION,
+                     "Recording %d MsgIds from set mask 0x%02X to %s/%s%05u",
+                     Recorder->SubscribedCnt, SetMask, Recorder->RecSeg.Dir, Recorder->RecSeg.BaseName,
+                     (unsigned int)Recorder->RecSeg.NextSeq);
+
+   return true;
+
+} /* End RECORDER_StartRec() */
+
+
+/******************************************************************************
+** Function: RECORDER_StartRecCmd
+**
+*/
+bool RECORDER_StartRecCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   const RECORDER_StartRecCmdMsg* Cmd = (const RECORDER_StartRecCmdMsg *) SbBufPtr;
+
+   return RECORDER_StartRec(Cmd->SetMask);
+
+} /* End RECORDER_StartRecCmd() */
+
+
+/******************************************************************************
+** Function: RECORDER_StopRecCmd
+**
+** Notes:
+**   1. READY segments are retired so their pre-allocated files don't stay on
+**      the file system at full size. A segment the child task is still
+**      preparing when recording stops becomes READY afterwards and is used
+**      when recording is restarted.
+**
+*/
+bool RECORDER_StopRecCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   if (Recorder->Recording) {
+
+      UnsubscribeSets(Recorder->SetMask);
+      DrainRecPipe(Recorder->RecPipeDepth);
+
+      Recorder->Recording = false;
+      Recorder->SetMask   = 0;
+
+      if (Recorder->ActiveSeg != NULL) {
+
+         RECSEG_Retire(Recorder->ActiveSeg);
+         Recorder->ActiveSeg = NULL;
+
+      }
+
+      RECSEG_RetireReady(&Recorder->RecSeg);
+
+   } /* End if recording */
+
+   CFE_EVS_SendEvent(RECORDER_STOP_REC_EID, CFE_EVS_EventType_INFORMATION,
+                     "Recording stopped. %u messages recorded, %u dropped",
+                     (unsigned int)Recorder->PktCnt, (unsigned int)Recorder->DropCnt);
+
+   return true;
+
+} /* End RECORDER_StopRecCmd() */
+
+
+/******************************************************************************
+** Function: RECORDER_RecordMsgs
+**
+** Notes:
+**   1. Only the initial pend is bracketed by performance log markers. The
+**      drain that follows polls the pipe.
+**   2. The drain is limited to one pipe depth of messages so a continuous
+**      stream doesn't starve the command pipe.
+**   3. A pipe error delays for the pipe timeout so the caller's loop keeps
+**      its command processing rate without spinning.
+**
+*/
+void RECORDER_RecordMsgs(uint32 PerfId)
+{
+
+   int32            SbStatus;
+   CFE_SB_Buffer_t* SbBufPtr;
+
+
+   CFE_ES_PerfLogExit(PerfId);
+   SbStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, Recorder->RecPipe, Recorder->RecPipeTimeout);
+   CFE_ES_PerfLogEntry(PerfId);
+
+   if (SbStatus == CFE_SUCCESS) {
+
+      RecordMsg(SbBufPtr);
+      DrainRecPipe(Recorder->RecPipeDepth);
+
+   }
+   else if (SbStatus != CFE_SB_TIME_OUT && SbStatus != CFE_SB_NO_MESSAGE) {
+
+      OS_TaskDelay(Recorder->RecPipeTimeout);
+
+   }
+
+} /* End RECORDER_RecordMsgs() */
+
+
+/******************************************************************************
+** Function: RECORDER_ChildTask
+**
+** Notes:
+**   1. Only sleeps when there was no segment work so a segment retired
+**      during a burst is closed and replaced immediately.
+**
+*/
+bool RECORDER_ChildTask(CHILDMGR_Class* ChildMgr)
+{
+
+   if (!RECSEG_ManageSegs(&Recorder->RecSeg, Recorder->Recording)) {
+
+      OS_TaskDelay(Recorder->ChildPollDelay);
+
+   }
+
+   return true;
+
+} /* End RECORDER_ChildTask() */
+
+
+/******************************************************************************
+** Function: SubscribeSets
+**
+*/
+static void SubscribeSets(uint8 SetMask)
+{
+
+   uint16 i;
+   int32  SbStatus;
+
+   for (i=0; i < Recorder->Tbl.EntryCnt; i++) {
+
+      if (SetMask & (1 << Recorder->Tbl.Entry[i].Set)) {
+
+         SbStatus = CFE_SB_SubscribeEx(Recorder->Tbl.Entry[i].MsgId, Recorder->RecPipe,
+                                       CFE_SB_DEFAULT_QOS, Recorder->Tbl.Entry[i].BufLim);
+
+         if (SbStatus == CFE_SUCCESS) {
+
+            Recorder->SubscribedCnt++;
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(RECORDER_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error subscribing record MsgId 0x%04X, status 0x%08X",
+                              (unsigned int)CFE_SB_MsgIdToValue(Recorder->Tbl.Entry[i].MsgId), SbStatus);
+
+         }
+      }
+
+   } /* End entry loop */
+
+} /* End SubscribeSets() */
+
+
+/******************************************************************************
+** Function: UnsubscribeSets
+**
+*/
+static void UnsubscribeSets(uint8 SetMask)
+{
+
+   uint16 i;
+
+   for (i=0; i < Recorder->Tbl.EntryCnt; i++) {
+
+      if (SetMask & (1 << Recorder->Tbl.Entry[i].Set)) {
+
+         CFE_SB_Unsubscribe(Recorder->Tbl.Entry[i].MsgId, Recorder->RecPipe);
+
+      }
+   }
+
+   Recorder->SubscribedCnt = 0;
+
+} /* End UnsubscribeSets() */
+
+
+/******************************************************************************
+** Function: DrainRecPipe
+**
+** Record up to MaxMsgs messages that are already queued on the record pipe.
+**
+*/
+static uint32 DrainRecPipe(uint32 MaxMsgs)
+{
+
+   uint32           MsgCnt = 0;
+   CFE_SB_Buffer_t* SbBufPtr;
+
+
+   while ((MsgCnt < MaxMsgs) &&
+          (CFE_SB_ReceiveBuffer(&SbBufPtr, Recorder->RecPipe, CFE_SB_POLL) == CFE_SUCCESS)) {
+
+      RecordMsg(SbBufPtr);
+      MsgCnt++;
+
+   }
+
+   return MsgCnt;
+
+} /* End DrainRecPipe() */
+
+
+/******************************************************************************
+** Function: RecordMsg
+**
+** Append one SB message to the active segment.
+**
+** Notes:
+**   1. Commands and other messages without a telemetry time stamp are
+**      indexed with their receive time.
+**   2. A full segment is retired and the message is written to the next
+**      READY segment. If the child task hasn't prepared one yet the message
+**      is dropped. One event is sent per run of drops.
+**
+*/
+static void RecordMsg(const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   bool               Recorded = false;
+   CFE_MSG_Size_t     MsgSize  = 0;
+   CFE_SB_MsgId_t     MsgId    = CFE_SB_INVALID_MSG_ID;
+   CFE_TIME_SysTime_t MsgTime;
+
+
+   CFE_MSG_GetSize(&SbBufPtr->Msg, &MsgSize);
+   CFE_MSG_GetMsgId(&SbBufPtr->Msg, &MsgId);
+
+   if (CFE_MSG_GetMsgTime(&SbBufPtr->Msg, &MsgTime) != CFE_SUCCESS) {
+
+      MsgTime = CFE_TIME_GetTime();
+
+   }
+
+   if (Recorder->ActiveSeg == NULL) {
+
+      Recorder->ActiveSeg = RECSEG_Activate(&Recorder->RecSeg);
+
+   }
+
+   if (Recorder->ActiveSeg != NULL) {
+
+      Recorded = RECSEG_Append(&Recorder->RecSeg, Recorder->ActiveSeg, SbBufPtr, (uint32)MsgSize, MsgId, MsgTime);
+
+      if (!Recorded) {
+
+         RECSEG_Retire(Recorder->ActiveSeg);
+         Recorder->ActiveSeg = RECSEG_Activate(&Recorder->RecSeg);
+
+         if (Recorder->ActiveSeg != NULL) {
+
+            Recorded = RECSEG_Append(&Recorder->RecSeg, Recorder->ActiveSeg, SbBufPtr, (uint32)MsgSize, MsgId, MsgTime);
+
+         }
+      }
+
+   } /* End if active segment */
+
+   if (Recorded) {
+
+      Recorder->PktCnt++;
+      Recorder->ByteCnt += MsgSize;
+      Recorder->DropReported = false;
+
+   }
+   else {
+
+      Recorder->DropCnt++;
+
+      if (!Recorder->DropReported) {
+
+         Recorder->DropReported = true;
+         CFE_EVS_SendEvent(RECORDER_DROP_EID, CFE_EVS_EventType_ERROR,
+                           "Dropping recorded messages, no segment file available. Verify the segment directory has space");
+
+      }
+   }
+
+} /* End RecordMsg() */
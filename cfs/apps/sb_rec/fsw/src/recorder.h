@@ -0,0 +1,209 @@
+/*
+** Purpose: Define the SB Recorder class
+**
+** Notes:
+**   1. The parent task pends on the record pipe and appends each message to
+**      the ACTIVE segment. The child task owns all file system calls: it
+**      prepares the next segment, starts writeback of the active one and
+**      closes retired ones. See recseg.h for the segment files.
+**   2. The record table assigns each MsgId to a set. Only the entries in the
+**      sets selected by the start record command are subscribed, so
+**      unrecorded MsgIds cost nothing on the bus.
+**   3. Messages are dropped rather than blocking the record pipe when the
+**      child task hasn't prepared a segment yet. Drops are counted in
+**      housekeeping telemetry.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _recorder_
+#define _recorder_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "rectbl.h"
+#include "recseg.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+
+/*
+** Event Message IDs
+*/
+
+#define RECORDER_CONSTRUCTOR_EID   (RECORDER_BASE_EID + 0)
+#define RECORDER_PIPE_ERR_EID      (RECORDER_BASE_EID + 1)
+#define RECORDER_SUBSCRIBE_ERR_EID (RECORDER_BASE_EID + 2)
+#define RECORDER_LOAD_TBL_EID      (RECORDER_BASE_EID + 3)
+#define RECORDER_START_REC_EID     (RECORDER_BASE_EID + 4)
+#define RECORDER_START_REC_ERR_EID (RECORDER_BASE_EID + 5)
+#define RECORDER_STOP_REC_EID      (RECORDER_BASE_EID + 6)
+#define RECORDER_DROP_EID          (RECORDER_BASE_EID + 7)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_CommandHeader_t  CmdHeader;
+   uint8   SetMask;     /* Bit n selects record table set n */
+   uint8   Spare;
+
+}  RECORDER_StartRecCmdMsg;
+#define RECORDER_START_REC_CMD_DATA_LEN  (sizeof(RECORDER_StartRecCmdMsg) - CFE_SB_CMD_HDR_SIZE)
+
+#define RECORDER_STOP_REC_CMD_DATA_LEN   0
+
+
+/******************************************************************************
+** RECORDER_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Class State Data
+   */
+
+   CFE_SB_PipeId_t  RecPipe;
+   uint32           RecPipeTimeout;   /* Milliseconds */
+   uint32           RecPipeDepth;
+   uint32           ChildPollDelay;   /* Milliseconds */
+
+   bool             Recording;
+   uint8            SetMask;
+   uint16           SubscribedCnt;
+
+   bool             DropReported;
+
+   uint32           PktCnt;
+   uint32           DropCnt;
+   uint64           ByteCnt;
+
+   RECSEG_Seg*      ActiveSeg;
+
+   RECTBL_Tbl       Tbl;
+   RECSEG_Class     RecSeg;
+
+} RECORDER_Class;
+
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: RECORDER_Constructor
+**
+** Initialize the recorder object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. Recording doesn't start until the table is loaded and a start
+**      record command is received (or REC_START_SET_MASK is non-zero).
+**
+*/
+void RECORDER_Constructor(RECORDER_Class *RecorderPtr, INITBL_Class* IniTbl);
+
+
+/******************************************************************************
+** Function: RECORDER_ResetStatus
+**
+** Reset counters and status flags to a known reset state.
+**
+** Notes:
+**   1. Any counter or variable that is reported in HK telemetry that doesn't
+**      change the functional behavior should be reset.
+**
+*/
+void RECORDER_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: RECORDER_GetTblPtr
+**
+** Return a pointer to the record table currently in use.
+**
+*/
+const RECTBL_Tbl* RECORDER_GetTblPtr(void);
+
+
+/******************************************************************************
+** Function: RECORDER_LoadTbl
+**
+** Replace the record table and resubscribe the record pipe to the selected
+** sets.
+**
+*/
+bool RECORDER_LoadTbl(RECTBL_Tbl* NewTbl);
+
+
+/******************************************************************************
+** Function: RECORDER_StartRec
+**
+** Subscribe to the sets in SetMask and start recording.
+**
+** Notes:
+**   1. If recording is in progress the subscriptions are changed to the new
+**      sets and the active segment is kept.
+**
+*/
+bool RECORDER_StartRec(uint8 SetMask);
+
+
+/******************************************************************************
+** Function: RECORDER_StartRecCmd
+**
+*/
+bool RECORDER_StartRecCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: RECORDER_StopRecCmd
+**
+** Notes:
+**   1. Messages already queued on the record pipe are recorded before the
+**      active segment is closed.
+**
+*/
+bool RECORDER_StopRecCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: RECORDER_RecordMsgs
+**
+** Pend on the record pipe for up to REC_PIPE_TIMEOUT milliseconds and append
+** the queued messages to the active segment.
+**
+*/
+void RECORDER_RecordMsgs(uint32 PerfId);
+
+
+/******************************************************************************
+** Function: RECORDER_ChildTask
+**
+*/
+bool RECORDER_ChildTask(CHILDMGR_Class* ChildMgr);
+
+
+#endif /* _recorder_ */
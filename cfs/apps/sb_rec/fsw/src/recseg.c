@@ -0,0 +1,641 @@
+/*
+** Purpose: Implement the SB Recorder segment file class
+**
+** Notes:
+**   1. See header notes for the file formats and segment ownership.
+**   2. The cFE file header is written through OSAL so it gets the standard
+**      byte order. The file is then reopened with the native path because
+**      OSAL doesn't expose posix_fallocate(), mmap() or sync_file_range().
+**   3. sync_file_range(SYNC_FILE_RANGE_WRITE) starts writeback of a
+**      completed range without waiting for it. Issuing it every
+**      SEG_SYNC_BYTES turns page cache writeback into large sequential
+**      writes instead of a burst when the kernel's dirty limit is reached.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "recseg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define FILE_HDR_BYTES  ((uint32)sizeof(CFE_FS_Header_t))
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static void  FindNextSeq(RECSEG_Class* RecSeg);
+static bool  SegFilename(RECSEG_Class* RecSeg, uint32 Seq, const char* Ext, char* Filename);
+static void  RemoveSegFiles(RECSEG_Class* RecSeg, uint32 Seq);
+static void* CreateMappedFile(const char* Filename, uint32 SubType, const char* Description,
+                              uint32 FileBytes, int* FdPtr);
+static bool  CloseMappedFile(void* MapAddr, uint32 MapBytes, int Fd, uint32 FileBytes);
+static bool  PrepareSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg);
+static bool  SyncSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg);
+static void  CloseSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg);
+
+
+/******************************************************************************
+** Function: RECSEG_Constructor
+**
+*/
+void RECSEG_Constructor(RECSEG_Class* RecSegPtr, INITBL_Class* IniTbl)
+{
+
+   uint8 i;
+
+
+   CFE_PSP_MemSet(RecSegPtr, 0, sizeof(RECSEG_Class));
+
+   strncpy(RecSegPtr->Dir, INITBL_GetStrConfig(IniTbl, CFG_SEG_DIR), OS_MAX_PATH_LEN - 1);
+   strncpy(RecSegPtr->BaseName, INITBL_GetStrConfig(IniTbl, CFG_SEG_BASE_NAME), OS_MAX_FILE_NAME - 1);
+
+   RecSegPtr->DataBytes   = INITBL_GetIntConfig(IniTbl, CFG_SEG_DATA_BYTES);
+   RecSegPtr->IdxEntries  = INITBL_GetIntConfig(IniTbl, CFG_SEG_INDEX_ENTRIES);
+   RecSegPtr->FileCnt     = INITBL_GetIntConfig(IniTbl, CFG_SEG_FILE_CNT);
+   RecSegPtr->SyncBytes   = INITBL_GetIntConfig(IniTbl, CFG_SEG_SYNC_BYTES);
+   RecSegPtr->DataSubType = INITBL_GetIntConfig(IniTbl, CFG_SEG_DATA_SUBTYPE);
+   RecSegPtr->IdxSubType  = INITBL_GetIntConfig(IniTbl, CFG_SEG_INDEX_SUBTYPE);
+
+   /* Every segment must hold at least one maximum size message */
+   if (RecSegPtr->DataBytes < CFE_MISSION_SB_MAX_SB_MSG_SIZE) RecSegPtr->DataBytes = CFE_MISSION_SB_MAX_SB_MSG_SIZE;
+   if (RecSegPtr->IdxEntries == 0) RecSegPtr->IdxEntries = 1;
+
+   for (i=0; i < RECSEG_SLOT_CNT; i++) {
+
+      RecSegPtr->Seg[i].State  = RECSEG_STATE_FREE;
+      RecSegPtr->Seg[i].DataFd = -1;
+      RecSegPtr->Seg[i].IdxFd  = -1;
+
+   }
+
+   FindNextSeq(RecSegPtr);
+
+   CFE_EVS_SendEvent(RECSEG_CONSTRUCTOR_EID, CFE_EVS_EventType_INFORMATION,
+                     "Recording to %s/%s, next segment %u, %u data bytes and %u index entries per segment",
+                     RecSegPtr->Dir, RecSegPtr->BaseName, (unsigned int)RecSegPtr->NextSeq,
+                     (unsigned int)RecSegPtr->DataBytes, (unsigned int)RecSegPtr->IdxEntries);
+
+} /* End RECSEG_Constructor() */
+
+
+/******************************************************************************
+** Function: RECSEG_ResetStatus
+**
+*/
+void RECSEG_ResetStatus(RECSEG_Class* RecSegPtr)
+{
+
+   RecSegPtr->CreateCnt = 0;
+   RecSegPtr->CloseCnt  = 0;
+   RecSegPtr->ErrCnt    = 0;
+
+} /* End RECSEG_ResetStatus() */
+
+
+/******************************************************************************
+** Function: RECSEG_Activate
+**
+*/
+RECSEG_Seg* RECSEG_Activate(RECSEG_Class* RecSegPtr)
+{
+
+   uint8       i;
+   RECSEG_Seg* Seg = NULL;
+
+
+   for (i=0; i < RECSEG_SLOT_CNT; i++) {
+
+      if (__atomic_load_n(&RecSegPtr->Seg[i].State, __ATOMIC_ACQUIRE) == RECSEG_STATE_READY) {
+
+         if (Seg == NULL || RecSegPtr->Seg[i].Seq < Seg->Seq) {
+            Seg = &RecSegPtr->Seg[i];
+         }
+
+      }
+   }
+
+   if (Seg != NULL) {
+
+      __atomic_store_n(&Seg->State, RECSEG_STATE_ACTIVE, __ATOMIC_RELEASE);
+
+   }
+
+   return Seg;
+
+} /* End RECSEG_Activate() */
+
+
+/******************************************************************************
+** Function: RECSEG_Append
+**
+** Notes:
+**   1. The index entry is written before the data offset is published so
+**      the child task never writes back a range without its index entries.
+**
+*/
+bool RECSEG_Append(RECSEG_Class* RecSegPtr, RECSEG_Seg* Seg, const CFE_SB_Buffer_t* SbBufPtr,
+                   uint32 MsgSize, CFE_SB_MsgId_t MsgId, CFE_TIME_SysTime_t MsgTime)
+{
+
+   uint32           DataOff = Seg->DataOff;
+   uint32           IdxCnt  = Seg->IdxCnt;
+   RECSEG_IdxEntry* IdxEntry;
+
+
+   if ((MsgSize > (RecSegPtr->DataBytes - DataOff)) || (IdxCnt >= RecSegPtr->IdxEntries)) {
+
+      return false;
+
+   }
+
+   memcpy(&Seg->DataMap[FILE_HDR_BYTES + DataOff], SbBufPtr, MsgSize);
+
+   IdxEntry = &Seg->IdxMap[IdxCnt];
+   IdxEntry->Seconds    = MsgTime.Seconds;
+   IdxEntry->Subseconds = MsgTime.Subseconds;
+   IdxEntry->MsgId      = CFE_SB_MsgIdToValue(MsgId);
+   IdxEntry->Offset     = FILE_HDR_BYTES + DataOff;
+
+   __atomic_store_n(&Seg->IdxCnt,  IdxCnt + 1,         __ATOMIC_RELEASE);
+   __atomic_store_n(&Seg->DataOff, DataOff + MsgSize,  __ATOMIC_RELEASE);
+
+   return true;
+
+} /* End RECSEG_Append() */
+
+
+/******************************************************************************
+** Function: RECSEG_Retire
+**
+*/
+void RECSEG_Retire(RECSEG_Seg* Seg)
+{
+
+   __atomic_store_n(&Seg->State, RECSEG_STATE_RETIRED, __ATOMIC_RELEASE);
+
+} /* End RECSEG_Retire() */
+
+
+/******************************************************************************
+** Function: RECSEG_RetireReady
+**
+*/
+void RECSEG_RetireReady(RECSEG_Class* RecSegPtr)
+{
+
+   uint8 i;
+
+   for (i=0; i < RECSEG_SLOT_CNT; i++) {
+
+      if (__atomic_load_n(&RecSegPtr->Seg[i].State, __ATOMIC_ACQUIRE) == RECSEG_STATE_READY) {
+
+         RECSEG_Retire(&RecSegPtr->Seg[i]);
+
+      }
+   }
+
+} /* End RECSEG_RetireReady() */
+
+
+/******************************************************************************
+** Function: RECSEG_ManageSegs
+**
+** Notes:
+**   1. Only one segment is kept READY. The next one is prepared as soon as
+**      the parent activates it, so the child has a full segment's recording
+**      time to create its replacement.
+**
+*/
+bool RECSEG_ManageSegs(RECSEG_Class* RecSegPtr, bool PrepareNext)
+{
+
+   bool        DidWork   = false;
+   bool        HaveReady = false;
+   uint8       i;
+   RECSEG_Seg* FreeSeg   = NULL;
+
+
+   for (i=0; i < RECSEG_SLOT_CNT; i++) {
+
+      switch (__atomic_load_n(&RecSegPtr->Seg[i].State, __ATOMIC_ACQUIRE)) {
+
+         case RECSEG_STATE_RETIRED:
+            CloseSeg(RecSegPtr, &RecSegPtr->Seg[i]);
+            FreeSeg = &RecSegPtr->Seg[i];
+            DidWork = true;
+            break;
+
+         case RECSEG_STATE_ACTIVE:
+            if (SyncSeg(RecSegPtr, &RecSegPtr->Seg[i])) DidWork = true;
+            break;
+
+         case RECSEG_STATE_READY:
+            HaveReady = true;
+            break;
+
+         default:
+            FreeSeg = &RecSegPtr->Seg[i];
+            break;
+
+      } /* End state switch */
+
+   } /* End slot loop */
+
+   if (PrepareNext && !HaveReady && FreeSeg != NULL) {
+
+      if (PrepareSeg(RecSegPtr, FreeSeg)) DidWork = true;
+
+   }
+
+   return DidWork;
+
+} /* End RECSEG_ManageSegs() */
+
+
+/******************************************************************************
+** Function: FindNextSeq
+**
+** Continue the segment sequence after the highest one in the segment
+** directory. The directory is created if it doesn't exist.
+**
+*/
+static void FindNextSeq(RECSEG_Class* RecSeg)
+{
+
+   int32          OsStatus;
+   osal_id_t      DirId;
+   os_dirent_t    DirEntry;
+   size_t         BaseLen = strlen(RecSeg->BaseName);
+   const char*    Name;
+   char*          NameEnd;
+   unsigned long  Seq;
+
+
+   RecSeg->NextSeq = 0;
+
+   OsStatus = OS_DirectoryOpen(&DirId, RecSeg->Dir);
+
+   if (OsStatus != OS_SUCCESS) {
+
+      OS_mkdir(RecSeg->Dir, 0);
+      return;
+
+   }
+
+   while (OS_DirectoryRead(DirId, &DirEntry) == OS_SUCCESS) {
+
+      Name = OS_DIRENTRY_NAME(DirEntry);
+
+      if (strncmp(Name, RecSeg->BaseName, BaseLen) == 0) {
+
+         Seq = strtoul(&Name[BaseLen], &NameEnd, 10);
+
+         if ((NameEnd != &Name[BaseLen]) && (strcmp(NameEnd, RECSEG_DATA_FILE_EXT) == 0) &&
+             (Seq >= RecSeg->NextSeq)) {
+
+            RecSeg->NextSeq = (uint32)Seq + 1;
+
+         }
+      }
+
+   } /* End directory loop */
+
+   OS_DirectoryClose(DirId);
+
+} /* End FindNextSeq() */
+
+
+/******************************************************************************
+** Function: SegFilename
+**
+** Notes:
+**   1. Returns false if the name doesn't fit in OS_MAX_PATH_LEN. Filename
+**      holds the truncated name so it can still be reported in an event.
+**
+*/
+static bool SegFilename(RECSEG_Class* RecSeg, uint32 Seq, const char* Ext, char* Filename)
+{
+
+   int Len = snprintf(Filename, OS_MAX_PATH_LEN, "%s/%s%05u%s", RecSeg->Dir, RecSeg->BaseName, (unsigned int)Seq, Ext);
+
+   return ((Len >= 0) && (Len < OS_MAX_PATH_LEN));
+
+} /* End SegFilename() */
+
+
+/******************************************************************************
+** Function: RemoveSegFiles
+**
+** Notes:
+**   1. Errors are ignored because a segment may already have been removed
+**      by ground command or never have been created.
+**   2. A truncated filename is never removed since it could name another file.
+**
+*/
+static void RemoveSegFiles(RECSEG_Class* RecSeg, uint32 Seq)
+{
+
+   char Filename[OS_MAX_PATH_LEN];
+
+   if (SegFilename(RecSeg, Seq, RECSEG_DATA_FILE_EXT, Filename)) OS_remove(Filename);
+
+   if (SegFilename(RecSeg, Seq, RECSEG_IDX_FILE_EXT, Filename)) OS_remove(Filename);
+
+} /* End RemoveSegFiles() */
+
+
+/******************************************************************************
+** Function: CreateMappedFile
+**
+** Create a file with a cFE header, allocate its full size and map it.
+**
+** Notes:
+**   1. Returns NULL on any failure with the file descriptor closed.
+**
+*/
+static void* CreateMappedFile(const char* Filename, uint32 SubType, const char* Description,
+                              uint32 FileBytes, int* FdPtr)
+{
+
+   void*            MapAddr = NULL;
+   int              Fd      = -1;
+   int32            OsStatus;
+   osal_id_t        FileHandle;
+   CFE_FS_Header_t  FileHeader;
+   char             LocalPath[OS_MAX_LOCAL_PATH_LEN];
+
+
+   OsStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+   if (OsStatus == OS_SUCCESS) {
+
+      CFE_FS_InitHeader(&FileHeader, Description, SubType);
+
+      if (CFE_FS_WriteHeader(FileHandle, &FileHeader) != sizeof(CFE_FS_Header_t)) {
+         OsStatus = OS_ERROR;
+      }
+
+      OS_close(FileHandle);
+
+   }
+
+   if (OsStatus == OS_SUCCESS) {
+
+      OsStatus = OS_TranslatePath(Filename, LocalPath);
+
+   }
+
+   if (OsStatus == OS_SUCCESS) {
+
+      Fd = open(LocalPath, O_RDWR);
+
+      if ((Fd >= 0) && (posix_fallocate(Fd, 0, FileBytes) == 0)) {
+
+         MapAddr = mmap(NULL, FileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+
+         if (MapAddr == MAP_FAILED) {
+
+            MapAddr = NULL;
+
+         }
+         else {
+
+            madvise(MapAddr, FileBytes, MADV_SEQUENTIAL);
+
+         }
+      }
+
+   } /* End if header written */
+
+   if ((MapAddr == NULL) && (Fd >= 0)) {
+
+      close(Fd);
+      Fd = -1;
+
+   }
+
+   *FdPtr = Fd;
+
+   return MapAddr;
+
+} /* End CreateMappedFile() */
+
+
+/******************************************************************************
+** Function: CloseMappedFile
+**
+** Sync, unmap and truncate a mapped file to the bytes that were used.
+**
+*/
+static bool CloseMappedFile(void* MapAddr, uint32 MapBytes, int Fd, uint32 FileBytes)
+{
+
+   bool RetStatus = true;
+
+   if (msync(MapAddr, FileBytes, MS_SYNC) != 0) RetStatus = false;
+
+   munmap(MapAddr, MapBytes);
+
+   if (ftruncate(Fd, FileBytes) != 0) RetStatus = false;
+
+   close(Fd);
+
+   return RetStatus;
+
+} /* End CloseMappedFile() */
+
+
+/******************************************************************************
+** Function: PrepareSeg
+**
+** Notes:
+**   1. A creation failure is retried on the next call without advancing the
+**      sequence number. One event is sent per run of failures.
+**   2. Segment directory and base name lengths come from the ini file so a
+**      name that doesn't fit is treated as a creation failure.
+**
+*/
+static bool PrepareSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg)
+{
+
+   uint8* IdxMap;
+   char   DataFilename[OS_MAX_PATH_LEN];
+   char   IdxFilename[OS_MAX_PATH_LEN];
+
+
+   if ((RecSeg->FileCnt > 0) && (RecSeg->NextSeq >= RecSeg->FileCnt)) {
+
+      RemoveSegFiles(RecSeg, RecSeg->NextSeq - RecSeg->FileCnt);
+
+   }
+
+   if (!SegFilename(RecSeg, RecSeg->NextSeq, RECSEG_DATA_FILE_EXT, DataFilename) ||
+       !SegFilename(RecSeg, RecSeg->NextSeq, RECSEG_IDX_FILE_EXT,  IdxFilename)) {
+
+      RecSeg->ErrCnt++;
+
+      if (!RecSeg->CreateErrReported) {
+
+         RecSeg->CreateErrReported = true;
+         CFE_EVS_SendEvent(RECSEG_FILENAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Segment filename %s exceeds %d characters, shorten the segment directory or base name",
+                           DataFilename, OS_MAX_PATH_LEN - 1);
+
+      }
+
+      return false;
+
+   }
+
+   Seg->DataMap = CreateMappedFile(DataFilename, RecSeg->DataSubType, "SB_REC message segment",
+                                   FILE_HDR_BYTES + RecSeg->DataBytes, &Seg->DataFd);
+   IdxMap = NULL;
+
+   if (Seg->DataMap != NULL) {
+
+      IdxMap = CreateMappedFile(IdxFilename, RecSeg->IdxSubType, "SB_REC message index",
+                                FILE_HDR_BYTES + RecSeg->IdxEntries * sizeof(RECSEG_IdxEntry), &Seg->IdxFd);
+
+      if (IdxMap == NULL) {
+
+         munmap(Seg->DataMap, FILE_HDR_BYTES + RecSeg->DataBytes);
+         close(Seg->DataFd);
+         Seg->DataMap = NULL;
+         Seg->DataFd  = -1;
+
+      }
+   }
+
+   if (IdxMap == NULL) {
+
+      RemoveSegFiles(RecSeg, RecSeg->NextSeq);
+      RecSeg->ErrCnt++;
+
+      if (!RecSeg->CreateErrReported) {
+
+         RecSeg->CreateErrReported = true;
+         CFE_EVS_SendEvent(RECSEG_CREATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Error creating segment %s. Verify %s exists and has space for %u bytes",
+                           DataFilename, RecSeg->Dir, (unsigned int)RecSeg->DataBytes);
+
+      }
+
+      return false;
+
+   }
+
+   Seg->IdxMap  = (RECSEG_IdxEntry*)&IdxMap[FILE_HDR_BYTES];
+   Seg->Seq     = RecSeg->NextSeq++;
+   Seg->DataOff = 0;
+   Seg->IdxCnt  = 0;
+   Seg->SyncOff = 0;
+
+   RecSeg->CreateCnt++;
+   RecSeg->CreateErrReported = false;
+
+   __atomic_store_n(&Seg->State, RECSEG_STATE_READY, __ATOMIC_RELEASE);
+
+   return true;
+
+} /* End PrepareSeg() */
+
+
+/******************************************************************************
+** Function: SyncSeg
+**
+** Start writeback of an ACTIVE segment once SEG_SYNC_BYTES have accumulated.
+**
+*/
+static bool SyncSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg)
+{
+
+   uint32 DataOff = __atomic_load_n(&Seg->DataOff, __ATOMIC_ACQUIRE);
+
+   if ((DataOff - Seg->SyncOff) < RecSeg->SyncBytes) {
+
+      return false;
+
+   }
+
+   sync_file_range(Seg->DataFd, FILE_HDR_BYTES + Seg->SyncOff, DataOff - Seg->SyncOff, SYNC_FILE_RANGE_WRITE);
+   Seg->SyncOff = DataOff;
+
+   return true;
+
+} /* End SyncSeg() */
+
+
+/******************************************************************************
+** Function: CloseSeg
+**
+** Notes:
+**   1. A segment that never recorded a message is removed so stopping and
+**      starting a recording doesn't leave empty segments behind.
+**
+*/
+static void CloseSeg(RECSEG_Class* RecSeg, RECSEG_Seg* Seg)
+{
+
+   bool   Closed;
+   uint8* IdxMap = ((uint8*)Seg->IdxMap) - FILE_HDR_BYTES;
+   char   Filename[OS_MAX_PATH_LEN];
+
+
+   Closed = CloseMappedFile(Seg->DataMap, FILE_HDR_BYTES + RecSeg->DataBytes, Seg->DataFd,
+                            FILE_HDR_BYTES + Seg->DataOff);
+   Closed = CloseMappedFile(IdxMap, FILE_HDR_BYTES + RecSeg->IdxEntries * sizeof(RECSEG_IdxEntry), Seg->IdxFd,
+                            FILE_HDR_BYTES + Seg->IdxCnt * sizeof(RECSEG_IdxEntry)) && Closed;
+
+   SegFilename(RecSeg, Seg->Seq, RECSEG_DATA_FILE_EXT, Filename);
+
+   if (Seg->IdxCnt == 0) {
+
+      RemoveSegFiles(RecSeg, Seg->Seq);
+
+   }
+   else if (Closed) {
+
+      RecSeg->CloseCnt++;
+      CFE_EVS_SendEvent(RECSEG_CLOSE_EID, CFE_EVS_EventType_DEBUG,
+                        "Closed segment %s with %u messages in %u bytes",
+                        Filename, (unsigned int)Seg->IdxCnt, (unsigned int)Seg->DataOff);
+
+   }
+   else {
+
+      RecSeg->ErrCnt++;
+      CFE_EVS_SendEvent(RECSEG_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error syncing or truncating segment %s, recorded data may be incomplete", Filename);
+
+   }
+
+   Seg->DataMap = NULL;
+   Seg->IdxMap  = NULL;
+   Seg->DataFd  = -1;
+   Seg->IdxFd   = -1;
+
+   __atomic_store_n(&Seg->State, RECSEG_STATE_FREE, __ATOMIC_RELEASE);
+
+} /* End CloseSeg() */
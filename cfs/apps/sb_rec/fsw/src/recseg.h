@@ -0,0 +1,245 @@
+/*
+** Purpose: Define the SB Recorder segment file class
+**
+** Notes:
+**   1. A segment is a pair of files named <SEG_BASE_NAME><seq>.rec and
+**      <SEG_BASE_NAME><seq>.idx in SEG_DIR:
+**      - The data file is a cFE file header followed by raw SB messages
+**        back to back, exactly as they were on the bus. Replay tools only
+**        need the CCSDS length field to walk the file.
+**      - The index file is a cFE file header followed by one RECSEG_IdxEntry
+**        per message. The entries are in host byte order.
+**   2. Both files are created at their full size with posix_fallocate() and
+**      mapped with mmap() before they are handed to the parent task, so
+**      recording a message is a memcpy() into page cache. File creation,
+**      writeback and truncating a closed segment to its used length are done
+**      by the child task and never block the SB consumer.
+**   3. Segment ownership moves through RECSEG_SLOT_CNT slots with a state
+**      token. Each transition is made by exactly one task:
+**        Child:  FREE    -> READY    (files created and mapped)
+**        Parent: READY   -> ACTIVE   (recording into the segment)
+**        Parent: ACTIVE  -> RETIRED  (segment full or recording stopped)
+**        Parent: READY   -> RETIRED  (recording stopped)
+**        Child:  RETIRED -> FREE     (files synced, truncated and closed)
+**      Only the child unmaps a segment so it can safely write back an
+**      ACTIVE segment that the parent retires concurrently.
+**   4. When SEG_FILE_CNT is non-zero the segment files form a ring. Creating
+**      segment N removes segment N-SEG_FILE_CNT. The constructor continues
+**      the sequence from the highest segment found in SEG_DIR so a restart
+**      never overwrites earlier recordings.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _recseg_
+#define _recseg_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define RECSEG_SLOT_CNT  3   /* One active, one ready and one being closed */
+
+#define RECSEG_STATE_FREE     0
+#define RECSEG_STATE_READY    1
+#define RECSEG_STATE_ACTIVE   2
+#define RECSEG_STATE_RETIRED  3
+
+#define RECSEG_DATA_FILE_EXT  ".rec"
+#define RECSEG_IDX_FILE_EXT   ".idx"
+
+/*
+** Event Message IDs
+*/
+
+#define RECSEG_CONSTRUCTOR_EID   (RECSEG_BASE_EID + 0)
+#define RECSEG_CREATE_ERR_EID    (RECSEG_BASE_EID + 1)
+#define RECSEG_CLOSE_ERR_EID     (RECSEG_BASE_EID + 2)
+#define RECSEG_CLOSE_EID         (RECSEG_BASE_EID + 3)
+#define RECSEG_FILENAME_ERR_EID  (RECSEG_BASE_EID + 4)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Index file entry
+**
+** Offset is the byte offset of the message from the start of the data file,
+** including the cFE file header, so a reader can seek to it directly. Time is
+** the message's telemetry time stamp or the receive time for messages that
+** don't carry one.
+*/
+
+typedef struct {
+
+   uint32  Seconds;
+   uint32  Subseconds;
+   uint32  MsgId;
+   uint32  Offset;
+
+} RECSEG_IdxEntry;
+
+
+/******************************************************************************
+** Segment slot
+*/
+
+typedef struct {
+
+   uint32            State;       /* RECSEG_STATE_x, accessed atomically */
+   uint32            Seq;
+
+   int               DataFd;
+   int               IdxFd;
+   uint8*            DataMap;     /* Start of data file, cFE header first */
+   RECSEG_IdxEntry*  IdxMap;      /* First entry after the cFE header     */
+
+   uint32            DataOff;     /* Message bytes written, published by parent */
+   uint32            IdxCnt;      /* Index entries written, published by parent */
+   uint32            SyncOff;     /* Message bytes handed to writeback by child */
+
+} RECSEG_Seg;
+
+
+/******************************************************************************
+** RECSEG_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Configuration
+   */
+
+   char     Dir[OS_MAX_PATH_LEN];
+   char     BaseName[OS_MAX_FILE_NAME];
+   uint32   DataBytes;
+   uint32   IdxEntries;
+   uint32   FileCnt;       /* 0 keeps every segment */
+   uint32   SyncBytes;
+   uint32   DataSubType;
+   uint32   IdxSubType;
+
+   /*
+   ** Child task state
+   */
+
+   uint32   NextSeq;
+   bool     CreateErrReported;
+
+   uint32   CreateCnt;
+   uint32   CloseCnt;
+   uint32   ErrCnt;
+
+   RECSEG_Seg Seg[RECSEG_SLOT_CNT];
+
+} RECSEG_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: RECSEG_Constructor
+**
+** Initialize the segment manager and find the next segment sequence number.
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**   2. No files are created. The child task creates the first segment when
+**      recording is started.
+**
+*/
+void RECSEG_Constructor(RECSEG_Class* RecSegPtr, INITBL_Class* IniTbl);
+
+
+/******************************************************************************
+** Function: RECSEG_ResetStatus
+**
+*/
+void RECSEG_ResetStatus(RECSEG_Class* RecSegPtr);
+
+
+/******************************************************************************
+** Function: RECSEG_Activate
+**
+** Parent task: take ownership of the oldest READY segment.
+**
+** Notes:
+**   1. Returns NULL if the child task hasn't prepared a segment yet.
+**
+*/
+RECSEG_Seg* RECSEG_Activate(RECSEG_Class* RecSegPtr);
+
+
+/******************************************************************************
+** Function: RECSEG_Append
+**
+** Parent task: copy one message into an ACTIVE segment and index it.
+**
+** Notes:
+**   1. Returns false without writing anything if the message or its index
+**      entry doesn't fit. The caller retires the segment and activates the
+**      next one.
+**
+*/
+bool RECSEG_Append(RECSEG_Class* RecSegPtr, RECSEG_Seg* Seg, const CFE_SB_Buffer_t* SbBufPtr,
+                   uint32 MsgSize, CFE_SB_MsgId_t MsgId, CFE_TIME_SysTime_t MsgTime);
+
+
+/******************************************************************************
+** Function: RECSEG_Retire
+**
+** Parent task: return an ACTIVE segment to the child task to be closed.
+**
+*/
+void RECSEG_Retire(RECSEG_Seg* Seg);
+
+
+/******************************************************************************
+** Function: RECSEG_RetireReady
+**
+** Parent task: return every READY segment to the child task.
+**
+** Notes:
+**   1. Used when recording stops so pre-allocated segments don't stay on
+**      the file system at full size. Segments without any messages are
+**      removed when they are closed.
+**
+*/
+void RECSEG_RetireReady(RECSEG_Class* RecSegPtr);
+
+
+/******************************************************************************
+** Function: RECSEG_ManageSegs
+**
+** Child task: close retired segments, start writeback of ACTIVE segment data
+** and prepare the next segment when PrepareNext is true.
+**
+** Notes:
+**   1. Returns true if any work was done so the caller only sleeps when the
+**      segments are idle.
+**
+*/
+bool RECSEG_ManageSegs(RECSEG_Class* RecSegPtr, bool PrepareNext);
+
+
+#endif /* _recseg_ */
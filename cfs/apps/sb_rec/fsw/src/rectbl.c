@@ -0,0 +1,312 @@
+/*
+** Purpose: SB Recorder Record Table.
+**
+** Notes:
+**   None
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "rectbl.h"
+
+
+#define  JSON  &(RecTbl->Json)  /* Convenience macro */
+
+
+/*
+** Global File Data
+*/
+
+static RECTBL_Class* RecTbl = NULL;
+
+
+/*
+** Local File Function Prototypes
+*/
+
+/******************************************************************************
+** Function: RecCallback
+**
+** Notes:
+**   1. This function must have the same function signature as
+**      JSON_ContainerFuncPtr.
+*/
+static bool RecCallback (void* UserData, int TokenIdx);
+
+
+/******************************************************************************
+** Function: RECTBL_Constructor
+**
+** Notes:
+**    1. This must be called prior to any other functions
+**
+*/
+void RECTBL_Constructor(RECTBL_Class*    ObjPtr,
+                        RECTBL_GetTblPtr GetTblPtrFunc,
+                        RECTBL_LoadTbl   LoadTblFunc)
+{
+
+   RecTbl = ObjPtr;
+
+   CFE_PSP_MemSet(RecTbl, 0, sizeof(RECTBL_Class));
+   RECTBL_SetTblToUnused(&(RecTbl->Tbl));
+
+   RecTbl->GetTblPtrFunc = GetTblPtrFunc;
+   RecTbl->LoadTblFunc   = LoadTblFunc;
+
+   JSON_Constructor(JSON, RecTbl->JsonFileBuf, RecTbl->JsonFileTokens);
+
+   JSON_ObjConstructor(&(RecTbl->JsonObj[RECTBL_OBJ_REC]),
+                       RECTBL_OBJ_NAME_REC,
+                       RecCallback,
+                       (void *)&(RecTbl->Tbl));
+
+   JSON_RegContainerCallback(JSON, &(RecTbl->JsonObj[RECTBL_OBJ_REC]));
+
+} /* End RECTBL_Constructor() */
+
+
+/******************************************************************************
+** Function: RECTBL_SetTblToUnused
+**
+*/
+void RECTBL_SetTblToUnused(RECTBL_Tbl* TblPtr)
+{
+
+   uint16 i;
+
+   CFE_PSP_MemSet(TblPtr, 0, sizeof(RECTBL_Tbl));
+
+   for (i=0; i < RECTBL_MAX_ENTRIES; i++) {
+
+      TblPtr->Entry[i].MsgId = RECTBL_UNUSED_MSG_ID;
+
+   }
+
+} /* End RECTBL_SetTblToUnused() */
+
+
+/******************************************************************************
+** Function: RECTBL_ResetStatus
+**
+*/
+void RECTBL_ResetStatus(void)
+{
+
+   RecTbl->LastLoadStatus = TBLMGR_STATUS_UNDEF;
+   RecTbl->AttrErrCnt     = 0;
+
+   JSON_ObjArrayReset (RecTbl->JsonObj, RECTBL_OBJ_CNT);
+
+} /* End RECTBL_ResetStatus() */
+
+
+/******************************************************************************
+** Function: RECTBL_LoadCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+*/
+bool RECTBL_LoadCmd(TBLMGR_Tbl *Tbl, uint8 LoadType, const char* Filename)
+{
+
+   RECTBL_ResetStatus();
+
+   RECTBL_SetTblToUnused(&(RecTbl->Tbl));
+
+   if (LoadType != TBLMGR_LOAD_TBL_REPLACE) {
+
+      CFE_EVS_SendEvent(RECTBL_LOAD_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Load record table rejected. Invalid table command load type %d", LoadType);
+
+   } /* End if invalid command option */
+   else if (JSON_OpenFile(JSON, Filename)) {
+
+      JSON_ProcessTokens(JSON);
+
+      /*
+      ** No need to send an event message if there are attribute errors since
+      ** events are sent for each error. An empty table is valid JSON but it
+      ** is rejected because it silently stops all recording.
+      */
+      if (RecTbl->AttrErrCnt == 0) {
+
+         if (RecTbl->Tbl.EntryCnt > 0) {
+
+            RecTbl->LastLoadStatus = ((RecTbl->LoadTblFunc)(&(RecTbl->Tbl)) == true) ? TBLMGR_STATUS_VALID : TBLMGR_STATUS_INVALID;
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(RECTBL_LOAD_EMPTY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Load record table command rejected. %s didn't contain any record definitions", Filename);
+
+         }
+
+      } /* End if no attribute errors */
+
+   } /* End if valid file */
+   else {
+
+      CFE_EVS_SendEvent(RECTBL_LOAD_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Load record table open failure for file %s. File Status = %s JSMN Status = %s",
+                        Filename, JSON_GetFileStatusStr(RecTbl->Json.FileStatus), JSON_GetJsmnErrStr(RecTbl->Json.JsmnStatus));
+
+   } /* End if file processing error */
+
+   return (RecTbl->LastLoadStatus == TBLMGR_STATUS_VALID);
+
+} /* End of RECTBL_LoadCmd() */
+
+
+/******************************************************************************
+** Function: RECTBL_DumpCmd
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager that has verified the file.
+**  3. DumpType is unused.
+**  4. File is formatted so it can be used as a load file. It does not follow
+**     the cFE table file format.
+**  5. Creates a new dump file, overwriting anything that may have existed
+**     previously
+*/
+bool RECTBL_DumpCmd(TBLMGR_Tbl *Tbl, uint8 DumpType, const char* Filename)
+{
+
+   bool              RetStatus = false;
+   uint16            i;
+   int32             OsStatus;
+   osal_id_t         FileHandle;
+   char              DumpRecord[256];
+   const RECTBL_Tbl* RecTblPtr;
+   char              SysTimeStr[64];
+
+   OsStatus = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+
+   if (OsStatus == OS_SUCCESS) {
+
+      RecTblPtr = (RecTbl->GetTblPtrFunc)();
+
+      sprintf(DumpRecord,"\n{\n\"name\": \"SB Recorder (SB_REC) Record Table\",\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      CFE_TIME_Print(SysTimeStr, CFE_TIME_GetTime());
+
+      sprintf(DumpRecord,"\"description\": \"SB_REC dumped at %s\",\n",SysTimeStr);
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      sprintf(DumpRecord,"\"record-array\": [\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      for (i=0; i < RecTblPtr->EntryCnt; i++) {
+
+         sprintf(DumpRecord,"%s   {\"record\": { \"dec-id\": %d, \"buf-limit\": %d, \"set\": %d }}",
+                 (i == 0) ? "" : ",\n",
+                 (int)CFE_SB_MsgIdToValue(RecTblPtr->Entry[i].MsgId), RecTblPtr->Entry[i].BufLim, RecTblPtr->Entry[i].Set);
+         OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      }
+
+      sprintf(DumpRecord,"\n]}\n");
+      OS_write(FileHandle,DumpRecord,strlen(DumpRecord));
+
+      RetStatus = true;
+
+      OS_close(FileHandle);
+
+   } /* End if file create */
+   else {
+
+      CFE_EVS_SendEvent(RECTBL_CREATE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error creating dump file '%s', Status=0x%08X", Filename, OsStatus);
+
+   } /* End if file create error */
+
+   return RetStatus;
+
+} /* End of RECTBL_DumpCmd() */
+
+
+/******************************************************************************
+** Function: RecCallback
+**
+** Process a record table entry.
+**
+** Notes:
+**   1. This must have the same function signature as JSON_ContainerFuncPtr.
+**   2. UserData is unused.
+**   3. A MsgId may only appear once because it maps to one subscription.
+*/
+static bool RecCallback (void* UserData, int TokenIdx)
+{
+
+   int          AttributeCnt = 0;
+   int          JsonIntData;
+   uint16       i;
+   RECTBL_Entry Entry;
+
+   RecTbl->JsonObj[RECTBL_OBJ_REC].Modified = false;
+
+   Entry.MsgId  = RECTBL_UNUSED_MSG_ID;
+   Entry.BufLim = 0;
+   Entry.Set    = 0;
+
+   if (JSON_GetValShortInt(JSON, TokenIdx, "dec-id",    &JsonIntData)) { AttributeCnt++; Entry.MsgId  = CFE_SB_ValueToMsgId(JsonIntData); }
+   if (JSON_GetValShortInt(JSON, TokenIdx, "buf-limit", &JsonIntData) && JsonIntData > 0) { AttributeCnt++; Entry.BufLim = (uint16)JsonIntData; }
+   if (JSON_GetValShortInt(JSON, TokenIdx, "set",       &JsonIntData) && JsonIntData >= 0 && JsonIntData < RECTBL_SET_CNT) { AttributeCnt++; Entry.Set = (uint8)JsonIntData; }
+
+   if (AttributeCnt != 3) {
+
+      ++RecTbl->AttrErrCnt;
+      CFE_EVS_SendEvent(RECTBL_LOAD_ATTR_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Invalid number of record attributes %d. Should be 3 with a set less than %d.",
+                        AttributeCnt, RECTBL_SET_CNT);
+      return false;
+
+   }
+
+   if (RecTbl->Tbl.EntryCnt >= RECTBL_MAX_ENTRIES) {
+
+      ++RecTbl->AttrErrCnt;
+      CFE_EVS_SendEvent(RECTBL_LOAD_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Record entry for MsgId 0x%04X exceeds table limit of %d entries",
+                        (unsigned int)CFE_SB_MsgIdToValue(Entry.MsgId), RECTBL_MAX_ENTRIES);
+      return false;
+
+   }
+
+   for (i=0; i < RecTbl->Tbl.EntryCnt; i++) {
+
+      if (CFE_SB_MsgId_Equal(RecTbl->Tbl.Entry[i].MsgId, Entry.MsgId)) {
+
+         ++RecTbl->AttrErrCnt;
+         CFE_EVS_SendEvent(RECTBL_LOAD_DUPLICATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                           "Duplicate record entry for MsgId 0x%04X",
+                           (unsigned int)CFE_SB_MsgIdToValue(Entry.MsgId));
+         return false;
+
+      }
+   }
+
+   RecTbl->Tbl.Entry[RecTbl->Tbl.EntryCnt++] = Entry;
+   RecTbl->JsonObj[RECTBL_OBJ_REC].Modified = true;
+
+   return RecTbl->JsonObj[RECTBL_OBJ_REC].Modified;
+
+} /* RecCallback() */
@@ -0,0 +1,182 @@
+/*
+** Purpose: SB Recorder Record Table
+**
+** Notes:
+**   1. Use the Singleton design pattern. A pointer to the table object
+**      is passed to the constructor and saved for all other operations.
+**      This is a table-specific file so it doesn't need to be re-entrant.
+**   2. The table file is a JSON text file. Each entry is a MsgId that can be
+**      recorded and the set it belongs to. Sets group MsgIds that are
+**      recorded together (e.g. housekeeping, science, events) so a start
+**      record command selects sets rather than individual MsgIds.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+#ifndef _rectbl_
+#define _rectbl_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "json.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define RECTBL_UNUSED_MSG_ID (CFE_SB_INVALID_MSG_ID)
+
+/*
+** Event Message IDs
+*/
+
+#define RECTBL_CREATE_FILE_ERR_EID    (RECTBL_BASE_EID + 0)
+#define RECTBL_LOAD_TYPE_ERR_EID      (RECTBL_BASE_EID + 1)
+#define RECTBL_LOAD_EMPTY_ERR_EID     (RECTBL_BASE_EID + 2)
+#define RECTBL_LOAD_OPEN_ERR_EID      (RECTBL_BASE_EID + 3)
+#define RECTBL_LOAD_ATTR_ERR_EID      (RECTBL_BASE_EID + 4)
+#define RECTBL_LOAD_FULL_ERR_EID      (RECTBL_BASE_EID + 5)
+#define RECTBL_LOAD_DUPLICATE_ERR_EID (RECTBL_BASE_EID + 6)
+
+/*
+** Table Structure Objects
+*/
+
+#define  RECTBL_OBJ_REC       0
+#define  RECTBL_OBJ_CNT       1
+
+#define  RECTBL_OBJ_NAME_REC  "record"
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Table -  Local table copy used for table loads
+**
+*/
+
+typedef struct {
+
+   CFE_SB_MsgId_t   MsgId;
+   uint16           BufLim;
+   uint8            Set;      /* 0..RECTBL_SET_CNT-1 */
+
+} RECTBL_Entry;
+
+
+typedef struct {
+
+   uint16        EntryCnt;
+   RECTBL_Entry  Entry[RECTBL_MAX_ENTRIES];
+
+} RECTBL_Tbl;
+
+
+/*
+** Table Owner Callback Functions
+*/
+
+/* Return pointer to owner's table data */
+typedef const RECTBL_Tbl* (*RECTBL_GetTblPtr)(void);
+
+/* Table Owner's function to load all table data */
+typedef bool    (*RECTBL_LoadTbl)(RECTBL_Tbl* NewTbl);
+
+
+typedef struct {
+
+   uint8    LastLoadStatus;
+   uint16   AttrErrCnt;
+
+   RECTBL_Tbl Tbl;
+
+   RECTBL_GetTblPtr    GetTblPtrFunc;
+   RECTBL_LoadTbl      LoadTblFunc;
+
+   JSON_Class Json;
+   JSON_Obj   JsonObj[RECTBL_OBJ_CNT];
+   char       JsonFileBuf[JSON_MAX_FILE_CHAR];
+   jsmntok_t  JsonFileTokens[JSON_MAX_FILE_TOKENS];
+
+} RECTBL_Class;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: RECTBL_Constructor
+**
+** Initialize the Record Table object.
+**
+** Notes:
+**   1. The table values are not populated. This is done when the table is
+**      registered with the table manager.
+*/
+void RECTBL_Constructor(RECTBL_Class*    ObjPtr,
+                        RECTBL_GetTblPtr GetTblPtrFunc,
+                        RECTBL_LoadTbl   LoadTblFunc);
+
+
+/******************************************************************************
+** Function: RECTBL_SetTblToUnused
+**
+*/
+void RECTBL_SetTblToUnused(RECTBL_Tbl* TblPtr);
+
+
+/******************************************************************************
+** Function: RECTBL_ResetStatus
+**
+** Reset counters and status flags to a known reset state.  The behavior of
+** the table manager should not be impacted. The intent is to clear counters
+** and flags to a known default state for telemetry.
+**
+*/
+void RECTBL_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: RECTBL_LoadCmd
+**
+** Command to load the table.
+**
+** Notes:
+**  1. Function signature must match TBLMGR_LoadTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager.
+**  3. Only TBLMGR_LOAD_TBL_REPLACE is supported because the recorder
+**     resubscribes its record pipe for every load.
+**
+*/
+bool RECTBL_LoadCmd(TBLMGR_Tbl *Tbl, uint8 LoadType, const char* Filename);
+
+
+/******************************************************************************
+** Function: RECTBL_DumpCmd
+**
+** Command to dump the table.
+**
+** Notes:
+**  1. Function signature must match TBLMGR_DumpTblFuncPtr.
+**  2. Can assume valid table file name because this is a callback from
+**     the app framework table manager.
+**
+*/
+bool RECTBL_DumpCmd(TBLMGR_Tbl *Tbl, uint8 DumpType, const char* Filename);
+
+#endif /* _rectbl_ */
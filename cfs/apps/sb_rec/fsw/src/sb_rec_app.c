@@ -0,0 +1,349 @@
+/*
+** Purpose: Implement the SB Recorder application
+**
+** Notes:
+**   1. See header notes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Includes
+*/
+
+#include <string.h>
+#include "sb_rec_app.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/* Convenience macros */
+#define  INITBL_OBJ    (&(SbRec.IniTbl))
+#define  CMDMGR_OBJ    (&(SbRec.CmdMgr))
+#define  TBLMGR_OBJ    (&(SbRec.TblMgr))
+#define  CHILDMGR_OBJ  (&(SbRec.ChildMgr))
+#define  RECTBL_OBJ    (&(SbRec.RecTbl))
+#define  RECORDER_OBJ  (&(SbRec.Recorder))
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static int32 InitApp(void);
+static int32 ProcessCommands(void);
+
+
+/**********************/
+/** File Global Data **/
+/**********************/
+
+/*
+** Must match DECLARE ENUM() declaration in app_cfg.h
+** Defines "static INILIB_CfgEnum IniCfgEnum"
+*/
+DEFINE_ENUM(Config,APP_CONFIG)
+
+
+/*****************/
+/** Global Data **/
+/*****************/
+
+SB_REC_Class  SbRec;
+
+
+/******************************************************************************
+** Function: SB_REC_AppMain
+**
+*/
+void SB_REC_AppMain(void)
+{
+
+   uint32 RunStatus = CFE_ES_RunStatus_APP_ERROR;
+
+
+   CFE_EVS_Register(NULL, 0, CFE_EVS_NO_FILTER);
+
+   if (InitApp() == CFE_SUCCESS) {  /* Performs initial CFE_ES_PerfLogEntry() call */
+
+      RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+   }
+
+   /*
+   ** Main process loop
+   */
+   while (CFE_ES_RunLoop(&RunStatus)) {
+
+      RECORDER_RecordMsgs(SbRec.PerfId);  /* Pends up to REC_PIPE_TIMEOUT & manages CFE_ES_PerfLogEntry() calls */
+
+      RunStatus = ProcessCommands();
+
+   } /* End CFE_ES_RunLoop */
+
+   CFE_ES_WriteToSysLog("SB_REC App terminating, err = 0x%08X\n", RunStatus);   /* Use SysLog, events may not be working */
+
+   CFE_EVS_SendEvent(SB_REC_EXIT_EID, CFE_EVS_EventType_CRITICAL, "SB_REC App terminating, err = 0x%08X", RunStatus);
+
+   CFE_ES_ExitApp(RunStatus);  /* Let cFE kill the task (and any child tasks) */
+
+} /* End of SB_REC_AppMain() */
+
+
+/******************************************************************************
+** Function: SB_REC_NoOpCmd
+**
+*/
+
+bool SB_REC_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CFE_EVS_SendEvent (SB_REC_NOOP_EID, CFE_EVS_EventType_INFORMATION,
+                      "No operation command received for SB_REC App version %d.%d.%d",
+                      SB_REC_MAJOR_VER, SB_REC_MINOR_VER, SB_REC_PLATFORM_REV);
+
+   return true;
+
+
+} /* End SB_REC_NoOpCmd() */
+
+
+/******************************************************************************
+** Function: SB_REC_ResetAppCmd
+**
+** Notes:
+**   1. No need to pass an object reference to contained objects becuase they
+**      already have a reference from when they were constructed
+**
+*/
+
+bool SB_REC_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CMDMGR_ResetStatus(CMDMGR_OBJ);
+   TBLMGR_ResetStatus(TBLMGR_OBJ);
+   CHILDMGR_ResetStatus(CHILDMGR_OBJ);
+
+   RECORDER_ResetStatus();
+
+   return true;
+
+} /* End SB_REC_ResetAppCmd() */
+
+
+/******************************************************************************
+** Function: SB_REC_SendHousekeepingPkt
+**
+*/
+void SB_REC_SendHousekeepingPkt(void)
+{
+
+   SbRec.HkPkt.ValidCmdCnt   = SbRec.CmdMgr.ValidCmdCnt;
+   SbRec.HkPkt.InvalidCmdCnt = SbRec.CmdMgr.InvalidCmdCnt;
+
+   /*
+   ** Record Table
+   */
+
+   SbRec.HkPkt.RecTblLastLoadStatus = SbRec.RecTbl.LastLoadStatus;
+   SbRec.HkPkt.RecTblEntryCnt       = (uint8)SbRec.Recorder.Tbl.EntryCnt;
+   SbRec.HkPkt.RecTblAttrErrCnt     = SbRec.RecTbl.AttrErrCnt;
+
+   /*
+   ** Recorder
+   */
+
+   SbRec.HkPkt.Recording     = SbRec.Recorder.Recording;
+   SbRec.HkPkt.SetMask       = SbRec.Recorder.SetMask;
+   SbRec.HkPkt.SubscribedCnt = SbRec.Recorder.SubscribedCnt;
+
+   SbRec.HkPkt.PktCnt        = SbRec.Recorder.PktCnt;
+   SbRec.HkPkt.DropCnt       = SbRec.Recorder.DropCnt;
+   SbRec.HkPkt.RecKbytes     = (uint32)(SbRec.Recorder.ByteCnt >> 10);
+
+   if (SbRec.Recorder.ActiveSeg != NULL) {
+
+      SbRec.HkPkt.SegSeq  = SbRec.Recorder.ActiveSeg->Seq;
+      SbRec.HkPkt.SegFill = SbRec.Recorder.ActiveSeg->DataOff;
+
+   }
+   else {
+
+      SbRec.HkPkt.SegSeq  = SbRec.Recorder.RecSeg.NextSeq;
+      SbRec.HkPkt.SegFill = 0;
+
+   }
+
+   SbRec.HkPkt.SegCreateCnt  = SbRec.Recorder.RecSeg.CreateCnt;
+   SbRec.HkPkt.SegCloseCnt   = SbRec.Recorder.RecSeg.CloseCnt;
+   SbRec.HkPkt.SegErrCnt     = SbRec.Recorder.RecSeg.ErrCnt;
+
+   CFE_SB_TimeStampMsg(&(SbRec.HkPkt.TlmHeader.Msg));
+   CFE_SB_TransmitMsg(&(SbRec.HkPkt.TlmHeader.Msg), true);
+
+} /* End SB_REC_SendHousekeepingPkt() */
+
+
+/******************************************************************************
+** Function: InitApp
+**
+** Notes:
+**   1. The recorder is constructed before the child task is started because
+**      the child task manages the recorder's segments.
+**   2. Recording is started after the record table is registered so the
+**      REC_START_SET_MASK sets subscribe the default table's MsgIds.
+**
+*/
+static int32 InitApp(void)
+{
+
+   int32 Status = OSK_C_FW_CFS_ERROR;
+
+   CHILDMGR_TaskInit ChildTaskInit;
+
+   /*
+   ** Initialize objects
+   */
+
+   if (INITBL_Constructor(&SbRec.IniTbl, SB_REC_INI_FILENAME, &IniCfgEnum)) {
+
+      SbRec.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_APP_PERF_ID);
+      SbRec.CmdMid    = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_MID);
+      SbRec.SendHkMid = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_SEND_HK_MID);
+      CFE_ES_PerfLogEntry(SbRec.PerfId);
+
+      RECORDER_Constructor(RECORDER_OBJ, INITBL_OBJ);
+
+      /* Constructor sends error events */
+      ChildTaskInit.TaskName  = INITBL_GetStrConfig(INITBL_OBJ, CFG_CHILD_NAME);
+      ChildTaskInit.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PERF_ID);
+      ChildTaskInit.StackSize = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_STACK_SIZE);
+      ChildTaskInit.Priority  = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PRIORITY);
+      Status = CHILDMGR_Constructor(CHILDMGR_OBJ,
+                                    ChildMgr_TaskMainCallback,
+                                    RECORDER_ChildTask,
+                                    &ChildTaskInit);
+
+   } /* End if INITBL Constructed */
+
+   if (Status == CFE_SUCCESS) {
+
+      /*
+      ** Initialize app level interfaces
+      */
+
+      CFE_SB_CreatePipe(&SbRec.CmdPipe, INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_PIPE_DEPTH), INITBL_GetStrConfig(INITBL_OBJ, CFG_CMD_PIPE_NAME));
+      CFE_SB_Subscribe(SbRec.CmdMid,    SbRec.CmdPipe);
+      CFE_SB_Subscribe(SbRec.SendHkMid, SbRec.CmdPipe);
+
+      CMDMGR_Constructor(CMDMGR_OBJ);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_NOOP_CMD_FC,   NULL, SB_REC_NoOpCmd,     0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_RESET_CMD_FC,  NULL, SB_REC_ResetAppCmd, 0);
+
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REC_REC_TBL_LOAD_CMD_FC, TBLMGR_OBJ,   TBLMGR_LoadTblCmd,    TBLMGR_LOAD_TBL_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REC_REC_TBL_DUMP_CMD_FC, TBLMGR_OBJ,   TBLMGR_DumpTblCmd,    TBLMGR_DUMP_TBL_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REC_START_REC_CMD_FC,    RECORDER_OBJ, RECORDER_StartRecCmd, RECORDER_START_REC_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REC_STOP_REC_CMD_FC,     RECORDER_OBJ, RECORDER_StopRecCmd,  RECORDER_STOP_REC_CMD_DATA_LEN);
+
+      RECTBL_Constructor(RECTBL_OBJ, RECORDER_GetTblPtr, RECORDER_LoadTbl);
+
+      TBLMGR_Constructor(TBLMGR_OBJ);
+      TBLMGR_RegisterTblWithDef(TBLMGR_OBJ, RECTBL_LoadCmd, RECTBL_DumpCmd, INITBL_GetStrConfig(INITBL_OBJ, CFG_REC_TBL_FILENAME));
+
+      if (INITBL_GetIntConfig(INITBL_OBJ, CFG_REC_START_SET_MASK) != 0) {
+
+         RECORDER_StartRec((uint8)INITBL_GetIntConfig(INITBL_OBJ, CFG_REC_START_SET_MASK));
+
+      }
+
+      CFE_MSG_Init(&SbRec.HkPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_HK_TLM_MID), SB_REC_TLM_HK_LEN);
+
+      /*
+      ** Application startup event message
+      */
+      CFE_EVS_SendEvent(SB_REC_INIT_APP_EID, CFE_EVS_EventType_INFORMATION,
+                        "SB_REC App Initialized. Version %d.%d.%d",
+                        SB_REC_MAJOR_VER, SB_REC_MINOR_VER, SB_REC_PLATFORM_REV);
+
+   } /* End if CHILDMGR constructed */
+
+   return(Status);
+
+} /* End of InitApp() */
+
+
+/******************************************************************************
+** Function: ProcessCommands
+**
+** Notes:
+**   1. Polls the command pipe until it is empty. The record pipe pend in
+**      the main loop sets the command processing rate.
+**
+*/
+static int32 ProcessCommands(void)
+{
+
+   int32  RetStatus = CFE_ES_RunStatus_APP_RUN;
+   int32  SysStatus;
+   int32  MsgStatus;
+   int32  MsgInt;
+
+   CFE_SB_Buffer_t* SbBufPtr;
+   CFE_SB_MsgId_t   MsgId = CFE_SB_INVALID_MSG_ID;
+
+
+   SysStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, SbRec.CmdPipe, CFE_SB_POLL);
+
+   while (SysStatus == CFE_SUCCESS) {
+
+      MsgStatus = CFE_MSG_GetMsgId(&SbBufPtr->Msg, &MsgId);
+
+      if (MsgStatus == CFE_SUCCESS) {
+
+         MsgInt = CFE_SB_MsgIdToValue(MsgId);
+
+         if (MsgInt == SbRec.CmdMid) {
+
+            CMDMGR_DispatchFunc(CMDMGR_OBJ, SbBufPtr);
+
+         }
+         else if (MsgInt == SbRec.SendHkMid) {
+
+            SB_REC_SendHousekeepingPkt();
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(SB_REC_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                              "Received invalid command packet, MID = 0x%08X", MsgInt);
+         }
+
+      }
+      else {
+
+         CFE_EVS_SendEvent(SB_REC_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                           "CFE couldn't retrieve message ID from the message, Status = %d", MsgStatus);
+      }
+
+      SysStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, SbRec.CmdPipe, CFE_SB_POLL);
+
+   } /* End while command messages */
+
+   if (SysStatus != CFE_SB_NO_MESSAGE) {
+
+      CFE_ES_WriteToSysLog("SB_REC software bus error. Status = 0x%08X\n", SysStatus);   /* Use SysLog, events may not be working */
+      RetStatus = CFE_ES_RunStatus_APP_ERROR;
+
+   }
+
+   return RetStatus;
+
+} /* ProcessCommands() */
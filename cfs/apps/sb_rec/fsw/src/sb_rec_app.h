@@ -0,0 +1,177 @@
+/*
+** Purpose: Define the SB Recorder application
+**
+** Notes:
+**   1. Records software bus messages to memory-mapped segment files with a
+**      time and MsgId index. See recorder.h for the data flow and recseg.h
+**      for the file formats.
+**   2. The main loop pends on the record pipe so recording isn't tied to
+**      the command rate. The command pipe is polled after each record pipe
+**      wake up or timeout.
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+*/
+#ifndef _sb_rec_app_
+#define _sb_rec_app_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "childmgr.h"
+#include "initbl.h"
+#include "recorder.h"
+#include "rectbl.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/*
+** Events
+*/
+
+#define SB_REC_INIT_APP_EID    (SB_REC_BASE_EID + 0)
+#define SB_REC_NOOP_EID        (SB_REC_BASE_EID + 1)
+#define SB_REC_EXIT_EID        (SB_REC_BASE_EID + 2)
+#define SB_REC_INVALID_MID_EID (SB_REC_BASE_EID + 3)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+
+/******************************************************************************
+** Telemetry Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_TelemetryHeader_t TlmHeader;
+
+   /*
+   ** Framework Status
+   */
+
+   uint16   ValidCmdCnt;
+   uint16   InvalidCmdCnt;
+
+   /*
+   ** Record Table
+   */
+
+   uint8    RecTblLastLoadStatus;
+   uint8    RecTblEntryCnt;
+   uint16   RecTblAttrErrCnt;
+
+   /*
+   ** Recorder
+   */
+
+   uint8    Recording;
+   uint8    SetMask;
+   uint16   SubscribedCnt;
+
+   uint32   PktCnt;
+   uint32   DropCnt;
+   uint32   RecKbytes;
+
+   uint32   SegSeq;          /* Active segment, or next segment if idle */
+   uint32   SegFill;         /* Bytes recorded in the active segment    */
+   uint32   SegCreateCnt;
+   uint32   SegCloseCnt;
+   uint32   SegErrCnt;
+
+} SB_REC_HkPkt;
+#define SB_REC_TLM_HK_LEN sizeof (SB_REC_HkPkt)
+
+
+/******************************************************************************
+** SB_REC_Class
+*/
+typedef struct {
+
+   /*
+   ** App Framework
+   */
+
+   INITBL_Class    IniTbl;
+   CFE_SB_PipeId_t CmdPipe;
+   CMDMGR_Class    CmdMgr;
+   TBLMGR_Class    TblMgr;
+   CHILDMGR_Class  ChildMgr;
+
+   /*
+   ** Telemetry Packets
+   */
+
+   SB_REC_HkPkt     HkPkt;
+
+   /*
+   ** App State & Objects
+   */
+
+   uint32           PerfId;
+   CFE_SB_MsgId_t   CmdMid;
+   CFE_SB_MsgId_t   SendHkMid;
+
+   RECTBL_Class     RecTbl;
+   RECORDER_Class   Recorder;
+
+} SB_REC_Class;
+
+
+/*******************/
+/** Exported Data **/
+/*******************/
+
+extern SB_REC_Class  SbRec;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: SB_REC_AppMain
+**
+*/
+void SB_REC_AppMain(void);
+
+
+/******************************************************************************
+** Function: SB_REC_NoOpCmd
+**
+*/
+bool SB_REC_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_REC_ResetAppCmd
+**
+*/
+bool SB_REC_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_REC_SendHousekeepingPkt
+**
+*/
+void SB_REC_SendHousekeepingPkt(void);
+
+
+#endif /* _sb_rec_app_ */
@@ -0,0 +1,35 @@
+/*
+** Purpose: Define platform configurations for the SB Replay application
+**
+** Notes:
+**   None
+**
+** License:
+**   Written by David McComas and licensed under the GNU
+**   Lesser General Public License (LGPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+*/
+
+#ifndef _sb_replay_platform_cfg_
+#define _sb_replay_platform_cfg_
+
+/*
+** Includes
+*/
+
+#include "sb_replay_mission_cfg.h"
+
+
+/******************************************************************************
+** Platform Deployment Configurations
+*/
+
+#define SB_REPLAY_PLATFORM_REV   0
+#define SB_REPLAY_INI_FILENAME   "/cf/sb_replay_ini.json"
+
+
+#endif /* _sb_replay_platform_cfg_ */
@@ -0,0 +1,132 @@
+/*
+** Purpose: Define application configurations for the SB Replay
+**          application
+**
+** Notes:
+**   1. These macros can only be built with the application and can't
+**      have a platform scope because the same app_cfg.h filename is used for
+**      all applications following the object-based application design.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+#ifndef _app_cfg_
+#define _app_cfg_
+
+/*
+** Includes
+*/
+
+#include "sb_replay_platform_cfg.h"
+#include "osk_c_fw.h"
+
+
+/******************************************************************************
+** Application Macros
+*/
+
+/*
+** Versions:
+**
+** 1.0 - Initial release
+*/
+
+#define  SB_REPLAY_MAJOR_VER   1
+#define  SB_REPLAY_MINOR_VER   0
+
+
+/******************************************************************************
+** Init File declarations create:
+**
+**  typedef enum {
+**     CMD_PIPE_DEPTH,
+**     CMD_PIPE_NAME
+**  } INITBL_ConfigEnum;
+**
+**  typedef struct {
+**     CMD_PIPE_DEPTH,
+**     CMD_PIPE_NAME
+**  } INITBL_ConfigStruct;
+**
+**   const char *GetConfigStr(value);
+**   ConfigEnum GetConfigVal(const char *str);
+**
+** XX(name,type)
+*/
+
+#define CFG_APP_CFE_NAME       APP_CFE_NAME
+#define CFG_APP_PERF_ID        APP_PERF_ID
+
+#define CFG_CHILD_NAME         CHILD_NAME
+#define CFG_CHILD_PERF_ID      CHILD_PERF_ID
+#define CFG_CHILD_STACK_SIZE   CHILD_STACK_SIZE
+#define CFG_CHILD_PRIORITY     CHILD_PRIORITY
+#define CFG_CHILD_POLL_DELAY   CHILD_POLL_DELAY
+
+#define CFG_CMD_PIPE_NAME      CMD_PIPE_NAME
+#define CFG_CMD_PIPE_DEPTH     CMD_PIPE_DEPTH
+
+#define CFG_CMD_MID            CMD_MID
+#define CFG_SEND_HK_MID        SEND_HK_MID
+#define CFG_HK_TLM_MID         HK_TLM_MID
+
+#define CFG_BURST_PKTS         BURST_PKTS
+#define CFG_MAX_DELAY          MAX_DELAY
+#define CFG_MAX_GAP            MAX_GAP
+
+#define APP_CONFIG(XX) \
+   XX(APP_CFE_NAME,char*) \
+   XX(APP_PERF_ID,uint32) \
+   XX(CHILD_NAME,char*) \
+   XX(CHILD_PERF_ID,uint32) \
+   XX(CHILD_STACK_SIZE,uint32) \
+   XX(CHILD_PRIORITY,uint32) \
+   XX(CHILD_POLL_DELAY,uint32) \
+   XX(CMD_PIPE_NAME,char*) \
+   XX(CMD_PIPE_DEPTH,uint32) \
+   XX(CMD_MID,uint32) \
+   XX(SEND_HK_MID,uint32) \
+   XX(HK_TLM_MID,uint32) \
+   XX(BURST_PKTS,uint32) \
+   XX(MAX_DELAY,uint32) \
+   XX(MAX_GAP,uint32) \
+
+DECLARE_ENUM(Config,APP_CONFIG)
+
+
+/******************************************************************************
+** Command Macros
+*/
+
+#define SB_REPLAY_START_CMD_FC  (CMDMGR_APP_START_FC + 0)
+#define SB_REPLAY_STOP_CMD_FC   (CMDMGR_APP_START_FC + 1)
+
+
+/******************************************************************************
+** Event Macros
+**
+** Define the base event message IDs used by each object/component used by the
+** application. There are no automated checks to ensure an ID range is not
+** exceeded so it is the developer's responsibility to verify the ranges.
+*/
+
+#define SB_REPLAY_BASE_EID  (OSK_C_FW_APP_BASE_EID +  0)
+#define REPLAY_BASE_EID     (OSK_C_FW_APP_BASE_EID + 20)
+
+
+/******************************************************************************
+** Replay
+**
+** REPLAY_FILE_BUF_BYTES is the file read size. It must hold at least one
+** maximum size SB message.
+*/
+
+#define REPLAY_FILE_BUF_BYTES  32768
+
+
+#endif /* _app_cfg_ */
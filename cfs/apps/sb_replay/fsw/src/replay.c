@@ -0,0 +1,585 @@
+/*
+** Purpose: Implement the SB Replay class
+**
+** Notes:
+**   1. See header notes.
+**   2. Messages in the file buffer aren't aligned so their headers are
+**      copied to a local header before the CFE_MSG accessors are used.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Include Files:
+*/
+
+#include <string.h>
+#include "replay.h"
+
+
+/**********************/
+/** Global File Data **/
+/**********************/
+
+static REPLAY_Class*  Replay = NULL;
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static bool         OpenFile(void);
+static void         CloseFile(bool EndOfFile);
+static bool         FillFileBuf(void);
+static const uint8* PeekMsg(CFE_MSG_TelemetryHeader_t* MsgHdr, uint32* MsgSize, bool* EndOfFile);
+static int64        PacedDelay(const CFE_MSG_Message_t* MsgPtr);
+static void         SendMsg(const uint8* MsgPtr, uint32 MsgSize);
+static void         ReplayMsgs(void);
+static int64        TimeToMicroSecs(CFE_TIME_SysTime_t Time);
+static uint32       ElapsedMs(void);
+
+
+/******************************************************************************
+** Function: REPLAY_Constructor
+**
+*/
+void REPLAY_Constructor(REPLAY_Class *ReplayPtr, INITBL_Class* IniTbl)
+{
+
+   Replay = ReplayPtr;
+
+   CFE_PSP_MemSet((void*)Replay, 0, sizeof(REPLAY_Class));
+
+   Replay->BurstPkts     = INITBL_GetIntConfig(IniTbl, CFG_BURST_PKTS);
+   Replay->MaxDelay      = INITBL_GetIntConfig(IniTbl, CFG_MAX_DELAY);
+   Replay->MaxGap        = INITBL_GetIntConfig(IniTbl, CFG_MAX_GAP);
+   Replay->IdlePollDelay = INITBL_GetIntConfig(IniTbl, CFG_CHILD_POLL_DELAY);
+
+   Replay->State      = REPLAY_STATE_IDLE;
+   Replay->FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+} /* End REPLAY_Constructor() */
+
+
+/******************************************************************************
+** Function: REPLAY_ResetStatus
+**
+*/
+void REPLAY_ResetStatus(void)
+{
+
+   Replay->ReplayCnt = 0;
+   Replay->ErrCnt    = 0;
+
+   if (__atomic_load_n(&Replay->State, __ATOMIC_ACQUIRE) == REPLAY_STATE_IDLE) {
+
+      Replay->PktCnt    = 0;
+      Replay->SkipCnt   = 0;
+      Replay->DropCnt   = 0;
+      Replay->ByteCnt   = 0;
+      Replay->ElapsedMs = 0;
+      Replay->MaxLagMs  = 0;
+
+   }
+
+} /* End REPLAY_ResetStatus() */
+
+
+/******************************************************************************
+** Function: REPLAY_StartCmd
+**
+*/
+bool REPLAY_StartCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   const REPLAY_StartCmdMsg* Cmd = (const REPLAY_StartCmdMsg *) SbBufPtr;
+
+
+   if (__atomic_load_n(&Replay->State, __ATOMIC_ACQUIRE) != REPLAY_STATE_IDLE) {
+
+      CFE_EVS_SendEvent(REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Start replay command rejected. Replay of %s in progress", Replay->Filename);
+      return false;
+
+   }
+
+   if (!FileUtil_VerifyFileForRead(Cmd->Filename)) {
+
+      CFE_EVS_SendEvent(REPLAY_START_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Start replay command rejected. Can't read file %s", Cmd->Filename);
+      return false;
+
+   }
+
+   strncpy(Replay->Filename, Cmd->Filename, OS_MAX_PATH_LEN - 1);
+   Replay->Filename[OS_MAX_PATH_LEN - 1] = '\0';
+   Replay->Speed    = Cmd->Speed;
+   Replay->InclCmds = (Cmd->InclCmds != 0);
+
+   __atomic_store_n(&Replay->StopReq, false, __ATOMIC_RELAXED);
+   __atomic_store_n(&Replay->State, REPLAY_STATE_STARTING, __ATOMIC_RELEASE);
+
+   return true;
+
+} /* End REPLAY_StartCmd() */
+
+
+/******************************************************************************
+** Function: REPLAY_StopCmd
+**
+** Notes:
+**   1. The child task closes the file and sends the completion event.
+**
+*/
+bool REPLAY_StopCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   if (__atomic_load_n(&Replay->State, __ATOMIC_ACQUIRE) != REPLAY_STATE_IDLE) {
+
+      __atomic_store_n(&Replay->StopReq, true, __ATOMIC_RELEASE);
+
+   }
+   else {
+
+      CFE_EVS_SendEvent(REPLAY_STOP_CMD_EID, CFE_EVS_EventType_INFORMATION,
+                        "Stop replay command received with no replay in progress");
+
+   }
+
+   return true;
+
+} /* End REPLAY_StopCmd() */
+
+
+/******************************************************************************
+** Function: REPLAY_ChildTask
+**
+*/
+bool REPLAY_ChildTask(CHILDMGR_Class* ChildMgr)
+{
+
+   switch (__atomic_load_n(&Replay->State, __ATOMIC_ACQUIRE)) {
+
+      case REPLAY_STATE_STARTING:
+         if (OpenFile()) {
+            __atomic_store_n(&Replay->State, REPLAY_STATE_ACTIVE, __ATOMIC_RELEASE);
+         }
+         else {
+            __atomic_store_n(&Replay->State, REPLAY_STATE_IDLE, __ATOMIC_RELEASE);
+         }
+         break;
+
+      case REPLAY_STATE_ACTIVE:
+         if (__atomic_load_n(&Replay->StopReq, __ATOMIC_ACQUIRE)) {
+            CloseFile(false);
+         }
+         else {
+            ReplayMsgs();
+         }
+         break;
+
+      default:
+         OS_TaskDelay(Replay->IdlePollDelay);
+         break;
+
+   } /* End state switch */
+
+   return true;
+
+} /* End REPLAY_ChildTask() */
+
+
+/******************************************************************************
+** Function: OpenFile
+**
+** Open the replay file, verify its cFE header and start a new set of
+** statistics.
+**
+*/
+static bool OpenFile(void)
+{
+
+   int32            OsStatus;
+   CFE_FS_Header_t  FileHeader;
+
+
+   OsStatus = OS_OpenCreate(&Replay->FileHandle, Replay->Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+   if (OsStatus != OS_SUCCESS) {
+
+      Replay->ErrCnt++;
+      CFE_EVS_SendEvent(REPLAY_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Error opening replay file %s, status 0x%08X", Replay->Filename, OsStatus);
+      return false;
+
+   }
+
+   if ((CFE_FS_ReadHeader(&FileHeader, Replay->FileHandle) != sizeof(CFE_FS_Header_t)) ||
+       (FileHeader.ContentType != CFE_FS_FILE_CONTENT_ID)) {
+
+      OS_close(Replay->FileHandle);
+      Replay->FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+      Replay->ErrCnt++;
+      CFE_EVS_SendEvent(REPLAY_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Replay file %s doesn't start with a cFE file header", Replay->Filename);
+      return false;
+
+   }
+
+   Replay->FileBufLen   = 0;
+   Replay->FileBufOff   = 0;
+   Replay->HaveBase     = false;
+   Replay->DropReported = false;
+
+   Replay->PktCnt    = 0;
+   Replay->SkipCnt   = 0;
+   Replay->DropCnt   = 0;
+   Replay->ByteCnt   = 0;
+   Replay->ElapsedMs = 0;
+   Replay->MaxLagMs  = 0;
+
+   OS_GetLocalTime(&Replay->StartWall);
+
+   CFE_EVS_SendEvent(REPLAY_START_EID, CFE_EVS_EventType_INFORMATION,
+                     "Replaying %s (subtype %u, %s) at speed %d%s, commands %s",
+                     Replay->Filename, (unsigned int)FileHeader.SubType, FileHeader.Description,
+                     Replay->Speed, (Replay->Speed == 0) ? " (as fast as possible)" : "x",
+                     Replay->InclCmds ? "included" : "skipped");
+
+   return true;
+
+} /* End OpenFile() */
+
+
+/******************************************************************************
+** Function: CloseFile
+**
+** Close the replay file and report the replay's throughput.
+**
+*/
+static void CloseFile(bool EndOfFile)
+{
+
+   uint32 RateDivisor;
+
+
+   OS_close(Replay->FileHandle);
+   Replay->FileHandle = OS_OBJECT_ID_UNDEFINED;
+
+   Replay->ElapsedMs = ElapsedMs();
+   RateDivisor = (Replay->ElapsedMs > 0) ? Replay->ElapsedMs : 1;
+
+   if (EndOfFile) Replay->ReplayCnt++;
+
+   CFE_EVS_SendEvent(REPLAY_COMPLETE_EID, CFE_EVS_EventType_INFORMATION,
+                     "Replay of %s %s. Sent %u msgs, %u KB in %u ms (%u msgs/s, %u KB/s). Dropped %u, skipped %u, max lag %u ms",
+                     Replay->Filename, EndOfFile ? "complete" : "stopped",
+                     (unsigned int)Replay->PktCnt, (unsigned int)(Replay->ByteCnt >> 10), (unsigned int)Replay->ElapsedMs,
+                     (unsigned int)(((uint64)Replay->PktCnt * 1000) / RateDivisor),
+                     (unsigned int)((Replay->ByteCnt * 1000 / RateDivisor) >> 10),
+                     (unsigned int)Replay->DropCnt, (unsigned int)Replay->SkipCnt, (unsigned int)Replay->MaxLagMs);
+
+   __atomic_store_n(&Replay->StopReq, false, __ATOMIC_RELAXED);
+   __atomic_store_n(&Replay->State, REPLAY_STATE_IDLE, __ATOMIC_RELEASE);
+
+} /* End CloseFile() */
+
+
+/******************************************************************************
+** Function: ReplayMsgs
+**
+** Send up to BURST_PKTS messages that are due.
+**
+** Notes:
+**   1. Returns after delaying for the next paced message (limited to
+**      MAX_DELAY) so a stop request is serviced promptly.
+**
+*/
+static void ReplayMsgs(void)
+{
+
+   uint32                     BurstCnt = 0;
+   uint32                     MsgSize;
+   bool                       EndOfFile;
+   int64                      DelayUs;
+   const uint8*               MsgPtr;
+   CFE_MSG_Type_t             MsgType;
+   CFE_MSG_TelemetryHeader_t  MsgHdr;
+
+
+   while (BurstCnt < Replay->BurstPkts) {
+
+      MsgPtr = PeekMsg(&MsgHdr, &MsgSize, &EndOfFile);
+
+      if (MsgPtr == NULL) {
+
+         CloseFile(EndOfFile);
+         break;
+
+      }
+
+      CFE_MSG_GetType(&MsgHdr.Msg, &MsgType);
+
+      if (MsgType == CFE_MSG_Type_Cmd && !Replay->InclCmds) {
+
+         Replay->SkipCnt++;
+
+      }
+      else {
+
+         DelayUs = PacedDelay(&MsgHdr.Msg);
+
+         if (DelayUs > 0) {
+
+            DelayUs = (DelayUs + 999) / 1000;
+            OS_TaskDelay((DelayUs < Replay->MaxDelay) ? (uint32)DelayUs : Replay->MaxDelay);
+            break;
+
+         }
+
+         SendMsg(MsgPtr, MsgSize);
+         BurstCnt++;
+
+      }
+
+      Replay->FileBufOff += MsgSize;
+
+   } /* End burst loop */
+
+   Replay->ElapsedMs = ElapsedMs();
+
+} /* End ReplayMsgs() */
+
+
+/******************************************************************************
+** Function: FillFileBuf
+**
+** Move the unread bytes to the start of the file buffer and read more.
+**
+** Notes:
+**   1. Returns false on a read error.
+**
+*/
+static bool FillFileBuf(void)
+{
+
+   int32 BytesRead;
+
+   if (Replay->FileBufOff > 0) {
+
+      Replay->FileBufLen -= Replay->FileBufOff;
+      memmove(Replay->FileBuf, &Replay->FileBuf[Replay->FileBufOff], Replay->FileBufLen);
+      Replay->FileBufOff = 0;
+
+   }
+
+   BytesRead = OS_read(Replay->FileHandle, &Replay->FileBuf[Replay->FileBufLen],
+                       REPLAY_FILE_BUF_BYTES - Replay->FileBufLen);
+
+   if (BytesRead < 0) return false;
+
+   Replay->FileBufLen += BytesRead;
+
+   return true;
+
+} /* End FillFileBuf() */
+
+
+/******************************************************************************
+** Function: PeekMsg
+**
+** Return a pointer to the next complete message in the file buffer without
+** consuming it.
+**
+** Notes:
+**   1. Returns NULL at the end of the file or when the file is corrupt.
+**      EndOfFile is only true for a clean end of file. An error event is
+**      sent for a read error or a corrupt or truncated file.
+**   2. MsgHdr receives an aligned copy of the message header.
+**
+*/
+static const uint8* PeekMsg(CFE_MSG_TelemetryHeader_t* MsgHdr, uint32* MsgSize, bool* EndOfFile)
+{
+
+   bool            ReadOk = true;
+   uint32          Avail  = Replay->FileBufLen - Replay->FileBufOff;
+   CFE_MSG_Size_t  Size   = 0;
+
+
+   if (Avail < sizeof(CFE_MSG_TelemetryHeader_t)) {
+
+      ReadOk = FillFileBuf();
+      Avail  = Replay->FileBufLen - Replay->FileBufOff;
+
+   }
+
+   *EndOfFile = (ReadOk && Avail == 0);
+
+   if (*EndOfFile) return NULL;
+
+   if (ReadOk && Avail >= sizeof(CFE_MSG_Message_t)) {
+
+      CFE_PSP_MemSet(MsgHdr, 0, sizeof(CFE_MSG_TelemetryHeader_t));
+      memcpy(MsgHdr, &Replay->FileBuf[Replay->FileBufOff],
+             (Avail < sizeof(CFE_MSG_TelemetryHeader_t)) ? Avail : sizeof(CFE_MSG_TelemetryHeader_t));
+      CFE_MSG_GetSize(&MsgHdr->Msg, &Size);
+
+      if ((Size >= sizeof(CFE_MSG_Message_t)) && (Size <= CFE_MISSION_SB_MAX_SB_MSG_SIZE)) {
+
+         if (Avail < Size) {
+
+            ReadOk = FillFileBuf();
+            Avail  = Replay->FileBufLen - Replay->FileBufOff;
+
+         }
+
+         if (ReadOk && Avail >= Size) {
+
+            *MsgSize = (uint32)Size;
+            return &Replay->FileBuf[Replay->FileBufOff];
+
+         }
+      }
+   }
+
+   Replay->ErrCnt++;
+   CFE_EVS_SendEvent(REPLAY_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                     "Replay file %s %s at message %u, message length %u",
+                     Replay->Filename, ReadOk ? "corrupt or truncated" : "read error",
+                     (unsigned int)(Replay->PktCnt + Replay->SkipCnt + Replay->DropCnt), (unsigned int)Size);
+
+   return NULL;
+
+} /* End PeekMsg() */
+
+
+/******************************************************************************
+** Function: PacedDelay
+**
+** Return the microseconds until the message is due. Zero or negative means
+** the message is due now.
+**
+*/
+static int64 PacedDelay(const CFE_MSG_Message_t* MsgPtr)
+{
+
+   int64              RecOffset;
+   int64              WallOffset;
+   int64              LagMs;
+   CFE_TIME_SysTime_t MsgTime;
+   OS_time_t          Now;
+
+
+   if ((Replay->Speed == 0) || (CFE_MSG_GetMsgTime(MsgPtr, &MsgTime) != CFE_SUCCESS)) {
+
+      return 0;
+
+   }
+
+   OS_GetLocalTime(&Now);
+
+   if (!Replay->HaveBase ||
+       (CFE_TIME_Compare(MsgTime, Replay->PrevTime) == CFE_TIME_A_LT_B) ||
+       (TimeToMicroSecs(CFE_TIME_Subtract(MsgTime, Replay->PrevTime)) > (int64)Replay->MaxGap * 1000)) {
+
+      Replay->HaveBase = true;
+      Replay->BaseTime = MsgTime;
+      Replay->BaseWall = Now;
+
+   }
+
+   Replay->PrevTime = MsgTime;
+
+   RecOffset  = TimeToMicroSecs(CFE_TIME_Subtract(MsgTime, Replay->BaseTime)) / Replay->Speed;
+   WallOffset = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Replay->BaseWall));
+
+   LagMs = (WallOffset - RecOffset) / 1000;
+   if (LagMs > Replay->MaxLagMs) Replay->MaxLagMs = (uint32)LagMs;
+
+   return RecOffset - WallOffset;
+
+} /* End PacedDelay() */
+
+
+/******************************************************************************
+** Function: SendMsg
+**
+** Notes:
+**   1. Allocation and transmit failures are counted as drops. One event is
+**      sent per run of drops.
+**
+*/
+static void SendMsg(const uint8* MsgPtr, uint32 MsgSize)
+{
+
+   int32            SbStatus = CFE_SB_BUF_ALOC_ERR;
+   CFE_SB_Buffer_t* SbBufPtr;
+
+
+   SbBufPtr = CFE_SB_AllocateMessageBuffer(MsgSize);
+
+   if (SbBufPtr != NULL) {
+
+      memcpy(SbBufPtr, MsgPtr, MsgSize);
+
+      SbStatus = CFE_SB_TransmitBuffer(SbBufPtr, false);
+
+      if (SbStatus == CFE_SUCCESS) {
+
+         Replay->PktCnt++;
+         Replay->ByteCnt += MsgSize;
+         Replay->DropReported = false;
+         return;
+
+      }
+
+      CFE_SB_ReleaseMessageBuffer(SbBufPtr);
+
+   }
+
+   Replay->DropCnt++;
+
+   if (!Replay->DropReported) {
+
+      Replay->DropReported = true;
+      CFE_EVS_SendEvent(REPLAY_DROP_EID, CFE_EVS_EventType_ERROR,
+                        "Dropping replayed messages, status 0x%08X", SbStatus);
+
+   }
+
+} /* End SendMsg() */
+
+
+/******************************************************************************
+** Function: TimeToMicroSecs
+**
+*/
+static int64 TimeToMicroSecs(CFE_TIME_SysTime_t Time)
+{
+
+   return ((int64)Time.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Time.Subseconds);
+
+} /* End TimeToMicroSecs() */
+
+
+/******************************************************************************
+** Function: ElapsedMs
+**
+*/
+static uint32 ElapsedMs(void)
+{
+
+   OS_time_t Now;
+
+   OS_GetLocalTime(&Now);
+
+   return (uint32)(OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, Replay->StartWall)) / 1000);
+
+} /* End ElapsedMs() */
@@ -0,0 +1,202 @@
+/*
+** Purpose: Define the SB Replay class
+**
+** Notes:
+**   1. Replays a file containing a cFE file header followed by raw SB
+**      messages back to back, e.g. an SB_REC segment or an EVS log file.
+**      Each message is copied into an SB buffer and sent with
+**      CFE_SB_TransmitBuffer() so it keeps its original sequence count.
+**   2. The parent task validates the start command and hands the replay to
+**      the child task, which owns the file and does all of the pacing. The
+**      replay state is the only shared variable:
+**        Parent: IDLE     -> STARTING (start command accepted)
+**        Child:  STARTING -> ACTIVE   (file opened)
+**        Child:  ACTIVE   -> IDLE     (end of file, error or stop request)
+**   3. Pacing uses the telemetry time stamps:
+**      - Speed 0 sends as fast as possible, BURST_PKTS messages per child
+**        task loop.
+**      - Speed N sends each message when the wall time since the replay
+**        base equals its recorded time since the base divided by N.
+**      - Messages without a time stamp are sent right after the previous
+**        message.
+**      - The base is reset when the recorded time goes backwards or jumps
+**        more than MAX_GAP milliseconds, so replaying several recordings
+**        or a recording with a long pause doesn't stall the replay.
+**   4. Command messages are skipped unless the start command includes them
+**      because replaying recorded commands would re-execute them.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU General Public
+**   Public License (GPL).
+**
+** References:
+**   1. OpenSatKit Object-based Application Developers Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+#ifndef _replay_
+#define _replay_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+#define REPLAY_STATE_IDLE      0
+#define REPLAY_STATE_STARTING  1
+#define REPLAY_STATE_ACTIVE    2
+
+/*
+** Event Message IDs
+*/
+
+#define REPLAY_START_CMD_ERR_EID  (REPLAY_BASE_EID + 0)
+#define REPLAY_STOP_CMD_EID       (REPLAY_BASE_EID + 1)
+#define REPLAY_OPEN_ERR_EID       (REPLAY_BASE_EID + 2)
+#define REPLAY_START_EID          (REPLAY_BASE_EID + 3)
+#define REPLAY_FILE_ERR_EID       (REPLAY_BASE_EID + 4)
+#define REPLAY_DROP_EID           (REPLAY_BASE_EID + 5)
+#define REPLAY_COMPLETE_EID       (REPLAY_BASE_EID + 6)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_CommandHeader_t  CmdHeader;
+   char    Filename[CFE_MISSION_MAX_PATH_LEN];
+   uint16  Speed;          /* 0 = As fast as possible, N = N times recorded rate */
+   uint8   InclCmds;       /* 0 = Skip command messages, 1 = Replay them        */
+   uint8   Spare;
+
+}  REPLAY_StartCmdMsg;
+#define REPLAY_START_CMD_DATA_LEN  (sizeof(REPLAY_StartCmdMsg) - CFE_SB_CMD_HDR_SIZE)
+
+#define REPLAY_STOP_CMD_DATA_LEN   0
+
+
+/******************************************************************************
+** REPLAY_Class
+*/
+
+typedef struct {
+
+   /*
+   ** Configuration
+   */
+
+   uint32   BurstPkts;
+   uint32   MaxDelay;        /* Milliseconds */
+   uint32   MaxGap;          /* Milliseconds */
+   uint32   IdlePollDelay;   /* Milliseconds */
+
+   /*
+   ** Replay request, written by the parent while IDLE
+   */
+
+   uint32   State;           /* REPLAY_STATE_x, accessed atomically */
+   bool     StopReq;         /* Accessed atomically                 */
+   char     Filename[OS_MAX_PATH_LEN];
+   uint16   Speed;
+   bool     InclCmds;
+
+   /*
+   ** Child task state
+   */
+
+   osal_id_t           FileHandle;
+   bool                HaveBase;
+   CFE_TIME_SysTime_t  BaseTime;
+   CFE_TIME_SysTime_t  PrevTime;
+   OS_time_t           BaseWall;
+   OS_time_t           StartWall;
+
+   bool     DropReported;
+
+   uint32   FileBufLen;
+   uint32   FileBufOff;
+   uint8    FileBuf[REPLAY_FILE_BUF_BYTES];
+
+   /*
+   ** Statistics for the current or last replay
+   */
+
+   uint32   PktCnt;
+   uint32   SkipCnt;
+   uint32   DropCnt;
+   uint64   ByteCnt;
+   uint32   ElapsedMs;
+   uint32   MaxLagMs;        /* Largest delay behind the paced send time */
+
+   uint32   ReplayCnt;       /* Replays that reached the end of the file */
+   uint32   ErrCnt;
+
+} REPLAY_Class;
+
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: REPLAY_Constructor
+**
+** Initialize the replay object to a known state
+**
+** Notes:
+**   1. This must be called prior to any other function.
+**
+*/
+void REPLAY_Constructor(REPLAY_Class *ReplayPtr, INITBL_Class* IniTbl);
+
+
+/******************************************************************************
+** Function: REPLAY_ResetStatus
+**
+** Reset counters and status flags to a known reset state.
+**
+** Notes:
+**   1. The statistics of a replay in progress are not reset so its
+**      throughput stays consistent.
+**
+*/
+void REPLAY_ResetStatus(void);
+
+
+/******************************************************************************
+** Function: REPLAY_StartCmd
+**
+*/
+bool REPLAY_StartCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: REPLAY_StopCmd
+**
+*/
+bool REPLAY_StopCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: REPLAY_ChildTask
+**
+*/
+bool REPLAY_ChildTask(CHILDMGR_Class* ChildMgr);
+
+
+#endif /* _replay_ */
@@ -0,0 +1,316 @@
+/*
+** Purpose: Implement the SB Replay application
+**
+** Notes:
+**   1. See header notes.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+*/
+
+/*
+** Includes
+*/
+
+#include <string.h>
+#include "sb_replay_app.h"
+
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/* Convenience macros */
+#define  INITBL_OBJ    (&(SbReplay.IniTbl))
+#define  CMDMGR_OBJ    (&(SbReplay.CmdMgr))
+#define  CHILDMGR_OBJ  (&(SbReplay.ChildMgr))
+#define  REPLAY_OBJ    (&(SbReplay.Replay))
+
+
+/*******************************/
+/** Local Function Prototypes **/
+/*******************************/
+
+static int32 InitApp(void);
+static int32 ProcessCommands(void);
+
+
+/**********************/
+/** File Global Data **/
+/**********************/
+
+/*
+** Must match DECLARE ENUM() declaration in app_cfg.h
+** Defines "static INILIB_CfgEnum IniCfgEnum"
+*/
+DEFINE_ENUM(Config,APP_CONFIG)
+
+
+/*****************/
+/** Global Data **/
+/*****************/
+
+SB_REPLAY_Class  SbReplay;
+
+
+/******************************************************************************
+** Function: SB_REPLAY_AppMain
+**
+*/
+void SB_REPLAY_AppMain(void)
+{
+
+   uint32 RunStatus = CFE_ES_RunStatus_APP_ERROR;
+
+
+   CFE_EVS_Register(NULL, 0, CFE_EVS_NO_FILTER);
+
+   if (InitApp() == CFE_SUCCESS) {  /* Performs initial CFE_ES_PerfLogEntry() call */
+
+      RunStatus = CFE_ES_RunStatus_APP_RUN;
+
+   }
+
+   /*
+   ** Main process loop
+   */
+   while (CFE_ES_RunLoop(&RunStatus)) {
+
+      RunStatus = ProcessCommands(); /* Pends indefinitely & manages CFE_ES_PerfLogEntry() calls */
+
+   } /* End CFE_ES_RunLoop */
+
+   CFE_ES_WriteToSysLog("SB_REPLAY App terminating, err = 0x%08X\n", RunStatus);   /* Use SysLog, events may not be working */
+
+   CFE_EVS_SendEvent(SB_REPLAY_EXIT_EID, CFE_EVS_EventType_CRITICAL, "SB_REPLAY App terminating, err = 0x%08X", RunStatus);
+
+   CFE_ES_ExitApp(RunStatus);  /* Let cFE kill the task (and any child tasks) */
+
+} /* End of SB_REPLAY_AppMain() */
+
+
+/******************************************************************************
+** Function: SB_REPLAY_NoOpCmd
+**
+*/
+
+bool SB_REPLAY_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CFE_EVS_SendEvent (SB_REPLAY_NOOP_EID, CFE_EVS_EventType_INFORMATION,
+                      "No operation command received for SB_REPLAY App version %d.%d.%d",
+                      SB_REPLAY_MAJOR_VER, SB_REPLAY_MINOR_VER, SB_REPLAY_PLATFORM_REV);
+
+   return true;
+
+
+} /* End SB_REPLAY_NoOpCmd() */
+
+
+/******************************************************************************
+** Function: SB_REPLAY_ResetAppCmd
+**
+** Notes:
+**   1. No need to pass an object reference to contained objects becuase they
+**      already have a reference from when they were constructed
+**
+*/
+
+bool SB_REPLAY_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr)
+{
+
+   CMDMGR_ResetStatus(CMDMGR_OBJ);
+   CHILDMGR_ResetStatus(CHILDMGR_OBJ);
+
+   REPLAY_ResetStatus();
+
+   return true;
+
+} /* End SB_REPLAY_ResetAppCmd() */
+
+
+/******************************************************************************
+** Function: SB_REPLAY_SendHousekeepingPkt
+**
+*/
+void SB_REPLAY_SendHousekeepingPkt(void)
+{
+
+   SbReplay.HkPkt.ValidCmdCnt   = SbReplay.CmdMgr.ValidCmdCnt;
+   SbReplay.HkPkt.InvalidCmdCnt = SbReplay.CmdMgr.InvalidCmdCnt;
+
+   /*
+   ** Replay
+   */
+
+   SbReplay.HkPkt.State     = (uint8)SbReplay.Replay.State;
+   SbReplay.HkPkt.InclCmds  = SbReplay.Replay.InclCmds;
+   SbReplay.HkPkt.Speed     = SbReplay.Replay.Speed;
+
+   SbReplay.HkPkt.PktCnt    = SbReplay.Replay.PktCnt;
+   SbReplay.HkPkt.SkipCnt   = SbReplay.Replay.SkipCnt;
+   SbReplay.HkPkt.DropCnt   = SbReplay.Replay.DropCnt;
+   SbReplay.HkPkt.Kbytes    = (uint32)(SbReplay.Replay.ByteCnt >> 10);
+   SbReplay.HkPkt.ElapsedMs = SbReplay.Replay.ElapsedMs;
+   SbReplay.HkPkt.MaxLagMs  = SbReplay.Replay.MaxLagMs;
+
+   if (SbReplay.HkPkt.ElapsedMs > 0) {
+
+      SbReplay.HkPkt.PktRate   = (uint32)(((uint64)SbReplay.HkPkt.PktCnt * 1000) / SbReplay.HkPkt.ElapsedMs);
+      SbReplay.HkPkt.KbyteRate = (uint32)(((uint64)SbReplay.HkPkt.Kbytes * 1000) / SbReplay.HkPkt.ElapsedMs);
+
+   }
+   else {
+
+      SbReplay.HkPkt.PktRate   = 0;
+      SbReplay.HkPkt.KbyteRate = 0;
+
+   }
+
+   SbReplay.HkPkt.ReplayCnt = SbReplay.Replay.ReplayCnt;
+   SbReplay.HkPkt.ErrCnt    = SbReplay.Replay.ErrCnt;
+
+   CFE_SB_TimeStampMsg(&(SbReplay.HkPkt.TlmHeader.Msg));
+   CFE_SB_TransmitMsg(&(SbReplay.HkPkt.TlmHeader.Msg), true);
+
+} /* End SB_REPLAY_SendHousekeepingPkt() */
+
+
+/******************************************************************************
+** Function: InitApp
+**
+** Notes:
+**   1. The replay object is constructed before the child task is started
+**      because the child task immediately starts polling its state.
+**
+*/
+static int32 InitApp(void)
+{
+
+   int32 Status = OSK_C_FW_CFS_ERROR;
+
+   CHILDMGR_TaskInit ChildTaskInit;
+
+   /*
+   ** Initialize objects
+   */
+
+   if (INITBL_Constructor(&SbReplay.IniTbl, SB_REPLAY_INI_FILENAME, &IniCfgEnum)) {
+
+      SbReplay.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_APP_PERF_ID);
+      SbReplay.CmdMid    = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_MID);
+      SbReplay.SendHkMid = (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_SEND_HK_MID);
+      CFE_ES_PerfLogEntry(SbReplay.PerfId);
+
+      REPLAY_Constructor(REPLAY_OBJ, INITBL_OBJ);
+
+      /* Constructor sends error events */
+      ChildTaskInit.TaskName  = INITBL_GetStrConfig(INITBL_OBJ, CFG_CHILD_NAME);
+      ChildTaskInit.PerfId    = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PERF_ID);
+      ChildTaskInit.StackSize = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_STACK_SIZE);
+      ChildTaskInit.Priority  = INITBL_GetIntConfig(INITBL_OBJ, CFG_CHILD_PRIORITY);
+      Status = CHILDMGR_Constructor(CHILDMGR_OBJ,
+                                    ChildMgr_TaskMainCallback,
+                                    REPLAY_ChildTask,
+                                    &ChildTaskInit);
+
+   } /* End if INITBL Constructed */
+
+   if (Status == CFE_SUCCESS) {
+
+      /*
+      ** Initialize app level interfaces
+      */
+
+      CFE_SB_CreatePipe(&SbReplay.CmdPipe, INITBL_GetIntConfig(INITBL_OBJ, CFG_CMD_PIPE_DEPTH), INITBL_GetStrConfig(INITBL_OBJ, CFG_CMD_PIPE_NAME));
+      CFE_SB_Subscribe(SbReplay.CmdMid,    SbReplay.CmdPipe);
+      CFE_SB_Subscribe(SbReplay.SendHkMid, SbReplay.CmdPipe);
+
+      CMDMGR_Constructor(CMDMGR_OBJ);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_NOOP_CMD_FC,   NULL, SB_REPLAY_NoOpCmd,     0);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, CMDMGR_RESET_CMD_FC,  NULL, SB_REPLAY_ResetAppCmd, 0);
+
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REPLAY_START_CMD_FC, REPLAY_OBJ, REPLAY_StartCmd, REPLAY_START_CMD_DATA_LEN);
+      CMDMGR_RegisterFunc(CMDMGR_OBJ, SB_REPLAY_STOP_CMD_FC,  REPLAY_OBJ, REPLAY_StopCmd,  REPLAY_STOP_CMD_DATA_LEN);
+
+      CFE_MSG_Init(&SbReplay.HkPkt.TlmHeader.Msg, (CFE_SB_MsgId_t)INITBL_GetIntConfig(INITBL_OBJ, CFG_HK_TLM_MID), SB_REPLAY_TLM_HK_LEN);
+
+      /*
+      ** Application startup event message
+      */
+      CFE_EVS_SendEvent(SB_REPLAY_INIT_APP_EID, CFE_EVS_EventType_INFORMATION,
+                        "SB_REPLAY App Initialized. Version %d.%d.%d",
+                        SB_REPLAY_MAJOR_VER, SB_REPLAY_MINOR_VER, SB_REPLAY_PLATFORM_REV);
+
+   } /* End if CHILDMGR constructed */
+
+   return(Status);
+
+} /* End of InitApp() */
+
+
+/******************************************************************************
+** Function: ProcessCommands
+**
+*/
+static int32 ProcessCommands(void)
+{
+
+   int32  RetStatus = CFE_ES_RunStatus_APP_RUN;
+   int32  SysStatus;
+   int32  MsgInt;
+
+   CFE_SB_Buffer_t* SbBufPtr;
+   CFE_SB_MsgId_t   MsgId = CFE_SB_INVALID_MSG_ID;
+
+
+   CFE_ES_PerfLogExit(SbReplay.PerfId);
+   SysStatus = CFE_SB_ReceiveBuffer(&SbBufPtr, SbReplay.CmdPipe, CFE_SB_PEND_FOREVER);
+   CFE_ES_PerfLogEntry(SbReplay.PerfId);
+
+   if (SysStatus == CFE_SUCCESS) {
+
+      SysStatus = CFE_MSG_GetMsgId(&SbBufPtr->Msg, &MsgId);
+
+      if (SysStatus == OS_SUCCESS) {
+
+         MsgInt = CFE_SB_MsgIdToValue(MsgId);
+
+         if (MsgInt == SbReplay.CmdMid) {
+
+            CMDMGR_DispatchFunc(CMDMGR_OBJ, SbBufPtr);
+
+         }
+         else if (MsgInt == SbReplay.SendHkMid) {
+
+            SB_REPLAY_SendHousekeepingPkt();
+
+         }
+         else {
+
+            CFE_EVS_SendEvent(SB_REPLAY_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                              "Received invalid command packet, MID = 0x%08X", MsgInt);
+         }
+
+      }
+      else {
+
+         CFE_EVS_SendEvent(SB_REPLAY_INVALID_MID_EID, CFE_EVS_EventType_ERROR,
+                           "CFE couldn't retrieve message ID from the message, Status = %d", SysStatus);
+      }
+
+   } /* Valid SB receive */
+   else {
+
+         CFE_ES_WriteToSysLog("SB_REPLAY software bus error. Status = 0x%08X\n", SysStatus);   /* Use SysLog, events may not be working */
+         RetStatus = CFE_ES_RunStatus_APP_ERROR;
+   }
+
+   return RetStatus;
+
+} /* ProcessCommands() */
@@ -0,0 +1,169 @@
+/*
+** Purpose: Define the SB Replay application
+**
+** Notes:
+**   1. Replays recorded software bus message files onto the local SB at
+**      their recorded rate, a multiple of it or as fast as possible. It is
+**      intended as a repeatable load generator for bus performance testing.
+**      See replay.h for the file format and pacing.
+**   2. The replay runs in the child task so the main task only processes
+**      commands and reports the replay statistics in housekeeping
+**      telemetry.
+**
+** References:
+**   1. OpenSat Object-based Application Developer's Guide.
+**   2. cFS Application Developer's Guide.
+**
+** License:
+**   Written by David McComas, licensed under the copyleft GNU
+**   General Public License (GPL).
+*/
+#ifndef _sb_replay_app_
+#define _sb_replay_app_
+
+/*
+** Includes
+*/
+
+#include "app_cfg.h"
+#include "childmgr.h"
+#include "initbl.h"
+#include "replay.h"
+
+/***********************/
+/** Macro Definitions **/
+/***********************/
+
+/*
+** Events
+*/
+
+#define SB_REPLAY_INIT_APP_EID    (SB_REPLAY_BASE_EID + 0)
+#define SB_REPLAY_NOOP_EID        (SB_REPLAY_BASE_EID + 1)
+#define SB_REPLAY_EXIT_EID        (SB_REPLAY_BASE_EID + 2)
+#define SB_REPLAY_INVALID_MID_EID (SB_REPLAY_BASE_EID + 3)
+
+
+/**********************/
+/** Type Definitions **/
+/**********************/
+
+
+/******************************************************************************
+** Command Packets
+*/
+
+
+/******************************************************************************
+** Telemetry Packets
+*/
+
+typedef struct {
+
+   CFE_MSG_TelemetryHeader_t TlmHeader;
+
+   /*
+   ** Framework Status
+   */
+
+   uint16   ValidCmdCnt;
+   uint16   InvalidCmdCnt;
+
+   /*
+   ** Replay
+   */
+
+   uint8    State;
+   uint8    InclCmds;
+   uint16   Speed;
+
+   uint32   PktCnt;
+   uint32   SkipCnt;
+   uint32   DropCnt;
+   uint32   Kbytes;
+   uint32   ElapsedMs;
+   uint32   PktRate;         /* Messages per second */
+   uint32   KbyteRate;       /* Kbytes per second   */
+   uint32   MaxLagMs;
+
+   uint32   ReplayCnt;
+   uint32   ErrCnt;
+
+} SB_REPLAY_HkPkt;
+#define SB_REPLAY_TLM_HK_LEN sizeof (SB_REPLAY_HkPkt)
+
+
+/******************************************************************************
+** SB_REPLAY_Class
+*/
+typedef struct {
+
+   /*
+   ** App Framework
+   */
+
+   INITBL_Class    IniTbl;
+   CFE_SB_PipeId_t CmdPipe;
+   CMDMGR_Class    CmdMgr;
+   CHILDMGR_Class  ChildMgr;
+
+   /*
+   ** Telemetry Packets
+   */
+
+   SB_REPLAY_HkPkt  HkPkt;
+
+   /*
+   ** App State & Objects
+   */
+
+   uint32           PerfId;
+   CFE_SB_MsgId_t   CmdMid;
+   CFE_SB_MsgId_t   SendHkMid;
+
+   REPLAY_Class     Replay;
+
+} SB_REPLAY_Class;
+
+
+/*******************/
+/** Exported Data **/
+/*******************/
+
+extern SB_REPLAY_Class  SbReplay;
+
+
+/************************/
+/** Exported Functions **/
+/************************/
+
+
+/******************************************************************************
+** Function: SB_REPLAY_AppMain
+**
+*/
+void SB_REPLAY_AppMain(void);
+
+
+/******************************************************************************
+** Function: SB_REPLAY_NoOpCmd
+**
+*/
+bool SB_REPLAY_NoOpCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_REPLAY_ResetAppCmd
+**
+*/
+bool SB_REPLAY_ResetAppCmd(void* ObjDataPtr, const CFE_SB_Buffer_t* SbBufPtr);
+
+
+/******************************************************************************
+** Function: SB_REPLAY_SendHousekeepingPkt
+**
+*/
+void SB_REPLAY_SendHousekeepingPkt(void);
+
+
+#endif /* _sb_replay_app_ */
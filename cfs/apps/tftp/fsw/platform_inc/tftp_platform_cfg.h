@@ -39,18 +39,27 @@
 */
 
 #define  TFTP_APP_RUNLOOP_DELAY       250  /* Delay in milliseconds for main loop        */
-#define  TFTP_APP_RUNLOOP_PKTS          8  /* Max number of packets to read per run loop */
+#define  TFTP_APP_RUNLOOP_PKTS         32  /* Max number of packets to read per run loop */
  
 
 /******************************************************************************
 ** TFTP Object Macros
 **
 ** - FSW is connectionless server and ground system  is client
+** - TFTP_MAX_BLKSIZE and TFTP_MAX_WINDOW_SIZE cap the RFC 2348 blksize and
+**   RFC 7440 windowsize options a client may negotiate. 65464 is the RFC 2348
+**   maximum. A client that doesn't request options gets RFC 1350 512 byte
+**   lock-step transfers.
+** - The socket buffer must hold a full window of maximum size blocks or the
+**   kernel drops the tail of each window.
 **
 */
 
 #define  TFTP_IP_ADDR_STR    "192.168.199.213"  /* cpu talking to */
 #define  TFTP_IN_PORT          69
-#define  TFTP_RECV_BUFF_LEN  1024
+#define  TFTP_MAX_BLKSIZE     65464
+#define  TFTP_MAX_WINDOW_SIZE    16
+#define  TFTP_RECV_BUFF_LEN   (4 + TFTP_MAX_BLKSIZE)
+#define  TFTP_SOCKET_BUFF_LEN (TFTP_MAX_WINDOW_SIZE * TFTP_RECV_BUFF_LEN)
 
 #endif /* _tftp_platform_cfg_ */
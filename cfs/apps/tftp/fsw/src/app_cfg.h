@@ -35,10 +35,11 @@
 **
 ** 1.0 - Initial release
 ** 1.1 - Refactored for OSK 2.2
+** 1.2 - Added RFC 2348 blksize and RFC 7440 windowsize option negotiation
 */
 
 #define  TFTP_MAJOR_VER   1
-#define  TFTP_MINOR_VER   1
+#define  TFTP_MINOR_VER   2
 
 
 #define  TFTP_CMD_PIPE_DEPTH    10
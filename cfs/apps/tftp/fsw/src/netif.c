@@ -96,14 +96,14 @@ int32 NETIF_RcvFrom(const uint8 NetIFid, void *BufPtr, const uint16 BufSize, boo
      
       if (ServerListen) {
        
-         Status = recvfrom(NetIf->SocketId, BufPtr, TFTP_RECV_BUFF_LEN, MSG_DONTWAIT,
+         Status = recvfrom(NetIf->SocketId, BufPtr, BufSize, MSG_DONTWAIT,
                           (struct sockaddr *) &(NetIf->ServerSocketAddr), (socklen_t *)&AddrLen);
       }
       else {
 
          CFE_PSP_MemSet( &(NetIf->XferSocketAddr), 0, sizeof(NetIf->XferSocketAddr));  /* TODO - Is this needed? */
       
-         Status = recvfrom(NetIf->SocketId, BufPtr, TFTP_RECV_BUFF_LEN, MSG_DONTWAIT,
+         Status = recvfrom(NetIf->SocketId, BufPtr, BufSize, MSG_DONTWAIT,
                           (struct sockaddr *) &(NetIf->XferSocketAddr), (socklen_t *)&AddrLen);
                         
          CFE_EVS_SendEvent(NETIF_DEBUG_EID,CFE_EVS_DEBUG,"Recvfrom XferSocketAddr on port %d with Status %d, eerno %d",ntohs(NetIf->XferSocketAddr.sin_port),Status,errno);
@@ -212,14 +212,14 @@ static void FlushSocket(int SocketId) {
    int    addr_len;
    int    i;
    int    status;
-   char   MsgBuf[TFTP_RECV_BUFF_LEN];
+   char   MsgBuf[64];  /* Stale datagrams are discarded so a truncated read is fine */
 
    addr_len = sizeof(s_addr);
    memset ((char *) &s_addr, 0, sizeof(s_addr));
 
    for (i=0; i<=50; i++) {
   
-      status = recvfrom(SocketId, MsgBuf, TFTP_RECV_BUFF_LEN - 1,
+      status = recvfrom(SocketId, MsgBuf, sizeof(MsgBuf),
                         MSG_DONTWAIT,(struct sockaddr *) &s_addr, (socklen_t *) &addr_len);
 
       if ( (status < 0) && (errno == EWOULDBLOCK) )
@@ -240,6 +240,7 @@ static boolean InitSocket(const char* DefIpAddrStr, int16 DefServerPort)
 {
 
    boolean RetStatus = FALSE;
+   int     SocketBuffLen = TFTP_SOCKET_BUFF_LEN;
    
    strcpy(NetIf->IpAddrStr, DefIpAddrStr);  
 
@@ -261,6 +262,10 @@ static boolean InitSocket(const char* DefIpAddrStr, int16 DefServerPort)
             fcntl(NetIf->SocketId, F_SETFL, O_NONBLOCK);
          #endif
 
+         /* Best effort, the kernel may cap the size. A smaller buffer only costs window retransmits. */
+         setsockopt(NetIf->SocketId, SOL_SOCKET, SO_RCVBUF, &SocketBuffLen, sizeof(SocketBuffLen));
+         setsockopt(NetIf->SocketId, SOL_SOCKET, SO_SNDBUF, &SocketBuffLen, sizeof(SocketBuffLen));
+
          FlushSocket(NetIf->SocketId);
          
 		   RetStatus = TRUE;
@@ -9,6 +9,10 @@
 **      errors. Higher logic functions may still send an event message such as an aborted transaction and the low level
 **      message would provide details.
 **   3. Only one transfer at a time
+**   4. Window state is advanced by received messages and by TFTP_Read()'s
+**      run loop cycle count, so windowing keeps the one read loop per wakeup
+**      structure. Resent blocks are reread from the file rather than
+**      buffered so memory use doesn't grow with the window size.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -43,7 +47,7 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen);
 
 static void CompleteFileTransfer(void);
 
-static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
+static int32 EncodePkt(const uint16 Opcode, uint16 BlockNum,
                        uint8 *DataPtr, uint16 DataLen);
 					   
 static boolean SendPkt(const uint16 Opcode, uint16 BlockNum,
@@ -59,6 +63,16 @@ static boolean DecodeErrorMsg(uint8 *Buf, uint16 BufLen, uint16 *ErrCode, char *
 
 static boolean DecodeRequestStrings(uint8 *Buf, uint16 BufLen, char  *Filename, char *Mode);
 
+static void DecodeRequestOptions(uint8 *Buf, uint16 BufLen);
+
+static char* NextRequestString(uint8 *Buf, uint16 BufLen, uint16 *Offset);
+
+static boolean SendWindow(void);
+
+static void RewindWindow(void);
+
+static void Retransmit(void);
+
 static void SendDumpBufEvent(void);
 
 /******************************************************************************
@@ -76,6 +90,9 @@ void TFTP_Constructor(TFTP_Class*  TftpPtr) {
    Tftp->State   = TFTP_STATE_IDLE;
    Tftp->Timer = 0;
    Tftp->NetIFid = 0;
+   Tftp->FileHandle = -1;
+   Tftp->BlkSize    = TFTP_DEF_DATA_LEN;
+   Tftp->WindowSize = 1;
    
    strcpy(Tftp->SrcFilename, "Undefined");
    strcpy(Tftp->DestFilename, "Undefined");
@@ -105,6 +122,7 @@ void TFTP_ResetStatus() {
    Tftp->State = TFTP_STATE_IDLE;
    Tftp->Timer = 0;
    Tftp->BlockNum = 0;
+   Tftp->RetransmitCnt = 0;
 
 } /* End TFTP_ResetStatus() */
 
@@ -132,6 +150,10 @@ uint16 TFTP_Read(uint16 MaxMsgRead) {
                         "TFTP timed out on peer response State = %d, Timer = %d", Tftp->State, Tftp->Timer);
 	   CompleteFileTransfer();
 	}
+   else if ( (Tftp->State != TFTP_STATE_IDLE) &&
+             ((Tftp->Timer % TFTP_RETRANSMIT_TIMEOUT) == 0) ) {
+      Retransmit();
+   }
 
 
    for (i = 0; i < MaxMsgRead; i++) {
@@ -255,6 +277,7 @@ static void CompleteFileTransfer(void) {
    }
    Tftp->State = TFTP_STATE_IDLE;
    Tftp->Timer = 0;
+   Tftp->OackPending = FALSE;
 
    NETIF_ClearClient();
    
@@ -268,23 +291,28 @@ static void CompleteFileTransfer(void) {
 ** in the TFTP data structure and the parameters provided. Since all
 ** TFTP message are very similar, we use a single function to encode
 ** all message types.
+**
+** Tftp->Timer is not reset here. It measures time since the peer last made
+** progress so resends don't postpone the transfer timeout.
 */
 
 static boolean SendPkt(const uint16 Opcode, uint16 BlockNum,
 		                   uint8 *DataPtr, uint16 DataLen) {
 
    boolean PktSent = FALSE;
+   int32   EncodeLen;
    uint16  SendMsgLen;
    int32   Status = 0;
  
-   Tftp->Timer = 0;
-   if ( (SendMsgLen = EncodePkt(Opcode, BlockNum, DataPtr, DataLen)) > 0) {
+   /* Encoded lengths reach TFTP_MAX_MSGSIZE so test for an error before narrowing */
+   if ( (EncodeLen = EncodePkt(Opcode, BlockNum, DataPtr, DataLen)) > 0) {
    
+      SendMsgLen       = (uint16) EncodeLen;
       Tftp->SendMsgLen = SendMsgLen;
     
       CFE_EVS_SendEvent(TFTP_SEND_PKT_DBG_EID, CFE_EVS_DEBUG, 
-                        "TFTP sending data on Net IF %d, block number %d, Length %d\n", 
-                        Tftp->NetIFid, Tftp->BlockNum, Tftp->SendMsgLen);
+                        "TFTP sending opcode %d on Net IF %d, block number %d, Length %d\n", 
+                        Opcode, Tftp->NetIFid, BlockNum, Tftp->SendMsgLen);
 	  
       Status = NETIF_SendTo(Tftp->NetIFid, Tftp->SendMsgBuf, SendMsgLen);
 
@@ -309,6 +337,97 @@ static boolean SendPkt(const uint16 Opcode, uint16 BlockNum,
 } /* End SendPkt() */
 
 
+/******************************************************************************
+** Function: SendWindow
+**
+** Send file data blocks until WindowSize blocks are outstanding or the
+** block that ends the file has been sent. Returns FALSE if the transfer was
+** aborted by a file read error.
+*/
+static boolean SendWindow(void)
+{
+
+   uint8   *DataPtr = &Tftp->SendMsgBuf[4];
+   int32    ReadStatus;
+   boolean  RetStatus = TRUE;
+
+   while ( (Tftp->NextBlock < (Tftp->WindowBase + Tftp->WindowSize)) &&
+           ((Tftp->LastBlock == 0) || (Tftp->NextBlock <= Tftp->LastBlock)) ) {
+
+      ReadStatus = OS_read(Tftp->FileHandle, DataPtr, Tftp->BlkSize);
+      
+      if (ReadStatus < 0) {
+         CFE_EVS_SendEvent(TFTP_FILE_IO_ERR_EID, CFE_EVS_ERROR,
+                           "TFTP error reading %s block %d. Status = %d",
+                           Tftp->SrcFilename, (int) Tftp->NextBlock, (int) ReadStatus);
+         SendPkt(TFTP_OPCODE_ERROR, TFTP_ERR_NOT_DEFINED, (uint8 *) "File read error", 0);
+         CompleteFileTransfer();
+         RetStatus = FALSE;
+         break;
+      }
+
+      /* A short block, including an empty one when the file ends on a block boundary, ends the file */
+      if (ReadStatus < Tftp->BlkSize) {
+         Tftp->LastBlock = Tftp->NextBlock;
+      }
+
+      Tftp->BlockNum = (uint16) Tftp->NextBlock;
+      SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, DataPtr, ReadStatus);
+      Tftp->NextBlock++;
+
+   } /* End window loop */
+
+   return RetStatus;
+
+} /* End SendWindow() */
+
+
+/******************************************************************************
+** Function: RewindWindow
+**
+** Restart sending at the first unacknowledged block.
+*/
+static void RewindWindow(void)
+{
+
+   Tftp->NextBlock = Tftp->WindowBase;
+   OS_lseek(Tftp->FileHandle, (int32) ((Tftp->WindowBase - 1) * Tftp->BlkSize), OS_SEEK_SET);
+
+} /* End RewindWindow() */
+
+
+/******************************************************************************
+** Function: Retransmit
+**
+** Called when the peer hasn't made progress for TFTP_RETRANSMIT_TIMEOUT run
+** loop cycles. A sender resends the current window. A receiver acks the
+** last in-order block so the sender restarts from the gap, or resends the
+** OACK if the peer hasn't answered it.
+*/
+static void Retransmit(void)
+{
+
+   Tftp->RetransmitCnt++;
+
+   CFE_EVS_SendEvent(TFTP_RETRANSMIT_EID, CFE_EVS_DEBUG,
+                     "TFTP resending after %d cycles without progress. State = %d, BlockNum = %d",
+                     Tftp->Timer, Tftp->State, Tftp->BlockNum);
+
+   if (Tftp->OackPending) {
+      NETIF_SendTo(Tftp->NetIFid, Tftp->SendMsgBuf, Tftp->SendMsgLen);
+   }
+   else if (Tftp->State == TFTP_STATE_GET) {
+      RewindWindow();
+      SendWindow();
+   }
+   else if (Tftp->State == TFTP_STATE_PUT) {
+      Tftp->WindowCnt = 0;
+      SendPkt(TFTP_OPCODE_ACK, (uint16)(Tftp->BlockNum - 1), NULL, 0);
+   }
+
+} /* End Retransmit() */
+
+
 /******************************************************************************
 ** Function: EncodePkt
 **
@@ -329,7 +448,7 @@ static boolean SendPkt(const uint16 Opcode, uint16 BlockNum,
 **   Get        WRQ        Get destination file is written to
 */
 
-static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
+static int32 EncodePkt(const uint16 Opcode, uint16 BlockNum,
 		               uint8 *DataPtr, uint16 DataLen) {
 
    uint8 *MsgPtr = Tftp->SendMsgBuf;
@@ -387,7 +506,10 @@ static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
                               "TFTP encoding error: Data too big %d", DataLen);
             return -1;
          }
-         memcpy(MsgPtr, DataPtr, DataLen);
+         /* SendWindow() reads file data in place to avoid copying large blocks */
+         if (DataPtr != MsgPtr) {
+            memcpy(MsgPtr, DataPtr, DataLen);
+         }
          MsgPtr += DataLen;
          break;
 	
@@ -417,6 +539,29 @@ static int16 EncodePkt(const uint16 Opcode, uint16 BlockNum,
          memcpy(MsgPtr, DataPtr, ErrStrLen);
          MsgPtr += ErrStrLen;
          break;
+
+      case TFTP_OPCODE_OACK:
+
+         /* 
+         ** Only echo options the peer requested. The option strings are
+         ** a few bytes so they can't overflow the message buffer.
+         */
+
+         if (Tftp->OptionMask == 0) {
+            CFE_EVS_SendEvent(TFTP_ENCODE_OACK_ERR_EID, CFE_EVS_ERROR,
+                              "TFTP encoding error: OACK without any negotiated options");
+            return -1;
+         }
+
+         if (Tftp->OptionMask & TFTP_OPTION_BLKSIZE_BIT) {
+            MsgPtr += sprintf((char *) MsgPtr, "%s", TFTP_OPTION_BLKSIZE) + 1;
+            MsgPtr += sprintf((char *) MsgPtr, "%u", (unsigned int) Tftp->BlkSize) + 1;
+         }
+         if (Tftp->OptionMask & TFTP_OPTION_WINDOWSIZE_BIT) {
+            MsgPtr += sprintf((char *) MsgPtr, "%s", TFTP_OPTION_WINDOWSIZE) + 1;
+            MsgPtr += sprintf((char *) MsgPtr, "%u", (unsigned int) Tftp->WindowSize) + 1;
+         }
+         break;
 	
    } /* End Opcode switch */
 
@@ -542,6 +687,89 @@ static boolean DecodeRequestStrings(uint8 *Buf, uint16 BufLen,
 } /* End DecodeRequestStrings() */
 
 
+/******************************************************************************
+** Function: DecodeRequestOptions
+**
+** Negotiate the RFC 2347 options that follow the mode string in a RRQ/WRQ.
+** Values outside the platform limits are clamped and values below the RFC
+** minimums cause the option to be ignored. Defaults are restored first so a
+** request without options gets a RFC 1350 transfer.
+*/
+static void DecodeRequestOptions(uint8 *Buf, uint16 BufLen)
+{
+
+   char     *Option, *Value;
+   uint16   Offset = 2;
+   uint32   OptionValue;
+
+   Tftp->OptionMask = 0;
+   Tftp->BlkSize    = TFTP_DEF_DATA_LEN;
+   Tftp->WindowSize = 1;
+
+   /* Skip the filename and mode strings */
+   if ( (NextRequestString(Buf, BufLen, &Offset) != NULL) &&
+        (NextRequestString(Buf, BufLen, &Offset) != NULL) ) {
+
+      while ( ((Option = NextRequestString(Buf, BufLen, &Offset)) != NULL) &&
+              ((Value  = NextRequestString(Buf, BufLen, &Offset)) != NULL) ) {
+
+         OptionValue = strtoul(Value, NULL, 10);
+
+         if (strcasecmp(Option, TFTP_OPTION_BLKSIZE) == 0) {
+            if (OptionValue >= TFTP_MIN_DATA_LEN) {
+               Tftp->BlkSize = (OptionValue > TFTP_MAX_DATA_LEN) ? TFTP_MAX_DATA_LEN : OptionValue;
+               Tftp->OptionMask |= TFTP_OPTION_BLKSIZE_BIT;
+            }
+         }
+         else if (strcasecmp(Option, TFTP_OPTION_WINDOWSIZE) == 0) {
+            if (OptionValue >= 1) {
+               Tftp->WindowSize = (OptionValue > TFTP_MAX_WINDOW_SIZE) ? TFTP_MAX_WINDOW_SIZE : OptionValue;
+               Tftp->OptionMask |= TFTP_OPTION_WINDOWSIZE_BIT;
+            }
+         }
+
+         CFE_EVS_SendEvent(TFTP_DECODE_DBG_EID, CFE_EVS_DEBUG,
+                           "DecodeRequestOptions(): %s = %s", Option, Value);
+
+      } /* End option loop */
+   } /* End if filename and mode */
+
+   if (Tftp->OptionMask != 0) {
+      CFE_EVS_SendEvent(TFTP_OPTION_EID, CFE_EVS_INFORMATION,
+                        "TFTP negotiated block size %d and window size %d",
+                        Tftp->BlkSize, Tftp->WindowSize);
+   }
+
+} /* End DecodeRequestOptions() */
+
+
+/******************************************************************************
+** Function: NextRequestString
+**
+** Return the null terminated string at Offset and advance Offset past it.
+** NULL is returned if no complete string remains in the buffer.
+*/
+static char* NextRequestString(uint8 *Buf, uint16 BufLen, uint16 *Offset)
+{
+
+   char   *Str = NULL;
+   uint8  *NullPtr;
+
+   if (*Offset < BufLen) {
+
+      NullPtr = memchr(&Buf[*Offset], '\0', BufLen - *Offset);
+      if (NullPtr != NULL) {
+         Str = (char *) &Buf[*Offset];
+         *Offset = (NullPtr - Buf) + 1;
+      }
+
+   }
+
+   return Str;
+
+} /* End NextRequestString() */
+
+
 /******************************************************************************
 ** Function: DecodeErrorMsg
 **
@@ -618,16 +846,21 @@ static void SendDumpBufEvent()
 **
 ** Block number is managed so it is set to the expected value to be immediately 
 ** used when a packet is received and processed.  
-**   GND_GET: When ground ACK received block number is at expected value
-**   GND_PUT: After ACK of previous data received block number is at value for next block to be sent
+**   GND_GET: WindowBase-1 is the last acked block and an ACK may acknowledge
+**            any block up to the last one sent. The 16-bit wire block number
+**            is mapped onto the 32-bit window counters relative to WindowBase.
+**   GND_PUT: BlockNum is the next in-order block expected. Only the last block
+**            of each window is acked unless a gap is detected.
 **
+** A RRQ/WRQ with options is answered with an OACK. The peer accepts it by
+** sending ACK 0 for a RRQ or data block 1 for a WRQ.
 **
 */
 static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
 
-   uint8    FileBuf[TFTP_MAX_MSGSIZE];
    uint16   BlockNum, ErrCode;
-   uint32   ReadStatus;
+   uint16   AckOffset;
+   uint32   AckBlock;
    char    *ErrMsg;
    uint8   *Data;
    uint16   DataLen;
@@ -647,6 +880,10 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
          if (DecodeErrorMsg(Buf, BufLen, &ErrCode, &ErrMsg)) {
             CFE_EVS_SendEvent(TFTP_DECODE_ERR_MSG_EID, CFE_EVS_ERROR, "TFTP error code %d, msg = %s\n", ErrCode, ErrMsg);
          }
+         /* A peer that rejects an OACK or aborts sends an error so don't wait for the timeout */
+         if (Tftp->State != TFTP_STATE_IDLE) {
+            CompleteFileTransfer();
+         }
          MsgProcessed = FALSE;
 
       } /* End if Opcode error */
@@ -658,83 +895,128 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
             switch (OpCode) {
 	         case TFTP_OPCODE_RRQ:
                /* 
-               ** Decode RRQ, Open file and send first data packet 
-               ** Don't increment block number so ACK will verify block number sent 
+               ** Decode RRQ, Open file and send first window or the OACK
+               ** Block numbers aren't acked until the peer's ACK arrives
                */
                if (DecodeRequestStrings(Buf, BufLen, Tftp->SrcFilename,Tftp->Mode)) {
                   
+                  DecodeRequestOptions(Buf, BufLen);
+
                   Tftp->FileHandle = OS_open(Tftp->SrcFilename, OS_READ_ONLY, 0);
                   if (Tftp->FileHandle >= 0) {
                     
-                     Tftp->BlockNum = 1;
-                     ReadStatus = OS_read(Tftp->FileHandle, FileBuf, TFTP_MAX_DATA_LEN);
-                     SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, ReadStatus);
+                     Tftp->State      = TFTP_STATE_GET;
+                     Tftp->Timer      = 0;
+                     Tftp->BlockNum   = 0;
+                     Tftp->WindowBase = 1;
+                     Tftp->NextBlock  = 1;
+                     Tftp->LastBlock  = 0;
+
+                     if (Tftp->OptionMask != 0) {
+                        Tftp->OackPending = TRUE;
+                        SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+                     }
+                     else {
+                        SendWindow();
+                     }
                   }
                   else {
                      CFE_EVS_SendEvent(TFTP_RRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
                                        "TFTP error opening RRQ file %s. Status = 0x%4x",
                                        Tftp->SrcFilename, Tftp->FileHandle);
+                     SendPkt(TFTP_OPCODE_ERROR, TFTP_ERR_NOT_FOUND, (uint8 *) "File not found", 0);
+                     CompleteFileTransfer();
                   }
 
-                  Tftp->State = (ReadStatus == TFTP_MAX_DATA_LEN) ? TFTP_STATE_GET : TFTP_STATE_GET_FINI;
-
                } /* End if decoded request strings */
                break;
 			 
             case TFTP_OPCODE_WRQ:
-               /* Decode WRQ, Create file and send ack. Note block number is zero in this special case. */
+               /* Decode WRQ, Create file and send ack or OACK. Note block number is zero in this special case. */
                if (DecodeRequestStrings(Buf, BufLen, Tftp->DestFilename,Tftp->Mode)) {
+
+                  DecodeRequestOptions(Buf, BufLen);
+
                   Tftp->FileHandle = OS_creat(Tftp->DestFilename, OS_WRITE_ONLY);
                   if (Tftp->FileHandle >= 0) {
-                     Tftp->BlockNum = 0;
-                     CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending WRQ ack. Block number = %d\n", Tftp->BlockNum);
-                     SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
-                     CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sent WRQ ack. Block number = %d\n", Tftp->BlockNum);
+
+                     Tftp->State      = TFTP_STATE_PUT;
+                     Tftp->Timer      = 0;
+                     Tftp->BlockNum   = 0;
+                     Tftp->WindowCnt  = 0;
+                     Tftp->OutOfOrder = FALSE;
+
+                     if (Tftp->OptionMask != 0) {
+                        Tftp->OackPending = TRUE;
+                        SendPkt(TFTP_OPCODE_OACK, 0, NULL, 0);
+                     }
+                     else {
+                        CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending WRQ ack. Block number = %d\n", Tftp->BlockNum);
+                        SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
+                        CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sent WRQ ack. Block number = %d\n", Tftp->BlockNum);
+                     }
                      Tftp->BlockNum++;
                   }
                   else {
                      CFE_EVS_SendEvent(TFTP_WRQ_FILE_OPEN_ERR_EID, CFE_EVS_ERROR,
                                        "TFTP error opening WRQ file %s Status = %d\n",
                                        Tftp->DestFilename, Tftp->FileHandle);
+                     SendPkt(TFTP_OPCODE_ERROR, TFTP_ERR_ACCESS_DENIED, (uint8 *) "File create failed", 0);
+                     CompleteFileTransfer();
                   } /* End if fiel create error */
 
-                  Tftp->State = TFTP_STATE_PUT;
                } /* End if decoded request strings */
                break;
             default:
                CFE_EVS_SendEvent(TFTP_UNEXP_OPCODE_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected opcode in idle state %d ignored\n", OpCode);
+               /* Late packets from a finished window must not latch the next transfer's client address */
+               NETIF_ClearClient();
             } /* End Opcode switch */
             break; /* End TFTP_STATE_IDLE */
 
          case TFTP_STATE_GET:
-	    	    /* Verify Ack opcode, read data from file and send it */
+	    	    /* Verify Ack opcode, slide the window and send the blocks it opened */
             if (OpCode == TFTP_OPCODE_ACK) {
                /*  DecodeBlockNum() sends event if error */
                if (DecodeBlockNum(Buf, BufLen, &BlockNum)) {
-                  if (BlockNum == Tftp->BlockNum) {
-	
-                     ReadStatus = OS_read(Tftp->FileHandle, FileBuf, TFTP_MAX_DATA_LEN);
-                     Tftp->BlockNum++;
 
-                     if (ReadStatus > 0) {    /* More file data */
-                        SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, ReadStatus);
-                        if (ReadStatus < TFTP_MAX_DATA_LEN) {
-                           Tftp->State = TFTP_STATE_GET_FINI;
-                        }
-                        else {
-                           Tftp->State = TFTP_STATE_GET;
-                        } /* End if max data */
-                        Tftp->Timer = 0;
+                  /* Offset 0 acks the block before the window, i.e. a duplicate or the OACK's ACK 0 */
+                  AckOffset = (uint16)(BlockNum - (uint16)(Tftp->WindowBase - 1));
+
+                  /*
+                  ** Resending the window for a duplicate ack would double every later
+                  ** window (Sorcerer's Apprentice, RFC 1123 4.2.3.1), so only the OACK's
+                  ** ACK 0 is acted on and lost blocks are left to the retransmit timer.
+                  */
+                  if ( (AckOffset == 0) && !Tftp->OackPending ) {
+                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_DEBUG,
+                                       "TFTP ignoring duplicate ack of block %d", BlockNum);
+                  }
+                  else if (AckOffset <= (Tftp->NextBlock - Tftp->WindowBase)) {
+
+                     AckBlock = Tftp->WindowBase - 1 + AckOffset;
+                     Tftp->Timer = 0;
+                     Tftp->OackPending = FALSE;
+
+                     if ( (Tftp->LastBlock != 0) && (AckBlock == Tftp->LastBlock) ) {
+                        Tftp->GetFileCnt++;
+                        CFE_EVS_SendEvent(TFTP_GND_GET_COMPLETE_EID, CFE_EVS_INFORMATION,
+                                          "TFTP successfully transferred a %d block file", (int) Tftp->LastBlock);
+                        CompleteFileTransfer();
                      }
-                     else { 
-                        /* Special case where file ends on block boundries */
-                        /* TODO handle read error < 0) */
-                        SendPkt(TFTP_OPCODE_DATA, Tftp->BlockNum, FileBuf, 0);
-                        Tftp->State = TFTP_STATE_GET_FINI;
+                     else {
+                        /* An ack short of the last block sent means the peer lost a block */
+                        Tftp->WindowBase = AckBlock + 1;
+                        if (Tftp->WindowBase < Tftp->NextBlock) {
+                           RewindWindow();
+                        }
+                        SendWindow();
                      }
+
                   } /* End if valid block num */
                   else {
-                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected block number in ack packet. Expect %d, Received %d",Tftp->BlockNum, BlockNum);
+                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected block number in ack packet. Expect %d..%d, Received %d",
+                                       (uint16)(Tftp->WindowBase - 1), (uint16)(Tftp->NextBlock - 1), BlockNum);
                   } /* End if invalid block num */
                } /* End if DecodeBlockNum() */
             } /* End if Ack Opcode */
@@ -745,45 +1027,51 @@ static boolean ProcessMsg(uint8* Buf, uint16 BufLen) {
             } /* Invalid Opcode */
             break; /* End TFTP_STATE_GET */
 
-         case TFTP_STATE_GET_FINI:
-            if (OpCode == TFTP_OPCODE_ACK) {
-               Tftp->GetFileCnt++;
-               CFE_EVS_SendEvent(TFTP_GND_GET_COMPLETE_EID, CFE_EVS_INFORMATION,
-                                 "TFTP successfully transferred a %d block file", Tftp->BlockNum);
-            }
-            else {
-               CFE_EVS_SendEvent(TFTP_UNEXP_OPCODE_ERR_EID, CFE_EVS_ERROR, "TFTP unexpected opcode %d when expecting an Ack", OpCode);
-            }		
-            CompleteFileTransfer();   
-            break;
-	      
          case TFTP_STATE_PUT:
-	    	    /* Verify data opcode, write data to file and ack it */
+	    	    /* Verify data opcode, write data to file and ack it at the end of each window */
             if (OpCode == TFTP_OPCODE_DATA) {
                if (DecodeBlockNum(Buf, BufLen, &BlockNum)) {
                   if (BlockNum == Tftp->BlockNum) {
                      if (DecodeData(Buf, BufLen, &Data, &DataLen)) {
-                        /* TODO - Verify file write, Fix buffers */
-                        if (DataLen > 0) { /* no more data */
-                           OS_write(Tftp->FileHandle,Data,DataLen);
+
+                        Tftp->Timer = 0;
+                        Tftp->OackPending = FALSE;
+                        Tftp->OutOfOrder  = FALSE;
+
+                        if ( (DataLen > 0) && (OS_write(Tftp->FileHandle,Data,DataLen) != DataLen) ) {
+                           CFE_EVS_SendEvent(TFTP_FILE_IO_ERR_EID, CFE_EVS_ERROR,
+                                             "TFTP error writing %s block %d", Tftp->DestFilename, Tftp->BlockNum);
+                           SendPkt(TFTP_OPCODE_ERROR, TFTP_ERR_DISK_FULL, (uint8 *) "File write error", 0);
+                           CompleteFileTransfer();
                         }
-                        SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
-                        CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending ACK for block number = %d\n", Tftp->BlockNum);
                         /* TODO - May want tlm to indicate last file transferred. Pass parameter to complete file transfer */
-                        if (DataLen != TFTP_MAX_DATA_LEN) {
+                        else if (DataLen < Tftp->BlkSize) {
+                           SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
                            Tftp->PutFileCnt++;
                            CompleteFileTransfer();
                            CFE_EVS_SendEvent(TFTP_GND_PUT_COMPLETE_EID, CFE_EVS_INFORMATION,
                                              "TFTP successfully received a %d block file", Tftp->BlockNum);
                         }
                         else {
+                           Tftp->WindowCnt++;
+                           if (Tftp->WindowCnt >= Tftp->WindowSize) {
+                              SendPkt(TFTP_OPCODE_ACK, Tftp->BlockNum, NULL, 0);
+                              CFE_EVS_SendEvent(TFTP_WRQ_DBG_EID, CFE_EVS_DEBUG, "TFTP sending ACK for block number = %d\n", Tftp->BlockNum);
+                              Tftp->WindowCnt = 0;
+                           }
                            Tftp->BlockNum++;
                         }
                      } /* End if DecodeData() */
                   } /* End if valid block num */
                   else {
-                     CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR,
-                                       "TFTP unexpected block number in data packet. Expect %d, Received %d",Tftp->BlockNum, BlockNum);
+                     /* Gap or duplicate. Ack the last in-order block once so the sender restarts the window there. */
+                     if (!Tftp->OutOfOrder) {
+                        CFE_EVS_SendEvent(TFTP_UNEXP_BLOCKNUM_ERR_EID, CFE_EVS_ERROR,
+                                          "TFTP unexpected block number in data packet. Expect %d, Received %d",Tftp->BlockNum, BlockNum);
+                        SendPkt(TFTP_OPCODE_ACK, (uint16)(Tftp->BlockNum - 1), NULL, 0);
+                        Tftp->WindowCnt  = 0;
+                        Tftp->OutOfOrder = TRUE;
+                     }
                   } /* End if invalid block num */
                } /* End if DecodeBlockNum() */
             } /* End if DATA OpCode */
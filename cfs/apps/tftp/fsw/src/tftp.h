@@ -6,6 +6,13 @@
 **      In it's header it states "A TFTP (RFC 1350) over IPv4/IPv6 client. This code is intended to
 **      demonstrate (i) how to write encoding/decoding functions, (ii) how to implement a simple state
 **      machine, and (iii) how to use a select() main loop to implement timeouts and retransmissions.
+**   2. RFC 2347 option negotiation is supported for the RFC 2348 blksize and
+**      RFC 7440 windowsize options. Unknown options are ignored as RFC 2347
+**      allows. A sender has up to windowsize blocks outstanding and a
+**      receiver only acks the last block of each window. Losses are
+**      recovered by resending from the first unacknowledged block, either
+**      when the receiver acks a block short of the window end or when
+**      TFTP_RETRANSMIT_TIMEOUT run loop cycles pass without progress.
 **
 ** License:
 **   Written by David McComas, licensed under the copyleft GNU
@@ -28,6 +35,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <strings.h>
 #include <unistd.h>
 #include <fcntl.h>
 
@@ -42,7 +50,7 @@
 /***********************/
 
 /*
-** See RFC 1350 section 5 and the appendix.
+** See RFC 1350 section 5 and the appendix. OACK is defined in RFC 2347.
 */
 
 #define TFTP_OPCODE_RRQ		1
@@ -50,13 +58,22 @@
 #define TFTP_OPCODE_DATA	3
 #define TFTP_OPCODE_ACK		4
 #define TFTP_OPCODE_ERROR	5
+#define TFTP_OPCODE_OACK	6
 
-#define TFTP_STATE_TIMEOUT    40  /* Length pepends on TFTP_APP_RUNLOOP_DELAY in tftp_platform_cfg.h */
+#define TFTP_STATE_TIMEOUT       40  /* Length pepends on TFTP_APP_RUNLOOP_DELAY in tftp_platform_cfg.h */
+#define TFTP_RETRANSMIT_TIMEOUT   4  /* Run loop cycles without peer progress before a resend */
 #define TFTP_DEF_TIMEOUT_SEC  0
 #define TFTP_DEF_TIMEOUT_USEC 50000
-#define TFTP_MAX_DATA_LEN     512
+#define TFTP_DEF_DATA_LEN     512                /* RFC 1350 block size when blksize isn't negotiated */
+#define TFTP_MIN_DATA_LEN     8                  /* RFC 2348 smallest blksize */
+#define TFTP_MAX_DATA_LEN     TFTP_MAX_BLKSIZE
 #define TFTP_MAX_MSGSIZE      (4 + TFTP_MAX_DATA_LEN)
 
+#define TFTP_OPTION_BLKSIZE       "blksize"
+#define TFTP_OPTION_WINDOWSIZE    "windowsize"
+#define TFTP_OPTION_BLKSIZE_BIT     0x01  /* TFTP_Class OptionMask bits */
+#define TFTP_OPTION_WINDOWSIZE_BIT  0x02
+
 #define TFTP_MODE_OCTET    "octet"
 #define TFTP_MODE_NETASCII "netascii"
 #define TFTP_MODE_MAIL     "mail"
@@ -116,8 +133,12 @@
 #define TFTP_GND_GET_COMPLETE_EID       (TFTP_BASE_EID + 24)
 #define TFTP_GND_PUT_COMPLETE_EID       (TFTP_BASE_EID + 25)
 #define TFTP_STATE_TIMEOUT_EID          (TFTP_BASE_EID + 26)
+#define TFTP_ENCODE_OACK_ERR_EID        (TFTP_BASE_EID + 27)
+#define TFTP_OPTION_EID                 (TFTP_BASE_EID + 28)
+#define TFTP_RETRANSMIT_EID             (TFTP_BASE_EID + 29)
+#define TFTP_FILE_IO_ERR_EID            (TFTP_BASE_EID + 30)
 
-#define TFTP_TOTAL_EID  27
+#define TFTP_TOTAL_EID  31
 
 /**********************/
 /** Type Definitions **/
@@ -214,6 +235,24 @@ typedef struct {
    uint16   Timer;                    /* Iimer for timeout logic         */
    uint16   BlockNum;                 /* Current block number            */
 
+   /*
+   ** Negotiated options and window state
+   ** - Window block counters are 32-bit so file offsets survive 16-bit block number rollover
+   ** - WindowBase is the first unacknowledged block and NextBlock the next block to send
+   ** - LastBlock is zero until the short block that ends a file has been read
+   */
+
+   uint16   OptionMask;               /* TFTP_OPTION_xxx_BIT options the peer requested */
+   uint16   BlkSize;                  /* Negotiated data bytes per block                */
+   uint16   WindowSize;               /* Negotiated blocks per window                   */
+   uint16   WindowCnt;                /* In-order blocks received since last ACK        */
+   boolean  OackPending;              /* OACK sent and not yet answered                 */
+   boolean  OutOfOrder;               /* ACK sent for a gap in the current window       */
+   uint32   WindowBase;
+   uint32   NextBlock;
+   uint32   LastBlock;
+   uint32   RetransmitCnt;
+
    /*
    ** Telemetry Packets
    */
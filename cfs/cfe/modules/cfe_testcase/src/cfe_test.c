@@ -39,5 +39,13 @@
 int32 CFE_Test_Init(int32 LibId)
 {
     ESInfoTestSetup(LibId);
+
+    /* Performance tests, the results file is written last */
+    SBPerfTestSetup(LibId);
+    EVSPerfTestSetup(LibId);
+    TBLPerfTestSetup(LibId);
+    TIMEPerfTestSetup(LibId);
+    ESPoolPerfTestSetup(LibId);
+    PerfResultsTestSetup(LibId);
     return CFE_SUCCESS;
 }
@@ -52,7 +52,52 @@
 #define UtAssert_ResourceID_Undifeined(id) \
     UtAssert_True(!CFE_RESOURCEID_TEST_DEFINED(id), "%s (%lu) not defined", #id, CFE_RESOURCEID_TO_ULONG(id))
 
+/*
+ * Performance tests
+ *
+ * Each result is reported as the tests run, and all results are written
+ * to CFE_TEST_PERF_RESULTS_FILE by the last test case.  The file is a
+ * standard cFE file header followed by CFE_Test_PerfRecord_t entries.
+ */
+#define CFE_TEST_PERF_RESULTS_FILE "/ram/cfe_test_perf.dat"
+#define CFE_TEST_PERF_FILE_SUBTYPE 0x50455246 /* "PERF" */
+#define CFE_TEST_PERF_MAX_RESULTS  64
+#define CFE_TEST_PERF_NAME_LEN     32
+#define CFE_TEST_PERF_PARAMS_LEN   32
+
+/* Message ID reserved for the SB performance tests */
+#define CFE_TEST_PERF_MID 0x0FF0
+
+typedef struct
+{
+    char   Name[CFE_TEST_PERF_NAME_LEN];     /* Name of the measurement, e.g. "SB.TransmitMsg" */
+    char   Params[CFE_TEST_PERF_PARAMS_LEN]; /* Configuration, e.g. "size=64 subs=2" */
+    uint32 Count;                            /* Number of operations timed */
+    uint32 ElapsedUsec;                      /* Total time for all operations */
+    uint32 MeanNsec;                         /* Mean time per operation */
+    uint32 MinNsec;                          /* Fastest single operation, if timed individually */
+    uint32 MaxNsec;                          /* Slowest single operation, if timed individually */
+    uint32 Bytes;                            /* Total payload moved, if meaningful */
+} CFE_Test_PerfRecord_t;
+
+/* Time stamp and elapsed time helpers */
+OS_time_t CFE_Test_PerfNow(void);
+int64     CFE_Test_PerfElapsedNsec(OS_time_t Start);
+
+/* Record a result where only the total time for Count operations is known */
+void CFE_Test_PerfRecord(const char *Name, const char *Params, uint32 Count, int64 ElapsedNsec, uint32 Bytes);
+
+/* Record a result where each operation was timed individually */
+void CFE_Test_PerfRecordLatency(const char *Name, const char *Params, uint32 Count, int64 ElapsedNsec,
+                                int64 MinNsec, int64 MaxNsec, uint32 Bytes);
+
 int32 CFE_Test_Init(int32 LibId);
 int32 ESInfoTestSetup(int32 LibId);
+int32 SBPerfTestSetup(int32 LibId);
+int32 EVSPerfTestSetup(int32 LibId);
+int32 TBLPerfTestSetup(int32 LibId);
+int32 TIMEPerfTestSetup(int32 LibId);
+int32 ESPoolPerfTestSetup(int32 LibId);
+int32 PerfResultsTestSetup(int32 LibId);
 
 #endif /* CFE_TEST_H */
@@ -0,0 +1,98 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: es_pool_perf_test.c
+**
+** Purpose:
+**   Performance test of Executive Services memory pool allocation
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define ES_POOL_PERF_POOL_SIZE  65536
+#define ES_POOL_PERF_ITERATIONS 10000
+
+static const uint32 ES_POOL_PERF_BLOCK_SIZES[] = {32, 512, 4096};
+
+static CFE_ES_STATIC_POOL_TYPE(ES_POOL_PERF_POOL_SIZE) ES_PoolPerfMemory;
+
+static void ES_PoolPerfGetPut(CFE_ES_MemHandle_t PoolId, const char *Mode)
+{
+    char                Params[CFE_TEST_PERF_PARAMS_LEN];
+    CFE_ES_MemPoolBuf_t Buf;
+    OS_time_t           Start;
+    int64               ElapsedNsec;
+    uint32              Size;
+    uint32              i;
+    uint32              j;
+    int32               Status;
+
+    for (j = 0; j < sizeof(ES_POOL_PERF_BLOCK_SIZES) / sizeof(ES_POOL_PERF_BLOCK_SIZES[0]); ++j)
+    {
+        Size = ES_POOL_PERF_BLOCK_SIZES[j];
+        snprintf(Params, sizeof(Params), "size=%lu %s", (unsigned long)Size, Mode);
+
+        Status = CFE_SUCCESS;
+        Start  = CFE_Test_PerfNow();
+        for (i = 0; i < ES_POOL_PERF_ITERATIONS && Status >= CFE_SUCCESS; ++i)
+        {
+            Status = CFE_ES_GetPoolBuf(&Buf, PoolId, Size);
+            if (Status >= CFE_SUCCESS)
+            {
+                Status = CFE_ES_PutPoolBuf(PoolId, Buf);
+            }
+        }
+        ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+        UtAssert_True(Status >= CFE_SUCCESS, "Pool get/put {%s} status = %ld", Params, (long)Status);
+        if (Status >= CFE_SUCCESS)
+        {
+            CFE_Test_PerfRecord("ES.GetPutPoolBuf", Params, i, ElapsedNsec, 0);
+        }
+    }
+}
+
+void TestESPoolPerfGetPut(void)
+{
+    CFE_ES_MemHandle_t PoolId;
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf, CFE_ES_PutPoolBuf with and without a pool semaphore");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreate(&PoolId, ES_PoolPerfMemory.Data, sizeof(ES_PoolPerfMemory)), CFE_SUCCESS);
+    ES_PoolPerfGetPut(PoolId, "sem");
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolId), CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateNoSem(&PoolId, ES_PoolPerfMemory.Data, sizeof(ES_PoolPerfMemory)),
+                      CFE_SUCCESS);
+    ES_PoolPerfGetPut(PoolId, "nosem");
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolId), CFE_SUCCESS);
+}
+
+int32 ESPoolPerfTestSetup(int32 LibId)
+{
+    UtTest_Add(TestESPoolPerfGetPut, NULL, NULL, "Test ES Pool Perf Get Put");
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: evs_perf_test.c
+**
+** Purpose:
+**   Performance test of Event Services event generation
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+#include "cfe_msgids.h"
+#include "cfe_evs_msg.h"
+#include "cfe_platform_cfg.h"
+
+/*
+ * Every event sent with an enabled type is also written to the console
+ * and the local event log, so this count is kept small.
+ */
+#define EVS_PERF_ITERATIONS 100
+#define EVS_PERF_EVENT_ID   100
+
+/*
+ * Time for EVS to process a command sent by this task
+ */
+#define EVS_PERF_COMMAND_DELAY 250
+
+static void EVS_PerfSetFormatMode(CFE_EVS_MsgFormat_Enum_t Mode)
+{
+    CFE_EVS_SetEventFormatModeCmd_t Cmd;
+
+    memset(&Cmd, 0, sizeof(Cmd));
+    CFE_MSG_Init(&Cmd.CmdHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_CMD_MID), sizeof(Cmd));
+    CFE_MSG_SetFcnCode(&Cmd.CmdHeader.Msg, CFE_EVS_SET_EVENT_FORMAT_MODE_CC);
+    Cmd.Payload.MsgFormat = Mode;
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsg(&Cmd.CmdHeader.Msg, true), CFE_SUCCESS);
+    OS_TaskDelay(EVS_PERF_COMMAND_DELAY);
+}
+
+static void EVS_PerfSendEvents(const char *Params, uint16 EventType)
+{
+    OS_time_t Start;
+    int64     ElapsedNsec;
+    uint32    i;
+    int32     Status;
+
+    Status = CFE_SUCCESS;
+    Start  = CFE_Test_PerfNow();
+    for (i = 0; i < EVS_PERF_ITERATIONS && Status == CFE_SUCCESS; ++i)
+    {
+        Status = CFE_EVS_SendEvent(EVS_PERF_EVENT_ID, EventType, "EVS performance test event %lu of %lu",
+                                   (unsigned long)i, (unsigned long)EVS_PERF_ITERATIONS);
+    }
+    ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+    UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_Test_PerfRecord("EVS.SendEvent", Params, i, ElapsedNsec, 0);
+    }
+}
+
+void TestEVSPerfSendEvent(void)
+{
+    UtPrintf("Testing: CFE_EVS_SendEvent by format mode");
+
+    EVS_PerfSetFormatMode(CFE_EVS_MsgFormat_SHORT);
+    EVS_PerfSendEvents("format=short", CFE_EVS_EventType_INFORMATION);
+
+    EVS_PerfSetFormatMode(CFE_EVS_MsgFormat_LONG);
+    EVS_PerfSendEvents("format=long", CFE_EVS_EventType_INFORMATION);
+
+    /* Debug events are disabled by default, so this is the cost of discarding an event */
+    EVS_PerfSendEvents("type=debug", CFE_EVS_EventType_DEBUG);
+
+    EVS_PerfSetFormatMode(CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE);
+}
+
+int32 EVSPerfTestSetup(int32 LibId)
+{
+    UtTest_Add(TestEVSPerfSendEvent, NULL, NULL, "Test EVS Perf Send Event");
+
+    return CFE_SUCCESS;
+}
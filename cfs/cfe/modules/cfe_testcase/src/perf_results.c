@@ -0,0 +1,137 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: perf_results.c
+**
+** Purpose:
+**   Recording and output of cFE performance test results
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+static CFE_Test_PerfRecord_t CFE_Test_PerfResults[CFE_TEST_PERF_MAX_RESULTS];
+static uint32                CFE_Test_PerfNumResults;
+
+OS_time_t CFE_Test_PerfNow(void)
+{
+    OS_time_t Now;
+
+    OS_GetLocalTime(&Now);
+    return Now;
+}
+
+int64 CFE_Test_PerfElapsedNsec(OS_time_t Start)
+{
+    return OS_TimeGetTotalNanoseconds(OS_TimeSubtract(CFE_Test_PerfNow(), Start));
+}
+
+void CFE_Test_PerfRecordLatency(const char *Name, const char *Params, uint32 Count, int64 ElapsedNsec,
+                                int64 MinNsec, int64 MaxNsec, uint32 Bytes)
+{
+    CFE_Test_PerfRecord_t *Result;
+
+    if (Count == 0)
+    {
+        return;
+    }
+
+    if (CFE_Test_PerfNumResults >= CFE_TEST_PERF_MAX_RESULTS)
+    {
+        UtAssert_Failed("Too many performance results, %s {%s} dropped", Name, Params);
+        return;
+    }
+
+    Result = &CFE_Test_PerfResults[CFE_Test_PerfNumResults];
+    ++CFE_Test_PerfNumResults;
+
+    memset(Result, 0, sizeof(*Result));
+    strncpy(Result->Name, Name, sizeof(Result->Name) - 1);
+    strncpy(Result->Params, Params, sizeof(Result->Params) - 1);
+    Result->Count       = Count;
+    Result->ElapsedUsec = (uint32)(ElapsedNsec / 1000);
+    Result->MeanNsec    = (uint32)(ElapsedNsec / Count);
+    Result->MinNsec     = (uint32)MinNsec;
+    Result->MaxNsec     = (uint32)MaxNsec;
+    Result->Bytes       = Bytes;
+
+    if (MaxNsec > 0)
+    {
+        UtPrintf("PERF %s {%s}: %lu ops, mean %lu ns, min %lu ns, max %lu ns", Result->Name, Result->Params,
+                 (unsigned long)Result->Count, (unsigned long)Result->MeanNsec, (unsigned long)Result->MinNsec,
+                 (unsigned long)Result->MaxNsec);
+    }
+    else
+    {
+        UtPrintf("PERF %s {%s}: %lu ops in %lu usec, mean %lu ns", Result->Name, Result->Params,
+                 (unsigned long)Result->Count, (unsigned long)Result->ElapsedUsec, (unsigned long)Result->MeanNsec);
+    }
+}
+
+void CFE_Test_PerfRecord(const char *Name, const char *Params, uint32 Count, int64 ElapsedNsec, uint32 Bytes)
+{
+    CFE_Test_PerfRecordLatency(Name, Params, Count, ElapsedNsec, 0, 0, Bytes);
+}
+
+void TestPerfWriteResults(void)
+{
+    CFE_FS_Header_t Header;
+    osal_id_t       FileDes;
+    int32           Status;
+    size_t          Size;
+
+    UtPrintf("Writing %lu performance results to %s", (unsigned long)CFE_Test_PerfNumResults,
+             CFE_TEST_PERF_RESULTS_FILE);
+
+    UtAssert_True(CFE_Test_PerfNumResults > 0, "Performance results recorded = %lu",
+                  (unsigned long)CFE_Test_PerfNumResults);
+
+    Status = OS_OpenCreate(&FileDes, CFE_TEST_PERF_RESULTS_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                           OS_WRITE_ONLY);
+    UtAssert_INT32_EQ(Status, OS_SUCCESS);
+    if (Status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    CFE_FS_InitHeader(&Header, "cFE Test Performance Results", CFE_TEST_PERF_FILE_SUBTYPE);
+    Status = CFE_FS_WriteHeader(FileDes, &Header);
+    UtAssert_INT32_EQ(Status, sizeof(CFE_FS_Header_t));
+
+    if (Status == sizeof(CFE_FS_Header_t))
+    {
+        Size   = CFE_Test_PerfNumResults * sizeof(CFE_Test_PerfRecord_t);
+        Status = OS_write(FileDes, CFE_Test_PerfResults, Size);
+        UtAssert_INT32_EQ(Status, Size);
+    }
+
+    OS_close(FileDes);
+}
+
+int32 PerfResultsTestSetup(int32 LibId)
+{
+    UtTest_Add(TestPerfWriteResults, NULL, NULL, "Test Perf Write Results");
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,278 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: sb_perf_test.c
+**
+** Purpose:
+**   Performance test of Software Bus transmit and receive
+**
+**   All pipes are read by the test task itself, so the times are the cost
+**   of the SB calls without any task switching.
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define SB_PERF_MAX_SUBSCRIBERS 4
+#define SB_PERF_MAX_MSG_SIZE    4096
+#define SB_PERF_ITERATIONS      1000
+
+static const uint32 SB_PERF_MSG_SIZES[]   = {64, 512, SB_PERF_MAX_MSG_SIZE};
+static const uint32 SB_PERF_SUBSCRIBERS[] = {1, 2, SB_PERF_MAX_SUBSCRIBERS};
+
+static union
+{
+    CFE_MSG_Message_t Msg;
+    uint8             Bytes[SB_PERF_MAX_MSG_SIZE];
+} SB_PerfMsg;
+
+static CFE_SB_PipeId_t SB_PerfPipes[SB_PERF_MAX_SUBSCRIBERS];
+
+/*
+ * Create a pipe for each subscriber, all subscribed to the test message ID
+ */
+static bool SB_PerfCreatePipes(uint32 NumPipes)
+{
+    char   PipeName[OS_MAX_API_NAME];
+    uint32 i;
+    int32  Status;
+
+    Status = CFE_SUCCESS;
+    for (i = 0; i < NumPipes; ++i)
+    {
+        snprintf(PipeName, sizeof(PipeName), "PerfPipe%lu", (unsigned long)i);
+        Status = CFE_SB_CreatePipe(&SB_PerfPipes[i], 4, PipeName);
+        if (Status != CFE_SUCCESS)
+        {
+            break;
+        }
+
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_TEST_PERF_MID), SB_PerfPipes[i]);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_SB_DeletePipe(SB_PerfPipes[i]);
+            break;
+        }
+    }
+
+    UtAssert_True(Status == CFE_SUCCESS, "Created %lu of %lu subscribed pipes, status = %ld", (unsigned long)i,
+                  (unsigned long)NumPipes, (long)Status);
+
+    if (Status != CFE_SUCCESS)
+    {
+        while (i > 0)
+        {
+            --i;
+            CFE_SB_DeletePipe(SB_PerfPipes[i]);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+static void SB_PerfDeletePipes(uint32 NumPipes)
+{
+    uint32 i;
+
+    for (i = 0; i < NumPipes; ++i)
+    {
+        CFE_SB_DeletePipe(SB_PerfPipes[i]);
+    }
+}
+
+/*
+ * Receive the message just sent on every pipe
+ */
+static int32 SB_PerfReceiveAll(uint32 NumPipes)
+{
+    CFE_SB_Buffer_t *BufPtr;
+    uint32           i;
+    int32            Status;
+
+    Status = CFE_SUCCESS;
+    for (i = 0; i < NumPipes && Status == CFE_SUCCESS; ++i)
+    {
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, SB_PerfPipes[i], CFE_SB_POLL);
+    }
+
+    return Status;
+}
+
+void TestSBPerfTransmitReceive(void)
+{
+    char      Params[CFE_TEST_PERF_PARAMS_LEN];
+    OS_time_t Start;
+    int64     OpNsec;
+    int64     TotalNsec;
+    int64     MinNsec;
+    int64     MaxNsec;
+    uint32    NumPipes;
+    uint32    Size;
+    uint32    i;
+    uint32    j;
+    uint32    k;
+    int32     Status;
+
+    UtPrintf("Testing: CFE_SB_TransmitMsg, CFE_SB_ReceiveBuffer latency by subscriber count and size");
+
+    for (k = 0; k < sizeof(SB_PERF_SUBSCRIBERS) / sizeof(SB_PERF_SUBSCRIBERS[0]); ++k)
+    {
+        NumPipes = SB_PERF_SUBSCRIBERS[k];
+        if (!SB_PerfCreatePipes(NumPipes))
+        {
+            continue;
+        }
+
+        for (j = 0; j < sizeof(SB_PERF_MSG_SIZES) / sizeof(SB_PERF_MSG_SIZES[0]); ++j)
+        {
+            Size = SB_PERF_MSG_SIZES[j];
+            snprintf(Params, sizeof(Params), "size=%lu subs=%lu", (unsigned long)Size, (unsigned long)NumPipes);
+            CFE_MSG_Init(&SB_PerfMsg.Msg, CFE_SB_ValueToMsgId(CFE_TEST_PERF_MID), Size);
+
+            Status    = CFE_SUCCESS;
+            TotalNsec = 0;
+            MinNsec   = 0;
+            MaxNsec   = 0;
+            for (i = 0; i < SB_PERF_ITERATIONS; ++i)
+            {
+                Start  = CFE_Test_PerfNow();
+                Status = CFE_SB_TransmitMsg(&SB_PerfMsg.Msg, true);
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = SB_PerfReceiveAll(NumPipes);
+                }
+                OpNsec = CFE_Test_PerfElapsedNsec(Start);
+
+                if (Status != CFE_SUCCESS)
+                {
+                    break;
+                }
+
+                TotalNsec += OpNsec;
+                if (i == 0 || OpNsec < MinNsec)
+                {
+                    MinNsec = OpNsec;
+                }
+                if (i == 0 || OpNsec > MaxNsec)
+                {
+                    MaxNsec = OpNsec;
+                }
+            }
+
+            UtAssert_True(i == SB_PERF_ITERATIONS, "SB transmit/receive {%s} completed %lu, status = %ld", Params,
+                          (unsigned long)i, (long)Status);
+            CFE_Test_PerfRecordLatency("SB.TransmitReceive", Params, i, TotalNsec, MinNsec, MaxNsec, i * Size);
+        }
+
+        SB_PerfDeletePipes(NumPipes);
+    }
+}
+
+void TestSBPerfZeroCopy(void)
+{
+    char             Params[CFE_TEST_PERF_PARAMS_LEN];
+    CFE_SB_Buffer_t *BufPtr;
+    OS_time_t        Start;
+    int64            ElapsedNsec;
+    uint32           Size;
+    uint32           i;
+    uint32           j;
+    int32            Status;
+
+    UtPrintf("Testing: CFE_SB_TransmitMsg compared with CFE_SB_AllocateMessageBuffer, CFE_SB_TransmitBuffer");
+
+    if (!SB_PerfCreatePipes(1))
+    {
+        return;
+    }
+
+    for (j = 0; j < sizeof(SB_PERF_MSG_SIZES) / sizeof(SB_PERF_MSG_SIZES[0]); ++j)
+    {
+        Size = SB_PERF_MSG_SIZES[j];
+        snprintf(Params, sizeof(Params), "size=%lu", (unsigned long)Size);
+
+        /* Copy: the message is built once and copied into an SB buffer on each transmit */
+        CFE_MSG_Init(&SB_PerfMsg.Msg, CFE_SB_ValueToMsgId(CFE_TEST_PERF_MID), Size);
+
+        Status = CFE_SUCCESS;
+        Start  = CFE_Test_PerfNow();
+        for (i = 0; i < SB_PERF_ITERATIONS && Status == CFE_SUCCESS; ++i)
+        {
+            Status = CFE_SB_TransmitMsg(&SB_PerfMsg.Msg, true);
+            if (Status == CFE_SUCCESS)
+            {
+                Status = SB_PerfReceiveAll(1);
+            }
+        }
+        ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+        UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_Test_PerfRecord("SB.CopyTransmit", Params, i, ElapsedNsec, i * Size);
+        }
+
+        /* Zero copy: the message is built directly in a new SB buffer on each transmit */
+        Status = CFE_SUCCESS;
+        Start  = CFE_Test_PerfNow();
+        for (i = 0; i < SB_PERF_ITERATIONS && Status == CFE_SUCCESS; ++i)
+        {
+            BufPtr = CFE_SB_AllocateMessageBuffer(Size);
+            if (BufPtr == NULL)
+            {
+                Status = CFE_SB_BUF_ALOC_ERR;
+                break;
+            }
+
+            CFE_MSG_Init(&BufPtr->Msg, CFE_SB_ValueToMsgId(CFE_TEST_PERF_MID), Size);
+            Status = CFE_SB_TransmitBuffer(BufPtr, true);
+            if (Status == CFE_SUCCESS)
+            {
+                Status = SB_PerfReceiveAll(1);
+            }
+            else
+            {
+                CFE_SB_ReleaseMessageBuffer(BufPtr);
+            }
+        }
+        ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+        UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_Test_PerfRecord("SB.ZeroCopyTransmit", Params, i, ElapsedNsec, i * Size);
+        }
+    }
+
+    SB_PerfDeletePipes(1);
+}
+
+int32 SBPerfTestSetup(int32 LibId)
+{
+    UtTest_Add(TestSBPerfTransmitReceive, NULL, NULL, "Test SB Perf Transmit Receive");
+    UtTest_Add(TestSBPerfZeroCopy, NULL, NULL, "Test SB Perf Zero Copy");
+
+    return CFE_SUCCESS;
+}
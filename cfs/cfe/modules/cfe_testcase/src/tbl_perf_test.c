@@ -0,0 +1,142 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: tbl_perf_test.c
+**
+** Purpose:
+**   Performance test of Table Services load and access
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+/*
+ * Every load also sends a "loaded" event, so this count is kept small
+ */
+#define TBL_PERF_MAX_TABLE_SIZE  4096
+#define TBL_PERF_LOAD_ITERATIONS 50
+#define TBL_PERF_GET_ITERATIONS  10000
+
+typedef struct
+{
+    const char *Name;
+    uint32      Size;
+} TBL_PerfTable_t;
+
+static const TBL_PerfTable_t TBL_PERF_TABLES[] = {
+    {"PerfTbl64", 64}, {"PerfTbl1024", 1024}, {"PerfTbl4096", TBL_PERF_MAX_TABLE_SIZE}};
+
+static uint8 TBL_PerfLoadData[TBL_PERF_MAX_TABLE_SIZE];
+
+static void TBL_PerfLoad(CFE_TBL_Handle_t Handle, const char *Params, uint32 Size)
+{
+    OS_time_t Start;
+    int64     ElapsedNsec;
+    uint32    i;
+    int32     Status;
+
+    Status = CFE_SUCCESS;
+    Start  = CFE_Test_PerfNow();
+    for (i = 0; i < TBL_PERF_LOAD_ITERATIONS && Status == CFE_SUCCESS; ++i)
+    {
+        TBL_PerfLoadData[0] = (uint8)i;
+        Status              = CFE_TBL_Load(Handle, CFE_TBL_SRC_ADDRESS, TBL_PerfLoadData);
+    }
+    ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+    UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_Test_PerfRecord("TBL.Load", Params, i, ElapsedNsec, i * Size);
+    }
+}
+
+static void TBL_PerfGetAddress(CFE_TBL_Handle_t Handle, const char *Params)
+{
+    OS_time_t Start;
+    int64     ElapsedNsec;
+    void *    TblPtr;
+    uint32    i;
+    int32     Status;
+
+    /* clear the "updated" indication left by the last load */
+    CFE_TBL_GetAddress(&TblPtr, Handle);
+    CFE_TBL_ReleaseAddress(Handle);
+
+    Status = CFE_SUCCESS;
+    Start  = CFE_Test_PerfNow();
+    for (i = 0; i < TBL_PERF_GET_ITERATIONS && Status == CFE_SUCCESS; ++i)
+    {
+        Status = CFE_TBL_GetAddress(&TblPtr, Handle);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_TBL_ReleaseAddress(Handle);
+        }
+    }
+    ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+    UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_Test_PerfRecord("TBL.GetReleaseAddress", Params, i, ElapsedNsec, 0);
+    }
+}
+
+void TestTBLPerfLoadAndAccess(void)
+{
+    char             Params[CFE_TEST_PERF_PARAMS_LEN];
+    CFE_TBL_Handle_t Handle;
+    uint32           Size;
+    uint32           j;
+    int32            Status;
+
+    UtPrintf("Testing: CFE_TBL_Load, CFE_TBL_GetAddress, CFE_TBL_ReleaseAddress by table size");
+
+    memset(TBL_PerfLoadData, 0xA5, sizeof(TBL_PerfLoadData));
+
+    for (j = 0; j < sizeof(TBL_PERF_TABLES) / sizeof(TBL_PERF_TABLES[0]); ++j)
+    {
+        Size = TBL_PERF_TABLES[j].Size;
+        snprintf(Params, sizeof(Params), "size=%lu", (unsigned long)Size);
+
+        Status = CFE_TBL_Register(&Handle, TBL_PERF_TABLES[j].Name, Size, CFE_TBL_OPT_DEFAULT, NULL);
+        UtAssert_INT32_EQ(Status, CFE_SUCCESS);
+        if (Status != CFE_SUCCESS)
+        {
+            continue;
+        }
+
+        TBL_PerfLoad(Handle, Params, Size);
+        TBL_PerfGetAddress(Handle, Params);
+
+        UtAssert_INT32_EQ(CFE_TBL_Unregister(Handle), CFE_SUCCESS);
+    }
+}
+
+int32 TBLPerfTestSetup(int32 LibId)
+{
+    UtTest_Add(TestTBLPerfLoadAndAccess, NULL, NULL, "Test TBL Perf Load and Access");
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,78 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: time_perf_test.c
+**
+** Purpose:
+**   Performance test of Time Services time queries
+**
+*************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cfe_test.h"
+
+#define TIME_PERF_ITERATIONS 10000
+
+typedef struct
+{
+    const char *Name;
+    CFE_TIME_SysTime_t (*GetTimeFunc)(void);
+} TIME_PerfFunc_t;
+
+static const TIME_PerfFunc_t TIME_PERF_FUNCS[] = {{"TIME.GetTime", CFE_TIME_GetTime},
+                                                  {"TIME.GetTAI", CFE_TIME_GetTAI},
+                                                  {"TIME.GetUTC", CFE_TIME_GetUTC},
+                                                  {"TIME.GetMET", CFE_TIME_GetMET}};
+
+void TestTIMEPerfGetTime(void)
+{
+    CFE_TIME_SysTime_t Time;
+    OS_time_t          Start;
+    int64              ElapsedNsec;
+    uint32             i;
+    uint32             j;
+
+    UtPrintf("Testing: CFE_TIME_GetTime, CFE_TIME_GetTAI, CFE_TIME_GetUTC, CFE_TIME_GetMET");
+
+    for (j = 0; j < sizeof(TIME_PERF_FUNCS) / sizeof(TIME_PERF_FUNCS[0]); ++j)
+    {
+        Time.Seconds = 0;
+        Start        = CFE_Test_PerfNow();
+        for (i = 0; i < TIME_PERF_ITERATIONS; ++i)
+        {
+            Time = TIME_PERF_FUNCS[j].GetTimeFunc();
+        }
+        ElapsedNsec = CFE_Test_PerfElapsedNsec(Start);
+
+        UtAssert_True(Time.Seconds != 0 || Time.Subseconds != 0, "%s() = %lu.%08lx", TIME_PERF_FUNCS[j].Name,
+                      (unsigned long)Time.Seconds, (unsigned long)Time.Subseconds);
+        CFE_Test_PerfRecord(TIME_PERF_FUNCS[j].Name, "", i, ElapsedNsec, 0);
+    }
+}
+
+int32 TIMEPerfTestSetup(int32 LibId)
+{
+    UtTest_Add(TestTIMEPerfGetTime, NULL, NULL, "Test TIME Perf Get Time");
+
+    return CFE_SUCCESS;
+}
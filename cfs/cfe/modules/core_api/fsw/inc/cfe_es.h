@@ -592,6 +592,7 @@ CFE_Status_t CFE_ES_GetLibIDByName(CFE_ES_LibId_t *LibIdPtr, const char *LibName
 **
 ** \par Assumptions, External Events, and Notes:
 **        In the case of a failure (#CFE_ES_ERR_RESOURCEID_NOT_VALID), an empty string is returned.
+**        This does not take the ES shared data lock, so it may be used on time critical paths.
 **
 ** \param[out]  AppName       Pointer to a character array of at least \c BufferLength in size that will
 **                            be filled with the appropriate Application name.
@@ -612,6 +613,41 @@ CFE_Status_t CFE_ES_GetLibIDByName(CFE_ES_LibId_t *LibIdPtr, const char *LibName
 ******************************************************************************/
 CFE_Status_t CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t BufferLength);
 
+/*****************************************************************************/
+/**
+** \brief Get the Application name and Task name for a specified Task ID
+**
+** \par Description
+**        This routine retrieves the name of the specified task and the name
+**        of the cFE Application that owns it.
+**
+** \par Assumptions, External Events, and Notes:
+**        In the case of a failure (#CFE_ES_ERR_RESOURCEID_NOT_VALID), empty strings are returned.
+**        This does not take the ES shared data lock, so it may be used on time critical paths
+**        such as error reporting.  To obtain the other task details use #CFE_ES_GetTaskInfo.
+**
+** \param[out]  AppName       Pointer to a character array of at least \c BufferLength in size that will
+**                            be filled with the name of the parent Application.
+**
+** \param[out]  TaskName      Pointer to a character array of at least \c BufferLength in size that will
+**                            be filled with the Task name.
+**
+** \param[in]   TaskId        Task ID of the Task whose names are being requested.
+**
+** \param[in]   BufferLength  The maximum number of characters, including the null terminator, that can be put
+**                            into each of the \c AppName and \c TaskName buffers.  This routine will truncate
+**                            the names to this length, if necessary.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                      \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID  \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT              \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_GetAppName, #CFE_ES_GetTaskName, #CFE_ES_GetTaskInfo
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_GetAppAndTaskName(char *AppName, char *TaskName, CFE_ES_TaskId_t TaskId, size_t BufferLength);
+
 /*****************************************************************************/
 /**
 ** \brief Get a Library name for a specified Library ID
@@ -797,7 +833,9 @@ int32 CFE_ES_GetModuleInfo(CFE_ES_AppInfo_t *ModuleInfo, CFE_ResourceId_t Resour
 **                            the highest priority.  Applications cannot create tasks with a higher priority
 **                            (lower number) than their own priority.
 **
-** \param[in]   Flags         Reserved for future expansion.
+** \param[in]   Flags         Options for the new task.  #CFE_ES_TASK_CPU_AFFINITY may be used to restrict
+**                            the task to a set of CPUs; otherwise the task inherits the CPU affinity of
+**                            the Application's main task.  Other bits are reserved for future expansion.
 **
 ** \return Execution status, see \ref CFEReturnCodes
 ** \retval #CFE_SUCCESS                  \copybrief CFE_SUCCESS
@@ -1126,6 +1164,42 @@ CFE_Status_t CFE_ES_GetCDSBlockName(char *BlockName, CFE_ES_CDSHandle_t BlockId,
 */
 CFE_Status_t CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save part of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies \c Size bytes of memory into the Critical Data Store block
+**        identified with the \c Handle, starting \c Offset bytes into the block.  The rest
+**        of the block is left unchanged.  The data integrity check is updated from the
+**        changed bytes alone, so the cost depends on \c Size rather than the size of the
+**        block.  This suits applications that keep a large state structure in the CDS
+**        and change a few fields at a time.
+**
+** \par Assumptions, External Events, and Notes:
+**        The integrity check is updated relative to the block's current content.  A block
+**        that would fail #CFE_ES_RestoreFromCDS before the update still fails afterwards,
+**        so a newly registered block should be initialized with #CFE_ES_CopyToCDS.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   DataToCopy   A Pointer to the \c Size bytes of memory to be copied into the CDS.
+**
+** \param[in]   Offset       The offset, in bytes, of the first byte to update within the CDS block.
+**
+** \param[in]   Size         The number of bytes to update.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID   \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_CDS_INVALID_SIZE           \copybrief CFE_ES_CDS_INVALID_SIZE
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+CFE_Status_t CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
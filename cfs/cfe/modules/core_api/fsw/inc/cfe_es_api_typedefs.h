@@ -185,6 +185,20 @@ typedef void *CFE_ES_MemPoolBuf_t;
  * to indicate that the stack should be dynamically allocated.
  */
 #define CFE_ES_TASK_STACK_ALLOCATE NULL /* aka OS_TASK_STACK_ALLOCATE in proposed OSAL change */
+
+/**
+ * \brief Child task creation flag restricting the new task to a set of CPUs
+ *
+ * This value may be supplied as the Flags argument to CFE_ES_CreateChildTask().
+ * Bit N of the mask allows the task to run on CPU N, for up to 16 CPUs.  A mask
+ * of zero means the child task uses the same CPUs as the main task of its app.
+ */
+#define CFE_ES_TASK_CPU_AFFINITY(mask) (((uint32)(mask)&0xFFFFU) << 16)
+
+/**
+ * \brief Extract the CPU affinity mask from child task creation flags
+ */
+#define CFE_ES_TASK_CPU_AFFINITY_GET(flags) (((uint32)(flags) >> 16) & 0xFFFFU)
 /** \} */
 
 #define CFE_ES_NO_MUTEX  false /**< \brief Indicates that the memory pool selection will not use a semaphore */
@@ -510,8 +510,15 @@ typedef struct CFE_ES_TaskInfo
     CFE_ES_MemOffset_t         StackSize;                         /**< Size of task stack */
     CFE_ES_TaskPriority_Atom_t Priority;                          /**< Priority of task */
     uint8                      Spare[2];                          /**< Spare bytes for alignment */
+    uint32                     CpuAffinityMask;                   /**< CPUs the task may run on, 0 for any */
+    uint32                     LastCpu;                           /**< CPU the task last ran on */
 } CFE_ES_TaskInfo_t;
 
+/**
+ * \brief Value of CFE_ES_TaskInfo_t::LastCpu when the CPU is not known
+ */
+#define CFE_ES_TASK_CPU_UNKNOWN 0xFFFFFFFF
+
 /**
  * \brief CDS Register Dump Record
  *
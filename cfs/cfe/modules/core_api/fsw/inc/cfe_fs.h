@@ -283,6 +283,76 @@ int32 CFE_FS_ParseInputFileName(char *OutputBuffer, const char *InputName, size_
 ******************************************************************************/
 CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnly);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a buffered text file reader
+**
+** \par Description
+**        Associates the reader with an open file and empties its buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        The caller opens and closes the file. Reading resumes from the
+**        current file position.
+**
+** \param[out] Reader      The buffered reader state object
+** \param[in]  FileDes     File descriptor of the open text file
+**
+** \return Execution status, see \ref CFEReturnCodes
+**
+** \sa #CFE_FS_TextReadChar, #CFE_FS_TextReadLine
+**
+******************************************************************************/
+int32 CFE_FS_TextReaderInit(CFE_FS_TextReader_t *Reader, osal_id_t FileDes);
+
+/*****************************************************************************/
+/**
+** \brief Reads the next character from a buffered text file reader
+**
+** \par Description
+**        Returns the next character of the file. The file is only read when
+**        the reader's buffer is empty, one #CFE_FS_TEXT_READER_BUF_SIZE
+**        block at a time.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[inout] Reader     The buffered reader state object
+** \param[out]   Char       The character read
+**
+** \return 1 if a character was read, 0 at the end of the file, or a negative
+**         OSAL or cFE error code
+**
+** \sa #CFE_FS_TextReaderInit, #CFE_FS_TextReadLine
+**
+******************************************************************************/
+int32 CFE_FS_TextReadChar(CFE_FS_TextReader_t *Reader, char *Char);
+
+/*****************************************************************************/
+/**
+** \brief Reads the next line from a buffered text file reader
+**
+** \par Description
+**        Copies characters up to and including the next newline into
+**        LineBuf and null terminates it, in the manner of fgets().
+**
+** \par Assumptions, External Events, and Notes:
+**        -# At most LineBufSize - 1 characters are copied. A line that does
+**           not fit is returned in pieces, so a line is complete only when
+**           it ends with a newline or the file ends.
+**        -# The last line of a file may not end with a newline.
+**
+** \param[inout] Reader      The buffered reader state object
+** \param[out]   LineBuf     Buffer to receive the line
+** \param[in]    LineBufSize Size of LineBuf, including the null terminator
+**
+** \return The number of characters copied, 0 at the end of the file, or a
+**         negative OSAL or cFE error code
+**
+** \sa #CFE_FS_TextReaderInit, #CFE_FS_TextReadChar
+**
+******************************************************************************/
+int32 CFE_FS_TextReadLine(CFE_FS_TextReader_t *Reader, char *LineBuf, size_t LineBufSize);
+
 /*****************************************************************************/
 /**
 ** \brief Register a background file dump request
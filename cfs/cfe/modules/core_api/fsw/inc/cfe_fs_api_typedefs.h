@@ -118,4 +118,28 @@ typedef struct CFE_FS_FileWriteMetaData
 
 } CFE_FS_FileWriteMetaData_t;
 
+/**
+ * \brief Size of the block buffer in a #CFE_FS_TextReader_t
+ *
+ * Text files are read from the file system in blocks of this size.
+ */
+#define CFE_FS_TEXT_READER_BUF_SIZE 512
+
+/**
+ * \brief Buffered text file reader state
+ *
+ * Reads a text file in blocks so callers that consume it a character or
+ * a line at a time don't make one OS_read() call per character.
+ * Initialize with CFE_FS_TextReaderInit() after the file is opened.
+ */
+typedef struct CFE_FS_TextReader
+{
+    osal_id_t FileDes;  /**< File being read, owned by the caller */
+    size_t    Position; /**< Index of the next unread character in Buffer */
+    size_t    Length;   /**< Number of valid characters in Buffer */
+
+    char Buffer[CFE_FS_TEXT_READER_BUF_SIZE]; /**< Block read from the file */
+
+} CFE_FS_TextReader_t;
+
 #endif /* CFE_FS_API_TYPEDEFS_H */
@@ -39,6 +39,32 @@
 #include "cfe_sb_api_typedefs.h"
 #include "cfe_time_api_typedefs.h"
 
+/*
+ * Types
+ */
+
+/**
+ * \brief Storage reserved for a message template, in bytes
+ *
+ * Room for the largest header plus what the MSG module keeps with it.
+ * The MSG module checks at build time that its template layout fits.
+ */
+#define CFE_MSG_TEMPLATE_SIZE \
+    (sizeof(CFE_MSG_TelemetryHeader_t) + sizeof(CFE_MSG_CommandHeader_t) + 4 * sizeof(void *))
+
+/**
+ * \brief Pre-built message template
+ *
+ * Holds the header of a message built once by CFE_MSG_InitTemplate so
+ * repeated sends only need CFE_MSG_ApplyTemplate instead of CFE_MSG_Init.
+ * The contents are opaque, their layout is private to the MSG module.
+ */
+typedef union CFE_MSG_Template
+{
+    CFE_ES_PoolAlign_t Align;                          /**< \brief Aligns the storage for any layout */
+    uint8              Storage[CFE_MSG_TEMPLATE_SIZE]; /**< \brief Opaque template contents */
+} CFE_MSG_Template_t;
+
 /** \defgroup CFEAPIMSGHeader cFE Message header APIs
  * \{
  */
@@ -62,6 +88,73 @@
  */
 CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
 
+/*****************************************************************************/
+/**
+ * \brief Initialize a message template
+ *
+ * \par Description
+ *          This routine builds the header for a message once, with the same
+ *          result as CFE_MSG_Init, and saves it in the template for later use
+ *          by CFE_MSG_ApplyTemplate.  If DefaultPayload is not NULL it must
+ *          point to (Size - header size) bytes that remain valid for the life
+ *          of the template; they are copied after the header on every apply.
+ *
+ * \param[out] TemplatePtr    Template to initialize
+ * \param[in]  MsgId          MsgId that corresponds to message
+ * \param[in]  Size           Total size of the message (used to set length field)
+ * \param[in]  DefaultPayload Optional default payload, NULL to leave payload untouched on apply
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS             \copybrief CFE_SUCCESS
+ * \retval #CFE_MSG_BAD_ARGUMENT    \copybrief CFE_MSG_BAD_ARGUMENT
+ */
+CFE_Status_t CFE_MSG_InitTemplate(CFE_MSG_Template_t *TemplatePtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size,
+                                  const void *DefaultPayload);
+
+/*****************************************************************************/
+/**
+ * \brief Stamp a message from a template
+ *
+ * \par Description
+ *          This routine copies the pre-built header (and default payload, if
+ *          the template has one) into the message with a single copy, then
+ *          sets the message time if Time is not NULL.  The sequence count
+ *          is left to the software bus (see CFE_SB_TransmitMsg).  On error
+ *          the message is not modified.
+ *
+ * \param[out] MsgPtr      A pointer to the buffer that receives the message.
+ *                         Must be at least the template size.
+ * \param[in]  TemplatePtr Template built with CFE_MSG_InitTemplate
+ * \param[in]  Time        Message time, or NULL to keep the template time (zero)
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS             \copybrief CFE_SUCCESS
+ * \retval #CFE_MSG_BAD_ARGUMENT    \copybrief CFE_MSG_BAD_ARGUMENT
+ * \retval #CFE_MSG_WRONG_MSG_TYPE  \copybrief CFE_MSG_WRONG_MSG_TYPE
+ */
+CFE_Status_t CFE_MSG_ApplyTemplate(CFE_MSG_Message_t *MsgPtr, const CFE_MSG_Template_t *TemplatePtr,
+                                   const CFE_TIME_SysTime_t *Time);
+
+/*****************************************************************************/
+/**
+ * \brief Decode all message header fields in one pass
+ *
+ * \par Description
+ *          This routine decodes every primary, extended (if configured) and
+ *          secondary header field of a message into a #CFE_MSG_HeaderInfo_t.
+ *          Secondary header fields are only decoded when the secondary header
+ *          flag is set; the function code and checksum for commands, the time
+ *          for telemetry.  Fields that do not apply are set to zero.
+ *
+ * \param[in]  MsgPtr      A pointer to the buffer that contains the message.
+ * \param[out] HdrInfo     Decoded header fields
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS             \copybrief CFE_SUCCESS
+ * \retval #CFE_MSG_BAD_ARGUMENT    \copybrief CFE_MSG_BAD_ARGUMENT
+ */
+CFE_Status_t CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderInfo_t *HdrInfo);
+
 /*****************************************************************************/
 /**
  * \brief Gets the total size of a message.
@@ -33,6 +33,8 @@
  */
 #include "common_types.h"
 #include "cfe_error.h"
+#include "cfe_sb_extern_typedefs.h"
+#include "cfe_time_extern_typedefs.h"
 
 /*
  * Defines
@@ -89,6 +91,33 @@ typedef enum CFE_MSG_PlaybackFlag
     CFE_MSG_PlayFlag_Playback  /**< \brief Playback */
 } CFE_MSG_PlaybackFlag_t;
 
+/**
+ * \brief Decoded message header fields
+ *
+ * Filled in a single pass by CFE_MSG_DecodeHeader.  Fields not present
+ * in the configured header layout (or not applicable to the message type)
+ * are left zero/invalid.
+ */
+typedef struct CFE_MSG_HeaderInfo
+{
+    CFE_SB_MsgId_t             MsgId;              /**< \brief Message id */
+    CFE_MSG_Size_t             Size;               /**< \brief Total message size */
+    CFE_MSG_Type_t             Type;               /**< \brief Message type */
+    CFE_MSG_HeaderVersion_t    HeaderVersion;      /**< \brief CCSDS header version */
+    bool                       HasSecondaryHeader; /**< \brief Secondary header present flag */
+    CFE_MSG_ApId_t             ApId;               /**< \brief Application ID */
+    CFE_MSG_SegmentationFlag_t SegmentationFlag;   /**< \brief Segmentation flag */
+    CFE_MSG_SequenceCount_t    SequenceCount;      /**< \brief Sequence count */
+    CFE_MSG_EDSVersion_t       EDSVersion;         /**< \brief EDS version, extended header only */
+    CFE_MSG_Endian_t           Endian;             /**< \brief Endian flag, extended header only */
+    CFE_MSG_PlaybackFlag_t     PlaybackFlag;       /**< \brief Playback flag, extended header only */
+    CFE_MSG_Subsystem_t        Subsystem;          /**< \brief Subsystem, extended header only */
+    CFE_MSG_System_t           System;             /**< \brief System, extended header only */
+    CFE_MSG_FcnCode_t          FcnCode;            /**< \brief Function code, commands only */
+    CFE_MSG_Checksum_t         Checksum;           /**< \brief Raw checksum field, commands only */
+    CFE_TIME_SysTime_t         Time;               /**< \brief Message time, telemetry only */
+} CFE_MSG_HeaderInfo_t;
+
 /*
  * Abstract Message Base Types
  *
@@ -152,6 +152,13 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 **          This routine sets (or clears) options to alter the pipe's behavior.
 **          Options are (re)set every call to this routine.
 **
+**          With #CFE_SB_PIPEOPTS_LATESTVALUE set, the pipe behaves as a set of
+**          per-MsgId mailboxes: a message that arrives while an earlier message
+**          with the same MsgId is still unread replaces it, and the older buffer
+**          is released.  The pipe then holds at most one entry per MsgId, so
+**          slow consumers of state telemetry always receive the newest sample
+**          and do not cause pipe overflow or MsgId limit errors.
+**
 ** \param[in]  PipeId       The pipe ID of the pipe to set options on.
 **
 ** \param[in]  Opts         A bit field of options.
@@ -161,6 +168,7 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 ** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
 **
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_GetPipeIdByName #CFE_SB_PIPEOPTS_IGNOREMINE
+**     #CFE_SB_PIPEOPTS_LATESTVALUE
 **/
 CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts);
 
@@ -245,6 +253,11 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **          shortest possible time, the developer may consider holding off its
 **          subscription until other applications have subscribed to the message.
 **
+**          Messages subscribed with a Quality.Priority of #CFE_SB_QosPriority_HIGH
+**          are returned by #CFE_SB_ReceiveBuffer ahead of any normal priority
+**          messages already waiting on the pipe.  High priority messages still
+**          count against the pipe depth.
+**
 ** \param[in]  MsgId        The message ID of the message to be subscribed to.
 **
 ** \param[in]  PipeId       The pipe ID of the pipe the subscribed message
@@ -268,6 +281,75 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **/
 CFE_Status_t CFE_SB_SubscribeEx(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim);
 
+/*****************************************************************************/
+/**
+** \brief Subscribe to a message on the software bus with a decimation filter
+**
+** \par Description
+**          This routine is the same as #CFE_SB_SubscribeEx with the addition of
+**          a decimation filter.  SB evaluates the filter before writing a message
+**          to the pipe, so messages that are filtered out are never queued to
+**          the subscriber.  See #CFE_SB_Filter_t for the filter algorithm.
+**
+** \par Assumptions, External Events, and Notes:
+**          If the pipe is already subscribed to the message the existing
+**          subscription, including its filter, is left unchanged.  Use
+**          #CFE_SB_SetSubscriptionFilter to change the filter of an existing
+**          subscription.
+**
+** \param[in]  MsgId        The message ID of the message to be subscribed to.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the subscribed message
+**                          should be sent to.
+**
+** \param[in]  Quality      The requested Quality of Service (QoS) required of
+**                          the messages. Most callers will use #CFE_SB_DEFAULT_QOS
+**                          for this parameter.
+**
+** \param[in]  MsgLim       The maximum number of messages with this Message ID to
+**                          allow in this pipe at the same time.
+**
+** \param[in]  FilterPtr    A pointer to the filter to apply, or NULL for no filter.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MSGS_MET  \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_MAX_DESTS_MET \copybrief CFE_SB_MAX_DESTS_MET
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_SubscribeEx, #CFE_SB_SetSubscriptionFilter, #CFE_SB_Unsubscribe
+**/
+CFE_Status_t CFE_SB_SubscribeFiltered(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality,
+                                      uint16 MsgLim, const CFE_SB_Filter_t *FilterPtr);
+
+/*****************************************************************************/
+/**
+** \brief Change the decimation filter of an existing subscription
+**
+** \par Description
+**          This routine replaces the filter SB applies to the specified message
+**          ID on the specified pipe.  The change takes effect with the next
+**          message sent; messages already on the pipe are not affected.
+**
+** \par Assumptions, External Events, and Notes:
+**          Only the owner of the pipe may change its filters.
+**
+** \param[in]  MsgId        The message ID of the subscription.
+**
+** \param[in]  PipeId       The pipe ID of the subscription.
+**
+** \param[in]  FilterPtr    A pointer to the new filter.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_SubscribeFiltered
+**/
+CFE_Status_t CFE_SB_SetSubscriptionFilter(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
+                                          const CFE_SB_Filter_t *FilterPtr);
+
 /*****************************************************************************/
 /**
 ** \brief Subscribe to a message on the software bus with default parameters
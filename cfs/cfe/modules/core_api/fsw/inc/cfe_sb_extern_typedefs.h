@@ -67,6 +67,11 @@ enum CFE_SB_QosPriority
  */
 typedef uint8 CFE_SB_QosPriority_Enum_t;
 
+/**
+ * @brief Number of QoS priority levels, for sizing per-priority statistics
+ */
+#define CFE_SB_QOS_PRIORITY_LEVELS (CFE_SB_QosPriority_HIGH + 1)
+
 /**
  * @brief Label definitions associated with CFE_SB_QosReliability_Enum_t
  */
@@ -91,6 +96,45 @@ enum CFE_SB_QosReliability
  */
 typedef uint8 CFE_SB_QosReliability_Enum_t;
 
+/**
+ * @brief Label definitions associated with CFE_SB_FilterType_Enum_t
+ */
+enum CFE_SB_FilterType
+{
+
+    /**
+     * @brief No filter, every message is delivered
+     */
+    CFE_SB_FilterType_NONE = 0,
+
+    /**
+     * @brief Every message is filtered
+     */
+    CFE_SB_FilterType_ALWAYS = 1,
+
+    /**
+     * @brief N of X messages delivered starting at offset O, by sequence count
+     */
+    CFE_SB_FilterType_BY_SEQ_CNT = 2,
+
+    /**
+     * @brief N of X messages delivered starting at offset O, by message time
+     */
+    CFE_SB_FilterType_BY_TIME = 3,
+
+    /**
+     * @brief No message is filtered
+     */
+    CFE_SB_FilterType_NEVER = 4
+};
+
+/**
+ * @brief Selects the decimation algorithm of a subscription filter
+ *
+ * @sa enum CFE_SB_FilterType
+ */
+typedef uint8 CFE_SB_FilterType_Enum_t;
+
 /**
  * @brief An integer type that should be used for indexing into the Routing Table
  */
@@ -136,6 +180,23 @@ typedef struct
                           currently unused */
 } CFE_SB_Qos_t;
 
+/** \brief Subscription Filter Type Definition
+**
+** Decimation filter applied by SB before a message is written to a subscriber's
+** pipe, see #CFE_SB_SubscribeFiltered.  The filter value is the sequence count
+** or a time value built from the 11 LSBs of seconds and the 4 MSBs of
+** subseconds.  A message is delivered when ((Value - O) % X) < N.  Invalid
+** parameters (X or N zero, N > X, O >= X) filter every message.
+**/
+typedef struct
+{
+    CFE_SB_FilterType_Enum_t Type; /**< \brief Filter algorithm, see #CFE_SB_FilterType */
+    uint8                    Spare;
+    uint16                   N; /**< \brief Messages delivered per group */
+    uint16                   X; /**< \brief Group size */
+    uint16                   O; /**< \brief Group offset */
+} CFE_SB_Filter_t;
+
 #endif /* CFE_EDS_ENABLED_BUILD */
 
 #endif /* CFE_SB_EXTERN_TYPEDEFS_H */
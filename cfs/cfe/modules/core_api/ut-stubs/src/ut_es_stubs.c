@@ -758,6 +758,64 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_GetAppAndTaskName stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_GetAppAndTaskName.  The application name is always "UT".  The
+**        task name is "UT" unless a data buffer has been set for this stub,
+**        in which case the buffer content is used as the task name.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns CFE_SUCCESS unless a different return value has been set.
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_GetAppAndTaskName(char *AppName, char *TaskName, CFE_ES_TaskId_t TaskId, size_t BufferLength)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_GetAppAndTaskName), AppName);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_GetAppAndTaskName), TaskName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_GetAppAndTaskName), TaskId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_GetAppAndTaskName), BufferLength);
+
+    size_t      UserBuffSize;
+    size_t      BuffPosition;
+    const char *NameBuff;
+    int32       status;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_GetAppAndTaskName);
+
+    if (status >= 0 && BufferLength > 0)
+    {
+        UT_GetDataBuffer(UT_KEY(CFE_ES_GetAppAndTaskName), (void **)&NameBuff, &UserBuffSize, &BuffPosition);
+        if (NameBuff == NULL || UserBuffSize == 0)
+        {
+            NameBuff     = "UT";
+            UserBuffSize = 2;
+        }
+
+        if (UserBuffSize < BufferLength)
+        {
+            BuffPosition = UserBuffSize;
+        }
+        else
+        {
+            BuffPosition = BufferLength - 1;
+        }
+
+        strncpy(TaskName, NameBuff, BuffPosition);
+        TaskName[BuffPosition] = 0;
+        strncpy(AppName, "UT", BufferLength - 1);
+        AppName[BufferLength - 1] = 0;
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetTaskInfo stub function
@@ -872,6 +930,44 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_CopyToCDSRange stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_CopyToCDSRange.  The user can adjust the response by setting
+**        the values in the ES_CopyToCDSRangeRtn structure prior to this function
+**        being called.  If the value ES_CopyToCDSRangeRtn.count is greater than
+**        zero then the counter is decremented; if it then equals zero the
+**        return value is set to the user-defined value ES_CopyToCDSRangeRtn.value.
+**        CFE_SUCCESS is returned otherwise.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Handle);
+    UT_Stub_RegisterContext(UT_KEY(CFE_ES_CopyToCDSRange), DataToCopy);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Offset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_ES_CopyToCDSRange), Size);
+    status = UT_DEFAULT_IMPL(CFE_ES_CopyToCDSRange);
+
+    if (status >= 0)
+    {
+        UT_Stub_CopyFromLocal(UT_KEY(CFE_ES_CopyToCDSRange), DataToCopy, Size);
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_RestoreFromCDS stub function
@@ -416,6 +416,66 @@ int32 CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnl
     return status;
 }
 
+int32 CFE_FS_TextReaderInit(CFE_FS_TextReader_t *Reader, osal_id_t FileDes)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_TextReaderInit), Reader);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_TextReaderInit), FileDes);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_FS_TextReaderInit);
+
+    if (status == CFE_SUCCESS)
+    {
+        memset(Reader, 0, sizeof(*Reader));
+        Reader->FileDes = FileDes;
+    }
+
+    return status;
+}
+
+/*
+ * Stub for CFE_FS_TextReadChar()
+ *
+ * By default this reads one character with OS_read() so test cases can
+ * supply file contents and errors through the OS_read() stub.
+ */
+int32 CFE_FS_TextReadChar(CFE_FS_TextReader_t *Reader, char *Char)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_TextReadChar), Reader);
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_TextReadChar), Char);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_TextReadChar, 1);
+
+    if (status == 1)
+    {
+        status = OS_read(Reader->FileDes, Char, 1);
+    }
+
+    return status;
+}
+
+int32 CFE_FS_TextReadLine(CFE_FS_TextReader_t *Reader, char *LineBuf, size_t LineBufSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_TextReadLine), Reader);
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_TextReadLine), LineBuf);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_TextReadLine), LineBufSize);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_FS_TextReadLine);
+
+    if (status == CFE_SUCCESS && LineBufSize > 0)
+    {
+        status          = UT_Stub_CopyToLocal(UT_KEY(CFE_FS_TextReadLine), LineBuf, LineBufSize - 1);
+        LineBuf[status] = 0;
+    }
+
+    return status;
+}
+
 bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_FS_RunBackgroundFileDump), ElapsedTime);
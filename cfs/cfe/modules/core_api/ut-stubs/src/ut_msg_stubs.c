@@ -44,6 +44,47 @@
 #define UTASSERT_GETSTUB(Expression) \
     UtAssert_Type(TSF, Expression, "%s: Check for get value provided by test", __func__);
 
+/*
+ * -----------------------------------------------------------
+ * Stub implementation of CFE_MSG_ApplyTemplate
+ * -----------------------------------------------------------
+ */
+int32 CFE_MSG_ApplyTemplate(CFE_MSG_Message_t *MsgPtr, const CFE_MSG_Template_t *TemplatePtr,
+                            const CFE_TIME_SysTime_t *Time)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_ApplyTemplate), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_ApplyTemplate), TemplatePtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_ApplyTemplate), Time);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_MSG_ApplyTemplate);
+
+    return status;
+}
+
+/*
+ * -----------------------------------------------------------
+ * Stub implementation of CFE_MSG_DecodeHeader
+ * -----------------------------------------------------------
+ */
+int32 CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderInfo_t *HdrInfo)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_DecodeHeader), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_DecodeHeader), HdrInfo);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_MSG_DecodeHeader);
+    if (status >= 0)
+    {
+        UTASSERT_GETSTUB(UT_Stub_CopyToLocal(UT_KEY(CFE_MSG_DecodeHeader), (uint8 *)HdrInfo, sizeof(*HdrInfo)) ==
+                         sizeof(*HdrInfo));
+    }
+
+    return status;
+}
+
 /*
  * -----------------------------------------------------------
  * Stub implementation of CFE_MSG_GenerateChecksum
@@ -427,6 +468,26 @@ int32 CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size
     return status;
 }
 
+/*
+ * -----------------------------------------------------------
+ * Stub implementation of CFE_MSG_InitTemplate
+ * -----------------------------------------------------------
+ */
+int32 CFE_MSG_InitTemplate(CFE_MSG_Template_t *TemplatePtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size,
+                           const void *DefaultPayload)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_InitTemplate), TemplatePtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_InitTemplate), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_InitTemplate), Size);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_MSG_InitTemplate), DefaultPayload);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_MSG_InitTemplate);
+
+    return status;
+}
+
 /*
  * -----------------------------------------------------------
  * Stub implementation of CFE_MSG_SetApId
@@ -421,6 +421,65 @@ int32 CFE_SB_SubscribeEx(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qo
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_SubscribeFiltered stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_SubscribeFiltered.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_SB_SubscribeFiltered(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
+                               const CFE_SB_Filter_t *FilterPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeFiltered), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeFiltered), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeFiltered), Quality);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeFiltered), MsgLim);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SubscribeFiltered), FilterPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SubscribeFiltered);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_SB_SetSubscriptionFilter stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_SetSubscriptionFilter.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_SB_SetSubscriptionFilter(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, const CFE_SB_Filter_t *FilterPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionFilter), MsgId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionFilter), PipeId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CFE_SB_SetSubscriptionFilter), FilterPtr);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(CFE_SB_SetSubscriptionFilter);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_Subscribe stub function
@@ -68,8 +68,7 @@ typedef struct
     ** System Log declaration
     */
     char   SystemLog[CFE_PLATFORM_ES_SYSTEM_LOG_SIZE];
-    size_t SystemLogWriteIdx;
-    size_t SystemLogEndIdx;
+    uint32 SystemLogState; /* Packed write and end index, see CFE_ES_SYSLOG_STATE() */
     uint32 SystemLogMode;
     uint32 SystemLogEntryNum;
 
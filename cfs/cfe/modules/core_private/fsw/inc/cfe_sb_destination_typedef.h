@@ -46,9 +46,13 @@ typedef struct
     uint16          BuffCount;
     uint16          DestCnt;
     uint8           Scope;
-    uint8           Spare[3];
+    uint8           Priority; /* CFE_SB_QosPriority_Enum_t of the subscription */
+    uint8           Spare[2];
     void *          Prev;
     void *          Next;
+    void *          LatestBuf;    /* Newest unread buffer, for CFE_SB_PIPEOPTS_LATESTVALUE pipes */
+    void *          LatestSignal; /* Queue entry that stands for LatestBuf (not a ref, compared only) */
+    CFE_SB_Filter_t Filter;       /* Decimation filter evaluated before queueing */
 } CFE_SB_DestinationD_t;
 
 #endif /* CFE_SB_DESTINATION_TYPEDEF_H */
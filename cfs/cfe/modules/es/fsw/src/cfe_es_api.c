@@ -169,14 +169,14 @@ int32 CFE_ES_RestartApp(CFE_ES_AppId_t AppID)
         */
         if (AppRecPtr->Type == CFE_ES_AppType_CORE)
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_RestartApp: Cannot Restart a CORE Application: %s.\n",
-                                      CFE_ES_AppRecordGetName(AppRecPtr));
+            CFE_ES_SysLogWrite("CFE_ES_RestartApp: Cannot Restart a CORE Application: %s.\n",
+                               CFE_ES_AppRecordGetName(AppRecPtr));
             ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
         }
         else if (AppRecPtr->AppState != CFE_ES_AppState_RUNNING)
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_RestartApp: Cannot Restart Application %s, It is not running.\n",
-                                      CFE_ES_AppRecordGetName(AppRecPtr));
+            CFE_ES_SysLogWrite("CFE_ES_RestartApp: Cannot Restart Application %s, It is not running.\n",
+                               CFE_ES_AppRecordGetName(AppRecPtr));
             ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
         }
         else
@@ -186,15 +186,15 @@ int32 CFE_ES_RestartApp(CFE_ES_AppId_t AppID)
             */
             if (OS_stat(AppRecPtr->StartParams.BasicInfo.FileName, &FileStatus) == OS_SUCCESS)
             {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_RestartApp: Restart Application %s Initiated\n",
-                                          CFE_ES_AppRecordGetName(AppRecPtr));
+                CFE_ES_SysLogWrite("CFE_ES_RestartApp: Restart Application %s Initiated\n",
+                                   CFE_ES_AppRecordGetName(AppRecPtr));
                 AppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_RESTART;
             }
             else
             {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_RestartApp: Cannot Restart Application %s, File %s does not exist.\n",
-                                          CFE_ES_AppRecordGetName(AppRecPtr),
-                                          AppRecPtr->StartParams.BasicInfo.FileName);
+                CFE_ES_SysLogWrite("CFE_ES_RestartApp: Cannot Restart Application %s, File %s does not exist.\n",
+                                   CFE_ES_AppRecordGetName(AppRecPtr),
+                                   AppRecPtr->StartParams.BasicInfo.FileName);
                 ReturnCode = CFE_ES_FILE_IO_ERR;
             }
         }
@@ -235,14 +235,14 @@ int32 CFE_ES_ReloadApp(CFE_ES_AppId_t AppID, const char *AppFileName)
     */
     if (AppRecPtr->Type == CFE_ES_AppType_CORE)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteApp: Cannot Reload a CORE Application: %s.\n",
-                                  CFE_ES_AppRecordGetName(AppRecPtr));
+        CFE_ES_SysLogWrite("CFE_ES_DeleteApp: Cannot Reload a CORE Application: %s.\n",
+                           CFE_ES_AppRecordGetName(AppRecPtr));
         ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
     else if (AppRecPtr->AppState != CFE_ES_AppState_RUNNING)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_ReloadApp: Cannot Reload Application %s, It is not running.\n",
-                                  CFE_ES_AppRecordGetName(AppRecPtr));
+        CFE_ES_SysLogWrite("CFE_ES_ReloadApp: Cannot Reload Application %s, It is not running.\n",
+                           CFE_ES_AppRecordGetName(AppRecPtr));
         ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
     else
@@ -252,8 +252,8 @@ int32 CFE_ES_ReloadApp(CFE_ES_AppId_t AppID, const char *AppFileName)
         */
         if (OS_stat(AppFileName, &FileStatus) == OS_SUCCESS)
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_ReloadApp: Reload Application %s Initiated. New filename = %s\n",
-                                      CFE_ES_AppRecordGetName(AppRecPtr), AppFileName);
+            CFE_ES_SysLogWrite("CFE_ES_ReloadApp: Reload Application %s Initiated. New filename = %s\n",
+                               CFE_ES_AppRecordGetName(AppRecPtr), AppFileName);
             strncpy(AppRecPtr->StartParams.BasicInfo.FileName, AppFileName,
                     sizeof(AppRecPtr->StartParams.BasicInfo.FileName) - 1);
             AppRecPtr->StartParams.BasicInfo.FileName[sizeof(AppRecPtr->StartParams.BasicInfo.FileName) - 1] = 0;
@@ -261,8 +261,8 @@ int32 CFE_ES_ReloadApp(CFE_ES_AppId_t AppID, const char *AppFileName)
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_ReloadApp: Cannot Reload Application %s, File %s does not exist.\n",
-                                      CFE_ES_AppRecordGetName(AppRecPtr), AppFileName);
+            CFE_ES_SysLogWrite("CFE_ES_ReloadApp: Cannot Reload Application %s, File %s does not exist.\n",
+                               CFE_ES_AppRecordGetName(AppRecPtr), AppFileName);
             ReturnCode = CFE_ES_FILE_IO_ERR;
         }
     }
@@ -293,20 +293,20 @@ int32 CFE_ES_DeleteApp(CFE_ES_AppId_t AppID)
     */
     if (AppRecPtr->Type == CFE_ES_AppType_CORE)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteApp: Cannot Delete a CORE Application: %s.\n",
-                                  CFE_ES_AppRecordGetName(AppRecPtr));
+        CFE_ES_SysLogWrite("CFE_ES_DeleteApp: Cannot Delete a CORE Application: %s.\n",
+                           CFE_ES_AppRecordGetName(AppRecPtr));
         ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
     else if (AppRecPtr->AppState != CFE_ES_AppState_RUNNING)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteApp: Cannot Delete Application %s, It is not running.\n",
-                                  CFE_ES_AppRecordGetName(AppRecPtr));
+        CFE_ES_SysLogWrite("CFE_ES_DeleteApp: Cannot Delete Application %s, It is not running.\n",
+                           CFE_ES_AppRecordGetName(AppRecPtr));
         ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
     else
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteApp: Delete Application %s Initiated\n",
-                                  CFE_ES_AppRecordGetName(AppRecPtr));
+        CFE_ES_SysLogWrite("CFE_ES_DeleteApp: Delete Application %s Initiated\n",
+                           CFE_ES_AppRecordGetName(AppRecPtr));
         AppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_DELETE;
     }
 
@@ -333,7 +333,7 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
 
     if (ExitStatus == CFE_ES_RunStatus_UNDEFINED || ExitStatus >= CFE_ES_RunStatus_MAX)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitApp: Called with invalid status (%u).\n", (unsigned int)ExitStatus);
+        CFE_ES_SysLogWrite("CFE_ES_ExitApp: Called with invalid status (%u).\n", (unsigned int)ExitStatus);
 
         /* revert to the ERROR status */
         ExitStatus = CFE_ES_RunStatus_APP_ERROR;
@@ -367,8 +367,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
             */
             if (ExitStatus == CFE_ES_RunStatus_CORE_APP_INIT_ERROR)
             {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitApp: CORE Application %s Had an Init Error.\n",
-                                          CFE_ES_AppRecordGetName(AppRecPtr));
+                CFE_ES_SysLogWrite("CFE_ES_ExitApp: CORE Application %s Had an Init Error.\n",
+                                   CFE_ES_AppRecordGetName(AppRecPtr));
 
                 /*
                 ** Unlock the ES Shared data before calling ResetCFE
@@ -392,8 +392,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
             }
             else if (ExitStatus == CFE_ES_RunStatus_CORE_APP_RUNTIME_ERROR)
             {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitApp: CORE Application %s Had a Runtime Error.\n",
-                                          CFE_ES_AppRecordGetName(AppRecPtr));
+                CFE_ES_SysLogWrite("CFE_ES_ExitApp: CORE Application %s Had a Runtime Error.\n",
+                                   CFE_ES_AppRecordGetName(AppRecPtr));
 
                 /*
                 ** Unlock the ES Shared data before killing the main task
@@ -412,14 +412,14 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
             }
             else
             {
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitApp, Cannot Exit CORE Application %s\n",
-                                          CFE_ES_AppRecordGetName(AppRecPtr));
+                CFE_ES_SysLogWrite("CFE_ES_ExitApp, Cannot Exit CORE Application %s\n",
+                                   CFE_ES_AppRecordGetName(AppRecPtr));
             }
         }
         else /* It is an external App */
         {
 
-            CFE_ES_SysLogWrite_Unsync("Application %s called CFE_ES_ExitApp\n", CFE_ES_AppRecordGetName(AppRecPtr));
+            CFE_ES_SysLogWrite("Application %s called CFE_ES_ExitApp\n", CFE_ES_AppRecordGetName(AppRecPtr));
 
             AppRecPtr->AppState = CFE_ES_AppState_STOPPED;
 
@@ -452,6 +452,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
 {
     bool                ReturnCode;
     CFE_ES_AppRecord_t *AppRecPtr;
+    OS_time_t           CurrentTime;
 
     /*
      * call CFE_ES_IncrementTaskCounter() so this is
@@ -494,6 +495,15 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
         {
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+
+            /* Record how long the app took to initialize, for startup tuning */
+            if (AppRecPtr->Type == CFE_ES_AppType_EXTERNAL)
+            {
+                OS_GetLocalTime(&CurrentTime);
+                CFE_ES_SysLogWrite(
+                    "ES Startup: %s initialized in %ld ms\n", AppRecPtr->AppName,
+                    (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrentTime, AppRecPtr->StartTime)));
+            }
         }
 
         /*
@@ -521,7 +531,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         /*
          * Cannot do anything without the AppID
          */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_RunLoop Error: Cannot get AppID for the caller\n");
+        CFE_ES_SysLogWrite("CFE_ES_RunLoop Error: Cannot get AppID for the caller\n");
         ReturnCode = false;
 
     } /* end if Status == CFE_SUCCESS */
@@ -811,7 +821,6 @@ int32 CFE_ES_GetTaskID(CFE_ES_TaskId_t *TaskIdPtr)
 */
 int32 CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t BufferLength)
 {
-    int32               Result;
     CFE_ES_AppRecord_t *AppRecPtr;
 
     if (BufferLength == 0 || AppName == NULL)
@@ -824,29 +833,46 @@ int32 CFE_ES_GetAppName(char *AppName, CFE_ES_AppId_t AppId, size_t BufferLength
     */
     AppRecPtr = CFE_ES_LocateAppRecordByID(AppId);
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-
     /*
-     * confirm that the app record is a match,
-     * which must be done while locked.
+     * Confirm that the app record is a match and copy the name.
+     * This does not take the ES lock, as it is called by EVS and SB
+     * on their message paths.
      */
-    if (CFE_ES_AppRecordIsMatch(AppRecPtr, AppId))
+    return CFE_ES_AppRecordCopyName(AppRecPtr, AppId, AppName, BufferLength);
+
+} /* End of CFE_ES_GetAppName() */
+
+/*
+** Function: CFE_ES_GetAppAndTaskName - See API and header file for details
+*/
+int32 CFE_ES_GetAppAndTaskName(char *AppName, char *TaskName, CFE_ES_TaskId_t TaskId, size_t BufferLength)
+{
+    int32                Result;
+    CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_AppId_t       AppId;
+
+    if (BufferLength == 0 || AppName == NULL || TaskName == NULL)
     {
-        strncpy(AppName, CFE_ES_AppRecordGetName(AppRecPtr), BufferLength - 1);
-        AppName[BufferLength - 1] = '\0';
-        Result                    = CFE_SUCCESS;
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /*
+    ** Get Task Record, then the record of its parent app
+    */
+    TaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+    Result     = CFE_ES_TaskRecordCopyName(TaskRecPtr, TaskId, TaskName, BufferLength, &AppId);
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_ES_AppRecordCopyName(CFE_ES_LocateAppRecordByID(AppId), AppId, AppName, BufferLength);
     }
     else
     {
         AppName[0] = 0;
-        Result     = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
-
     return (Result);
 
-} /* End of CFE_ES_GetAppName() */
+} /* End of CFE_ES_GetAppAndTaskName() */
 
 /*
 ** Function: CFE_ES_GetLibName - See API and header file for details
@@ -1042,7 +1068,7 @@ int32 CFE_ES_GetLibInfo(CFE_ES_AppInfo_t *LibInfo, CFE_ES_LibId_t LibId)
         /*
          * Log a message if called with an invalid ID.
          */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_GetLibInfo: Lib ID not active: %lu\n", CFE_RESOURCEID_TO_ULONG(LibId));
+        CFE_ES_SysLogWrite("CFE_ES_GetLibInfo: Lib ID not active: %lu\n", CFE_RESOURCEID_TO_ULONG(LibId));
 
         Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
@@ -1110,6 +1136,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
 {
     CFE_ES_TaskRecord_t *TaskRecPtr;
     CFE_ES_AppRecord_t * AppRecPtr;
+    OS_task_prop_t       TaskProp;
     int32                Status;
 
     if (TaskInfo == NULL)
@@ -1128,7 +1155,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
     {
         /* task ID is bad */
         Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_GetTaskInfo: Task ID Not Active: %lu\n", CFE_RESOURCEID_TO_ULONG(TaskId));
+        CFE_ES_SysLogWrite("CFE_ES_GetTaskInfo: Task ID Not Active: %lu\n", CFE_RESOURCEID_TO_ULONG(TaskId));
     }
     else
     {
@@ -1151,6 +1178,7 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
         TaskInfo->ExecutionCounter = TaskRecPtr->ExecutionCounter;
         TaskInfo->StackSize        = TaskRecPtr->StartParams.StackSize;
         TaskInfo->Priority         = TaskRecPtr->StartParams.Priority;
+        TaskInfo->CpuAffinityMask  = TaskRecPtr->StartParams.CpuAffinityMask;
 
         /*
         ** Get the Application Details
@@ -1171,6 +1199,17 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    /*
+    ** The CPU the task last ran on comes from the OS, which is
+    ** queried outside the lock.  Not all platforms can report it.
+    */
+    TaskInfo->LastCpu = CFE_ES_TASK_CPU_UNKNOWN;
+    if (Status == CFE_SUCCESS && OS_TaskGetInfo(CFE_ES_TaskId_ToOSAL(TaskId), &TaskProp) == OS_SUCCESS)
+    {
+        TaskInfo->LastCpu         = TaskProp.last_cpu;
+        TaskInfo->CpuAffinityMask = TaskProp.cpu_mask;
+    }
+
     return (Status);
 
 } /* End of CFE_ES_GetTaskInfo() */
@@ -1237,20 +1276,29 @@ int32 CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName,
         AppRecPtr = CFE_ES_GetAppRecordByContext();
         if (AppRecPtr == NULL)
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_CreateChildTask: Invalid calling context when creating Task '%s'\n",
-                                      TaskName);
+            CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Invalid calling context when creating Task '%s'\n",
+                               TaskName);
             ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
         }
         else if (!CFE_RESOURCEID_TEST_EQUAL(SelfTaskId, AppRecPtr->MainTaskId))
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_CreateChildTask: Error: Cannot call from a Child Task (for Task '%s').\n",
-                                      TaskName);
+            CFE_ES_SysLogWrite("CFE_ES_CreateChildTask: Error: Cannot call from a Child Task (for Task '%s').\n",
+                               TaskName);
             ReturnCode = CFE_ES_ERR_CHILD_TASK_CREATE;
         }
         else
         {
             ParentAppId = CFE_ES_AppRecordGetID(AppRecPtr);
             ReturnCode  = CFE_SUCCESS;
+
+            /*
+            ** Unless the caller selected CPUs, the child runs where the main task does
+            */
+            Params.CpuAffinityMask = CFE_ES_TASK_CPU_AFFINITY_GET(Flags);
+            if (Params.CpuAffinityMask == 0)
+            {
+                Params.CpuAffinityMask = AppRecPtr->StartParams.MainTaskInfo.CpuAffinityMask;
+            }
         } /* end If AppID is valid */
 
         CFE_ES_UnlockSharedData(__func__, __LINE__);
@@ -1363,13 +1411,13 @@ int32 CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
                     /*
                     ** Report the task delete
                     */
-                    CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Task %lu Deleted\n",
-                                              CFE_RESOURCEID_TO_ULONG(TaskId));
+                    CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Task %lu Deleted\n",
+                                       CFE_RESOURCEID_TO_ULONG(TaskId));
                     ReturnCode = CFE_SUCCESS;
                 }
                 else
                 {
-                    CFE_ES_SysLogWrite_Unsync(
+                    CFE_ES_SysLogWrite(
                         "CFE_ES_DeleteChildTask Error: Error Calling OS_TaskDelete: Task %lu, RC = 0x%08X\n",
                         CFE_RESOURCEID_TO_ULONG(TaskId), (unsigned int)OSReturnCode);
                     ReturnCode = CFE_ES_ERR_CHILD_TASK_DELETE;
@@ -1380,8 +1428,8 @@ int32 CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
                 /*
                 ** Error: The task is a cFE Application Main task
                 */
-                CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Error: Task %lu is a cFE Main Task.\n",
-                                          CFE_RESOURCEID_TO_ULONG(TaskId));
+                CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Error: Task %lu is a cFE Main Task.\n",
+                                   CFE_RESOURCEID_TO_ULONG(TaskId));
                 ReturnCode = CFE_ES_ERR_CHILD_TASK_DELETE_MAIN_TASK;
             } /* end if TaskMain == false */
         }
@@ -1390,8 +1438,8 @@ int32 CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
             /*
             ** Task ID is not in use, so it is invalid
             */
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_DeleteChildTask Error: Task ID is not active: %lu\n",
-                                      CFE_RESOURCEID_TO_ULONG(TaskId));
+            CFE_ES_SysLogWrite("CFE_ES_DeleteChildTask Error: Task ID is not active: %lu\n",
+                               CFE_RESOURCEID_TO_ULONG(TaskId));
             ReturnCode = CFE_ES_ERR_RESOURCEID_NOT_VALID;
 
         } /* end if */
@@ -1454,13 +1502,13 @@ void CFE_ES_ExitChildTask(void)
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitChildTask Error: Cannot Call from a cFE App Main Task. ID = %lu\n",
-                                      CFE_RESOURCEID_TO_ULONG(CFE_ES_TaskRecordGetID(TaskRecPtr)));
+            CFE_ES_SysLogWrite("CFE_ES_ExitChildTask Error: Cannot Call from a cFE App Main Task. ID = %lu\n",
+                               CFE_RESOURCEID_TO_ULONG(CFE_ES_TaskRecordGetID(TaskRecPtr)));
         }
     }
     else
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_ExitChildTask called from invalid task context\n");
+        CFE_ES_SysLogWrite("CFE_ES_ExitChildTask called from invalid task context\n");
     } /* end if GetAppId */
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
@@ -1486,12 +1534,10 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
     va_end(ArgPtr);
 
     /*
-     * Append to the syslog buffer, which must be done while locked.
-     * Only one thread can actively write into the buffer at time.
+     * Append to the syslog buffer.  This reserves space atomically and
+     * does not take the ES shared data lock.
      */
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    ReturnCode = CFE_ES_SysLogAppend_Unsync(TmpString);
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    ReturnCode = CFE_ES_SysLogAppend(TmpString);
 
     /* Output the entry to the console */
     OS_printf("%s", TmpString);
@@ -1753,6 +1799,22 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return CFE_ES_CDSBlockWrite(Handle, DataToCopy);
 } /* End of CFE_ES_CopyToCDS() */
 
+/*
+** Function: CFE_ES_CopyToCDSRange
+**
+** Purpose:  Copies part of a data block to a Critical Data Store.
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, const void *DataToCopy, size_t Offset, size_t Size)
+{
+    if (DataToCopy == NULL || Size == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    return CFE_ES_CDSBlockWriteRange(Handle, DataToCopy, Offset, Size);
+} /* End of CFE_ES_CopyToCDSRange() */
+
 /*
 ** Function: CFE_ES_RestoreFromCDS
 **
@@ -1798,7 +1860,7 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
     CountRecPtr = CFE_ES_LocateCounterRecordByName(CounterName);
     if (CountRecPtr != NULL)
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: Duplicate Counter name '%s'\n", CounterName);
+        CFE_ES_SysLogWrite("ES Startup: Duplicate Counter name '%s'\n", CounterName);
         Status            = CFE_ES_ERR_DUPLICATE_NAME;
         PendingResourceId = CFE_RESOURCEID_UNDEFINED;
     }
@@ -1811,7 +1873,7 @@ int32 CFE_ES_RegisterGenCounter(CFE_ES_CounterId_t *CounterIdPtr, const char *Co
 
         if (CountRecPtr == NULL)
         {
-            CFE_ES_SysLogWrite_Unsync("ES Startup: No free Counter slots available\n");
+            CFE_ES_SysLogWrite("ES Startup: No free Counter slots available\n");
             Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
         }
         else
@@ -2080,8 +2142,8 @@ void CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("ES SharedData Mutex Take Err Stat=0x%x,Func=%s,Line=%d\n", (unsigned int)Status,
-                                  FunctionName, (int)LineNumber);
+        CFE_ES_SysLogWrite("ES SharedData Mutex Take Err Stat=0x%x,Func=%s,Line=%d\n", (unsigned int)Status,
+                           FunctionName, (int)LineNumber);
 
     } /* end if */
 
@@ -2114,8 +2176,8 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
          * NOTE: this is going to write into a buffer that itself
          * is _supposed_ to be protected by this same mutex.
          */
-        CFE_ES_SysLogWrite_Unsync("ES SharedData Mutex Give Err Stat=0x%x,Func=%s,Line=%d\n", (unsigned int)Status,
-                                  FunctionName, (int)LineNumber);
+        CFE_ES_SysLogWrite("ES SharedData Mutex Give Err Stat=0x%x,Func=%s,Line=%d\n", (unsigned int)Status,
+                           FunctionName, (int)LineNumber);
 
     } /* end if */
 
@@ -50,7 +50,10 @@
 /*
 ** Defines
 */
-#define ES_START_BUFF_SIZE 128
+#define ES_START_BUFF_SIZE CFE_ES_STARTSCRIPT_BUFFER_SIZE
+
+#define CFE_ES_STARTUP_WORK_SEM_NAME "ES_StartupWork"
+#define CFE_ES_STARTUP_DONE_SEM_NAME "ES_StartupDone"
 
 /*
 **
@@ -85,6 +88,8 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     bool        LineTooLong = false;
     bool        FileOpened  = false;
 
+    CFE_FS_TextReader_t AppFileReader; /* Reads the script in blocks rather than a char at a time */
+
     /*
     ** Get the ES startup script filename.
     ** If this is a Processor Reset, try to open the file in the volatile disk first.
@@ -148,18 +153,21 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     */
     if (FileOpened == true)
     {
+        memset(&CFE_ES_Global.StartupScript, 0, sizeof(CFE_ES_Global.StartupScript));
         memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
         BuffLen      = 0;
         NumTokens    = 0;
         TokenList[0] = ES_AppLoadBuffer;
 
+        CFE_FS_TextReaderInit(&AppFileReader, AppFile);
+
         /*
         ** Parse the lines from the file. If it has an error
         ** or reaches EOF, then abort the loop.
         */
         while (1)
         {
-            Status = OS_read(AppFile, &c, 1);
+            Status = CFE_FS_TextReadChar(&AppFileReader, &c);
             if (Status < 0)
             {
                 CFE_ES_WriteToSysLog("ES Startup: Error Reading Startup file. EC = 0x%08X\n", (unsigned int)Status);
@@ -235,11 +243,11 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                     else
                     {
                         /*
-                        ** Send the line to the file parser
+                        ** Add the line to the startup schedule
                         ** Ensure termination of the last token and send it along
                         */
                         ES_AppLoadBuffer[BuffLen] = 0;
-                        CFE_ES_ParseFileEntry(TokenList, 1 + NumTokens);
+                        CFE_ES_StartupScriptAddEntry(TokenList, 1 + NumTokens);
                     }
                     BuffLen   = 0;
                     NumTokens = 0;
@@ -257,6 +265,11 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         ** close the file
         */
         OS_close(AppFile);
+
+        /*
+        ** Now load/start everything in the script, in dependency order
+        */
+        CFE_ES_StartupScriptRun(CFE_PLATFORM_ES_STARTUP_WORKERS);
     }
 }
 
@@ -331,6 +344,14 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
         /* No specific upper/lower limit for stack size - will pass value through */
         ParamBuf.MainTaskInfo.StackSize = strtoul(TokenList[5], NULL, 0);
 
+        /* The optional CPU affinity mask is limited to the CPUs a task can be created with */
+        if (NumTokens > CFE_ES_STARTSCRIPT_AFFINITY_TOKEN)
+        {
+            ParsedValue = strtoul(TokenList[CFE_ES_STARTSCRIPT_AFFINITY_TOKEN], NULL, 0);
+            ParamBuf.MainTaskInfo.CpuAffinityMask =
+                CFE_ES_TASK_CPU_AFFINITY_GET(CFE_ES_TASK_CPU_AFFINITY(ParsedValue));
+        }
+
         /*
         ** Validate Some parameters
         ** Exception action should be 0 ( Restart App ) or
@@ -371,6 +392,495 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     return (Status);
 }
 
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupEntryName
+**
+**   Purpose: Helper to get the module name of a scheduled startup script entry.
+**---------------------------------------------------------------------------------------
+*/
+static const char *CFE_ES_StartupEntryName(const CFE_ES_StartupEntry_t *EntryPtr)
+{
+    if (EntryPtr->NumTokens <= 3)
+    {
+        return "";
+    }
+
+    return &EntryPtr->LineBuffer[EntryPtr->TokenOffset[3]];
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupScriptAddEntry
+**
+**   Purpose: This function adds a startup file line to the startup schedule, and
+**            resolves its optional phase and dependency annotations.
+**
+**   Dependencies may only name entries that appear earlier in the script, so the
+**   resulting ordering can never be circular.  The effective phase of an entry is
+**   raised to that of its dependencies so a dependency is never held back by the
+**   entry waiting on it.
+**---------------------------------------------------------------------------------------
+*/
+int32 CFE_ES_StartupScriptAddEntry(const char **TokenList, uint32 NumTokens)
+{
+    CFE_ES_StartupScriptState_t *State = &CFE_ES_Global.StartupScript;
+    CFE_ES_StartupEntry_t *      EntryPtr;
+    CFE_ES_StartupEntry_t *      DepPtr;
+    const char *                 DepName;
+    const char *                 DepEnd;
+    size_t                       DepLen;
+    size_t                       TokenLen;
+    size_t                       Offset;
+    uint32                       i;
+    uint32                       j;
+
+    if (NumTokens == 0 || NumTokens > CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE)
+    {
+        CFE_ES_WriteToSysLog("ES Startup: Invalid ES Startup file entry: %u\n", (unsigned int)NumTokens);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    if (State->NumEntries >= CFE_ES_STARTSCRIPT_MAX_ENTRIES)
+    {
+        CFE_ES_WriteToSysLog("ES Startup: Too many ES Startup file entries, ignoring: %s\n",
+                             TokenList[NumTokens > 3 ? 3 : 0]);
+        return CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
+    }
+
+    EntryPtr = &State->Entries[State->NumEntries];
+    memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+    /*
+     * Keep a private copy of the tokens, as the line buffer is reused for the next line
+     */
+    Offset = 0;
+    for (i = 0; i < NumTokens; ++i)
+    {
+        TokenLen = strlen(TokenList[i]) + 1;
+        if ((Offset + TokenLen) > sizeof(EntryPtr->LineBuffer))
+        {
+            CFE_ES_WriteToSysLog("ES Startup: ES Startup File Line is too long: %u bytes.\n",
+                                 (unsigned int)(Offset + TokenLen));
+            return CFE_ES_BAD_ARGUMENT;
+        }
+        memcpy(&EntryPtr->LineBuffer[Offset], TokenList[i], TokenLen);
+        EntryPtr->TokenOffset[i] = (uint8)Offset;
+        Offset += TokenLen;
+    }
+
+    EntryPtr->NumTokens       = NumTokens;
+    EntryPtr->IsLibrary       = (strcmp(TokenList[0], "CFE_LIB") == 0);
+    EntryPtr->ImplicitLibDeps = true;
+    EntryPtr->State           = CFE_ES_STARTSCRIPT_ENTRY_PENDING;
+
+    if (NumTokens > CFE_ES_STARTSCRIPT_PHASE_TOKEN)
+    {
+        EntryPtr->Phase = strtoul(TokenList[CFE_ES_STARTSCRIPT_PHASE_TOKEN], NULL, 0);
+    }
+
+    /*
+     * Resolve the explicit dependency list, if present.  Without one, the entry
+     * depends on every library listed before it, which is the historical behavior.
+     */
+    if (NumTokens > CFE_ES_STARTSCRIPT_DEPENDS_TOKEN && TokenList[CFE_ES_STARTSCRIPT_DEPENDS_TOKEN][0] != 0)
+    {
+        EntryPtr->ImplicitLibDeps = false;
+        DepName                   = TokenList[CFE_ES_STARTSCRIPT_DEPENDS_TOKEN];
+        while (*DepName != 0)
+        {
+            DepEnd = strchr(DepName, CFE_ES_STARTSCRIPT_DEPENDS_SEPARATOR);
+            if (DepEnd == NULL)
+            {
+                DepEnd = DepName + strlen(DepName);
+            }
+            DepLen = DepEnd - DepName;
+
+            if (DepLen > 0)
+            {
+                DepPtr = NULL;
+                for (j = 0; j < State->NumEntries; ++j)
+                {
+                    if (strncmp(CFE_ES_StartupEntryName(&State->Entries[j]), DepName, DepLen) == 0 &&
+                        CFE_ES_StartupEntryName(&State->Entries[j])[DepLen] == 0)
+                    {
+                        DepPtr = &State->Entries[j];
+                        break;
+                    }
+                }
+
+                if (DepPtr == NULL)
+                {
+                    CFE_ES_WriteToSysLog("ES Startup: %s dependency %.*s is not an earlier entry, ignored\n",
+                                         CFE_ES_StartupEntryName(EntryPtr), (int)DepLen, DepName);
+                }
+                else if (EntryPtr->NumDeps >= CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES)
+                {
+                    CFE_ES_WriteToSysLog("ES Startup: %s has too many dependencies, %.*s ignored\n",
+                                         CFE_ES_StartupEntryName(EntryPtr), (int)DepLen, DepName);
+                }
+                else
+                {
+                    EntryPtr->Deps[EntryPtr->NumDeps] = (uint16)j;
+                    ++EntryPtr->NumDeps;
+                    if (DepPtr->Phase > EntryPtr->Phase)
+                    {
+                        EntryPtr->Phase = DepPtr->Phase;
+                    }
+                }
+            }
+
+            DepName = DepEnd;
+            if (*DepName != 0)
+            {
+                ++DepName;
+            }
+        }
+    }
+    else
+    {
+        for (j = 0; j < State->NumEntries; ++j)
+        {
+            if (State->Entries[j].IsLibrary && State->Entries[j].Phase > EntryPtr->Phase)
+            {
+                EntryPtr->Phase = State->Entries[j].Phase;
+            }
+        }
+    }
+
+    ++State->NumEntries;
+
+    return CFE_SUCCESS;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupQueueReady
+**
+**   Purpose: Moves every pending startup entry whose phase and dependencies are
+**            satisfied to the queued state.  Must be called with the ES lock held.
+**            Returns the number of entries newly queued.
+**---------------------------------------------------------------------------------------
+*/
+static uint32 CFE_ES_StartupQueueReady(CFE_ES_StartupScriptState_t *State)
+{
+    CFE_ES_StartupEntry_t *EntryPtr;
+    CFE_ES_StartupEntry_t *OtherPtr;
+    uint32                 NumQueued;
+    uint32                 i;
+    uint32                 j;
+    bool                   IsReady;
+
+    NumQueued = 0;
+    for (i = 0; i < State->NumEntries; ++i)
+    {
+        EntryPtr = &State->Entries[i];
+        if (EntryPtr->State != CFE_ES_STARTSCRIPT_ENTRY_PENDING)
+        {
+            continue;
+        }
+
+        IsReady = true;
+        for (j = 0; IsReady && j < State->NumEntries; ++j)
+        {
+            OtherPtr = &State->Entries[j];
+            if (OtherPtr->State != CFE_ES_STARTSCRIPT_ENTRY_DONE &&
+                (OtherPtr->Phase < EntryPtr->Phase || (j < i && EntryPtr->ImplicitLibDeps && OtherPtr->IsLibrary)))
+            {
+                IsReady = false;
+            }
+        }
+
+        for (j = 0; IsReady && j < EntryPtr->NumDeps; ++j)
+        {
+            if (State->Entries[EntryPtr->Deps[j]].State != CFE_ES_STARTSCRIPT_ENTRY_DONE)
+            {
+                IsReady = false;
+            }
+        }
+
+        if (IsReady)
+        {
+            EntryPtr->State = CFE_ES_STARTSCRIPT_ENTRY_QUEUED;
+            ++NumQueued;
+        }
+    }
+
+    return NumQueued;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupRunNext
+**
+**   Purpose: Claims the first queued startup entry, if any, and executes it.
+**            Returns false if there was nothing queued.
+**---------------------------------------------------------------------------------------
+*/
+static bool CFE_ES_StartupRunNext(void)
+{
+    CFE_ES_StartupScriptState_t *State = &CFE_ES_Global.StartupScript;
+    CFE_ES_StartupEntry_t *      EntryPtr;
+    const char *                 TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    OS_time_t                    StartTime;
+    OS_time_t                    EndTime;
+    int32                        Status;
+    uint32                       i;
+
+    EntryPtr = NULL;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    for (i = 0; i < State->NumEntries; ++i)
+    {
+        if (State->Entries[i].State == CFE_ES_STARTSCRIPT_ENTRY_QUEUED)
+        {
+            EntryPtr        = &State->Entries[i];
+            EntryPtr->State = CFE_ES_STARTSCRIPT_ENTRY_RUNNING;
+            ++State->NumRunning;
+            break;
+        }
+    }
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (EntryPtr == NULL)
+    {
+        return false;
+    }
+
+    for (i = 0; i < EntryPtr->NumTokens; ++i)
+    {
+        TokenList[i] = &EntryPtr->LineBuffer[EntryPtr->TokenOffset[i]];
+    }
+
+    OS_GetLocalTime(&StartTime);
+    Status = CFE_ES_ParseFileEntry(TokenList, EntryPtr->NumTokens);
+    OS_GetLocalTime(&EndTime);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("ES Startup: %s loaded in %ld ms\n", CFE_ES_StartupEntryName(EntryPtr),
+                             (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime)));
+    }
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    EntryPtr->State = CFE_ES_STARTSCRIPT_ENTRY_DONE;
+    --State->NumRunning;
+    ++State->NumDone;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (OS_ObjectIdDefined(State->DoneSem))
+    {
+        OS_CountSemGive(State->DoneSem);
+    }
+
+    return true;
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupScriptRun
+**
+**   Purpose: This function executes all scheduled startup script entries.
+**
+**   The calling task always takes part in loading.  When NumWorkers is nonzero,
+**   that many additional loader tasks are started so that independent entries
+**   are loaded concurrently.  Entries are always claimed in script order, so
+**   with no loader tasks this is identical to the historical sequential startup.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_StartupScriptRun(uint32 NumWorkers)
+{
+    CFE_ES_StartupScriptState_t *State = &CFE_ES_Global.StartupScript;
+    char                         WorkerName[OS_MAX_API_NAME];
+    osal_id_t                    WorkerId;
+    OS_time_t                    StartTime;
+    OS_time_t                    EndTime;
+    int32                        Status;
+    uint32                       NumQueued;
+    uint32                       NumWaiting;
+    uint32                       i;
+    bool                         IsFinished;
+    bool                         IsStalled;
+
+    OS_GetLocalTime(&StartTime);
+
+    State->NumDone      = 0;
+    State->NumRunning   = 0;
+    State->NumWorkers   = 0;
+    State->ShutdownFlag = false;
+    State->WorkSem      = OS_OBJECT_ID_UNDEFINED;
+    State->DoneSem      = OS_OBJECT_ID_UNDEFINED;
+
+    /* No point in having more loaders than entries */
+    if (State->NumEntries == 0)
+    {
+        NumWorkers = 0;
+    }
+    else if (NumWorkers >= State->NumEntries)
+    {
+        NumWorkers = State->NumEntries - 1;
+    }
+
+    if (NumWorkers > 0)
+    {
+        Status = OS_CountSemCreate(&State->WorkSem, CFE_ES_STARTUP_WORK_SEM_NAME, 0, 0);
+        if (Status == OS_SUCCESS)
+        {
+            Status = OS_CountSemCreate(&State->DoneSem, CFE_ES_STARTUP_DONE_SEM_NAME, 0, 0);
+            if (Status != OS_SUCCESS)
+            {
+                OS_CountSemDelete(State->WorkSem);
+            }
+        }
+        if (Status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("ES Startup: Cannot create loader semaphores, loading sequentially. EC = 0x%08X\n",
+                                 (unsigned int)Status);
+            State->WorkSem = OS_OBJECT_ID_UNDEFINED;
+            State->DoneSem = OS_OBJECT_ID_UNDEFINED;
+            NumWorkers     = 0;
+        }
+    }
+
+    for (i = 0; i < NumWorkers; ++i)
+    {
+        snprintf(WorkerName, sizeof(WorkerName), "ES_Loader%u", (unsigned int)(i + 1));
+        Status = OS_TaskCreate(&WorkerId, WorkerName, CFE_ES_StartupWorkerMain, OSAL_TASK_STACK_ALLOCATE,
+                               CFE_PLATFORM_ES_START_TASK_STACK_SIZE, CFE_PLATFORM_ES_START_TASK_PRIORITY,
+                               OS_FP_ENABLED);
+        if (Status != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("ES Startup: Cannot create loader task %s. EC = 0x%08X\n", WorkerName,
+                                 (unsigned int)Status);
+            break;
+        }
+        ++State->NumWorkers;
+    }
+    NumWorkers = State->NumWorkers;
+
+    /*
+     * Queue everything that is ready and help load it.  If everything queued
+     * is already being loaded by a loader task, wait for one of them to finish.
+     */
+    while (true)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        NumQueued  = CFE_ES_StartupQueueReady(State);
+        NumWaiting = 0;
+        for (i = 0; i < State->NumEntries; ++i)
+        {
+            if (State->Entries[i].State == CFE_ES_STARTSCRIPT_ENTRY_QUEUED)
+            {
+                ++NumWaiting;
+            }
+        }
+        IsFinished = (State->NumDone >= State->NumEntries);
+        IsStalled  = (!IsFinished && State->NumRunning == 0 && NumWaiting == 0);
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (IsFinished || IsStalled)
+        {
+            break;
+        }
+
+        for (i = 0; i < NumQueued && i < NumWorkers; ++i)
+        {
+            OS_CountSemGive(State->WorkSem);
+        }
+
+        if (!CFE_ES_StartupRunNext())
+        {
+            if (NumWorkers == 0)
+            {
+                break;
+            }
+            OS_CountSemTake(State->DoneSem);
+        }
+    }
+
+    if (State->NumDone < State->NumEntries)
+    {
+        CFE_ES_WriteToSysLog("ES Startup: %u ES Startup file entries could not be scheduled\n",
+                             (unsigned int)(State->NumEntries - State->NumDone));
+    }
+
+    /*
+     * Release the loader tasks.  The last one to exit deletes the semaphores.
+     */
+    if (NumWorkers > 0)
+    {
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        State->ShutdownFlag = true;
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        for (i = 0; i < NumWorkers; ++i)
+        {
+            OS_CountSemGive(State->WorkSem);
+        }
+    }
+    else
+    {
+        if (OS_ObjectIdDefined(State->WorkSem))
+        {
+            OS_CountSemDelete(State->WorkSem);
+        }
+        if (OS_ObjectIdDefined(State->DoneSem))
+        {
+            OS_CountSemDelete(State->DoneSem);
+        }
+    }
+
+    OS_GetLocalTime(&EndTime);
+    CFE_ES_WriteToSysLog("ES Startup: Loaded %u ES Startup file entries in %ld ms with %u loader task(s)\n",
+                         (unsigned int)State->NumDone,
+                         (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime)),
+                         (unsigned int)(NumWorkers + 1));
+}
+
+/*
+**---------------------------------------------------------------------------------------
+** Name: CFE_ES_StartupWorkerMain
+**
+**   Purpose: Entry point of the startup loader tasks.  Loads queued startup
+**            entries until told to shut down.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_StartupWorkerMain(void)
+{
+    CFE_ES_StartupScriptState_t *State = &CFE_ES_Global.StartupScript;
+    uint32                       NumRemaining;
+    bool                         IsShutdown;
+
+    IsShutdown = false;
+    while (!IsShutdown)
+    {
+        if (OS_CountSemTake(State->WorkSem) != OS_SUCCESS)
+        {
+            break;
+        }
+
+        if (!CFE_ES_StartupRunNext())
+        {
+            CFE_ES_LockSharedData(__func__, __LINE__);
+            IsShutdown = State->ShutdownFlag;
+            CFE_ES_UnlockSharedData(__func__, __LINE__);
+        }
+    }
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+    --State->NumWorkers;
+    NumRemaining = State->NumWorkers;
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    if (NumRemaining == 0)
+    {
+        OS_CountSemDelete(State->WorkSem);
+        OS_CountSemDelete(State->DoneSem);
+    }
+
+    OS_TaskExit();
+}
+
 /*
 **-------------------------------------------------------------------------------------
 ** Name: CFE_ES_LoadModule
@@ -589,9 +1099,12 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
     CFE_ES_TaskRecord_t *TaskRecPtr;
     osal_id_t            OsalTaskId;
     CFE_ES_TaskId_t      LocalTaskId;
+    uint32               TaskFlags;
     int32                StatusCode;
     int32                ReturnCode;
 
+    TaskFlags = OS_FP_ENABLED | OS_TASK_CPU_AFFINITY(Params->CpuAffinityMask);
+
     /*
      * Create the primary task for the newly loaded task
      */
@@ -601,7 +1114,7 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
                                OSAL_TASK_STACK_ALLOCATE, /* stack pointer (allocate) */
                                Params->StackSize,        /* stack size */
                                Params->Priority,         /* task priority */
-                               OS_FP_ENABLED);           /* task options */
+                               TaskFlags);               /* task options */
 
     CFE_ES_LockSharedData(__func__, __LINE__);
 
@@ -616,8 +1129,11 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
         TaskRecPtr  = CFE_ES_LocateTaskRecordByID(LocalTaskId);
         if (CFE_ES_TaskRecordIsUsed(TaskRecPtr))
         {
-            CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES_TaskTable slot for ID %lx in use at task creation!\n",
-                                      OS_ObjectIdToInteger(OsalTaskId));
+            CFE_ES_SysLogWrite("ES Startup: Error: ES_TaskTable slot for ID %lx in use at task creation!\n",
+                               OS_ObjectIdToInteger(OsalTaskId));
+
+            /* Invalidate the stale entry for any lock-free name readers before it is overwritten */
+            CFE_ES_TaskRecordSetFree(TaskRecPtr);
         }
 
         /*
@@ -644,8 +1160,8 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
     }
     else
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: AppCreate Error: TaskCreate %s Failed. EC = 0x%08X!\n", TaskName,
-                                  (unsigned int)StatusCode);
+        CFE_ES_SysLogWrite("ES Startup: AppCreate Error: TaskCreate %s Failed. EC = 0x%08X!\n", TaskName,
+                           (unsigned int)StatusCode);
         ReturnCode = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
         *TaskIdPtr = CFE_ES_TASKID_UNDEFINED;
     }
@@ -712,7 +1228,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     AppRecPtr = CFE_ES_LocateAppRecordByName(AppName);
     if (AppRecPtr != NULL)
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: Duplicate app name '%s'\n", AppName);
+        CFE_ES_SysLogWrite("ES Startup: Duplicate app name '%s'\n", AppName);
         Status = CFE_ES_ERR_DUPLICATE_NAME;
     }
     else
@@ -724,7 +1240,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
 
         if (AppRecPtr == NULL)
         {
-            CFE_ES_SysLogWrite_Unsync("ES Startup: No free application slots available\n");
+            CFE_ES_SysLogWrite("ES Startup: No free application slots available\n");
             Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
         }
         else
@@ -779,6 +1295,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
      */
     if (Status == CFE_SUCCESS)
     {
+        OS_GetLocalTime(&AppRecPtr->StartTime);
         Status =
             CFE_ES_StartAppTask(&AppRecPtr->MainTaskId, /* Task ID (output) stored in App Record as main task */
                                 AppName,                /* Main Task name matches app name */
@@ -881,7 +1398,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
     LibSlotPtr = CFE_ES_LocateLibRecordByName(LibName);
     if (LibSlotPtr != NULL || CFE_ES_LocateAppRecordByName(LibName) != NULL)
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: Duplicate Lib name '%s'\n", LibName);
+        CFE_ES_SysLogWrite("ES Startup: Duplicate Lib name '%s'\n", LibName);
         if (LibSlotPtr != NULL)
         {
             PendingResourceId = CFE_RESOURCEID_UNWRAP(CFE_ES_LibRecordGetID(LibSlotPtr));
@@ -897,7 +1414,7 @@ int32 CFE_ES_LoadLibrary(CFE_ES_LibId_t *LibraryIdPtr, const char *LibName, cons
 
         if (LibSlotPtr == NULL)
         {
-            CFE_ES_SysLogWrite_Unsync("ES Startup: No free library slots available\n");
+            CFE_ES_SysLogWrite("ES Startup: No free library slots available\n");
             Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
         }
         else
@@ -1433,8 +1950,8 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
     }
     else
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_CleanUpApp: AppID %lu is not valid for deletion\n",
-                                  CFE_RESOURCEID_TO_ULONG(AppId));
+        CFE_ES_SysLogWrite("CFE_ES_CleanUpApp: AppID %lu is not valid for deletion\n",
+                           CFE_RESOURCEID_TO_ULONG(AppId));
         ReturnCode = CFE_ES_APP_CLEANUP_ERR;
     }
 
@@ -1638,8 +2155,8 @@ void CFE_ES_CleanupObjectCallback(osal_id_t ObjectId, void *arg)
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("Call to OSAL Delete Object (ID:%lu) failed. RC=0x%08X\n",
-                                      OS_ObjectIdToInteger(ObjectId), (unsigned int)Status);
+            CFE_ES_SysLogWrite("Call to OSAL Delete Object (ID:%lu) failed. RC=0x%08X\n",
+                               OS_ObjectIdToInteger(ObjectId), (unsigned int)Status);
             if (CleanState->OverallStatus == CFE_SUCCESS)
             {
                 /*
@@ -45,7 +45,30 @@
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 11
+#define CFE_ES_STARTSCRIPT_BUFFER_SIZE         128
+
+/*
+** Startup script annotation fields (optional, after the 8 standard fields)
+*/
+#define CFE_ES_STARTSCRIPT_PHASE_TOKEN       8   /* Startup phase number, default 0 */
+#define CFE_ES_STARTSCRIPT_DEPENDS_TOKEN     9   /* '|'-separated names of earlier entries */
+#define CFE_ES_STARTSCRIPT_AFFINITY_TOKEN    10  /* CPU affinity mask of the main task, default 0 */
+#define CFE_ES_STARTSCRIPT_DEPENDS_SEPARATOR '|'
+#define CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES  8
+
+/*
+** Maximum number of startup script entries that can be scheduled
+*/
+#define CFE_ES_STARTSCRIPT_MAX_ENTRIES (CFE_PLATFORM_ES_MAX_APPLICATIONS + CFE_PLATFORM_ES_MAX_LIBRARIES)
+
+/*
+** Startup script entry states, as they are scheduled
+*/
+#define CFE_ES_STARTSCRIPT_ENTRY_PENDING 0 /* waiting for its phase and dependencies */
+#define CFE_ES_STARTSCRIPT_ENTRY_QUEUED  1 /* ready, waiting for a loader */
+#define CFE_ES_STARTSCRIPT_ENTRY_RUNNING 2 /* being loaded/started */
+#define CFE_ES_STARTSCRIPT_ENTRY_DONE    3 /* load complete (successfully or not) */
 
 /*
 ** Type Definitions
@@ -105,6 +128,7 @@ typedef struct
 {
     size_t                     StackSize;
     CFE_ES_TaskPriority_Atom_t Priority;
+    uint32                     CpuAffinityMask; /* CPUs the task may run on, 0 for any */
 
 } CFE_ES_TaskStartParams_t;
 
@@ -141,6 +165,7 @@ typedef struct
     CFE_ES_ModuleLoadStatus_t LoadStatus;               /* Runtime module information */
     CFE_ES_ControlReq_t       ControlReq;               /* The Control Request Record for External cFE Apps */
     CFE_ES_TaskId_t           MainTaskId;               /* The Application's Main Task ID */
+    OS_time_t                 StartTime;                /* Time the main task was started, for init timing */
 
 } CFE_ES_AppRecord_t;
 
@@ -183,6 +208,44 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** CFE_ES_StartupEntry_t holds one parsed line of the startup script
+** until it is scheduled.  The tokens point into the local copy of the line.
+*/
+typedef struct
+{
+    char   LineBuffer[CFE_ES_STARTSCRIPT_BUFFER_SIZE];
+    uint8  TokenOffset[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
+    uint32 NumTokens;
+    uint32 Phase;           /* Effective phase, never lower than that of any dependency */
+    bool   IsLibrary;       /* Whether this entry is a CFE_LIB entry */
+    bool   ImplicitLibDeps; /* No explicit dependencies - depends on all preceding libraries */
+    uint8  State;           /* One of the CFE_ES_STARTSCRIPT_ENTRY_xxx values */
+    uint8  NumDeps;
+    uint16 Deps[CFE_ES_STARTSCRIPT_MAX_DEPENDENCIES]; /* Indices of entries that must be done first */
+
+} CFE_ES_StartupEntry_t;
+
+/*
+** CFE_ES_StartupScriptState_t is an internal structure used to schedule
+** the startup script entries across the startup loader tasks.
+**
+** The entry table and counters are protected by the ES shared data lock.
+*/
+typedef struct
+{
+    uint32    NumEntries;
+    uint32    NumDone;
+    uint32    NumRunning;
+    uint32    NumWorkers;    /* Number of loader tasks that have not yet exited */
+    bool      ShutdownFlag;  /* Set when all entries are done, tells loader tasks to exit */
+    osal_id_t WorkSem;       /* Given whenever an entry is queued */
+    osal_id_t DoneSem;       /* Given whenever an entry completes or a loader task exits */
+
+    CFE_ES_StartupEntry_t Entries[CFE_ES_STARTSCRIPT_MAX_ENTRIES];
+
+} CFE_ES_StartupScriptState_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -198,6 +261,24 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath);
 */
 int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
 
+/*
+** Internal function to add a line of the startup script to the startup schedule
+** The phase and dependency annotations are resolved here, the entry is executed later.
+*/
+int32 CFE_ES_StartupScriptAddEntry(const char **TokenList, uint32 NumTokens);
+
+/*
+** Internal function to execute all scheduled startup script entries, honoring
+** phases and dependencies, using the given number of additional loader tasks.
+** If NumWorkers is 0 all entries are executed sequentially in script order.
+*/
+void CFE_ES_StartupScriptRun(uint32 NumWorkers);
+
+/*
+** Entry point of the startup loader tasks
+*/
+void CFE_ES_StartupWorkerMain(void);
+
 /*
 ** Internal function to load a module (app or library)
 ** This only loads the code and looks up relevent runtime information.
@@ -64,7 +64,7 @@ int32 CFE_ES_CDS_EarlyInit(void)
     Status = OS_MutSemCreate(&CDS->GenMutex, CFE_ES_CDS_MUT_REG_NAME, CFE_ES_CDS_MUT_REG_VALUE);
     if (Status != OS_SUCCESS)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES_CDS_EarlyInit: Failed to create mutex with error %d\n", (int)Status);
+        CFE_ES_SysLogWrite("CFE_ES_CDS_EarlyInit: Failed to create mutex with error %d\n", (int)Status);
         return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
     }
 
@@ -40,6 +40,21 @@
 
 #include "cfe_es_module_all.h"
 
+/*****************************************************************************/
+/*
+** Macro Definitions
+*/
+
+/*
+ * Reflected CRC-16 polynomial matching the table in CFE_ES_CalculateCRC()
+ */
+#define CFE_ES_CDS_CRC16_POLY 0xA001
+
+/*
+ * Stack buffer used when reading back the old content of a range update
+ */
+#define CFE_ES_CDS_RANGE_CHUNK_SIZE 256
+
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -63,6 +78,147 @@ const size_t CFE_ES_CDSMemPoolDefSize[CFE_ES_CDS_NUM_BLOCK_SIZES] = {
 ** Functions
 */
 
+/*
+** CFE_ES_CDS_Gf2MatrixTimes multiplies a 16x16 GF(2) matrix by a vector.
+**
+** Each matrix entry is the column for one input bit of the CRC register.
+*/
+static uint16 CFE_ES_CDS_Gf2MatrixTimes(const uint16 *Mat, uint16 Vec)
+{
+    uint16 Sum = 0;
+
+    while (Vec != 0)
+    {
+        if (Vec & 1)
+        {
+            Sum ^= *Mat;
+        }
+        Vec >>= 1;
+        ++Mat;
+    }
+
+    return Sum;
+}
+
+/*
+** CFE_ES_CDS_Gf2MatrixSquare computes Square = Mat * Mat.
+*/
+static void CFE_ES_CDS_Gf2MatrixSquare(uint16 *Square, const uint16 *Mat)
+{
+    uint32 n;
+
+    for (n = 0; n < 16; ++n)
+    {
+        Square[n] = CFE_ES_CDS_Gf2MatrixTimes(Mat, Mat[n]);
+    }
+}
+
+/*
+** CFE_ES_CDS_Crc16ZeroExtend returns the CRC-16 of a message extended by
+** NumZeroBytes zero bytes, given the CRC of the message alone.
+**
+** This is only valid for a zero initial value, which is what the CDS uses, and
+** runs in O(log NumZeroBytes) time by repeated squaring of the one zero bit
+** operator.  The method is the same one zlib's crc32_combine() uses.
+*/
+static uint16 CFE_ES_CDS_Crc16ZeroExtend(uint16 Crc, size_t NumZeroBytes)
+{
+    uint16 Even[16]; /* operator for an even power of two zero bits */
+    uint16 Odd[16];  /* operator for an odd power of two zero bits */
+    uint16 Row;
+    uint32 n;
+
+    if (NumZeroBytes == 0 || Crc == 0)
+    {
+        return Crc;
+    }
+
+    /* Operator for one zero bit */
+    Odd[0] = CFE_ES_CDS_CRC16_POLY;
+    Row    = 1;
+    for (n = 1; n < 16; ++n)
+    {
+        Odd[n] = Row;
+        Row <<= 1;
+    }
+
+    /* Operators for two and then four zero bits */
+    CFE_ES_CDS_Gf2MatrixSquare(Even, Odd);
+    CFE_ES_CDS_Gf2MatrixSquare(Odd, Even);
+
+    /* The first square in the loop gives the one zero byte operator */
+    do
+    {
+        CFE_ES_CDS_Gf2MatrixSquare(Even, Odd);
+        if (NumZeroBytes & 1)
+        {
+            Crc = CFE_ES_CDS_Gf2MatrixTimes(Even, Crc);
+        }
+        NumZeroBytes >>= 1;
+
+        if (NumZeroBytes == 0)
+        {
+            break;
+        }
+
+        CFE_ES_CDS_Gf2MatrixSquare(Odd, Even);
+        if (NumZeroBytes & 1)
+        {
+            Crc = CFE_ES_CDS_Gf2MatrixTimes(Odd, Crc);
+        }
+        NumZeroBytes >>= 1;
+    } while (NumZeroBytes != 0);
+
+    return Crc;
+}
+
+/*
+** CFE_ES_CDS_RangeCrcDelta computes the CRC-16 of (old XOR new) over a range
+** of CDS user data, reading the old content back from the PSP in chunks.
+**
+** Because the CRC is linear, XOR-ing this into the block CRC after extending
+** it over the bytes that follow the range gives the CRC of the updated block.
+*/
+static int32 CFE_ES_CDS_RangeCrcDelta(const void *DataToWrite, size_t CDSOffset, size_t Size, uint16 *CrcDelta)
+{
+    uint8        OldData[CFE_ES_CDS_RANGE_CHUNK_SIZE];
+    const uint8 *NewData = DataToWrite;
+    uint32       Crc     = 0;
+    size_t       ChunkSize;
+    size_t       i;
+    int32        Status = CFE_PSP_SUCCESS;
+
+    while (Size > 0)
+    {
+        ChunkSize = Size;
+        if (ChunkSize > sizeof(OldData))
+        {
+            ChunkSize = sizeof(OldData);
+        }
+
+        Status = CFE_PSP_ReadFromCDS(OldData, CDSOffset, ChunkSize);
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            break;
+        }
+
+        for (i = 0; i < ChunkSize; ++i)
+        {
+            OldData[i] ^= NewData[i];
+        }
+
+        Crc = CFE_ES_CalculateCRC(OldData, ChunkSize, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+
+        NewData += ChunkSize;
+        CDSOffset += ChunkSize;
+        Size -= ChunkSize;
+    }
+
+    *CrcDelta = (uint16)(Crc & 0xFFFF);
+
+    return Status;
+}
+
 /*
 ** CFE_ES_CDS_PoolRetrieve will obtain a block descriptor from CDS storage.
 **
@@ -95,9 +251,7 @@ int32 CFE_ES_CDS_PoolCommit(CFE_ES_GenPoolRecord_t *GenPoolRecPtr, size_t Offset
 ** CFE_ES_CreateCDSPool will initialize a pre-allocated memory pool.
 **
 ** NOTE:
-**  This function is only ever called during "Early Init" phase,
-**  where it is not possible to have contention writing into the syslog.
-**  Therefore the use of CFE_ES_SysLogWrite_Unsync() is acceptable
+**  This function is only ever called during "Early Init" phase.
 */
 int32 CFE_ES_CreateCDSPool(size_t CDSPoolSize, size_t StartOffset)
 {
@@ -112,8 +266,8 @@ int32 CFE_ES_CreateCDSPool(size_t CDSPoolSize, size_t StartOffset)
     if (ActualSize < SizeCheck)
     {
         /* Must be able make Pool verification, block descriptor and at least one of the smallest blocks  */
-        CFE_ES_SysLogWrite_Unsync("CFE_ES:CreateCDSPool-Pool size(%lu) too small for one CDS Block, need >=%lu\n",
-                                  (unsigned long)ActualSize, (unsigned long)SizeCheck);
+        CFE_ES_SysLogWrite("CFE_ES:CreateCDSPool-Pool size(%lu) too small for one CDS Block, need >=%lu\n",
+                           (unsigned long)ActualSize, (unsigned long)SizeCheck);
         return CFE_ES_CDS_INVALID_SIZE;
     }
 
@@ -133,9 +287,7 @@ int32 CFE_ES_CreateCDSPool(size_t CDSPoolSize, size_t StartOffset)
 ** Purpose:
 **
 ** NOTE:
-**  This function is only ever called during "Early Init" phase,
-**  where it is not possible to have contention writing into the syslog.
-**  Therefore the use of CFE_ES_SysLogWrite_Unsync() is acceptable
+**  This function is only ever called during "Early Init" phase.
 */
 int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
 {
@@ -156,7 +308,7 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
 
     if (Status != CFE_SUCCESS)
     {
-        CFE_ES_SysLogWrite_Unsync("CFE_ES:RebuildCDS-Err rebuilding CDS (Stat=0x%08x)\n", (unsigned int)Status);
+        CFE_ES_SysLogWrite("CFE_ES:RebuildCDS-Err rebuilding CDS (Stat=0x%08x)\n", (unsigned int)Status);
         Status = CFE_ES_CDS_ACCESS_ERROR;
     }
 
@@ -261,6 +413,127 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
     return Status;
 }
 
+/*
+** Function:
+**   CFE_ES_CDSBlockWriteRange
+**
+** Purpose:
+**
+*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size)
+{
+    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
+    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                  Status;
+    size_t                 BlockSize;
+    size_t                 UserDataSize;
+    size_t                 UserDataOffset;
+    uint16                 Crc;
+    uint16                 CrcDelta;
+    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+
+    /* Ensure the the log message is an empty string in case it is never written to */
+    LogMessage[0] = 0;
+
+    CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
+
+    /*
+     * A CDS block ID must be accessed by only one thread at a time.
+     * Checking the validity of the block requires access to the registry.
+     */
+    CFE_ES_LockCDS();
+
+    if (CFE_ES_CDSBlockRecordIsMatch(CDSRegRecPtr, Handle))
+    {
+        Status = CFE_ES_GenPoolGetBlockSize(&CDS->Pool, &BlockSize, CDSRegRecPtr->BlockOffset);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                   "CFE_ES:CDSBlkWriteRange-Invalid Handle or Block Descriptor.\n");
+        }
+        else if (BlockSize <= sizeof(CFE_ES_CDS_BlockHeader_t) || BlockSize != CDSRegRecPtr->BlockSize)
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                   "CFE_ES:CDSBlkWriteRange-Block size %lu invalid, expected %lu\n",
+                                   (unsigned long)BlockSize, (unsigned long)CDSRegRecPtr->BlockSize);
+            Status = CFE_ES_CDS_INVALID_SIZE;
+        }
+        else if (Offset >= CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr) ||
+                 Size > (CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr) - Offset))
+        {
+            CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                                   "CFE_ES:CDSBlkWriteRange-Range %lu+%lu exceeds data size %lu\n",
+                                   (unsigned long)Offset, (unsigned long)Size,
+                                   (unsigned long)CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr));
+            Status = CFE_ES_CDS_INVALID_SIZE;
+        }
+        else
+        {
+            UserDataSize = CFE_ES_CDSBlockRecordGetUserSize(CDSRegRecPtr);
+            UserDataOffset = CDSRegRecPtr->BlockOffset;
+            UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
+
+            /* Read the header for the CRC of the current content */
+            Status = CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_ES_CDS_RangeCrcDelta(DataToWrite, UserDataOffset + Offset, Size, &CrcDelta);
+                if (Status != CFE_PSP_SUCCESS)
+                {
+                    CFE_ES_SysLog_snprintf(
+                        LogMessage, sizeof(LogMessage),
+                        "CFE_ES:CDSBlkWriteRange-Err reading user data from CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                        (unsigned int)Status, (unsigned long)(UserDataOffset + Offset));
+                }
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                Crc = (uint16)(CDS->Cache.Data.BlockHeader.Crc & 0xFFFF);
+                Crc ^= CFE_ES_CDS_Crc16ZeroExtend(CrcDelta, UserDataSize - Offset - Size);
+
+                /* Store in the sign extended form CFE_ES_CalculateCRC() returns so CFE_ES_CDSBlockRead() matches */
+                CDS->Cache.Data.BlockHeader.Crc = (uint32)(int16)Crc;
+
+                /* Fetch left the cache offset and size at the block header */
+                Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+                if (Status != CFE_SUCCESS)
+                {
+                    CFE_ES_SysLog_snprintf(
+                        LogMessage, sizeof(LogMessage),
+                        "CFE_ES:CDSBlkWriteRange-Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                        (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+                else
+                {
+                    Status = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset + Offset, Size);
+                    if (Status != CFE_PSP_SUCCESS)
+                    {
+                        CFE_ES_SysLog_snprintf(
+                            LogMessage, sizeof(LogMessage),
+                            "CFE_ES:CDSBlkWriteRange-Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                            (unsigned int)Status, (unsigned long)(UserDataOffset + Offset));
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        Status = CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    CFE_ES_UnlockCDS();
+
+    /* Do the actual syslog if something went wrong */
+    if (LogMessage[0] != 0)
+    {
+        CFE_ES_SYSLOG_APPEND(LogMessage);
+    }
+
+    return Status;
+}
+
 /*
 ** Function:
 **   CFE_ES_CDSBlockRead
@@ -71,6 +71,27 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset);
 
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite);
 
+/*****************************************************************************/
+/**
+** \brief Writes part of the user data of a CDS block
+**
+** \par Description
+**        Writes Size bytes at Offset within the user data and updates the
+**        block CRC from the changed range alone, so the cost is independent
+**        of the block size.
+**
+** \par Assumptions, External Events, and Notes:
+**          The resulting CRC equals what CFE_ES_CDSBlockWrite() would store
+**          for the same content, so CFE_ES_CDSBlockRead() validation is
+**          unchanged.  A block whose content doesn't match its CRC stays
+**          invalid until it is written in full.
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_CDS_INVALID_SIZE         \copydoc CFE_ES_CDS_INVALID_SIZE
+**
+******************************************************************************/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSHandle_t Handle, const void *DataToWrite, size_t Offset, size_t Size);
+
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle);
 
 size_t CFE_ES_CDSReqdMinSize(uint32 MaxNumBlocksToSupport);
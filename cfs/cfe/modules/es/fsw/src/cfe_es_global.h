@@ -143,6 +143,11 @@ typedef struct
     */
     osal_id_t SharedDataMutex;
 
+    /*
+    ** Number of system log writers between reserve and commit
+    */
+    uint32 SysLogPendingWriters;
+
     /*
     ** Performance Data Mutex
     */
@@ -158,6 +163,7 @@ typedef struct
     */
     uint32              RegisteredTasks;
     CFE_ES_TaskRecord_t TaskTable[OS_MAX_TASKS];
+    uint32              TaskRecordVersion[OS_MAX_TASKS]; /**< ID change count, for lock-free name lookup */
 
     /*
     ** ES App Table
@@ -166,6 +172,7 @@ typedef struct
     uint32             RegisteredExternalApps;
     CFE_ResourceId_t   LastAppId;
     CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    uint32             AppRecordVersion[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /**< ID change count, for lock-free name lookup */
 
     /*
     ** ES Shared Library Table
@@ -213,6 +220,11 @@ typedef struct
      */
     CFE_ES_AppTableScanState_t BackgroundAppScanState;
 
+    /*
+     * Scheduling state of the startup script entries (only used during startup)
+     */
+    CFE_ES_StartupScriptState_t StartupScript;
+
     /*
      * Task global data (formerly a separate global).
      */
@@ -68,10 +68,9 @@
  * Size of the syslog "dump buffer"
  *
  * This is a temporary buffer that serves as a holding place for syslog data as
- * it is being dumped to a file on disk.  Since disks are comparatively slow and
- * access to the syslog buffer must be synchronized, copying to a temporary buffer
- * first significantly decreases the amount of time that the syslog is locked after
- * a file dump is requested.
+ * it is being dumped to a file on disk.  Since disks are comparatively slow,
+ * copying to a temporary buffer first significantly decreases the window in which
+ * concurrent writers may overwrite data that has not yet been dumped.
  *
  * This buffer also reflects the SysLog "burst size" that is guaranteed to be
  * safe for concurrent writes and reads/dump operations.  If applications Log more than
@@ -86,25 +85,62 @@
 #define CFE_ES_SYSLOG_READ_BUFFER_SIZE (3 * CFE_ES_MAX_SYSLOG_MSG_SIZE)
 
 /**
- * \brief Self-synchronized macro to call CFE_ES_SysLogAppend_Unsync
+ * \brief Append a preformatted string to the syslog and echo it to the console
  *
- * Calls CFE_ES_SysLogAppend_Unsync() with appropriate synchronization.
- * It will acquire the shared data lock and release it after appending the log.
+ * Calls CFE_ES_SysLogAppend(), which does not require any external lock,
+ * and then outputs the same string to the console.
  *
- * This is implemented as a macro such that the "__func__" and "__LINE__" directives
- * will reflect the actual place that the append was done, rather than where this
- * wrapper was defined.
- *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
-#define CFE_ES_SYSLOG_APPEND(LogString)              \
-    {                                                \
-        CFE_ES_LockSharedData(__func__, __LINE__);   \
-        CFE_ES_SysLogAppend_Unsync(LogString);       \
-        CFE_ES_UnlockSharedData(__func__, __LINE__); \
-        OS_printf("%s", LogString);                  \
+#define CFE_ES_SYSLOG_APPEND(LogString)    \
+    {                                      \
+        CFE_ES_SysLogAppend(LogString);    \
+        OS_printf("%s", LogString);        \
     }
 
+/**
+ * \brief Number of bits used for each index within the packed syslog state
+ *
+ * The syslog write index and end index are kept together in a single 32 bit
+ * word in the reset area, so that a writer can reserve space in the buffer with
+ * a single atomic compare-and-swap.  The platform verification checks that
+ * CFE_PLATFORM_ES_SYSTEM_LOG_SIZE fits in this many bits.
+ */
+#define CFE_ES_SYSLOG_IDX_BITS 16
+
+/**
+ * \brief Mask of a single index within the packed syslog state
+ */
+#define CFE_ES_SYSLOG_IDX_MASK ((1U << CFE_ES_SYSLOG_IDX_BITS) - 1)
+
+/**
+ * \brief Compose a packed syslog state word from a write index and an end index
+ *
+ * The write index indicates 1 byte past the end of the newest message, and the
+ * end index indicates the extent of valid data in the buffer.
+ */
+#define CFE_ES_SYSLOG_STATE(WriteIdx, EndIdx) \
+    ((((uint32)(EndIdx)&CFE_ES_SYSLOG_IDX_MASK) << CFE_ES_SYSLOG_IDX_BITS) | ((uint32)(WriteIdx)&CFE_ES_SYSLOG_IDX_MASK))
+
+/**
+ * \brief Extract the write index from a packed syslog state word
+ */
+#define CFE_ES_SYSLOG_STATE_WRITEIDX(State) ((size_t)((State)&CFE_ES_SYSLOG_IDX_MASK))
+
+/**
+ * \brief Extract the end index from a packed syslog state word
+ */
+#define CFE_ES_SYSLOG_STATE_ENDIDX(State) ((size_t)(((State) >> CFE_ES_SYSLOG_IDX_BITS) & CFE_ES_SYSLOG_IDX_MASK))
+
+/**
+ * \brief Number of attempts to obtain a stable snapshot of the syslog for reading
+ *
+ * A reader retries if a writer is between reserving space and committing its
+ * message.  After this many attempts the reader proceeds with the most recent
+ * state, which may include a partially written message.
+ */
+#define CFE_ES_SYSLOG_SNAPSHOT_ATTEMPTS 4
+
 /**
  * \brief Indicates no context information Error Logs
  *
@@ -120,11 +156,11 @@
 /**
  * \brief Buffer structure for reading data out of the SysLog
  *
- * Access to the syslog must be synchronized, so it is not possible to
+ * The syslog may be concurrently written, so it is not possible to
  * directly access the contents.  This structure keeps the state of
  * read operations such that the syslog can be read in segments.
  *
- * @sa CFE_ES_SysLogReadData(), CFE_ES_SysLogReadStart_Unsync()
+ * @sa CFE_ES_SysLogReadData(), CFE_ES_SysLogReadStart()
  */
 typedef struct
 {
@@ -151,9 +187,10 @@ typedef struct
  *
  * This discards the entire system log buffer and resets internal index values
  *
- * \note This function requires external thread synchronization
+ * Messages which are being written concurrently with the clear may or may
+ * not be retained.
  */
-void CFE_ES_SysLogClear_Unsync(void);
+void CFE_ES_SysLogClear(void);
 
 /**
  * \brief Begin reading the system log
@@ -169,24 +206,25 @@ void CFE_ES_SysLogClear_Unsync(void);
  * data to the supplied buffer.  The CFE_ES_SysLogReadData() should be called
  * to read log data.
  *
+ * The log indices are captured at a point where no writer is between reserving
+ * space and committing its message, so the first message through the newest message
+ * are all complete.  If writers are continuously active, this gives up after
+ * #CFE_ES_SYSLOG_SNAPSHOT_ATTEMPTS and uses the latest indices.
+ *
  * \param Buffer  A local buffer which will be initialized to the start of the log buffer
  *
- * \note This function requires external thread synchronization
  * \sa CFE_ES_SysLogReadData()
  */
-void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer);
+void CFE_ES_SysLogReadStart(CFE_ES_SysLogReadBuffer_t *Buffer);
 
 /**
  * \brief Write a printf-style formatted string to the system log
  *
- * This is a drop-in replacement for the existing CFE_ES_WriteToSysLog() API
- * that does _not_ perform any synchronization or locking.  It is intended for
- * logging from within the ES subsystem where the appropriate lock is
- * already held for other reasons.
- *
- * \note This function requires external thread synchronization
+ * This is the ES internal equivalent of the CFE_ES_WriteToSysLog() API.
+ * The syslog buffer does not depend on the ES shared data lock, so this
+ * may be called with or without the lock held.
  */
-int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
+int32 CFE_ES_SysLogWrite(const char *SpecStringPtr, ...);
 
 /**
  * \brief Append a complete pre-formatted string to the ES SysLog
@@ -201,18 +239,23 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...);
  * If "LogMode" is set to OVERWRITE, then the oldest message(s) in the
  * system log will be overwritten with this new message.
  *
+ * Space for the message is reserved with an atomic update of the packed
+ * write/end index, so concurrent writers do not block any task holding the
+ * ES shared data lock.  A writer that wraps to the start of the buffer in
+ * OVERWRITE mode does not wait for the other pending writers, so no message
+ * is ever discarded in that mode.
+ *
  * \param LogString     Message to append
  *
- * \note This function requires external thread synchronization
  * \sa CFE_ES_SysLogSetMode()
  */
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString);
+int32 CFE_ES_SysLogAppend(const char *LogString);
 
 /**
  * \brief Read data from the system log buffer into the local buffer
  *
  * Prior to calling this function, the buffer structure should be initialized
- * using CFE_ES_SysLogReadStart_Unsync()
+ * using CFE_ES_SysLogReadStart()
  *
  * This copies the data from the syslog memory space into the local buffer, starting
  * from the end of the previously read data.  To read the complete system log,
@@ -224,10 +267,9 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString);
  * if system log data is overwritten between calls to this function, it may result in
  * undefined data being returned to the caller.
  *
- * Therefore, in cases where it is critically important to read log message data, the
- * lock should be held for the entire procedure (initialization through complete read).
- * However this may have significant realtime implications, so it is not the required
- * mode of operation.
+ * Writers are never blocked by readers, so in cases where applications log more than
+ * the read buffer size while a read is in progress, some data may be lost or corrupt
+ * in the output.
  *
  * \param Buffer  A local buffer which will be filled with data from the log buffer
  */
@@ -256,7 +298,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
 /**
  * \brief Format a message intended for output to the system log
  *
- * This function prepares a complete message for passing into CFE_ES_SysLogAppend_Unsync(),
+ * This function prepares a complete message for passing into CFE_ES_SysLogAppend(),
  * based on the given vsnprintf-style specification string and argument list.
  *
  * The message is prefixed with a time stamp based on the current time, followed by the
@@ -272,7 +314,7 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode);
  * \param SpecStringPtr Printf-style format string
  * \param ArgPtr        Variable argument list as obtained by va_start() in the caller
  *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
 void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecStringPtr, va_list ArgPtr);
 
@@ -288,7 +330,7 @@ void CFE_ES_SysLog_vsnprintf(char *Buffer, size_t BufferSize, const char *SpecSt
  * \param BufferSize    Size of "Buffer" parameter.  Should be greater than (CFE_TIME_PRINTED_STRING_SIZE+2)
  * \param SpecStringPtr Printf-style format string
  *
- * \sa CFE_ES_SysLogAppend_Unsync()
+ * \sa CFE_ES_SysLogAppend()
  */
 void CFE_ES_SysLog_snprintf(char *Buffer, size_t BufferSize, const char *SpecStringPtr, ...) OS_PRINTF(3, 4);
 
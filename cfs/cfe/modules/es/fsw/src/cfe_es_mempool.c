@@ -205,7 +205,7 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, uint8 *MemPtr, size_t Size
 
     if (PoolRecPtr == NULL)
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: No free MemPoolrary slots available\n");
+        CFE_ES_SysLogWrite("ES Startup: No free MemPoolrary slots available\n");
         Status = CFE_ES_NO_RESOURCE_IDS_AVAILABLE;
     }
     else
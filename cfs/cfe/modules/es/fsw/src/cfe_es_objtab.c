@@ -100,31 +100,36 @@ CFE_ES_ObjectTable_t CFE_ES_ObjectTable[CFE_PLATFORM_ES_OBJECT_TABLE_SIZE] = {
      .ObjectName               = "CFE_EVS",
      .FuncPtrUnion.MainTaskPtr = CFE_EVS_TaskMain,
      .ObjectPriority           = CFE_PLATFORM_EVS_START_TASK_PRIORITY,
-     .ObjectSize               = CFE_PLATFORM_EVS_START_TASK_STACK_SIZE},
+     .ObjectSize               = CFE_PLATFORM_EVS_START_TASK_STACK_SIZE,
+     .ObjectFlags              = CFE_ES_TASK_CPU_AFFINITY(CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY)},
     {.ObjectType = CFE_ES_NULL_ENTRY},
     {.ObjectType               = CFE_ES_CORE_TASK,
      .ObjectName               = "CFE_SB",
      .FuncPtrUnion.MainTaskPtr = CFE_SB_TaskMain,
      .ObjectPriority           = CFE_PLATFORM_SB_START_TASK_PRIORITY,
-     .ObjectSize               = CFE_PLATFORM_SB_START_TASK_STACK_SIZE},
+     .ObjectSize               = CFE_PLATFORM_SB_START_TASK_STACK_SIZE,
+     .ObjectFlags              = CFE_ES_TASK_CPU_AFFINITY(CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY)},
     {.ObjectType = CFE_ES_NULL_ENTRY},
     {.ObjectType               = CFE_ES_CORE_TASK,
      .ObjectName               = "CFE_ES",
      .FuncPtrUnion.MainTaskPtr = CFE_ES_TaskMain,
      .ObjectPriority           = CFE_PLATFORM_ES_START_TASK_PRIORITY,
-     .ObjectSize               = CFE_PLATFORM_ES_START_TASK_STACK_SIZE},
+     .ObjectSize               = CFE_PLATFORM_ES_START_TASK_STACK_SIZE,
+     .ObjectFlags              = CFE_ES_TASK_CPU_AFFINITY(CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY)},
     {.ObjectType = CFE_ES_NULL_ENTRY},
     {.ObjectType               = CFE_ES_CORE_TASK,
      .ObjectName               = "CFE_TIME",
      .FuncPtrUnion.MainTaskPtr = CFE_TIME_TaskMain,
      .ObjectPriority           = CFE_PLATFORM_TIME_START_TASK_PRIORITY,
-     .ObjectSize               = CFE_PLATFORM_TIME_START_TASK_STACK_SIZE},
+     .ObjectSize               = CFE_PLATFORM_TIME_START_TASK_STACK_SIZE,
+     .ObjectFlags              = CFE_ES_TASK_CPU_AFFINITY(CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY)},
     {.ObjectType = CFE_ES_NULL_ENTRY},
     {.ObjectType               = CFE_ES_CORE_TASK,
      .ObjectName               = "CFE_TBL",
      .FuncPtrUnion.MainTaskPtr = CFE_TBL_TaskMain,
      .ObjectPriority           = CFE_PLATFORM_TBL_START_TASK_PRIORITY,
-     .ObjectSize               = CFE_PLATFORM_TBL_START_TASK_STACK_SIZE},
+     .ObjectSize               = CFE_PLATFORM_TBL_START_TASK_STACK_SIZE,
+     .ObjectFlags              = CFE_ES_TASK_CPU_AFFINITY(CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY)},
 
     /*
     ** Spare entries
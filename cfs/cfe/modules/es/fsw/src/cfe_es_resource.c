@@ -347,6 +347,99 @@ CFE_ES_AppRecord_t *CFE_ES_GetAppRecordByContext(void)
     return AppRecPtr;
 }
 
+/*********************************************************************/
+/*
+ * CFE_ES_AppRecordCopyName
+ *
+ * For complete API information, see prototype in header
+ */
+int32 CFE_ES_AppRecordCopyName(const CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppId_t AppId, char *NameBuf,
+                               size_t BufferLength)
+{
+    const uint32 *VersionPtr;
+    uint32        Version;
+    bool          IsMatch;
+
+    NameBuf[0] = 0;
+    if (AppRecPtr == NULL)
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    VersionPtr = &CFE_ES_Global.AppRecordVersion[AppRecPtr - CFE_ES_Global.AppTable];
+
+    /*
+     * Retry until no ID transition happened on this entry while copying.
+     * ES changes an entry ID at most a few times per app lifetime, so this
+     * normally completes on the first pass.
+     */
+    do
+    {
+        Version = __atomic_load_n(VersionPtr, __ATOMIC_ACQUIRE);
+        IsMatch = CFE_ES_AppRecordIsMatch(AppRecPtr, AppId);
+        if (IsMatch)
+        {
+            strncpy(NameBuf, CFE_ES_AppRecordGetName(AppRecPtr), BufferLength - 1);
+            NameBuf[BufferLength - 1] = '\0';
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(VersionPtr, __ATOMIC_RELAXED) != Version);
+
+    if (!IsMatch)
+    {
+        NameBuf[0] = 0;
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*********************************************************************/
+/*
+ * CFE_ES_TaskRecordCopyName
+ *
+ * For complete API information, see prototype in header
+ */
+int32 CFE_ES_TaskRecordCopyName(const CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ES_TaskId_t TaskId, char *NameBuf,
+                                size_t BufferLength, CFE_ES_AppId_t *AppIdPtr)
+{
+    const uint32 *VersionPtr;
+    uint32        Version;
+    bool          IsMatch;
+
+    NameBuf[0] = 0;
+    *AppIdPtr  = CFE_ES_APPID_UNDEFINED;
+    if (TaskRecPtr == NULL)
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    VersionPtr = &CFE_ES_Global.TaskRecordVersion[TaskRecPtr - CFE_ES_Global.TaskTable];
+
+    /* Same retry scheme as CFE_ES_AppRecordCopyName() */
+    do
+    {
+        Version = __atomic_load_n(VersionPtr, __ATOMIC_ACQUIRE);
+        IsMatch = CFE_ES_TaskRecordIsMatch(TaskRecPtr, TaskId);
+        if (IsMatch)
+        {
+            strncpy(NameBuf, CFE_ES_TaskRecordGetName(TaskRecPtr), BufferLength - 1);
+            NameBuf[BufferLength - 1] = '\0';
+            *AppIdPtr                 = TaskRecPtr->AppId;
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(VersionPtr, __ATOMIC_RELAXED) != Version);
+
+    if (!IsMatch)
+    {
+        NameBuf[0] = 0;
+        *AppIdPtr  = CFE_ES_APPID_UNDEFINED;
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*
  * ---------------------------------------------------------------------------------------
  * Function: CFE_ES_CheckCounterIdSlotUsed
@@ -111,6 +111,25 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
     return AppRecPtr->AppId;
 }
 
+/**
+ * @brief Record a change of the ID held in a table entry
+ *
+ * The lock-free name lookups read this counter before and after copying
+ * the name from the entry, and retry if it changed.  The name of an entry
+ * is only written while the entry does not hold a valid ID, so counting
+ * every ID transition is sufficient to detect a name being replaced.
+ *
+ * The sequentially consistent increment also acts as a full barrier, so
+ * the preceding ID store is visible before the count changes and any
+ * subsequent name stores are not visible before it.
+ *
+ * @param[in]   VersionPtr  pointer to the change counter for the entry
+ */
+static inline void CFE_ES_RecordVersionBump(uint32 *VersionPtr)
+{
+    __atomic_add_fetch(VersionPtr, 1, __ATOMIC_SEQ_CST);
+}
+
 /**
  * @brief Marks an app table entry as used (not free)
  *
@@ -126,6 +145,7 @@ static inline CFE_ES_AppId_t CFE_ES_AppRecordGetID(const CFE_ES_AppRecord_t *App
 static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_ResourceId_t PendingId)
 {
     AppRecPtr->AppId = CFE_ES_APPID_C(PendingId);
+    CFE_ES_RecordVersionBump(&CFE_ES_Global.AppRecordVersion[AppRecPtr - CFE_ES_Global.AppTable]);
 }
 
 /**
@@ -142,6 +162,7 @@ static inline void CFE_ES_AppRecordSetUsed(CFE_ES_AppRecord_t *AppRecPtr, CFE_Re
 static inline void CFE_ES_AppRecordSetFree(CFE_ES_AppRecord_t *AppRecPtr)
 {
     AppRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
+    CFE_ES_RecordVersionBump(&CFE_ES_Global.AppRecordVersion[AppRecPtr - CFE_ES_Global.AppTable]);
 }
 
 /**
@@ -313,6 +334,7 @@ static inline bool CFE_ES_TaskRecordIsUsed(const CFE_ES_TaskRecord_t *TaskRecPtr
 static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ResourceId_t PendingId)
 {
     TaskRecPtr->TaskId = CFE_ES_TASKID_C(PendingId);
+    CFE_ES_RecordVersionBump(&CFE_ES_Global.TaskRecordVersion[TaskRecPtr - CFE_ES_Global.TaskTable]);
 }
 
 /**
@@ -329,6 +351,7 @@ static inline void CFE_ES_TaskRecordSetUsed(CFE_ES_TaskRecord_t *TaskRecPtr, CFE
 static inline void CFE_ES_TaskRecordSetFree(CFE_ES_TaskRecord_t *TaskRecPtr)
 {
     TaskRecPtr->TaskId = CFE_ES_TASKID_UNDEFINED;
+    CFE_ES_RecordVersionBump(&CFE_ES_Global.TaskRecordVersion[TaskRecPtr - CFE_ES_Global.TaskTable]);
 }
 
 /**
@@ -544,6 +567,39 @@ CFE_ES_LibRecord_t *       CFE_ES_LocateLibRecordByName(const char *Name);
 CFE_ES_TaskRecord_t *      CFE_ES_LocateTaskRecordByName(const char *Name);
 CFE_ES_GenCounterRecord_t *CFE_ES_LocateCounterRecordByName(const char *Name);
 
+/*
+ * Internal functions to copy names out of the app and task tables
+ *
+ * These functions do not lock.  They use the per-entry change counters to
+ * detect concurrent ID transitions and retry, so they may be used on hot
+ * paths without contending with other users of the ES shared data lock.
+ */
+
+/**
+ * @brief Copy the name of an app table entry without locking
+ *
+ * @param[in]   AppRecPtr     pointer to app table entry, may be NULL
+ * @param[in]   AppId         expected app ID of the entry
+ * @param[out]  NameBuf       buffer to store the name
+ * @param[in]   BufferLength  size of NameBuf, must be nonzero
+ * @returns CFE_SUCCESS if the entry matches AppId, CFE_ES_ERR_RESOURCEID_NOT_VALID otherwise
+ */
+int32 CFE_ES_AppRecordCopyName(const CFE_ES_AppRecord_t *AppRecPtr, CFE_ES_AppId_t AppId, char *NameBuf,
+                               size_t BufferLength);
+
+/**
+ * @brief Copy the name and parent app ID of a task table entry without locking
+ *
+ * @param[in]   TaskRecPtr    pointer to task table entry, may be NULL
+ * @param[in]   TaskId        expected task ID of the entry
+ * @param[out]  NameBuf       buffer to store the name
+ * @param[in]   BufferLength  size of NameBuf, must be nonzero
+ * @param[out]  AppIdPtr      parent app ID of the task
+ * @returns CFE_SUCCESS if the entry matches TaskId, CFE_ES_ERR_RESOURCEID_NOT_VALID otherwise
+ */
+int32 CFE_ES_TaskRecordCopyName(const CFE_ES_TaskRecord_t *TaskRecPtr, CFE_ES_TaskId_t TaskId, char *NameBuf,
+                                size_t BufferLength, CFE_ES_AppId_t *AppIdPtr);
+
 /* Availability check functions used in conjunction with CFE_ResourceId_FindNext() */
 bool CFE_ES_CheckAppIdSlotUsed(CFE_ResourceId_t CheckId);
 bool CFE_ES_CheckLibIdSlotUsed(CFE_ResourceId_t CheckId);
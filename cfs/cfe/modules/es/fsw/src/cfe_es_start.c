@@ -132,8 +132,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ReturnCode = OS_MutSemCreate(&CFE_ES_Global.PerfDataMutex, "ES_PERF_MUTEX", 0);
     if (ReturnCode != OS_SUCCESS)
     {
-        CFE_ES_SysLogWrite_Unsync("ES Startup: Error: ES Performance Data Mutex could not be created. RC=0x%08X\n",
-                                  (unsigned int)ReturnCode);
+        CFE_ES_SysLogWrite("ES Startup: Error: ES Performance Data Mutex could not be created. RC=0x%08X\n",
+                           (unsigned int)ReturnCode);
 
         /*
         ** Delay to allow the message to be read
@@ -239,8 +239,8 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
 **          It will also initiate a power on reset when too many processor resets
 **           have happened.
 **
-** SYSLOGGING NOTE: Any logging in here must use CFE_ES_SysLogWrite_Unsync() as the necessary
-** primitives are not even initialized yet.  There is no chance for log contention here.
+** SYSLOGGING NOTE: Any logging in here must use CFE_ES_SysLogWrite() as the necessary
+** primitives are not even initialized yet.
 **
 */
 void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 BootSource)
@@ -335,19 +335,19 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
         */
         if (StartSubtype == CFE_PSP_RST_SUBTYPE_POWER_CYCLE)
         {
-            CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to Power Cycle (Power Cycle).\n");
+            CFE_ES_SysLogWrite("POWER ON RESET due to Power Cycle (Power Cycle).\n");
             CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                                 "POWER ON RESET due to Power Cycle (Power Cycle)");
         }
         else if (StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND)
         {
-            CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to HW Special Cmd (Hw Spec Cmd).\n");
+            CFE_ES_SysLogWrite("POWER ON RESET due to HW Special Cmd (Hw Spec Cmd).\n");
             CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                                 "POWER ON RESET due to HW Special Cmd (Hw Spec Cmd)");
         }
         else
         {
-            CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to other cause (See Subtype).\n");
+            CFE_ES_SysLogWrite("POWER ON RESET due to other cause (See Subtype).\n");
             CFE_ES_WriteToERLog(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, StartSubtype,
                                 "POWER ON RESET due to other cause (See Subtype)");
         }
@@ -380,7 +380,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
                 if (StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND)
                 {
                     CFE_ES_Global.ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND;
-                    CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to max proc resets (HW Spec Cmd).\n");
+                    CFE_ES_SysLogWrite("POWER ON RESET due to max proc resets (HW Spec Cmd).\n");
 
                     /*
                     ** Log the reset in the ER Log. The log will be wiped out, but it's good to have
@@ -392,7 +392,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
                 else
                 {
                     CFE_ES_Global.ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_WATCHDOG;
-                    CFE_ES_SysLogWrite_Unsync("POWER ON RESET due to max proc resets (Watchdog).\n");
+                    CFE_ES_SysLogWrite("POWER ON RESET due to max proc resets (Watchdog).\n");
 
                     /*
                     ** Log the reset in the ER Log. The log will be wiped out, but it's good to have
@@ -409,14 +409,14 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
                 /*
                 ** Should not return here.
                 */
-                CFE_ES_SysLogWrite_Unsync("ES Startup: Error: CFE_PSP_Restart returned.\n");
+                CFE_ES_SysLogWrite("ES Startup: Error: CFE_PSP_Restart returned.\n");
             }
             else /* Maximum processor reset not exceeded */
             {
                 if (StartSubtype == CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND)
                 {
                     CFE_ES_Global.ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND;
-                    CFE_ES_SysLogWrite_Unsync("PROCESSOR RESET due to Hardware Special Command (HW Spec Cmd).\n");
+                    CFE_ES_SysLogWrite("PROCESSOR RESET due to Hardware Special Command (HW Spec Cmd).\n");
 
                     /*
                     ** Log the watchdog reset
@@ -427,7 +427,7 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
                 else
                 {
                     CFE_ES_Global.ResetDataPtr->ResetVars.ResetSubtype = CFE_PSP_RST_SUBTYPE_HW_WATCHDOG;
-                    CFE_ES_SysLogWrite_Unsync("PROCESSOR RESET due to Watchdog (Watchdog).\n");
+                    CFE_ES_SysLogWrite("PROCESSOR RESET due to Watchdog (Watchdog).\n");
 
                     /*
                     ** Log the watchdog reset
@@ -755,6 +755,8 @@ void CFE_ES_CreateObjects(void)
                     /* FileName and EntryPoint is not valid for core apps */
                     AppRecPtr->StartParams.MainTaskInfo.StackSize = CFE_ES_ObjectTable[i].ObjectSize;
                     AppRecPtr->StartParams.MainTaskInfo.Priority  = CFE_ES_ObjectTable[i].ObjectPriority;
+                    AppRecPtr->StartParams.MainTaskInfo.CpuAffinityMask =
+                        CFE_ES_TASK_CPU_AFFINITY_GET(CFE_ES_ObjectTable[i].ObjectFlags);
                     AppRecPtr->StartParams.ExceptionAction        = CFE_ES_ExceptionAction_PROC_RESTART;
 
                     /*
@@ -31,21 +31,17 @@
 **
 **  Notes:
 **
-**     Some functions have EXTERNAL SYNC REQUIREMENTS
+**     The syslog buffer itself does not use the ES shared data lock.  The write index
+**     and end index are packed into a single word in the reset area, and writers
+**     reserve space for a message with an atomic compare-and-swap on that word, then
+**     copy the message into the reserved space and commit it.  A count of writers
+**     between reserve and commit allows readers to obtain a consistent snapshot.
+**     This keeps chatty syslog writers from stalling the app, task and counter
+**     table lookups that share the ES lock.
 **
-**     SysLog functions marked with "Unsync" in their name are designated
-**     as functions which are _not_ safe to be called concurrently by multiple
-**     threads, and also do _not_ implement any locking or protection.  These
-**     functions expect the caller to perform all thread synchronization before
-**     calling it.
-**
-**     The synchronization requirement is across all functions; i.e. it is not safe
-**     to call B_Unsync() while A_Unsync() is executing or vice-versa.  The external
-**     lock must wait until A_Unsync() finishes before calling B_Unsync().
-**
-**     The expectation is that the required level of synchronization can be achieved
-**     using the existing ES shared data lock.  However, if it becomes necessary, this
-**     could be replaced with a finer grained syslog-specific lock.
+**     In overwrite mode a writer that wraps to the start of the buffer first
+**     waits for the pending writers to drain, so the wrapped space is never
+**     reused while an earlier message is still being copied into it.
 */
 
 /*
@@ -60,50 +56,85 @@
 
 /*******************************************************************
  *
- * Non-synchronized helper functions
- *
- * An external mutex be held while calling any function marked "Unsync"
- * These helper functions are local to the ES subsystem and must _NOT_
- * be exposed to the public API.
+ * Self-synchronized syslog buffer functions
  *
- * For external access, a public wrapper API must first acquire the
- * necessary mutex before calling any function marked as "Unsync"
+ * These functions access the syslog index state only through the
+ * atomic helpers below and do not require any external lock.  They are
+ * local to the ES subsystem and must _NOT_ be exposed to the public API.
  *
  *******************************************************************/
 
+/*
+ * Atomic accessors for the syslog state.  These use the GCC/Clang builtins,
+ * which are available for all supported toolchains and are lock-free for
+ * naturally aligned 32 bit values on all supported processors.
+ */
+#define CFE_ES_SYSLOG_LOAD(Var)           __atomic_load_n(&(Var), __ATOMIC_ACQUIRE)
+#define CFE_ES_SYSLOG_STORE(Var, Val)     __atomic_store_n(&(Var), (Val), __ATOMIC_RELEASE)
+#define CFE_ES_SYSLOG_INCREMENT(Var)      __atomic_add_fetch(&(Var), 1, __ATOMIC_ACQ_REL)
+#define CFE_ES_SYSLOG_DECREMENT(Var)      __atomic_sub_fetch(&(Var), 1, __ATOMIC_ACQ_REL)
+#define CFE_ES_SYSLOG_CAS(Var, Exp, Val)  \
+    __atomic_compare_exchange_n(&(Var), (Exp), (Val), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
 /*
  * -----------------------------------------------------------------
  * CFE_ES_SysLogClear --
  * Clear system log & index
  * -----------------------------------------------------------------
  */
-void CFE_ES_SysLogClear_Unsync(void)
+void CFE_ES_SysLogClear(void)
 {
     /*
      * Note - no need to actually memset the SystemLog buffer -
      * by simply zeroing out the indices will cover it.
      */
 
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEntryNum = 0;
+    CFE_ES_SYSLOG_STORE(CFE_ES_Global.ResetDataPtr->SystemLogState, CFE_ES_SYSLOG_STATE(0, 0));
+    CFE_ES_SYSLOG_STORE(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 0);
 
-} /* End of CFE_ES_SysLogClear_Unsync() */
+} /* End of CFE_ES_SysLogClear() */
 
 /*
  * -----------------------------------------------------------------
- * CFE_ES_SysLogReadStart_Unsync --
+ * CFE_ES_SysLogReadStart --
  * Locate start (oldest message) of syslog for reading
  * -----------------------------------------------------------------
  */
-void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer)
+void CFE_ES_SysLogReadStart(CFE_ES_SysLogReadBuffer_t *Buffer)
 {
     size_t ReadIdx;
     size_t EndIdx;
     size_t TotalSize;
+    uint32 State;
+    uint32 EntryNum;
+    uint32 Attempt;
+    bool   IsStable;
+
+    /*
+     * Take a snapshot of the indices at a point where no writer is between
+     * reserve and commit.  A writer that reserves after the first state read
+     * changes either the pending count, the state word or the entry count
+     * before the second reads, so matching values mean every message up to
+     * the snapshot write index has been completely copied in.
+     */
+    Attempt = 0;
+    do
+    {
+        if (Attempt > 0)
+        {
+            OS_TaskDelay(0);
+        }
+        ++Attempt;
 
-    ReadIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    EndIdx    = CFE_ES_Global.ResetDataPtr->SystemLogEndIdx;
+        EntryNum = CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
+        State    = CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogState);
+        IsStable = (CFE_ES_SYSLOG_LOAD(CFE_ES_Global.SysLogPendingWriters) == 0 &&
+                    CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogState) == State &&
+                    CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum) == EntryNum);
+    } while (!IsStable && Attempt < CFE_ES_SYSLOG_SNAPSHOT_ATTEMPTS);
+
+    ReadIdx   = CFE_ES_SYSLOG_STATE_WRITEIDX(State);
+    EndIdx    = CFE_ES_SYSLOG_STATE_ENDIDX(State);
     TotalSize = EndIdx;
 
     /*
@@ -124,20 +155,24 @@ void CFE_ES_SysLogReadStart_Unsync(CFE_ES_SysLogReadBuffer_t *Buffer)
     Buffer->LastOffset = ReadIdx;
     Buffer->EndIdx     = EndIdx;
     Buffer->BlockSize  = 0;
-} /* End of CFE_ES_SysLogReadStart_Unsync() */
+} /* End of CFE_ES_SysLogReadStart() */
 
 /*
  * -----------------------------------------------------------------
- * CFE_ES_SysLogAppend_Unsync() --
+ * CFE_ES_SysLogAppend() --
  * Append a preformatted string to the syslog
  * -----------------------------------------------------------------
  */
-int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
+int32 CFE_ES_SysLogAppend(const char *LogString)
 {
     int32  ReturnCode;
+    int32  Status;
     size_t MessageLen;
+    size_t CopyLen;
     size_t WriteIdx;
     size_t EndIdx;
+    uint32 OldState;
+    uint32 NewState;
 
     /*
      * Sanity check - Make sure the message length is actually reasonable
@@ -165,98 +200,121 @@ int32 CFE_ES_SysLogAppend_Unsync(const char *LogString)
 
     /*
      * Real work begins --
-     * Take a local snapshot of the head & tail index values
+     * Reserve space for the message.
+     *
+     * The packed state holds both of:
      *
      * WriteIdx -> indicates 1 byte past the end of the newest message
      *      (this is the place where new messages will be added)
      *
      * EndIdx -> indicates the entire size of the buffer
      *
-     * Keeping them in local stack variables allows more efficient modification,
-     * since CFE_ES_Global.ResetDataPtr may point directly into a slower NVRAM space.
-     */
-    WriteIdx = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    EndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogEndIdx;
-
-    /*
-     * Check if the log message plus will fit between
-     * the HeadIdx and the end of the buffer.
-     *
-     * If so, then the process can proceed as normal.
+     * The new values are computed from a local snapshot and published with a
+     * compare-and-swap, which is retried if another writer reserved space in
+     * the meantime.  The writer is counted as pending until the message has
+     * been copied in, so readers do not snapshot a partially written message.
      *
-     * If not, then the action depends on the setting of "SystemLogMode" which will be
-     * to either discard (default) or overwrite
+     * In "overwrite" mode the wrap never waits for other pending writers, so
+     * no message is dropped.  A writer still copying into the start of the
+     * buffer can only be overtaken if the whole log is rewritten during its
+     * copy, and then only that message's text is garbled.
      */
-    if ((WriteIdx + MessageLen) > CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
+    CFE_ES_SYSLOG_INCREMENT(CFE_ES_Global.SysLogPendingWriters);
+
+    OldState = CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogState);
+    do
     {
-        if (CFE_ES_Global.ResetDataPtr->SystemLogMode == CFE_ES_LogMode_OVERWRITE)
+        WriteIdx = CFE_ES_SYSLOG_STATE_WRITEIDX(OldState);
+        EndIdx   = CFE_ES_SYSLOG_STATE_ENDIDX(OldState);
+        CopyLen  = MessageLen;
+        Status   = ReturnCode;
+
+        /*
+         * Check if the log message plus will fit between
+         * the HeadIdx and the end of the buffer.
+         *
+         * If so, then the process can proceed as normal.
+         *
+         * If not, then the action depends on the setting of "SystemLogMode" which will be
+         * to either discard (default) or overwrite
+         */
+        if ((WriteIdx + CopyLen) > CFE_PLATFORM_ES_SYSTEM_LOG_SIZE)
         {
-            /* In "overwrite" mode, start back at the beginning of the buffer */
-            EndIdx   = WriteIdx;
-            WriteIdx = 0;
+            if (CFE_ES_SYSLOG_LOAD(CFE_ES_Global.ResetDataPtr->SystemLogMode) == CFE_ES_LogMode_OVERWRITE)
+            {
+                /* In "overwrite" mode, start back at the beginning of the buffer */
+                EndIdx   = WriteIdx;
+                WriteIdx = 0;
+            }
+            else if (WriteIdx < (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
+            {
+                /* In "discard" mode, save as much as possible and discard the remainder of the message
+                 * However this should only be done if there is enough room for at least a full timestamp,
+                 * otherwise the fragment will not be useful at all. */
+                CopyLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - WriteIdx;
+                Status  = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            }
+            else
+            {
+                /* entire message must be discarded */
+                CopyLen = 0;
+            }
         }
-        else if (WriteIdx < (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE))
+
+        if (CopyLen == 0)
         {
-            /* In "discard" mode, save as much as possible and discard the remainder of the message
-             * However this should only be done if there is enough room for at least a full timestamp,
-             * otherwise the fragment will not be useful at all. */
-            MessageLen = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - WriteIdx;
-            ReturnCode = CFE_ES_ERR_SYS_LOG_TRUNCATED;
+            /* nothing to reserve */
+            break;
         }
-        else
+
+        /*
+         * Keep track of the buffer endpoint for future reference
+         */
+        if ((WriteIdx + CopyLen) > EndIdx)
         {
-            /* entire message must be discarded */
-            MessageLen = 0;
+            EndIdx = WriteIdx + CopyLen;
         }
-    }
 
-    if (MessageLen == 0)
+        NewState = CFE_ES_SYSLOG_STATE(WriteIdx + CopyLen, EndIdx);
+    } while (!CFE_ES_SYSLOG_CAS(CFE_ES_Global.ResetDataPtr->SystemLogState, &OldState, NewState));
+
+    if (CopyLen == 0)
     {
-        ReturnCode = CFE_ES_ERR_SYS_LOG_FULL;
+        Status = CFE_ES_ERR_SYS_LOG_FULL;
     }
     else
     {
         /*
-         * Copy the message in, EXCEPT for the last char which is probably a newline
+         * Copy the message into the reserved space, EXCEPT for the last char which is probably a newline
          */
-        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, MessageLen - 1);
-        WriteIdx += MessageLen;
+        memcpy(&CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx], LogString, CopyLen - 1);
 
         /*
          * Ensure the that last-written character is a newline.
          * This would have been enforced already except in cases where
          * the message got truncated.
          */
-        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx - 1] = '\n';
+        CFE_ES_Global.ResetDataPtr->SystemLog[WriteIdx + CopyLen - 1] = '\n';
 
         /*
-         * Keep track of the buffer endpoint for future reference
+         * Commit the message
          */
-        if (WriteIdx > EndIdx)
-        {
-            EndIdx = WriteIdx;
-        }
-
-        /*
-         * Export updated index values to the reset area for next time.
-         */
-        CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = WriteIdx;
-        CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = EndIdx;
-        ++CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
+        CFE_ES_SYSLOG_INCREMENT(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum);
     }
 
-    return (ReturnCode);
-} /* End of CFE_ES_SysLogAppend_Unsync() */
+    CFE_ES_SYSLOG_DECREMENT(CFE_ES_Global.SysLogPendingWriters);
+
+    return (Status);
+} /* End of CFE_ES_SysLogAppend() */
 
 /*
  * -----------------------------------------------------------------
- * CFE_ES_SysLogWrite_Unsync() --
- * Identical to the public CFE_ES_WriteToSysLog() function, except
- * that it operates in an unsynchronized manner.  It can be used in
- * cases where the appropriate lock is already held for other reasons
+ * CFE_ES_SysLogWrite() --
+ * Format a message and append it to the syslog for the ES internal
+ * callers, which may or may not hold the ES shared data lock
  * -----------------------------------------------------------------
  */
-int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
+int32 CFE_ES_SysLogWrite(const char *SpecStringPtr, ...)
 {
     char    TmpString[CFE_ES_MAX_SYSLOG_MSG_SIZE];
     va_list ArgPtr;
@@ -271,8 +329,8 @@ int32 CFE_ES_SysLogWrite_Unsync(const char *SpecStringPtr, ...)
     /*
      * Append to the syslog buffer
      */
-    return CFE_ES_SysLogAppend_Unsync(TmpString);
-} /* End of CFE_ES_SysLogWrite_Unsync() */
+    return CFE_ES_SysLogAppend(TmpString);
+} /* End of CFE_ES_SysLogWrite() */
 
 /*******************************************************************
  *
@@ -343,8 +401,8 @@ int32 CFE_ES_SysLogSetMode(CFE_ES_LogMode_Enum_t Mode)
 
     if ((Mode == CFE_ES_LogMode_OVERWRITE) || (Mode == CFE_ES_LogMode_DISCARD))
     {
-        CFE_ES_Global.ResetDataPtr->SystemLogMode = Mode;
-        Status                                    = CFE_SUCCESS;
+        CFE_ES_SYSLOG_STORE(CFE_ES_Global.ResetDataPtr->SystemLogMode, Mode);
+        Status = CFE_SUCCESS;
     }
     else
     {
@@ -485,14 +543,12 @@ int32 CFE_ES_SysLogDump(const char *Filename)
         TotalSize += Status;
 
         /*
-         * Get a snapshot of the buffer pointers and read the first block of
-         * data while locked - ensuring that nothing additional can be written
-         * into the syslog buffer while getting the first block of log data.
+         * Get a snapshot of the buffer indices and read the first block of data.
+         * Writers are never blocked by this, they simply reserve space
+         * past the snapshot.
          */
-        CFE_ES_LockSharedData(__func__, __LINE__);
-        CFE_ES_SysLogReadStart_Unsync(&Buffer.LogData);
+        CFE_ES_SysLogReadStart(&Buffer.LogData);
         CFE_ES_SysLogReadData(&Buffer.LogData);
-        CFE_ES_UnlockSharedData(__func__, __LINE__);
 
         while (Buffer.LogData.BlockSize > 0)
         {
@@ -516,7 +572,7 @@ int32 CFE_ES_SysLogDump(const char *Filename)
             }
 
             /*
-             * _NOT_ taking the lock for subsequent reads --
+             * Subsequent reads --
              *
              * All syslog index values use the local snapshots that were taken earlier.
              * (The shared memory index values are not referenced on subsequent reads)
@@ -526,9 +582,8 @@ int32 CFE_ES_SysLogDump(const char *Filename)
              * probably will not overwrite the data about to be read here.
              *
              * There is still a possibility of a "flood" of syslogs coming in which would
-             * potentially overwrite unread data and cause message loss/corruption.  However
-             * taking a lock here will not alleviate that situation - this means that the
-             * buffer simply isn't big enough.
+             * potentially overwrite unread data and cause message loss/corruption.  This
+             * means that the buffer simply isn't big enough.
              */
             CFE_ES_SysLogReadData(&Buffer.LogData);
         }
@@ -733,7 +733,7 @@ int32 CFE_ES_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
     CFE_ES_Global.TaskData.HkPacket.Payload.CommandErrorCounter = CFE_ES_Global.TaskData.CommandErrorCounter;
 
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogBytesUsed =
-        CFE_ES_MEMOFFSET_C(CFE_ES_Global.ResetDataPtr->SystemLogEndIdx);
+        CFE_ES_MEMOFFSET_C(CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogState));
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogSize    = CFE_ES_MEMOFFSET_C(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogEntries = CFE_ES_Global.ResetDataPtr->SystemLogEntryNum;
     CFE_ES_Global.TaskData.HkPacket.Payload.SysLogMode    = CFE_ES_Global.ResetDataPtr->SystemLogMode;
@@ -1542,9 +1542,7 @@ int32 CFE_ES_ClearSysLogCmd(const CFE_ES_ClearSysLogCmd_t *data)
     ** Clear syslog index and memory area
     */
 
-    CFE_ES_LockSharedData(__func__, __LINE__);
-    CFE_ES_SysLogClear_Unsync();
-    CFE_ES_UnlockSharedData(__func__, __LINE__);
+    CFE_ES_SysLogClear();
 
     /*
     ** This command will always succeed...
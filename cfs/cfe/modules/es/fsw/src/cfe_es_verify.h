@@ -55,6 +55,10 @@
 #error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be less than 512 Bytes!
 #endif
 
+#if CFE_PLATFORM_ES_SYSTEM_LOG_SIZE > 65535
+#error CFE_PLATFORM_ES_SYSTEM_LOG_SIZE cannot be greater than 65535 Bytes!
+#endif
+
 #if CFE_PLATFORM_ES_DEFAULT_STACK_SIZE < 2048
 #error CFE_PLATFORM_ES_DEFAULT_STACK_SIZE cannot be less than 2048 Bytes!
 #endif
@@ -318,6 +322,18 @@
 #error CFE_PLATFORM_ES_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_ES_STARTUP_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_WORKERS cannot be less than 0
+#elif CFE_PLATFORM_ES_STARTUP_WORKERS > 8
+#error CFE_PLATFORM_ES_STARTUP_WORKERS cannot be greater than 8
+#endif
+
+#if CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY < 0
+#error CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY cannot be less than 0
+#elif CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY > 0xFFFF
+#error CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY cannot be greater than 0xFFFF
+#endif
+
 #if ((CFE_MISSION_MAX_API_LEN % 4) != 0)
 #error CFE_MISSION_MAX_API_LEN must be a multiple of 4
 #endif
@@ -1107,6 +1107,89 @@ void TestApps(void)
     UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     UtAssert_NONZERO(UT_PrintfIsInHistory(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]));
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumEntries, 4);
+    UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumDone, 4);
+
+    /* Test scheduling startup script entries with phase and dependency annotations */
+    ES_ResetUnitTest();
+    {
+        const char *LibTokens[]   = {"CFE_LIB", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "1"};
+        const char *App1Tokens[]  = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0",
+                                    "1"};
+        const char *App2Tokens[]  = {"CFE_APP", "/cf/apps/sch.bundle", "SCH_TaskMain", "SCH_APP", "120", "4096",
+                                    "0x0", "1", "1"};
+        const char *App3Tokens[]  = {"CFE_APP", "/cf/apps/to.bundle", "TO_task_main", "TO_APP", "74", "4096", "0x0",
+                                    "1", "0", "CI_APP|SCH_APP|NONE"};
+        const char *TooManyTokens[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE + 1];
+
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(LibTokens, 8), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App1Tokens, 8), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App2Tokens, 9), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App3Tokens, 10), CFE_SUCCESS);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumEntries, 4);
+        UtAssert_NONZERO(CFE_ES_Global.StartupScript.Entries[0].IsLibrary);
+        UtAssert_NONZERO(CFE_ES_Global.StartupScript.Entries[1].ImplicitLibDeps);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[2].Phase, 1);
+
+        /* Unknown dependency is dropped, and the phase is raised to that of its dependencies */
+        UtAssert_ZERO(CFE_ES_Global.StartupScript.Entries[3].ImplicitLibDeps);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[3].NumDeps, 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[3].Deps[0], 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[3].Deps[1], 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[3].Phase, 1);
+
+        /* Loader tasks never run under unit test, so the calling task must load everything itself */
+        CFE_ES_StartupScriptRun(2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumDone, 4);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumRunning, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumWorkers, 2);
+        UtAssert_NONZERO(CFE_ES_Global.StartupScript.ShutdownFlag);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.Entries[3].State, CFE_ES_STARTSCRIPT_ENTRY_DONE);
+
+        /* Test falling back to sequential loading if the loader semaphores cannot be created */
+        ES_ResetUnitTest();
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(LibTokens, 8), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App1Tokens, 8), CFE_SUCCESS);
+        UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+        CFE_ES_StartupScriptRun(4);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumDone, 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumWorkers, 0);
+        UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+
+        /* Test a loader task creation failure */
+        ES_ResetUnitTest();
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App1Tokens, 8), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App2Tokens, 8), CFE_SUCCESS);
+        UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+        CFE_ES_StartupScriptRun(1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumDone, 2);
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumWorkers, 0);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 2);
+
+        /* Test the loader task, which exits when told to shut down */
+        ES_ResetUnitTest();
+        OS_CountSemCreate(&CFE_ES_Global.StartupScript.WorkSem, "UT", 0, 0);
+        OS_CountSemCreate(&CFE_ES_Global.StartupScript.DoneSem, "UT", 0, 0);
+        CFE_ES_Global.StartupScript.NumWorkers   = 1;
+        CFE_ES_Global.StartupScript.ShutdownFlag = true;
+        CFE_ES_StartupWorkerMain();
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupScript.NumWorkers, 0);
+        UtAssert_STUB_COUNT(OS_CountSemDelete, 2);
+        UtAssert_STUB_COUNT(OS_TaskExit, 1);
+
+        /* Test adding invalid entries */
+        ES_ResetUnitTest();
+        memset(TooManyTokens, 0, sizeof(TooManyTokens));
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(TooManyTokens, 0), CFE_ES_BAD_ARGUMENT);
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(TooManyTokens, CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE + 1),
+                          CFE_ES_BAD_ARGUMENT);
+        CFE_ES_Global.StartupScript.NumEntries = CFE_ES_STARTSCRIPT_MAX_ENTRIES;
+        UtAssert_INT32_EQ(CFE_ES_StartupScriptAddEntry(App1Tokens, 8), CFE_ES_NO_RESOURCE_IDS_AVAILABLE);
+        CFE_ES_Global.StartupScript.NumEntries = 0;
+    }
 
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
@@ -1611,6 +1694,19 @@ void TestApps(void)
                   "CFE application; restart application on exception");
     }
 
+    /* Test parsing the startup script for a cFE application with a CPU affinity mask */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "0",       "",                        "",             "0x12345"};
+        UtAssert_INT32_EQ(CFE_ES_ParseFileEntry(TokenList, 11), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_ES_GetAppIDByName(&AppId, "TST_LIB"), CFE_SUCCESS);
+        UtAppRecPtr = CFE_ES_LocateAppRecordByID(AppId);
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.MainTaskInfo.CpuAffinityMask, 0x2345);
+        UtTaskRecPtr = CFE_ES_LocateTaskRecordByID(UtAppRecPtr->MainTaskId);
+        UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuAffinityMask, 0x2345);
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -2194,6 +2290,7 @@ void TestTask(void)
     CFE_ES_CDS_RegRec_t *   UtCDSRegRecPtr;
     CFE_ES_MemPoolRecord_t *UtPoolRecPtr;
     CFE_SB_MsgId_t          MsgId = CFE_SB_INVALID_MSG_ID;
+    int                     LogLen;
 
     UtPrintf("Begin Test Task");
 
@@ -2202,8 +2299,7 @@ void TestTask(void)
      * depending on the value that the index has reached from previous tests
      */
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
+    CFE_ES_Global.ResetDataPtr->SystemLogState = CFE_ES_SYSLOG_STATE(0, 0);
 
     /* Test task main process loop with a command pipe error */
     ES_ResetUnitTest();
@@ -2775,11 +2871,10 @@ void TestTask(void)
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
     UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx =
-        snprintf(CFE_ES_Global.ResetDataPtr->SystemLog, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog),
-                 "0000-000-00:00:00.00000 Test Message\n");
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CmdBuf.WriteSysLogCmd.Payload.FileName[0]   = '\0';
+    LogLen = snprintf(CFE_ES_Global.ResetDataPtr->SystemLog, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog),
+                      "0000-000-00:00:00.00000 Test Message\n");
+    CFE_ES_Global.ResetDataPtr->SystemLogState = CFE_ES_SYSLOG_STATE(LogLen, LogLen);
+    CmdBuf.WriteSysLogCmd.Payload.FileName[0]  = '\0';
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.WriteSysLogCmd), UT_TPID_CFE_ES_CMD_WRITE_SYSLOG_CC);
     UT_Report(__FILE__, __LINE__, UT_EventIsInHistory(CFE_ES_FILEWRITE_ERR_EID), "CFE_ES_WriteSysLogCmd",
               "Write system log; OS write");
@@ -3656,6 +3751,7 @@ void TestAPI(void)
 {
     osal_id_t            TestObjId;
     char                 AppName[OS_MAX_API_NAME + 12];
+    char                 TaskName[OS_MAX_API_NAME + 12];
     uint32               StackBuf[8];
     int32                Return;
     uint8                Data[12];
@@ -3665,6 +3761,7 @@ void TestAPI(void)
     CFE_ES_TaskId_t      TaskId;
     uint32               RunStatus;
     CFE_ES_TaskInfo_t    TaskInfo;
+    OS_task_prop_t       TaskProp;
     CFE_ES_AppInfo_t     AppInfo;
     CFE_ES_AppRecord_t * UtAppRecPtr;
     CFE_ES_TaskRecord_t *UtTaskRecPtr;
@@ -3857,6 +3954,43 @@ void TestAPI(void)
     AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
     UT_Report(__FILE__, __LINE__, CFE_ES_GetAppName(AppName, AppId, sizeof(AppName)) == CFE_SUCCESS,
               "CFE_ES_GetAppName", "Get application name by ID successful");
+    UtAssert_StrCmp(AppName, "UT", "CFE_ES_GetAppName() name");
+
+    /* The name lookup must not take the ES shared data lock */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* The name lookup must not return a stale name after the entry is freed */
+    CFE_ES_AppRecordSetFree(UtAppRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetAppName(AppName, AppId, sizeof(AppName)), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_StrCmp(AppName, "", "CFE_ES_GetAppName() name after free");
+
+    /* Test getting the app and task names using the task ID */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, "UT", &UtAppRecPtr, &UtTaskRecPtr);
+    ES_UT_SetupChildTaskId(UtAppRecPtr, "UTChild", &UtTaskRecPtr);
+    TaskId = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(NULL, TaskName, TaskId, sizeof(TaskName)), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, NULL, TaskId, sizeof(TaskName)), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, TaskName, TaskId, 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, TaskName, TaskId, sizeof(TaskName)), CFE_SUCCESS);
+    UtAssert_StrCmp(AppName, "UT", "CFE_ES_GetAppAndTaskName() app name");
+    UtAssert_StrCmp(TaskName, "UTChild", "CFE_ES_GetAppAndTaskName() task name");
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Test getting the names of a task whose parent app is gone */
+    CFE_ES_AppRecordSetFree(UtAppRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, TaskName, TaskId, sizeof(TaskName)),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_StrCmp(AppName, "", "CFE_ES_GetAppAndTaskName() app name of deleted app");
+
+    /* Test getting the names with a bad task ID */
+    CFE_ES_TaskRecordSetFree(UtTaskRecPtr);
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, TaskName, TaskId, sizeof(TaskName)),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_StrCmp(AppName, "", "CFE_ES_GetAppAndTaskName() app name of bad task");
+    UtAssert_StrCmp(TaskName, "", "CFE_ES_GetAppAndTaskName() task name of bad task");
+    UtAssert_INT32_EQ(CFE_ES_GetAppAndTaskName(AppName, TaskName, CFE_ES_TASKID_UNDEFINED, sizeof(TaskName)),
+                      CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
     /* Test getting task information using the task ID - NULL buffer */
     ES_ResetUnitTest();
@@ -3877,6 +4011,30 @@ void TestAPI(void)
     UtAppRecPtr->AppState = CFE_ES_AppState_RUNNING;
     UT_Report(__FILE__, __LINE__, CFE_ES_GetTaskInfo(&TaskInfo, TaskId) == CFE_SUCCESS, "CFE_ES_GetTaskInfo",
               "Get task info by ID successful");
+    UtAssert_UINT32_EQ(TaskInfo.LastCpu, CFE_ES_TASK_CPU_UNKNOWN);
+
+    /* Test getting task information including the CPU reported by the OS */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    TaskId                                    = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UtTaskRecPtr->StartParams.CpuAffinityMask = 0x1;
+    memset(&TaskProp, 0, sizeof(TaskProp));
+    TaskProp.cpu_mask = 0x6;
+    TaskProp.last_cpu = 2;
+    UT_SetDataBuffer(UT_KEY(OS_TaskGetInfo), &TaskProp, sizeof(TaskProp), false);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskInfo(&TaskInfo, TaskId), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(TaskInfo.CpuAffinityMask, 0x6);
+    UtAssert_UINT32_EQ(TaskInfo.LastCpu, 2);
+
+    /* Test getting task information when the OS cannot report the CPU */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
+    TaskId                                    = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UtTaskRecPtr->StartParams.CpuAffinityMask = 0x1;
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetInfo), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GetTaskInfo(&TaskInfo, TaskId), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(TaskInfo.CpuAffinityMask, 0x1);
+    UtAssert_UINT32_EQ(TaskInfo.LastCpu, CFE_ES_TASK_CPU_UNKNOWN);
 
     /* Test getting task information using the task ID with parent inactive */
     ES_ResetUnitTest();
@@ -3950,6 +4108,25 @@ void TestAPI(void)
     Return = CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0);
     UT_Report(__FILE__, __LINE__, Return == CFE_SUCCESS, "CFE_ES_CreateChildTask", "Create child task successful");
 
+    /* Test that a child task inherits the CPU affinity of the main task */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->StartParams.MainTaskInfo.CpuAffinityMask = 0x4;
+    UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0),
+                      CFE_SUCCESS);
+    UtTaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuAffinityMask, 0x4);
+
+    /* Test creating a child task with its own CPU affinity */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->StartParams.MainTaskInfo.CpuAffinityMask = 0x4;
+    UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400,
+                                             CFE_ES_TASK_CPU_AFFINITY(0x3)),
+                      CFE_SUCCESS);
+    UtTaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuAffinityMask, 0x3);
+
     /* Test common entry point */
     ES_ResetUnitTest();
 
@@ -4043,16 +4220,16 @@ void TestAPI(void)
      * must be truncated
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_DISCARD;
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4,
+                            CFE_PLATFORM_ES_SYSTEM_LOG_SIZE - CFE_TIME_PRINTED_STRING_SIZE - 4);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
     UT_Report(__FILE__, __LINE__,
-              CFE_ES_SysLogWrite_Unsync("SysLogText This message should be truncated") == CFE_ES_ERR_SYS_LOG_TRUNCATED,
-              "CFE_ES_SysLogWrite_Internal", "Add message to log that must be truncated");
+              CFE_ES_SysLogWrite("SysLogText This message should be truncated") == CFE_ES_ERR_SYS_LOG_TRUNCATED,
+              "CFE_ES_SysLogWrite", "Add message to log that must be truncated");
 
     /* Reset the system log index to prevent an overflow in later tests */
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = 0;
+    CFE_ES_Global.ResetDataPtr->SystemLogState = CFE_ES_SYSLOG_STATE(0, 0);
 
     /* Test calculating a CRC on a range of memory using CRC type 8
      * NOTE: This capability is not currently implemented in cFE
@@ -4148,9 +4325,9 @@ void TestAPI(void)
      * causes the log index to be reset
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_DISCARD;
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_DISCARD;
     UT_Report(__FILE__, __LINE__, CFE_ES_WriteToSysLog("SysLogText") == CFE_ES_ERR_SYS_LOG_FULL, "CFE_ES_WriteToSysLog",
               "Add message to log that resets the log index");
 
@@ -4158,12 +4335,15 @@ void TestAPI(void)
      * causes the log index to be reset
      */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = CFE_PLATFORM_ES_SYSTEM_LOG_SIZE;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx;
-    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_OVERWRITE;
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode = CFE_ES_LogMode_OVERWRITE;
     UT_Report(__FILE__, __LINE__,
               CFE_ES_WriteToSysLog("SysLogText") == CFE_SUCCESS &&
-                  CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx < CFE_PLATFORM_ES_SYSTEM_LOG_SIZE,
+                  CFE_ES_SYSLOG_STATE_WRITEIDX(CFE_ES_Global.ResetDataPtr->SystemLogState) <
+                      CFE_PLATFORM_ES_SYSTEM_LOG_SIZE &&
+                  CFE_ES_SYSLOG_STATE_ENDIDX(CFE_ES_Global.ResetDataPtr->SystemLogState) ==
+                      CFE_PLATFORM_ES_SYSTEM_LOG_SIZE,
               "CFE_ES_WriteToSysLog", "Add message to log that resets the log index");
 
     /* Test run loop with an application error status */
@@ -4474,6 +4654,12 @@ void TestCDS()
     UT_Report(__FILE__, __LINE__, CFE_ES_RestoreFromCDS(&BlockData, CDSHandle) == CFE_SUCCESS, "CFE_ES_RestoreFromCDS",
               "Restore from CDS successful");
 
+    /* Test partial copies to a CDS */
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, NULL, 0, 1), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, BlockData, 0, 0), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CFE_ES_CDS_BAD_HANDLE, BlockData, 0, 1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_CopyToCDSRange(CDSHandle, &BlockData[2], 2, 2), CFE_SUCCESS);
+
     /* Test CDS registering using a name longer than the maximum allowed */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_RUNNING, "UT", NULL, NULL);
@@ -4703,6 +4889,9 @@ void TestCDSMempool(void)
 {
     CFE_ES_CDS_RegRec_t *UtCdsRegRecPtr;
     int                  Data;
+    uint8                RangeData[1000];
+    uint8                RangeCheck[sizeof(RangeData)];
+    uint32               i;
     CFE_ES_CDSHandle_t   BlockHandle;
     size_t               SavedSize;
     size_t               SavedOffset;
@@ -4824,6 +5013,59 @@ void TestCDSMempool(void)
     UT_Report(__FILE__, __LINE__, CFE_ES_CDSBlockRead(&Data, BlockHandle) == CFE_ES_CDS_BLOCK_CRC_ERR,
               "CFE_ES_CDSBlockRead", "CRC error on content");
     CdsPtr[UtCdsRegRecPtr->BlockOffset] ^= 0x02; /* Fix Bit */
+
+    /* Test CDS block range writes using an invalid memory handle */
+    ES_ResetUnitTest();
+    BlockHandle = CFE_ES_CDSHANDLE_C(CFE_ResourceId_FromInteger(7));
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &Data, 0, sizeof(Data)), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Test CDS block range writes, the CRC must match a full write of the same content */
+    ES_ResetUnitTest();
+    ES_UT_SetupCDSGlobal(ES_UT_CDS_SMALL_TEST_SIZE);
+    ES_UT_SetupSingleCDSRegistry("UT", sizeof(RangeData) + sizeof(CFE_ES_CDS_BlockHeader_t), false, &UtCdsRegRecPtr);
+    BlockHandle = CFE_ES_CDSBlockRecordGetID(UtCdsRegRecPtr);
+    for (i = 0; i < sizeof(RangeData); ++i)
+    {
+        RangeData[i] = (uint8)(i * 7);
+    }
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWrite(BlockHandle, RangeData), CFE_SUCCESS);
+
+    /* A range spanning several read back chunks, a single byte, and the last byte */
+    memset(&RangeData[10], 0xA5, 600);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[10], 10, 600), CFE_SUCCESS);
+    RangeData[700] = 0x5A;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[700], 700, 1), CFE_SUCCESS);
+    RangeData[sizeof(RangeData) - 1] ^= 0xFF;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, &RangeData[sizeof(RangeData) - 1],
+                                                sizeof(RangeData) - 1, 1),
+                      CFE_SUCCESS);
+
+    memset(RangeCheck, 0, sizeof(RangeCheck));
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(RangeCheck, BlockHandle), CFE_SUCCESS);
+    UtAssert_MemCmp(RangeCheck, RangeData, sizeof(RangeData), "Range writes restored");
+
+    /* Ranges outside of the user data */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, sizeof(RangeData), 1), CFE_ES_CDS_INVALID_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 1, sizeof(RangeData)), CFE_ES_CDS_INVALID_SIZE);
+
+    /* Corrupt/change the block size, should trigger invalid size error */
+    --UtCdsRegRecPtr->BlockSize;
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_INVALID_SIZE);
+    ++UtCdsRegRecPtr->BlockSize;
+
+    /* Read errors on the descriptor, the header, and the old content */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 3, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), OS_ERROR);
+
+    /* Write errors on the header and the new content */
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), CFE_ES_CDS_ACCESS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_WriteToCDS), 2, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockWriteRange(BlockHandle, RangeData, 0, 1), OS_ERROR);
 }
 
 void TestESMempool(void)
@@ -5248,36 +5490,82 @@ void TestSysLog(void)
 
     UtPrintf("Begin Test Sys Log");
 
-    /* Test loop in CFE_ES_SysLogReadStart_Unsync that ensures
+    /* Test loop in CFE_ES_SysLogReadStart that ensures
      * reading at the start of a message */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1;
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(0, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
 
-    memset(CFE_ES_Global.ResetDataPtr->SystemLog, 'a', CFE_ES_Global.ResetDataPtr->SystemLogEndIdx);
-    CFE_ES_Global.ResetDataPtr->SystemLog[CFE_ES_Global.ResetDataPtr->SystemLogEndIdx - 1] = '\n';
+    memset(CFE_ES_Global.ResetDataPtr->SystemLog, 'a', sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
+    CFE_ES_Global.ResetDataPtr->SystemLog[sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 2] = '\n';
 
-    CFE_ES_SysLogReadStart_Unsync(&SysLogBuffer);
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
 
     UT_Report(__FILE__, __LINE__,
               SysLogBuffer.EndIdx == sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1 &&
                   SysLogBuffer.LastOffset == sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1 &&
                   SysLogBuffer.BlockSize == 0 && SysLogBuffer.SizeLeft == 0,
-              "CFE_ES_SysLogReadStart_Unsync(SysLogBuffer)", "ResetDataPtr pointing to an old fragment of a message");
+              "CFE_ES_SysLogReadStart(SysLogBuffer)", "ResetDataPtr pointing to an old fragment of a message");
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* Test snapshot retries while a writer is between reserve and commit */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->SystemLogState = CFE_ES_SYSLOG_STATE(6, 6);
+    memcpy(CFE_ES_Global.ResetDataPtr->SystemLog, "abcde\n", 6);
+    CFE_ES_Global.SysLogPendingWriters = 1;
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    UtAssert_STUB_COUNT(OS_TaskDelay, CFE_ES_SYSLOG_SNAPSHOT_ATTEMPTS - 1);
+    UtAssert_UINT32_EQ(SysLogBuffer.EndIdx, 6);
+    UtAssert_UINT32_EQ(SysLogBuffer.SizeLeft, 6);
+    CFE_ES_Global.SysLogPendingWriters = 0;
+
+    /* Test that appended messages are committed and readable */
+    ES_ResetUnitTest();
+    CFE_ES_SysLogClear();
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("first\n"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("second\n"), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogState, CFE_ES_SYSLOG_STATE(13, 13));
+    UtAssert_UINT32_EQ(CFE_ES_Global.SysLogPendingWriters, 0);
+    CFE_ES_SysLogReadStart(&SysLogBuffer);
+    CFE_ES_SysLogReadData(&SysLogBuffer);
+    UtAssert_UINT32_EQ(SysLogBuffer.BlockSize, 13);
+    UtAssert_MemCmp(SysLogBuffer.Data, "first\nsecond\n", 13, "SysLog content");
+
+    /* Test that an overwrite wrap never waits for, or is dropped because of, a pending writer */
+    ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE);
+    CFE_ES_Global.ResetDataPtr->SystemLogMode     = CFE_ES_LogMode_OVERWRITE;
+    CFE_ES_Global.ResetDataPtr->SystemLogEntryNum = 0;
+    CFE_ES_Global.SysLogPendingWriters            = 1;
+    UtAssert_INT32_EQ(CFE_ES_SysLogAppend("wrap\n"), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SysLogPendingWriters, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogState,
+                       CFE_ES_SYSLOG_STATE(5, CFE_PLATFORM_ES_SYSTEM_LOG_SIZE));
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 1);
+    UtAssert_MemCmp(CFE_ES_Global.ResetDataPtr->SystemLog, "wrap\n", 5, "Wrapped SysLog content");
+    CFE_ES_Global.SysLogPendingWriters = 0;
+
+    /* Test that clearing the log resets the indices and count */
+    CFE_ES_SysLogClear();
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogState, CFE_ES_SYSLOG_STATE(0, 0));
+    UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->SystemLogEntryNum, 0);
 
     /* Test truncation of a sys log message that is over half
      * the size of the total log */
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[(CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1] = '\0';
-    UT_Report(__FILE__, __LINE__, CFE_ES_SysLogAppend_Unsync(LogString) == CFE_ES_ERR_SYS_LOG_TRUNCATED,
-              "CFE_ES_SysLogAppend_Unsync", "Truncated sys log message");
+    UT_Report(__FILE__, __LINE__, CFE_ES_SysLogAppend(LogString) == CFE_ES_ERR_SYS_LOG_TRUNCATED,
+              "CFE_ES_SysLogAppend", "Truncated sys log message");
 
     /* Test code that skips writing an empty string to the sys log */
     ES_ResetUnitTest();
     memset(LogString, 'a', (CFE_PLATFORM_ES_SYSTEM_LOG_SIZE / 2) + 1);
     LogString[0] = '\0';
-    UT_Report(__FILE__, __LINE__, CFE_ES_SysLogAppend_Unsync(LogString) == CFE_SUCCESS, "CFE_ES_SysLogAppend_Unsync",
+    UT_Report(__FILE__, __LINE__, CFE_ES_SysLogAppend(LogString) == CFE_SUCCESS, "CFE_ES_SysLogAppend",
               "Don't log an empty string");
 
     /* Test Reading space between the current read offset and end of the log buffer */
@@ -5297,8 +5585,8 @@ void TestSysLog(void)
     /* Test nominal flow through CFE_ES_SysLogDump
      * with multiple reads and writes  */
     ES_ResetUnitTest();
-    CFE_ES_Global.ResetDataPtr->SystemLogWriteIdx = 0;
-    CFE_ES_Global.ResetDataPtr->SystemLogEndIdx   = sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1;
+    CFE_ES_Global.ResetDataPtr->SystemLogState =
+        CFE_ES_SYSLOG_STATE(0, sizeof(CFE_ES_Global.ResetDataPtr->SystemLog) - 1);
 
     CFE_ES_SysLogDump("fakefilename");
 
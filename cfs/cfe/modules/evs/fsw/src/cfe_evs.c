@@ -75,6 +75,9 @@ int32 CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 Filte
             AppDataPtr->ActiveFlag           = true;
             AppDataPtr->EventTypesActiveFlag = CFE_PLATFORM_EVS_DEFAULT_TYPE_FLAG;
 
+            /* Cache the app name, so it need not be looked up for every event */
+            CFE_ES_GetAppName(AppDataPtr->AppName, AppID, sizeof(AppDataPtr->AppName));
+
             /* Set limit for number of provided filters */
             if (NumEventFilters < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS)
             {
@@ -82,6 +82,23 @@ int32 CFE_EVS_EarlyInit(void)
     CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort        = CFE_PLATFORM_EVS_PORT_DEFAULT;
     CFE_EVS_Global.EVS_TlmPkt.Payload.LogMode           = CFE_PLATFORM_EVS_DEFAULT_LOG_MODE;
 
+    /* Build event message headers once, applied on every event */
+    Status = CFE_MSG_InitTemplate(&CFE_EVS_Global.LongEventTemplate, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                                  sizeof(CFE_EVS_LongEventTlm_t), NULL);
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_MSG_InitTemplate(&CFE_EVS_Global.ShortEventTemplate,
+                                      CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
+                                      sizeof(CFE_EVS_ShortEventTlm_t), NULL);
+    }
+
+    /* Events cannot be sent without their headers */
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("EVS call to CFE_MSG_InitTemplate failed, RC=0x%08x\n", (unsigned int)Status);
+        return Status;
+    }
+
     /* Get a pointer to the CFE reset area from the BSP */
     Status = CFE_PSP_GetResetArea(&resetAreaAddr, &resetAreaSize);
 
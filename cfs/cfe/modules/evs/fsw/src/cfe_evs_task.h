@@ -49,6 +49,7 @@
 #include "cfe_evs_api_typedefs.h"
 #include "cfe_evs_log_typedef.h"
 #include "cfe_sb_api_typedefs.h"
+#include "cfe_msg.h"
 #include "cfe_evs_events.h"
 
 /*********************  Macro and Constant Type Definitions   ***************************/
@@ -86,6 +87,8 @@ typedef struct
     CFE_ES_AppId_t AppID;
     CFE_ES_AppId_t UnregAppID;
 
+    char AppName[OS_MAX_API_NAME]; /* Application name, cached at registration */
+
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
 
     uint8  ActiveFlag;           /* Application event service active flag */
@@ -116,6 +119,8 @@ typedef struct
     ** EVS task data
     */
     CFE_EVS_HousekeepingTlm_t EVS_TlmPkt;
+    CFE_MSG_Template_t        LongEventTemplate;  /* Pre-built long format event header */
+    CFE_MSG_Template_t        ShortEventTemplate; /* Pre-built short format event header */
     CFE_SB_PipeId_t           EVS_CommandPipe;
     osal_id_t                 EVS_SharedDataMutexID;
     CFE_ES_AppId_t            EVS_AppID;
@@ -383,8 +383,9 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
     int                     ExpandedLength;
 
-    /* Initialize EVS event packets */
-    CFE_MSG_Init(&LongEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID), sizeof(LongEventTlm));
+    /* Initialize EVS event packets from the pre-built header, payload is zeroed separately */
+    CFE_MSG_ApplyTemplate(&LongEventTlm.TlmHeader.Msg, &CFE_EVS_Global.LongEventTemplate, TimeStamp);
+    memset(&LongEventTlm.Payload, 0, sizeof(LongEventTlm.Payload));
     LongEventTlm.Payload.PacketID.EventID   = EventID;
     LongEventTlm.Payload.PacketID.EventType = EventType;
 
@@ -404,15 +405,21 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
 
-    /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
+    /* Obtain task and system information, using the app name cached at registration if available */
+    if (AppDataPtr->AppName[0] != 0)
+    {
+        strncpy((char *)LongEventTlm.Payload.PacketID.AppName, AppDataPtr->AppName,
+                sizeof(LongEventTlm.Payload.PacketID.AppName) - 1);
+        LongEventTlm.Payload.PacketID.AppName[sizeof(LongEventTlm.Payload.PacketID.AppName) - 1] = '\0';
+    }
+    else
+    {
+        CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
+                          sizeof(LongEventTlm.Payload.PacketID.AppName));
+    }
     LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
     LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
-    /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(&LongEventTlm.TlmHeader.Msg, *TimeStamp);
-
     /* Write event to the event log */
     EVS_AddLog(&LongEventTlm);
 
@@ -432,9 +439,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
          *
          * This goes out on a separate message ID.
          */
-        CFE_MSG_Init(&ShortEventTlm.TlmHeader.Msg, CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
-                     sizeof(ShortEventTlm));
-        CFE_MSG_SetMsgTime(&ShortEventTlm.TlmHeader.Msg, *TimeStamp);
+        CFE_MSG_ApplyTemplate(&ShortEventTlm.TlmHeader.Msg, &CFE_EVS_Global.ShortEventTemplate, TimeStamp);
         ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
         CFE_SB_TransmitMsg(&ShortEventTlm.TlmHeader.Msg, true);
     }
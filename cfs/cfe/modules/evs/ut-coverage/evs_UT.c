@@ -55,7 +55,8 @@ static const char *EVS_SYSLOG_MSGS[] = {
     "EVS:Call to CFE_EVS_Register Failed:RC=0x%08X\n",
     "EVS:Call to CFE_SB_CreatePipe Failed:RC=0x%08X\n",
     "EVS:Subscribing to Cmds Failed:RC=0x%08X\n",
-    "EVS:Subscribing to HK Request Failed:RC=0x%08X\n"};
+    "EVS:Subscribing to HK Request Failed:RC=0x%08X\n",
+    "EVS call to CFE_MSG_InitTemplate failed, RC=0x%08x\n"};
 
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_EVS_CMD_NOOP_CC = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_CMD_MID),
                                                                     .CommandCode = CFE_EVS_NOOP_CC};
@@ -122,22 +123,21 @@ typedef struct
 
 static UT_EVS_EventCapture_t UT_EVS_EventBuf;
 
-/* MSG Init hook data */
+/* MSG ApplyTemplate hook data */
 typedef struct
 {
-    CFE_MSG_Message_t *MsgPtr;
-    CFE_SB_MsgId_t     MsgId;
-    CFE_MSG_Size_t     Size;
-} UT_EVS_MSGInitData_t;
+    CFE_MSG_Message_t *       MsgPtr;
+    const CFE_MSG_Template_t *TemplatePtr;
+} UT_EVS_MSGApplyTemplateData_t;
 
-/* Message init hook to stora last MsgId passed in */
-static int32 UT_EVS_MSGInitHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+/* Message template hook to store last message and template passed in */
+static int32 UT_EVS_MSGApplyTemplateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                         const UT_StubContext_t *Context)
 {
-    UT_EVS_MSGInitData_t *msgdataptr = UserObj;
+    UT_EVS_MSGApplyTemplateData_t *msgdataptr = UserObj;
 
-    msgdataptr->MsgPtr = UT_Hook_GetArgValueByName(Context, "MsgPtr", CFE_MSG_Message_t *);
-    msgdataptr->MsgId  = UT_Hook_GetArgValueByName(Context, "MsgId", CFE_SB_MsgId_t);
-    msgdataptr->Size   = UT_Hook_GetArgValueByName(Context, "Size", CFE_MSG_Size_t);
+    msgdataptr->MsgPtr      = UT_Hook_GetArgValueByName(Context, "MsgPtr", CFE_MSG_Message_t *);
+    msgdataptr->TemplatePtr = UT_Hook_GetArgValueByName(Context, "TemplatePtr", const CFE_MSG_Template_t *);
 
     return StubRetcode;
 }
@@ -299,6 +299,21 @@ void Test_Init(void)
     UT_Report(__FILE__, __LINE__, UT_SyslogIsInHistory(EVS_SYSLOG_MSGS[3]), "CFE_EVS_EarlyInit",
               "Mutex create failure");
 
+    /* Test early initialization with an event template failure, long then short */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_InitTemplate), 1, CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_EVS_EarlyInit(), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_TRUE(UT_SyslogIsInHistory(EVS_SYSLOG_MSGS[15]));
+
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_InitTemplate), 2, CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_EVS_EarlyInit(), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_TRUE(UT_SyslogIsInHistory(EVS_SYSLOG_MSGS[15]));
+
+    /* Restore a successfully initialized EVS for the remaining tests */
+    UT_InitData();
+    CFE_EVS_EarlyInit();
+
     /* Test early initialization with an unexpected size returned
      * by CFE_PSP_GetResetArea
      */
@@ -679,15 +694,12 @@ void Test_Format(void)
                                                           .SnapshotOffset =
                                                               offsetof(CFE_EVS_LongEventTlm_t, Payload.PacketID),
                                                           .SnapshotSize = sizeof(CapturedMsg)};
-    UT_SoftwareBusSnapshot_Entry_t  ShortFmtSnapshotData = {
-        .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_SHORT_EVENT_MSG_MID),
-        .SnapshotBuffer = &CapturedMsg,
-        .SnapshotOffset = offsetof(CFE_EVS_ShortEventTlm_t, Payload.PacketID),
-        .SnapshotSize   = sizeof(CapturedMsg)};
-    EVS_AppData_t *      AppDataPtr;
-    CFE_ES_AppId_t       AppID;
-    UT_EVS_MSGInitData_t MsgData;
-    CFE_MSG_Message_t *  MsgSend;
+    EVS_AppData_t *               AppDataPtr;
+    EVS_AppData_t                 SavedAppData;
+    char                          AppName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t                AppID;
+    UT_EVS_MSGApplyTemplateData_t MsgData;
+    CFE_MSG_Message_t *           MsgSend;
 
     /* Get a local ref to the "current" AppData table entry */
     EVS_GetCurrentContext(&AppDataPtr, &AppID);
@@ -727,15 +739,15 @@ void Test_Format(void)
 
     UtPrintf("Test for short event sent when configured to do so ");
     UT_InitData();
-    UT_SetHookFunction(UT_KEY(CFE_MSG_Init), UT_EVS_MSGInitHook, &MsgData);
+    UT_SetHookFunction(UT_KEY(CFE_MSG_ApplyTemplate), UT_EVS_MSGApplyTemplateHook, &MsgData);
     UT_SetDataBuffer(UT_KEY(CFE_SB_TransmitMsg), &MsgSend, sizeof(MsgSend), false);
     CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Short format check 1");
 
     /* Note implementation initializes both short and long message */
-    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_Init)), 2);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_MSG_ApplyTemplate)), 2);
     ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 1);
-    ASSERT_TRUE(CFE_SB_MsgId_Equal(MsgData.MsgId, ShortFmtSnapshotData.MsgId));
-    ASSERT_TRUE(!CFE_SB_MsgId_Equal(MsgData.MsgId, LongFmtSnapshotData.MsgId));
+    ASSERT_TRUE(MsgData.TemplatePtr == &CFE_EVS_Global.ShortEventTemplate);
+    ASSERT_TRUE(MsgData.TemplatePtr != &CFE_EVS_Global.LongEventTemplate);
 
     /* Confirm the right message was sent */
     ASSERT_TRUE(MsgSend == MsgData.MsgPtr);
@@ -766,6 +778,50 @@ void Test_Format(void)
     UT_Report(__FILE__, __LINE__, EventID[0] == 0 && EventID[1] == 0 && CapturedMsg.EventID == 0,
               "CFE_EVS_SetEventFormatModeCmd", "Long event format mode verification");
 
+    /* Test that the event packet's app name comes from the name cached at
+     * registration, and that registering again refreshes it
+     */
+    UT_InitData();
+    SavedAppData = *AppDataPtr;
+    UT_ResetState(UT_KEY(CFE_ES_GetAppName));
+    strncpy(AppName, "CachedName", sizeof(AppName));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppName), AppName, sizeof(AppName), false);
+    ASSERT(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    AppDataPtr->EventTypesActiveFlag |= CFE_EVS_INFORMATION_BIT;
+    UT_ResetState(UT_KEY(CFE_ES_GetAppName));
+    strncpy(AppName, "LookupName", sizeof(AppName));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppName), AppName, sizeof(AppName), false);
+    memset(&CapturedMsg, 0xFF, sizeof(CapturedMsg));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &LongFmtSnapshotData);
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Cached app name check");
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppName)), 0);
+    ASSERT_TRUE(strcmp(CapturedMsg.AppName, "CachedName") == 0);
+
+    UT_InitData();
+    UT_ResetState(UT_KEY(CFE_ES_GetAppName));
+    strncpy(AppName, "RenamedApp", sizeof(AppName));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppName), AppName, sizeof(AppName), false);
+    ASSERT(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    AppDataPtr->EventTypesActiveFlag |= CFE_EVS_INFORMATION_BIT;
+    memset(&CapturedMsg, 0xFF, sizeof(CapturedMsg));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &LongFmtSnapshotData);
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Refreshed app name check");
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppName)), 1);
+    ASSERT_TRUE(strcmp(CapturedMsg.AppName, "RenamedApp") == 0);
+
+    /* Test that an entry without a cached name falls back to the ES lookup */
+    UT_InitData();
+    UT_ResetState(UT_KEY(CFE_ES_GetAppName));
+    strncpy(AppName, "LookupName", sizeof(AppName));
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppName), AppName, sizeof(AppName), false);
+    AppDataPtr->AppName[0] = '\0';
+    memset(&CapturedMsg, 0xFF, sizeof(CapturedMsg));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &LongFmtSnapshotData);
+    CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Uncached app name check");
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppName)), 1);
+    ASSERT_TRUE(strcmp(CapturedMsg.AppName, "LookupName") == 0);
+    *AppDataPtr = SavedAppData;
+
     /* Test sending an event using a string length greater than
      * the maximum allowed
      */
@@ -632,6 +632,123 @@ int32 CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnl
     return (ReturnCode);
 }
 
+/*
+** CFE_FS_TextReaderInit - See API and header file for details
+*/
+int32 CFE_FS_TextReaderInit(CFE_FS_TextReader_t *Reader, osal_id_t FileDes)
+{
+    if (Reader == NULL)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    Reader->FileDes  = FileDes;
+    Reader->Position = 0;
+    Reader->Length   = 0;
+
+    return CFE_SUCCESS;
+}
+
+/*
+** CFE_FS_TextReadChar - See API and header file for details
+*/
+int32 CFE_FS_TextReadChar(CFE_FS_TextReader_t *Reader, char *Char)
+{
+    int32 Status;
+
+    if (Reader == NULL || Char == NULL)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    if (Reader->Position >= Reader->Length)
+    {
+        /*
+        ** Refill the buffer with as much of the file as fits
+        */
+        Status = OS_read(Reader->FileDes, Reader->Buffer, sizeof(Reader->Buffer));
+        if (Status <= 0)
+        {
+            return Status;
+        }
+
+        Reader->Position = 0;
+        Reader->Length   = Status;
+    }
+
+    *Char = Reader->Buffer[Reader->Position];
+    ++Reader->Position;
+
+    return 1;
+}
+
+/*
+** CFE_FS_TextReadLine - See API and header file for details
+*/
+int32 CFE_FS_TextReadLine(CFE_FS_TextReader_t *Reader, char *LineBuf, size_t LineBufSize)
+{
+    int32  Status;
+    size_t LineLen;
+    size_t CopyLen;
+    char * LineEnd;
+
+    if (Reader == NULL || LineBuf == NULL || LineBufSize == 0)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    LineLen = 0;
+    while (LineLen < (LineBufSize - 1))
+    {
+        if (Reader->Position >= Reader->Length)
+        {
+            Status = OS_read(Reader->FileDes, Reader->Buffer, sizeof(Reader->Buffer));
+            if (Status < 0)
+            {
+                LineBuf[LineLen] = 0;
+                return Status;
+            }
+            if (Status == 0)
+            {
+                /* EOF, return whatever was read of the last line */
+                break;
+            }
+
+            Reader->Position = 0;
+            Reader->Length   = Status;
+        }
+
+        /*
+        ** Copy up to the end of the line, the end of the buffered data,
+        ** or the space left in the caller's buffer, whichever is first
+        */
+        CopyLen = Reader->Length - Reader->Position;
+        if (CopyLen > (LineBufSize - 1 - LineLen))
+        {
+            CopyLen = LineBufSize - 1 - LineLen;
+        }
+
+        LineEnd = memchr(&Reader->Buffer[Reader->Position], '\n', CopyLen);
+        if (LineEnd != NULL)
+        {
+            CopyLen = (LineEnd - &Reader->Buffer[Reader->Position]) + 1;
+        }
+
+        memcpy(&LineBuf[LineLen], &Reader->Buffer[Reader->Position], CopyLen);
+        Reader->Position += CopyLen;
+        LineLen += CopyLen;
+
+        if (LineEnd != NULL)
+        {
+            break;
+        }
+    }
+
+    LineBuf[LineLen] = 0;
+
+    return LineLen;
+}
+
 /*
 ** CFE_FS_RunBackgroundFileDump - See API and header file for details
 */
@@ -82,6 +82,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_ByteSwapUint32);
     UT_ADD_TEST(Test_CFE_FS_ParseInputFileNameEx);
     UT_ADD_TEST(Test_CFE_FS_ExtractFileNameFromPath);
+    UT_ADD_TEST(Test_CFE_FS_TextReader);
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
@@ -492,6 +493,82 @@ void Test_CFE_FS_ExtractFileNameFromPath(void)
               "CFE_FS_ExtractFilenameFromPath", "Null file name");
 }
 
+/*
+** Test FS API buffered text reader functions
+*/
+void Test_CFE_FS_TextReader(void)
+{
+    CFE_FS_TextReader_t Reader;
+    osal_id_t           FileDes = OS_OBJECT_ID_UNDEFINED;
+    char                Text[]  = "line1\nline22\nend";
+    char                LineBuf[8];
+    char                Char;
+
+    UtPrintf("Begin Test Text Reader");
+
+    /* Test with invalid arguments */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_FS_TextReaderInit(NULL, FileDes), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_TextReaderInit(&Reader, FileDes), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(NULL, &Char), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, NULL), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(NULL, LineBuf, sizeof(LineBuf)), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, NULL, sizeof(LineBuf)), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, 0), CFE_FS_BAD_ARGUMENT);
+
+    /* Test reading characters, the whole file is read in one block */
+    UT_InitData();
+    CFE_FS_TextReaderInit(&Reader, FileDes);
+    UT_SetReadBuffer(Text, 3);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, &Char), 1);
+    UtAssert_INT32_EQ(Char, 'l');
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, &Char), 1);
+    UtAssert_INT32_EQ(Char, 'i');
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, &Char), 1);
+    UtAssert_INT32_EQ(Char, 'n');
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, &Char), 0);
+
+    /* Test reading characters with a read error */
+    UT_InitData();
+    CFE_FS_TextReaderInit(&Reader, FileDes);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_FS_TextReadChar(&Reader, &Char), OS_ERROR);
+
+    /* Test reading lines, including a last line without a newline */
+    UT_InitData();
+    CFE_FS_TextReaderInit(&Reader, FileDes);
+    UT_SetReadBuffer(Text, strlen(Text));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, sizeof(LineBuf)), 6);
+    UtAssert_StrCmp(LineBuf, "line1\n", "LineBuf content");
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, sizeof(LineBuf)), 7);
+    UtAssert_StrCmp(LineBuf, "line22\n", "LineBuf content");
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, sizeof(LineBuf)), 3);
+    UtAssert_StrCmp(LineBuf, "end", "LineBuf content");
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, sizeof(LineBuf)), 0);
+    UtAssert_StrCmp(LineBuf, "", "LineBuf content");
+
+    /* Test reading a line longer than the line buffer */
+    UT_InitData();
+    CFE_FS_TextReaderInit(&Reader, FileDes);
+    UT_SetReadBuffer(Text, strlen(Text));
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, 4), 3);
+    UtAssert_StrCmp(LineBuf, "lin", "LineBuf content");
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, 4), 3);
+    UtAssert_StrCmp(LineBuf, "e1\n", "LineBuf content");
+
+    /* Test reading a line with a read error */
+    UT_InitData();
+    CFE_FS_TextReaderInit(&Reader, FileDes);
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_FS_TextReadLine(&Reader, LineBuf, sizeof(LineBuf)), OS_ERROR);
+    UtAssert_StrCmp(LineBuf, "", "LineBuf content");
+}
+
 /*
 ** Tests for FS private functions (cfe_fs_priv.c)
 */
@@ -245,6 +245,25 @@ void Test_CFE_FS_ParseInputFileNameEx(void);
 ******************************************************************************/
 void Test_CFE_FS_ExtractFileNameFromPath(void);
 
+/*****************************************************************************/
+/**
+** \brief Test FS API buffered text reader functions
+**
+** \par Description
+**        This function tests the buffered text reader functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #UT_SetReadBuffer, #CFE_FS_TextReaderInit,
+** \sa #CFE_FS_TextReadChar, #CFE_FS_TextReadLine
+**
+******************************************************************************/
+void Test_CFE_FS_TextReader(void);
+
 /*****************************************************************************/
 /**
 ** \brief Tests for FS private functions (cfe_fs_priv.c)
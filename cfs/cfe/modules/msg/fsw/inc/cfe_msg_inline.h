@@ -0,0 +1,407 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ * Inline message header accessors for the configured header layout
+ *  - Intended for hot paths (e.g. software bus transmit, telemetry output)
+ *    where the message pointer is already known to be valid
+ *  - No argument checking is performed, callers must pass a valid message
+ *  - Layout is selected at compile time from cfe_msg_layout.h, which the
+ *    MSG mission build generates from the same configuration that selects
+ *    the MSG sources (CFE_MSG_HDR_HAS_CCSDSEXT and CFE_MSG_MSGID_V2)
+ *  - Unit tests of code that calls these accessors while stubbing the MSG
+ *    API define CFE_MSG_INLINE_USE_API, which routes the accessors through
+ *    the API getters so the stubs remain in control
+ */
+
+#ifndef CFE_MSG_INLINE_H
+#define CFE_MSG_INLINE_H
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_mission_cfg.h"
+#include "cfe_msg_layout.h"
+#include "cfe_msg_hdr.h"
+#include "cfe_msg_api_typedefs.h"
+#include "cfe_sb.h"
+
+#ifdef CFE_MSG_INLINE_USE_API
+#include "cfe_msg.h"
+#include <string.h>
+#endif
+
+/*
+ * Defines
+ */
+
+/* CCSDS Primary Standard definitions */
+#define CFE_MSG_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
+#define CFE_MSG_CCSDSVER_MASK  0xE000 /**< \brief CCSDS version mask */
+#define CFE_MSG_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
+#define CFE_MSG_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
+#define CFE_MSG_SHDR_MASK      0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
+#define CFE_MSG_APID_MASK      0x07FF /**< \brief CCSDS ApID mask */
+#define CFE_MSG_SEGFLG_MASK    0xC000 /**< \brief CCSDS segmentation flag mask, all set = complete packet */
+#define CFE_MSG_SEGFLG_CNT     0x0000 /**< \brief CCSDS Segment continuation flag */
+#define CFE_MSG_SEGFLG_FIRST   0x4000 /**< \brief CCSDS Segment first flag */
+#define CFE_MSG_SEGFLG_LAST    0x8000 /**< \brief CCSDS Segment last flag */
+#define CFE_MSG_SEGFLG_UNSEG   0xC000 /**< \brief CCSDS Unsegmented flag */
+#define CFE_MSG_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
+
+/* CCSDS Extended definitions */
+#define CFE_MSG_EDSVER_SHIFT  11     /**< \brief CCSDS EDS version shift */
+#define CFE_MSG_EDSVER_MASK   0xF800 /**< \brief CCSDS EDS version mask */
+#define CFE_MSG_ENDIAN_MASK   0x0400 /**< \brief CCSDS endiam mask, little endian when set */
+#define CFE_MSG_PLAYBACK_MASK 0x0200 /**< \brief CCSDS playback flag, playback when set */
+#define CFE_MSG_SUBSYS_MASK   0x01FF /**< \brief CCSDS Subsystem mask */
+
+/* cFS MsgId V2 definitions */
+#define CFE_MSG_MSGID_APID_MASK   0x007F /**< \brief CCSDS ApId mask for MsgId */
+#define CFE_MSG_MSGID_TYPE_MASK   0x0080 /**< \brief Message type mask for MsgId, set = cmd */
+#define CFE_MSG_MSGID_SUBSYS_MASK 0xFF00 /**< \brief Subsystem mask for MsgId */
+
+/* cFS default secondary header definitions */
+#define CFE_MSG_FC_MASK 0x7F /**< \brief Function code mask */
+
+/*
+ * The time accessors implement the default secondary header time layout,
+ * 32 bit seconds and upper 16 bits of subseconds, big endian.  Refuse to
+ * build against a mission configuration with any other time layout.
+ */
+#if (CFE_MISSION_SB_PACKET_TIME_FORMAT != CFE_MISSION_SB_TIME_32_16_SUBS)
+#error Inline MSG time accessors only support the default 32/16 packet time format
+#endif
+CompileTimeAssert(sizeof(((CFE_MSG_TelemetrySecondaryHeader_t *)0)->Time) == 6, CFE_MSG_InlineTimeLayout);
+
+/*****************************************************************************/
+/**
+ * \brief Big endian read of a 16 bit header word (uint8 array[2])
+ *
+ * \param[in] Word Header word to read
+ *
+ * \return Header word value in host order
+ */
+static inline uint16 CFE_MSG_FastGetHeaderWord(const uint8 *Word)
+{
+    return (uint16)((Word[0] << 8) | Word[1]);
+}
+
+#ifndef CFE_MSG_INLINE_USE_API
+
+/*****************************************************************************/
+/**
+ * \brief Get message header version, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Header version
+ */
+static inline CFE_MSG_HeaderVersion_t CFE_MSG_FastGetHeaderVersion(const CFE_MSG_Message_t *MsgPtr)
+{
+    return (CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId) & CFE_MSG_CCSDSVER_MASK) >> CFE_MSG_CCSDSVER_SHIFT;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message type, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Message type, command or telemetry
+ */
+static inline CFE_MSG_Type_t CFE_MSG_FastGetType(const CFE_MSG_Message_t *MsgPtr)
+{
+    return ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_TYPE_MASK >> 8)) != 0) ? CFE_MSG_Type_Cmd : CFE_MSG_Type_Tlm;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message has secondary header flag, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return true if the secondary header flag is set
+ */
+static inline bool CFE_MSG_FastGetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr)
+{
+    return (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_SHDR_MASK >> 8)) != 0;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message application ID, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Application ID
+ */
+static inline CFE_MSG_ApId_t CFE_MSG_FastGetApId(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId) & CFE_MSG_APID_MASK;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message segmentation flag, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Segmentation flag
+ */
+static inline CFE_MSG_SegmentationFlag_t CFE_MSG_FastGetSegmentationFlag(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_SegmentationFlag_t SegFlag;
+
+    switch (CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.Sequence) & CFE_MSG_SEGFLG_MASK)
+    {
+        case CFE_MSG_SEGFLG_CNT:
+            SegFlag = CFE_MSG_SegFlag_Continue;
+            break;
+        case CFE_MSG_SEGFLG_FIRST:
+            SegFlag = CFE_MSG_SegFlag_First;
+            break;
+        case CFE_MSG_SEGFLG_LAST:
+            SegFlag = CFE_MSG_SegFlag_Last;
+            break;
+        case CFE_MSG_SEGFLG_UNSEG:
+        default:
+            SegFlag = CFE_MSG_SegFlag_Unsegmented;
+    }
+
+    return SegFlag;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message sequence count, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Sequence count
+ */
+static inline CFE_MSG_SequenceCount_t CFE_MSG_FastGetSequenceCount(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.Sequence) & CFE_MSG_SEQCNT_MASK;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get total message size, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Total message size
+ */
+static inline CFE_MSG_Size_t CFE_MSG_FastGetSize(const CFE_MSG_Message_t *MsgPtr)
+{
+    return (CFE_MSG_Size_t)CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.Length) + CFE_MSG_SIZE_OFFSET;
+}
+
+#ifdef CFE_MSG_HDR_HAS_CCSDSEXT
+
+/*****************************************************************************/
+/**
+ * \brief Get message EDS version, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return EDS version
+ */
+static inline CFE_MSG_EDSVersion_t CFE_MSG_FastGetEDSVersion(const CFE_MSG_Message_t *MsgPtr)
+{
+    return (CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Ext.Subsystem) & CFE_MSG_EDSVER_MASK) >> CFE_MSG_EDSVER_SHIFT;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message endian, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Endian flag
+ */
+static inline CFE_MSG_Endian_t CFE_MSG_FastGetEndian(const CFE_MSG_Message_t *MsgPtr)
+{
+    return ((MsgPtr->CCSDS.Ext.Subsystem[0] & (CFE_MSG_ENDIAN_MASK >> 8)) != 0) ? CFE_MSG_Endian_Little
+                                                                                 : CFE_MSG_Endian_Big;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message playback flag, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Playback flag
+ */
+static inline CFE_MSG_PlaybackFlag_t CFE_MSG_FastGetPlaybackFlag(const CFE_MSG_Message_t *MsgPtr)
+{
+    return ((MsgPtr->CCSDS.Ext.Subsystem[0] & (CFE_MSG_PLAYBACK_MASK >> 8)) != 0) ? CFE_MSG_PlayFlag_Playback
+                                                                                   : CFE_MSG_PlayFlag_Original;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message subsystem, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Subsystem
+ */
+static inline CFE_MSG_Subsystem_t CFE_MSG_FastGetSubsystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Ext.Subsystem) & CFE_MSG_SUBSYS_MASK;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message system, no argument checking
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return System
+ */
+static inline CFE_MSG_System_t CFE_MSG_FastGetSystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Ext.SystemId);
+}
+
+#endif /* CFE_MSG_HDR_HAS_CCSDSEXT */
+
+/*****************************************************************************/
+/**
+ * \brief Get message id, no argument checking
+ *
+ * \par Description
+ *        MsgId V1 is the CCSDS stream ID.  MsgId V2 is built from the
+ *        low ApId bits, the type bit and the extended header subsystem.
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Message id
+ */
+static inline CFE_SB_MsgId_t CFE_MSG_FastGetMsgId(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_SB_MsgId_Atom_t msgidval;
+
+#ifdef CFE_MSG_MSGID_V2
+    msgidval = MsgPtr->CCSDS.Pri.StreamId[1] & CFE_MSG_MSGID_APID_MASK;
+    if (CFE_MSG_FastGetType(MsgPtr) == CFE_MSG_Type_Cmd)
+    {
+        msgidval |= CFE_MSG_MSGID_TYPE_MASK;
+    }
+    msgidval |= (MsgPtr->CCSDS.Ext.Subsystem[1] << 8) & CFE_MSG_MSGID_SUBSYS_MASK;
+#else
+    msgidval = CFE_MSG_FastGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId);
+#endif
+
+    return CFE_SB_ValueToMsgId(msgidval);
+}
+
+/*****************************************************************************/
+/**
+ * \brief Get message time, no argument checking
+ *
+ * \par Description
+ *        The message must be telemetry with a secondary header.
+ *
+ * \param[in] MsgPtr A pointer to a valid message
+ *
+ * \return Message time
+ */
+static inline CFE_TIME_SysTime_t CFE_MSG_FastGetMsgTime(const CFE_MSG_Message_t *MsgPtr)
+{
+    const CFE_MSG_TelemetryHeader_t *tlm = (const CFE_MSG_TelemetryHeader_t *)MsgPtr;
+    CFE_TIME_SysTime_t               Time;
+
+    Time.Seconds = ((uint32)tlm->Sec.Time[0] << 24) + ((uint32)tlm->Sec.Time[1] << 16) +
+                   ((uint32)tlm->Sec.Time[2] << 8) + tlm->Sec.Time[3];
+    Time.Subseconds = ((uint32)tlm->Sec.Time[4] << 24) + ((uint32)tlm->Sec.Time[5] << 16);
+
+    return Time;
+}
+
+/*****************************************************************************/
+/**
+ * \brief Set message time, no argument checking
+ *
+ * \par Description
+ *        The message must be telemetry with a secondary header.
+ *
+ * \param[in, out] MsgPtr  A pointer to a valid message
+ * \param[in]      NewTime Time to write
+ */
+static inline void CFE_MSG_FastSetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    CFE_MSG_TelemetryHeader_t *tlm = (CFE_MSG_TelemetryHeader_t *)MsgPtr;
+
+    tlm->Sec.Time[0] = (NewTime.Seconds >> 24) & 0xFF;
+    tlm->Sec.Time[1] = (NewTime.Seconds >> 16) & 0xFF;
+    tlm->Sec.Time[2] = (NewTime.Seconds >> 8) & 0xFF;
+    tlm->Sec.Time[3] = NewTime.Seconds & 0xFF;
+    tlm->Sec.Time[4] = (NewTime.Subseconds >> 24) & 0xFF;
+    tlm->Sec.Time[5] = (NewTime.Subseconds >> 16) & 0xFF;
+}
+
+#else /* CFE_MSG_INLINE_USE_API */
+
+/*
+ * Unit test variant, each accessor calls the matching (stubbed) API getter
+ */
+#define CFE_MSG_INLINE_VIA_API(Type, Field)                                    \
+    static inline Type CFE_MSG_FastGet##Field(const CFE_MSG_Message_t *MsgPtr) \
+    {                                                                          \
+        Type Value;                                                            \
+        memset(&Value, 0, sizeof(Value));                                      \
+        CFE_MSG_Get##Field(MsgPtr, &Value);                                    \
+        return Value;                                                          \
+    }
+
+CFE_MSG_INLINE_VIA_API(CFE_MSG_HeaderVersion_t, HeaderVersion)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_Type_t, Type)
+CFE_MSG_INLINE_VIA_API(bool, HasSecondaryHeader)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_ApId_t, ApId)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_SegmentationFlag_t, SegmentationFlag)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_SequenceCount_t, SequenceCount)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_Size_t, Size)
+#ifdef CFE_MSG_HDR_HAS_CCSDSEXT
+CFE_MSG_INLINE_VIA_API(CFE_MSG_EDSVersion_t, EDSVersion)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_Endian_t, Endian)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_PlaybackFlag_t, PlaybackFlag)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_Subsystem_t, Subsystem)
+CFE_MSG_INLINE_VIA_API(CFE_MSG_System_t, System)
+#endif
+CFE_MSG_INLINE_VIA_API(CFE_SB_MsgId_t, MsgId)
+CFE_MSG_INLINE_VIA_API(CFE_TIME_SysTime_t, MsgTime)
+
+static inline void CFE_MSG_FastSetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    CFE_MSG_SetMsgTime(MsgPtr, NewTime);
+}
+
+#undef CFE_MSG_INLINE_VIA_API
+
+#endif /* CFE_MSG_INLINE_USE_API */
+
+#endif /* CFE_MSG_INLINE_H */
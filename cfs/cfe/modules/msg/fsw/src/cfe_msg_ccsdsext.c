@@ -23,17 +23,11 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_msg_defaults.h"
 #include "cfe_error.h"
 #include "cfe_psp.h"
 
-/* CCSDS Extended definitions */
-#define CFE_MSG_EDSVER_SHIFT  11     /**< \brief CCSDS EDS version shift */
-#define CFE_MSG_EDSVER_MASK   0xF800 /**< \brief CCSDS EDS version mask */
-#define CFE_MSG_ENDIAN_MASK   0x0400 /**< \brief CCSDS endiam mask, little endian when set */
-#define CFE_MSG_PLAYBACK_MASK 0x0200 /**< \brief CCSDS playback flag, playback when set */
-#define CFE_MSG_SUBSYS_MASK   0x01FF /**< \brief CCSDS Subsystem mask */
-
 /******************************************************************************
  * CCSDS extended header initialization - See header file for details
  */
@@ -64,8 +58,7 @@ int32 CFE_MSG_GetEDSVersion(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_EDSVersion_
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Ext.Subsystem, Version, CFE_MSG_EDSVER_MASK);
-    *Version >>= CFE_MSG_EDSVER_SHIFT;
+    *Version = CFE_MSG_FastGetEDSVersion(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -96,14 +89,7 @@ int32 CFE_MSG_GetEndian(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Endian_t *Endia
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    if ((MsgPtr->CCSDS.Ext.Subsystem[0] & (CFE_MSG_ENDIAN_MASK >> 8)) != 0)
-    {
-        *Endian = CFE_MSG_Endian_Little;
-    }
-    else
-    {
-        *Endian = CFE_MSG_Endian_Big;
-    }
+    *Endian = CFE_MSG_FastGetEndian(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -147,14 +133,7 @@ int32 CFE_MSG_GetPlaybackFlag(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_PlaybackF
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    if ((MsgPtr->CCSDS.Ext.Subsystem[0] & (CFE_MSG_PLAYBACK_MASK >> 8)) != 0)
-    {
-        *PlayFlag = CFE_MSG_PlayFlag_Playback;
-    }
-    else
-    {
-        *PlayFlag = CFE_MSG_PlayFlag_Original;
-    }
+    *PlayFlag = CFE_MSG_FastGetPlaybackFlag(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -198,7 +177,7 @@ int32 CFE_MSG_GetSubsystem(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Subsystem_t
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Ext.Subsystem, Subsystem, CFE_MSG_SUBSYS_MASK);
+    *Subsystem = CFE_MSG_FastGetSubsystem(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -229,7 +208,7 @@ int32 CFE_MSG_GetSystem(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_System_t *Syste
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    *System = (MsgPtr->CCSDS.Ext.SystemId[0] << 8) + MsgPtr->CCSDS.Ext.SystemId[1];
+    *System = CFE_MSG_FastGetSystem(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -23,23 +23,10 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_msg_defaults.h"
 #include "cfe_error.h"
 
-/* CCSDS Primary Standard definitions */
-#define CFE_MSG_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
-#define CFE_MSG_CCSDSVER_MASK  0xE000 /**< \brief CCSDS version mask */
-#define CFE_MSG_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
-#define CFE_MSG_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
-#define CFE_MSG_SHDR_MASK      0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
-#define CFE_MSG_APID_MASK      0x07FF /**< \brief CCSDS ApID mask */
-#define CFE_MSG_SEGFLG_MASK    0xC000 /**< \brief CCSDS segmentation flag mask, all set = complete packet */
-#define CFE_MSG_SEGFLG_CNT     0x0000 /**< \brief CCSDS Segment continuation flag */
-#define CFE_MSG_SEGFLG_FIRST   0x4000 /**< \brief CCSDS Segment first flag */
-#define CFE_MSG_SEGFLG_LAST    0x8000 /**< \brief CCSDS Segment last flag */
-#define CFE_MSG_SEGFLG_UNSEG   0xC000 /**< \brief CCSDS Unsegmented flag */
-#define CFE_MSG_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
-
 /******************************************************************************
  * CCSDS Primary header initialization - See header file for details
  */
@@ -70,8 +57,7 @@ int32 CFE_MSG_GetHeaderVersion(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderVe
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.StreamId, Version, CFE_MSG_CCSDSVER_MASK);
-    *Version >>= CFE_MSG_CCSDSVER_SHIFT;
+    *Version = CFE_MSG_FastGetHeaderVersion(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -102,14 +88,7 @@ int32 CFE_MSG_GetType(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Type_t *Type)
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_TYPE_MASK >> 8)) != 0)
-    {
-        *Type = CFE_MSG_Type_Cmd;
-    }
-    else
-    {
-        *Type = CFE_MSG_Type_Tlm;
-    }
+    *Type = CFE_MSG_FastGetType(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -153,7 +132,7 @@ int32 CFE_MSG_GetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr, bool *HasSe
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    *HasSecondary = (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_SHDR_MASK >> 8)) != 0;
+    *HasSecondary = CFE_MSG_FastGetHasSecondaryHeader(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -191,7 +170,7 @@ int32 CFE_MSG_GetApId(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_ApId_t *ApId)
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.StreamId, ApId, CFE_MSG_APID_MASK);
+    *ApId = CFE_MSG_FastGetApId(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -217,30 +196,12 @@ int32 CFE_MSG_SetApId(CFE_MSG_Message_t *MsgPtr, CFE_MSG_ApId_t ApId)
 int32 CFE_MSG_GetSegmentationFlag(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SegmentationFlag_t *SegFlag)
 {
 
-    uint16 rawval;
-
     if (MsgPtr == NULL || SegFlag == NULL)
     {
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.Sequence, &rawval, CFE_MSG_SEGFLG_MASK);
-
-    switch (rawval)
-    {
-        case CFE_MSG_SEGFLG_CNT:
-            *SegFlag = CFE_MSG_SegFlag_Continue;
-            break;
-        case CFE_MSG_SEGFLG_FIRST:
-            *SegFlag = CFE_MSG_SegFlag_First;
-            break;
-        case CFE_MSG_SEGFLG_LAST:
-            *SegFlag = CFE_MSG_SegFlag_Last;
-            break;
-        case CFE_MSG_SEGFLG_UNSEG:
-        default:
-            *SegFlag = CFE_MSG_SegFlag_Unsegmented;
-    }
+    *SegFlag = CFE_MSG_FastGetSegmentationFlag(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -296,7 +257,7 @@ int32 CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Sequence
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    CFE_MSG_GetHeaderField(MsgPtr->CCSDS.Pri.Sequence, SeqCnt, CFE_MSG_SEQCNT_MASK);
+    *SeqCnt = CFE_MSG_FastGetSequenceCount(MsgPtr);
 
     return CFE_SUCCESS;
 }
@@ -327,7 +288,7 @@ int32 CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    *Size = (MsgPtr->CCSDS.Pri.Length[0] << 8) + MsgPtr->CCSDS.Pri.Length[1] + CFE_MSG_SIZE_OFFSET;
+    *Size = CFE_MSG_FastGetSize(MsgPtr);
 
     return CFE_SUCCESS;
 }
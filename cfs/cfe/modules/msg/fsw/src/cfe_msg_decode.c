@@ -0,0 +1,81 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+ * One pass header decode - cFS default secondary header layout
+ */
+#include "cfe_msg.h"
+#include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
+#include "cfe_error.h"
+#include <string.h>
+
+/******************************************************************************
+ * Decode all header fields - See API and header file for details
+ */
+int32 CFE_MSG_DecodeHeader(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_HeaderInfo_t *HdrInfo)
+{
+    const CFE_MSG_CommandHeader_t *cmd;
+
+    if (MsgPtr == NULL || HdrInfo == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    memset(HdrInfo, 0, sizeof(*HdrInfo));
+
+    /* Primary header */
+    HdrInfo->MsgId              = CFE_MSG_FastGetMsgId(MsgPtr);
+    HdrInfo->Size               = CFE_MSG_FastGetSize(MsgPtr);
+    HdrInfo->Type               = CFE_MSG_FastGetType(MsgPtr);
+    HdrInfo->HeaderVersion      = CFE_MSG_FastGetHeaderVersion(MsgPtr);
+    HdrInfo->HasSecondaryHeader = CFE_MSG_FastGetHasSecondaryHeader(MsgPtr);
+    HdrInfo->ApId               = CFE_MSG_FastGetApId(MsgPtr);
+    HdrInfo->SegmentationFlag   = CFE_MSG_FastGetSegmentationFlag(MsgPtr);
+    HdrInfo->SequenceCount      = CFE_MSG_FastGetSequenceCount(MsgPtr);
+
+#ifdef CFE_MSG_HDR_HAS_CCSDSEXT
+    /* Extended header */
+    HdrInfo->EDSVersion   = CFE_MSG_FastGetEDSVersion(MsgPtr);
+    HdrInfo->Endian       = CFE_MSG_FastGetEndian(MsgPtr);
+    HdrInfo->PlaybackFlag = CFE_MSG_FastGetPlaybackFlag(MsgPtr);
+    HdrInfo->Subsystem    = CFE_MSG_FastGetSubsystem(MsgPtr);
+    HdrInfo->System       = CFE_MSG_FastGetSystem(MsgPtr);
+#endif
+
+    /* Secondary header, same applicability rules as the individual accessors */
+    if (HdrInfo->HasSecondaryHeader)
+    {
+        if (HdrInfo->Type == CFE_MSG_Type_Cmd)
+        {
+            cmd = (const CFE_MSG_CommandHeader_t *)MsgPtr;
+
+            HdrInfo->FcnCode  = cmd->Sec.FunctionCode & CFE_MSG_FC_MASK;
+            HdrInfo->Checksum = cmd->Sec.Checksum;
+        }
+        else
+        {
+            /* Same layout as CFE_MSG_GetMsgTime, checked at build time in cfe_msg_inline.h */
+            HdrInfo->Time = CFE_MSG_FastGetMsgTime(MsgPtr);
+        }
+    }
+
+    return CFE_SUCCESS;
+}
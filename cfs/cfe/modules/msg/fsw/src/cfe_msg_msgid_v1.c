@@ -23,6 +23,7 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_error.h"
 #include "cfe_platform_cfg.h"
 #include "cfe_sb.h"
@@ -36,15 +37,12 @@
 int32 CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
 {
 
-    CFE_SB_MsgId_Atom_t msgidval;
-
     if (MsgPtr == NULL || MsgId == NULL)
     {
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    msgidval = (MsgPtr->CCSDS.Pri.StreamId[0] << 8) + MsgPtr->CCSDS.Pri.StreamId[1];
-    *MsgId   = CFE_SB_ValueToMsgId(msgidval);
+    *MsgId = CFE_MSG_FastGetMsgId(MsgPtr);
 
     return CFE_SUCCESS;
 }
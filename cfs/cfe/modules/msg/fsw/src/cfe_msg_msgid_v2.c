@@ -39,40 +39,23 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_error.h"
 #include "cfe_platform_cfg.h"
 
-/* cFS MsgId definitions */
-#define CFE_MSG_MSGID_APID_MASK   0x007F /**< \brief CCSDS ApId mask for MsgId */
-#define CFE_MSG_MSGID_TYPE_MASK   0x0080 /**< \brief Message type mask for MsgId, set = cmd */
-#define CFE_MSG_MSGID_SUBSYS_MASK 0xFF00 /**< \brief Subsystem mask for MsgId */
-
 /******************************************************************************
  * Get message id - See API and header file for details
  */
 int32 CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
 {
 
-    CFE_SB_MsgId_Atom_t msgidval;
-    CFE_MSG_Type_t      type;
-
     if (MsgPtr == NULL || MsgId == NULL)
     {
         return CFE_MSG_BAD_ARGUMENT;
     }
 
-    /* Ignore return, assumes tlm if invalid */
-    CFE_MSG_GetType(MsgPtr, &type);
-
     /* Set message ID bits from CCSDS header fields */
-    msgidval = MsgPtr->CCSDS.Pri.StreamId[1] & CFE_MSG_MSGID_APID_MASK;
-    if (type == CFE_MSG_Type_Cmd)
-    {
-        msgidval |= CFE_MSG_MSGID_TYPE_MASK;
-    }
-    msgidval |= (MsgPtr->CCSDS.Ext.Subsystem[1] << 8) & CFE_MSG_MSGID_SUBSYS_MASK;
-
-    *MsgId = CFE_SB_ValueToMsgId(msgidval);
+    *MsgId = CFE_MSG_FastGetMsgId(MsgPtr);
 
     return CFE_SUCCESS;
 }
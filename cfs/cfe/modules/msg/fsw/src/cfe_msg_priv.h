@@ -33,6 +33,31 @@
  */
 #include "common_types.h"
 #include "cfe_msg_hdr.h"
+#include "cfe_msg_api_typedefs.h"
+
+/*
+ * Types
+ */
+
+/**
+ * \brief Message template contents
+ *
+ * Layout of the storage in the public (opaque) CFE_MSG_Template_t
+ */
+typedef struct
+{
+    union
+    {
+        CFE_MSG_Message_t         Msg; /**< \brief Base message */
+        CFE_MSG_CommandHeader_t   Cmd; /**< \brief Command header */
+        CFE_MSG_TelemetryHeader_t Tlm; /**< \brief Telemetry header */
+    } Hdr;                             /**< \brief Pre-built header */
+
+    CFE_MSG_Size_t HdrSize;        /**< \brief Number of header bytes copied on apply */
+    CFE_MSG_Size_t Size;           /**< \brief Total message size */
+    const void *   DefaultPayload; /**< \brief Optional payload copied after the header, NULL if none */
+    bool           HasTime;        /**< \brief Telemetry with secondary header, time stamped on apply */
+} CFE_MSG_TemplateContent_t;
 
 /*****************************************************************************/
 /**
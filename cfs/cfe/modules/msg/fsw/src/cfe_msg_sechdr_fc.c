@@ -23,8 +23,7 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
-
-#define CFE_MSG_FC_MASK 0x7F /**< \brief Function code mask */
+#include "cfe_msg_inline.h"
 
 /******************************************************************************
  * Get function code - See API and header file for details
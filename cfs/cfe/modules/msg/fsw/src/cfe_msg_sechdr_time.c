@@ -24,6 +24,7 @@
  */
 #include "cfe_msg.h"
 #include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
 #include "cfe_error.h"
 #include <string.h>
 
@@ -33,10 +34,9 @@
 int32 CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
 {
 
-    uint32                     status;
-    CFE_MSG_Type_t             type;
-    bool                       hassechdr = false;
-    CFE_MSG_TelemetryHeader_t *tlm       = (CFE_MSG_TelemetryHeader_t *)MsgPtr;
+    uint32         status;
+    CFE_MSG_Type_t type;
+    bool           hassechdr = false;
 
     if (MsgPtr == NULL)
     {
@@ -53,12 +53,7 @@ int32 CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
     }
 
     /* Set big endian time field with default 32/16 layout */
-    tlm->Sec.Time[0] = (NewTime.Seconds >> 24) & 0xFF;
-    tlm->Sec.Time[1] = (NewTime.Seconds >> 16) & 0xFF;
-    tlm->Sec.Time[2] = (NewTime.Seconds >> 8) & 0xFF;
-    tlm->Sec.Time[3] = NewTime.Seconds & 0xFF;
-    tlm->Sec.Time[4] = (NewTime.Subseconds >> 24) & 0xFF;
-    tlm->Sec.Time[5] = (NewTime.Subseconds >> 16) & 0xFF;
+    CFE_MSG_FastSetMsgTime(MsgPtr, NewTime);
 
     return CFE_SUCCESS;
 }
@@ -69,10 +64,9 @@ int32 CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
 int32 CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
 {
 
-    uint32                     status;
-    CFE_MSG_Type_t             type;
-    bool                       hassechdr = false;
-    CFE_MSG_TelemetryHeader_t *tlm       = (CFE_MSG_TelemetryHeader_t *)MsgPtr;
+    uint32         status;
+    CFE_MSG_Type_t type;
+    bool           hassechdr = false;
 
     if (MsgPtr == NULL || Time == NULL)
     {
@@ -90,8 +84,7 @@ int32 CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Ti
     }
 
     /* Get big endian time fields with default 32/16 layout */
-    Time->Subseconds = (tlm->Sec.Time[4] << 24) + (tlm->Sec.Time[5] << 16);
-    Time->Seconds    = (tlm->Sec.Time[0] << 24) + (tlm->Sec.Time[1] << 16) + (tlm->Sec.Time[2] << 8) + tlm->Sec.Time[3];
+    *Time = CFE_MSG_FastGetMsgTime(MsgPtr);
 
     return CFE_SUCCESS;
 }
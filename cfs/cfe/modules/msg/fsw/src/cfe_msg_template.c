@@ -0,0 +1,133 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/******************************************************************************
+ * Message templates - cFS default secondary header layout
+ */
+#include "cfe_msg.h"
+#include "cfe_msg_priv.h"
+#include "cfe_msg_inline.h"
+#include "cfe_error.h"
+#include <string.h>
+
+/* The opaque public storage must hold the private layout */
+CompileTimeAssert(sizeof(CFE_MSG_TemplateContent_t) <= sizeof(CFE_MSG_Template_t), CFE_MSG_TemplateStorageSize);
+
+/******************************************************************************
+ * Initialize a message template - See API and header file for details
+ */
+int32 CFE_MSG_InitTemplate(CFE_MSG_Template_t *TemplatePtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size,
+                           const void *DefaultPayload)
+{
+    CFE_MSG_TemplateContent_t *Content;
+    int32                      status;
+
+    if (TemplatePtr == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Same defaults as CFE_MSG_Init, but only the header is held in the template */
+    memset(TemplatePtr, 0, sizeof(*TemplatePtr));
+    Content = (CFE_MSG_TemplateContent_t *)TemplatePtr;
+    CFE_MSG_InitDefaultHdr(&Content->Hdr.Msg);
+
+    status = CFE_MSG_SetMsgId(&Content->Hdr.Msg, MsgId);
+    if (status == CFE_SUCCESS)
+    {
+        status = CFE_MSG_SetSize(&Content->Hdr.Msg, Size);
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        if (!CFE_MSG_FastGetHasSecondaryHeader(&Content->Hdr.Msg))
+        {
+            Content->HdrSize = sizeof(Content->Hdr.Msg);
+        }
+        else if (CFE_MSG_FastGetType(&Content->Hdr.Msg) == CFE_MSG_Type_Cmd)
+        {
+            Content->HdrSize = sizeof(Content->Hdr.Cmd);
+        }
+        else
+        {
+            Content->HdrSize = sizeof(Content->Hdr.Tlm);
+            Content->HasTime = true;
+        }
+
+        /* Message must at least hold the header it is stamped with */
+        if (Size < Content->HdrSize)
+        {
+            status = CFE_MSG_BAD_ARGUMENT;
+        }
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        Content->Size           = Size;
+        Content->DefaultPayload = DefaultPayload;
+    }
+    else
+    {
+        memset(TemplatePtr, 0, sizeof(*TemplatePtr));
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * Stamp a message from a template - See API and header file for details
+ */
+int32 CFE_MSG_ApplyTemplate(CFE_MSG_Message_t *MsgPtr, const CFE_MSG_Template_t *TemplatePtr,
+                            const CFE_TIME_SysTime_t *Time)
+{
+    const CFE_MSG_TemplateContent_t *Content;
+
+    if (MsgPtr == NULL || TemplatePtr == NULL)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    Content = (const CFE_MSG_TemplateContent_t *)TemplatePtr;
+    if (Content->HdrSize == 0)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    /* Checked before copying, so the message is left alone on error */
+    if (Time != NULL && !Content->HasTime)
+    {
+        return CFE_MSG_WRONG_MSG_TYPE;
+    }
+
+    memcpy(MsgPtr, &Content->Hdr, Content->HdrSize);
+
+    if (Content->DefaultPayload != NULL)
+    {
+        memcpy(&MsgPtr->Byte[Content->HdrSize], Content->DefaultPayload, Content->Size - Content->HdrSize);
+    }
+
+    if (Time != NULL)
+    {
+        /* Same layout as CFE_MSG_SetMsgTime, checked at build time in cfe_msg_inline.h */
+        CFE_MSG_FastSetMsgTime(MsgPtr, *Time);
+    }
+
+    return CFE_SUCCESS;
+}
@@ -25,3 +25,17 @@ generate_config_includefile(
     FILE_NAME           "cfe_msg_sechdr.h"
     FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/default_cfe_msg_sechdr.h"
 )
+
+# Header layout used by the inline accessors in cfe_msg_inline.h.  This is
+# generated with the other mission headers (rather than set as compile
+# definitions on the MSG library) so every module and application that
+# includes the inline accessors sees the same layout as the MSG sources.
+set(MSG_LAYOUT_CONTENT "/* Message header layout selected by the mission configuration */\n")
+if (MISSION_INCLUDE_CCSDSEXT_HEADER)
+  list(APPEND MSG_LAYOUT_CONTENT "#define CFE_MSG_HDR_HAS_CCSDSEXT\n")
+endif (MISSION_INCLUDE_CCSDSEXT_HEADER)
+if (MISSION_MSGID_V2)
+  list(APPEND MSG_LAYOUT_CONTENT "#define CFE_MSG_MSGID_V2\n")
+endif (MISSION_MSGID_V2)
+
+generate_c_headerfile("${CMAKE_BINARY_DIR}/inc/cfe_msg_layout.h" ${MSG_LAYOUT_CONTENT})
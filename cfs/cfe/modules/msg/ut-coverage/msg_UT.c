@@ -35,6 +35,8 @@
 #include "test_cfe_msg_fc.h"
 #include "test_cfe_msg_checksum.h"
 #include "test_cfe_msg_time.h"
+#include "test_cfe_msg_decode.h"
+#include "test_cfe_msg_template.h"
 
 /*
  * Functions
@@ -52,4 +54,6 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_MSG_Checksum);
     UT_ADD_TEST(Test_MSG_FcnCode);
     UT_ADD_TEST(Test_MSG_Time);
+    UT_ADD_TEST(Test_MSG_DecodeHeader);
+    UT_ADD_TEST(Test_MSG_Template);
 }
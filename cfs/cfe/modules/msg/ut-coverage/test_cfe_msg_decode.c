@@ -0,0 +1,156 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Test one pass header decode and inline accessors
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "test_msg_not.h"
+#include "test_msg_utils.h"
+#include "cfe_msg.h"
+#include "cfe_msg_inline.h"
+#include "test_cfe_msg_ccsdspri.h"
+#include "test_cfe_msg_decode.h"
+#include "cfe_error.h"
+#include <string.h>
+
+/*
+ * Verify decoded fields and inline accessors match the individual API accessors
+ */
+static void Test_MSG_DecodeCompare(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_HeaderInfo_t       info;
+    CFE_SB_MsgId_t             msgid;
+    CFE_MSG_Size_t             size;
+    CFE_MSG_Type_t             type;
+    CFE_MSG_HeaderVersion_t    hdrver;
+    bool                       hassec;
+    CFE_MSG_ApId_t             apid;
+    CFE_MSG_SegmentationFlag_t segflag;
+    CFE_MSG_SequenceCount_t    seqcnt;
+
+    ASSERT_EQ(CFE_MSG_DecodeHeader(MsgPtr, &info), CFE_SUCCESS);
+
+    CFE_MSG_GetMsgId(MsgPtr, &msgid);
+    CFE_MSG_GetSize(MsgPtr, &size);
+    CFE_MSG_GetType(MsgPtr, &type);
+    CFE_MSG_GetHeaderVersion(MsgPtr, &hdrver);
+    CFE_MSG_GetHasSecondaryHeader(MsgPtr, &hassec);
+    CFE_MSG_GetApId(MsgPtr, &apid);
+    CFE_MSG_GetSegmentationFlag(MsgPtr, &segflag);
+    CFE_MSG_GetSequenceCount(MsgPtr, &seqcnt);
+
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(info.MsgId, msgid));
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(CFE_MSG_FastGetMsgId(MsgPtr), msgid));
+    ASSERT_EQ(info.Size, size);
+    ASSERT_EQ(CFE_MSG_FastGetSize(MsgPtr), size);
+    ASSERT_EQ(info.Type, type);
+    ASSERT_EQ(CFE_MSG_FastGetType(MsgPtr), type);
+    ASSERT_EQ(info.HeaderVersion, hdrver);
+    ASSERT_EQ(info.HasSecondaryHeader, hassec);
+    ASSERT_EQ(info.ApId, apid);
+    ASSERT_EQ(CFE_MSG_FastGetApId(MsgPtr), apid);
+    ASSERT_EQ(info.SegmentationFlag, segflag);
+    ASSERT_EQ(info.SequenceCount, seqcnt);
+
+#ifdef CFE_MSG_HDR_HAS_CCSDSEXT
+    {
+        CFE_MSG_EDSVersion_t   edsver;
+        CFE_MSG_Endian_t       endian;
+        CFE_MSG_PlaybackFlag_t playflag;
+        CFE_MSG_Subsystem_t    subsys;
+        CFE_MSG_System_t       system;
+
+        CFE_MSG_GetEDSVersion(MsgPtr, &edsver);
+        CFE_MSG_GetEndian(MsgPtr, &endian);
+        CFE_MSG_GetPlaybackFlag(MsgPtr, &playflag);
+        CFE_MSG_GetSubsystem(MsgPtr, &subsys);
+        CFE_MSG_GetSystem(MsgPtr, &system);
+
+        ASSERT_EQ(info.EDSVersion, edsver);
+        ASSERT_EQ(info.Endian, endian);
+        ASSERT_EQ(info.PlaybackFlag, playflag);
+        ASSERT_EQ(info.Subsystem, subsys);
+        ASSERT_EQ(info.System, system);
+    }
+#endif
+}
+
+void Test_MSG_DecodeHeader(void)
+{
+    CFE_MSG_CommandHeader_t   cmd;
+    CFE_MSG_TelemetryHeader_t tlm;
+    CFE_MSG_HeaderInfo_t      info;
+    CFE_TIME_SysTime_t        time = {0x12345678, 0xABCD0000};
+
+    UtPrintf("Bad parameter tests, Null pointers");
+    memset(&cmd, 0, sizeof(cmd));
+    ASSERT_EQ(CFE_MSG_DecodeHeader(NULL, &info), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_DecodeHeader(&cmd.Msg, NULL), CFE_MSG_BAD_ARGUMENT);
+
+    UtPrintf("All zero message, no secondary header");
+    ASSERT_EQ(CFE_MSG_DecodeHeader(&cmd.Msg, &info), CFE_SUCCESS);
+    ASSERT_EQ(info.Size, TEST_MSG_SIZE_OFFSET);
+    ASSERT_EQ(info.Type, CFE_MSG_Type_Tlm);
+    ASSERT_EQ(info.HasSecondaryHeader, false);
+    ASSERT_EQ(info.Time.Seconds, 0);
+    Test_MSG_DecodeCompare(&cmd.Msg);
+
+    UtPrintf("All F's message");
+    memset(&cmd, 0xFF, sizeof(cmd));
+    Test_MSG_DecodeCompare(&cmd.Msg);
+    ASSERT_EQ(CFE_MSG_DecodeHeader(&cmd.Msg, &info), CFE_SUCCESS);
+    ASSERT_EQ(info.FcnCode, 0x7F);
+    ASSERT_EQ(info.Checksum, 0xFF);
+
+    UtPrintf("Command with secondary header");
+    memset(&cmd, 0, sizeof(cmd));
+    ASSERT_EQ(CFE_MSG_SetHasSecondaryHeader(&cmd.Msg, true), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetType(&cmd.Msg, CFE_MSG_Type_Cmd), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetApId(&cmd.Msg, 0x123), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetSequenceCount(&cmd.Msg, 0x2BCD), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetSize(&cmd.Msg, sizeof(cmd)), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetFcnCode(&cmd.Msg, 0x55), CFE_SUCCESS);
+    Test_MSG_DecodeCompare(&cmd.Msg);
+    ASSERT_EQ(CFE_MSG_DecodeHeader(&cmd.Msg, &info), CFE_SUCCESS);
+    ASSERT_EQ(info.Type, CFE_MSG_Type_Cmd);
+    ASSERT_EQ(info.ApId, 0x123);
+    ASSERT_EQ(info.SequenceCount, 0x2BCD);
+    ASSERT_EQ(info.Size, sizeof(cmd));
+    ASSERT_EQ(info.FcnCode, 0x55);
+    ASSERT_EQ(info.Time.Seconds, 0);
+
+    UtPrintf("Telemetry with secondary header");
+    memset(&tlm, 0, sizeof(tlm));
+    ASSERT_EQ(CFE_MSG_SetHasSecondaryHeader(&tlm.Msg, true), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetSegmentationFlag(&tlm.Msg, CFE_MSG_SegFlag_First), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_SetMsgTime(&tlm.Msg, time), CFE_SUCCESS);
+    Test_MSG_DecodeCompare(&tlm.Msg);
+    ASSERT_EQ(CFE_MSG_DecodeHeader(&tlm.Msg, &info), CFE_SUCCESS);
+    ASSERT_EQ(info.SegmentationFlag, CFE_MSG_SegFlag_First);
+    ASSERT_EQ(info.Time.Seconds, time.Seconds);
+    ASSERT_EQ(info.Time.Subseconds, time.Subseconds);
+    ASSERT_EQ(info.FcnCode, 0);
+}
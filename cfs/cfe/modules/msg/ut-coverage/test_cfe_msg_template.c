@@ -0,0 +1,119 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+ * Test message templates
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "test_msg_not.h"
+#include "test_msg_utils.h"
+#include "cfe_msg.h"
+#include "cfe_msg_priv.h"
+#include "cfe_platform_cfg.h"
+#include "test_cfe_msg_template.h"
+#include "cfe_error.h"
+#include <string.h>
+
+/*
+ * Defines
+ */
+#define TEST_TEMPLATE_PAYLOAD_SIZE 8
+#define TEST_TEMPLATE_TLM_MSGID    0x0801 /* Telemetry with secondary header */
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader;
+    uint8                     Payload[TEST_TEMPLATE_PAYLOAD_SIZE];
+} Test_MSG_TemplateTlm_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader;
+    uint8                   Payload[TEST_TEMPLATE_PAYLOAD_SIZE];
+} Test_MSG_TemplateCmd_t;
+
+void Test_MSG_Template(void)
+{
+    CFE_MSG_Template_t         tmpl;
+    CFE_MSG_TemplateContent_t *content = (CFE_MSG_TemplateContent_t *)&tmpl;
+    Test_MSG_TemplateTlm_t     expected;
+    Test_MSG_TemplateTlm_t     actual;
+    Test_MSG_TemplateCmd_t     cmd;
+    CFE_TIME_SysTime_t         time    = {0x12345678, 0xABCD0000};
+    CFE_TIME_SysTime_t         acttime = {0, 0};
+    CFE_SB_MsgId_t             msgid   = CFE_SB_ValueToMsgId(TEST_TEMPLATE_TLM_MSGID);
+    uint8                      payload[TEST_TEMPLATE_PAYLOAD_SIZE];
+    CFE_MSG_Type_t             type;
+
+    UtPrintf("Bad parameter tests, Null pointers and invalid sizes");
+    ASSERT_EQ(CFE_MSG_InitTemplate(NULL, msgid, sizeof(expected), NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, msgid, 0, NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, msgid, sizeof(CFE_MSG_Message_t), NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, CFE_SB_INVALID_MSG_ID, sizeof(expected), NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&actual.TlmHeader.Msg, &tmpl, NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(NULL, &tmpl, NULL), CFE_MSG_BAD_ARGUMENT);
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&actual.TlmHeader.Msg, NULL, NULL), CFE_MSG_BAD_ARGUMENT);
+
+    UtPrintf("Header only template matches CFE_MSG_Init");
+    memset(&expected, 0xFF, sizeof(expected));
+    memset(&actual, 0xFF, sizeof(actual));
+    ASSERT_EQ(CFE_MSG_Init(&expected.TlmHeader.Msg, msgid, sizeof(expected)), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, msgid, sizeof(expected), NULL), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&actual.TlmHeader.Msg, &tmpl, NULL), CFE_SUCCESS);
+    ASSERT_EQ(memcmp(&actual.TlmHeader, &expected.TlmHeader, sizeof(expected.TlmHeader)), 0);
+    memset(expected.Payload, 0xFF, sizeof(expected.Payload));
+    ASSERT_EQ(memcmp(actual.Payload, expected.Payload, sizeof(actual.Payload)), 0);
+
+    UtPrintf("Time stamped on apply");
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&actual.TlmHeader.Msg, &tmpl, &time), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_GetMsgTime(&actual.TlmHeader.Msg, &acttime), CFE_SUCCESS);
+    ASSERT_EQ(acttime.Seconds, time.Seconds);
+    ASSERT_EQ(acttime.Subseconds, time.Subseconds);
+
+    UtPrintf("Default payload copied on apply");
+    memset(payload, 0xA5, sizeof(payload));
+    memset(&actual, 0, sizeof(actual));
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, msgid, sizeof(actual), payload), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&actual.TlmHeader.Msg, &tmpl, NULL), CFE_SUCCESS);
+    ASSERT_EQ(memcmp(actual.Payload, payload, sizeof(payload)), 0);
+
+    UtPrintf("Command template, time not supported");
+    memset(&cmd, 0, sizeof(cmd));
+    ASSERT_EQ(CFE_MSG_InitTemplate(&tmpl, CFE_SB_ValueToMsgId(CFE_PLATFORM_SB_HIGHEST_VALID_MSGID), sizeof(cmd),
+                                   NULL),
+              CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_GetType(&content->Hdr.Msg, &type), CFE_SUCCESS);
+    ASSERT_EQ(type, CFE_MSG_Type_Cmd);
+    ASSERT_EQ(content->HdrSize, sizeof(CFE_MSG_CommandHeader_t));
+
+    UtPrintf("Message is not modified when time cannot be set");
+    memset(&cmd, 0xFF, sizeof(cmd));
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&cmd.CmdHeader.Msg, &tmpl, &time), CFE_MSG_WRONG_MSG_TYPE);
+    ASSERT_EQ(Test_MSG_NotF(&cmd.CmdHeader.Msg), 0);
+
+    ASSERT_EQ(CFE_MSG_ApplyTemplate(&cmd.CmdHeader.Msg, &tmpl, NULL), CFE_SUCCESS);
+    ASSERT_EQ(CFE_MSG_GetType(&cmd.CmdHeader.Msg, &type), CFE_SUCCESS);
+    ASSERT_EQ(type, CFE_MSG_Type_Cmd);
+}
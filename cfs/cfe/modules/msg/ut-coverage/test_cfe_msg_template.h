@@ -0,0 +1,35 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ * cfe_msg_template test header
+ */
+#ifndef TEST_CFE_MSG_TEMPLATE_H
+#define TEST_CFE_MSG_TEMPLATE_H
+
+/*
+ * Functions
+ */
+/* Test message template functions */
+void Test_MSG_Template(void);
+
+#endif /* TEST_CFE_MSG_TEMPLATE_H */
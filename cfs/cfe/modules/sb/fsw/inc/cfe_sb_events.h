@@ -41,7 +41,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_SB_MAX_EID 67
+#define CFE_SB_MAX_EID 70
 
 /*
 ** SB task event message ID's.
@@ -251,6 +251,31 @@
 **/
 #define CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID 67
 
+/** \brief <tt> 'SetSubscriptionFilter Err:\%s,MsgId 0x\%x,PipeId \%lu,app \%s' </tt>
+**  \event <tt> 'SetSubscriptionFilter Err:\%s,MsgId 0x\%x,PipeId \%lu,app \%s' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This error event message is issued when the #CFE_SB_SetSubscriptionFilter API
+**  is called with an invalid argument, by an app that does not own the pipe, or
+**  for a message that is not subscribed to on the pipe.
+**/
+#define CFE_SB_SETFILTER_ERR_EID 68
+
+/** \brief <tt> 'Subscription filter set:Msg 0x\%x on pipe \%lu,type \%d,N/X/O \%d/\%d/\%d' </tt>
+**  \event <tt> 'Subscription filter set:Msg 0x\%x on pipe \%lu,type \%d,N/X/O \%d/\%d/\%d' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when the #CFE_SB_SetSubscriptionFilter API
+**  successfully changes the filter of a subscription.
+**/
+#define CFE_SB_SETFILTER_EID 69
+
 /** \brief <tt> 'Subscribe Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s,scope \%d' </tt>
 **  \event <tt> 'Subscribe Err:Bad Arg,MsgId 0x\%x,PipeId \%d,app \%s,scope \%d' </tt>
 **
@@ -592,6 +617,18 @@
 **/
 #define CFE_SB_SND_STATS_EID 32
 
+/** \brief <tt> 'Software Bus Latency packet sent' </tt>
+**  \event <tt> 'Software Bus Latency packet sent' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This debug event message is issued when SB receives a cmd to send the SB
+**  pipe latency pkt.
+**/
+#define CFE_SB_SND_LATENCY_EID 70
+
 /** \brief <tt> 'Enbl Route Cmd:Route does not exist.Msg 0x\%x,Pipe \%d' </tt>
 **  \event <tt> 'Enbl Route Cmd:Route does not exist.Msg 0x\%x,Pipe \%d' </tt>
 **
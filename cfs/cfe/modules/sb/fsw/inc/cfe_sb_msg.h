@@ -40,6 +40,16 @@
 #include "cfe_sb_extern_typedefs.h"
 #include "cfe_es_extern_typedefs.h"
 
+/**
+** \brief Number of bins in the SB pipe latency histograms
+**
+** The queueing delay of each message received from a pipe is counted in a
+** log2 scale bin.  Bin 0 counts delays under 1 microsecond, bin n counts
+** delays of at least 2^(n-1) and less than 2^n microseconds, and the last
+** bin also counts every longer delay (from about 4.2 seconds upward).
+*/
+#define CFE_SB_LATENCY_HIST_BINS 24
+
 /****************************************
 ** SB task command packet command codes
 ****************************************/
@@ -453,6 +463,41 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC 11
 
+/** \cfesbcmd Send Software Bus Latency Statistics
+**
+**  \par Description
+**       This command will cause the SB task to send the pipe latency
+**       histograms packet. Each histogram counts how long messages waited
+**       on that pipe between transmit and #CFE_SB_ReceiveBuffer, see
+**       #CFE_SB_LATENCY_HIST_BINS for the bin boundaries.
+**
+**  \cfecmdmnemonic \SB_DUMPLATENCY
+**
+**  \par Command Structure
+**       #CFE_SB_SendLatencyStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - Receipt of latency packet with MsgId #CFE_SB_LATENCY_TLM_MID
+**       - The #CFE_SB_SND_LATENCY_EID debug event message will be generated. All
+**         debug events are filtered by default.
+**
+**  \par Error Conditions
+**       There are no error conditions for this command. If the Software
+**       Bus receives the command, the debug event is sent and the counter
+**       is incremented unconditionally.
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create and send
+**       a message on the software bus. If performed repeatedly, it is
+**       possible that receiver pipes may overflow.
+**
+**  \sa #CFE_SB_LatencyStatsTlm_t
+*/
+#define CFE_SB_SEND_LATENCY_STATS_CC 12
+
 /****************************
 **  SB Command Formats     **
 *****************************/
@@ -470,6 +515,7 @@ typedef CFE_MSG_CommandHeader_t CFE_SB_EnableSubReportingCmd_t;
 typedef CFE_MSG_CommandHeader_t CFE_SB_DisableSubReportingCmd_t;
 typedef CFE_MSG_CommandHeader_t CFE_SB_SendSbStatsCmd_t;
 typedef CFE_MSG_CommandHeader_t CFE_SB_SendPrevSubsCmd_t;
+typedef CFE_MSG_CommandHeader_t CFE_SB_SendLatencyStatsCmd_t;
 
 /**
 **  \brief Write File Info Command Payload
@@ -606,6 +652,23 @@ typedef struct CFE_SB_PipeDepthStats
 
 } CFE_SB_PipeDepthStats_t;
 
+/**
+** \brief SB Pipe Information File per-priority statistics
+**
+** Messages subscribed with #CFE_SB_QosPriority_HIGH are delivered ahead of
+** normal priority messages on the same pipe, these statistics allow the
+** resulting queueing delay of each class to be verified.
+*/
+typedef struct CFE_SB_PipePrioInfo
+{
+    uint16 CurrentQueueDepth; /**< Number of messages of this priority currently on the pipe */
+    uint16 PeakQueueDepth;    /**< Peak number of messages of this priority that have been on the pipe */
+    uint32 RcvCount;          /**< Number of messages of this priority received from the pipe */
+    uint32 AvgLatencyUsec;    /**< Average time from transmit to receive, in microseconds */
+    uint32 MaxLatencyUsec;    /**< Longest time from transmit to receive, in microseconds */
+
+} CFE_SB_PipePrioInfo_t;
+
 /**
 ** \brief SB Pipe Information File Entry
 **
@@ -634,6 +697,9 @@ typedef struct CFE_SB_PipeInfoEntry
     uint8           Opts;                              /**< Pipe options set (bitmask) */
     uint8           Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
 
+    CFE_SB_PipePrioInfo_t PrioInfo[CFE_SB_QOS_PRIORITY_LEVELS]; /**< Statistics indexed by QoS priority */
+    uint32                LatencyHist[CFE_SB_LATENCY_HIST_BINS];  /**< Queueing delay histogram, all priorities */
+
 } CFE_SB_PipeInfoEntry_t;
 
 /**
@@ -691,6 +757,43 @@ typedef struct CFE_SB_StatsTlm
     CFE_SB_StatsTlm_Payload_t Payload; /**< \brief Telemetry payload */
 } CFE_SB_StatsTlm_t;
 
+/**
+** \brief SB Pipe Latency Statistics
+**
+** Used in SB Latency Telemetry Packet #CFE_SB_LatencyStatsTlm_t
+*/
+typedef struct CFE_SB_PipeLatencyStats
+{
+
+    CFE_SB_PipeId_t PipeId;                         /**< \cfetlmmnemonic \SB_PLPIPEID
+                                                         \brief Pipe Id associated with the stats below */
+    uint32 RcvCount;                                /**< \cfetlmmnemonic \SB_PLRCVCNT
+                                                         \brief Number of messages received from the pipe */
+    uint32 LatencyHist[CFE_SB_LATENCY_HIST_BINS];   /**< \cfetlmmnemonic \SB_PLHIST
+                                                         \brief Queueing delay histogram, see
+                                                         #CFE_SB_LATENCY_HIST_BINS */
+
+} CFE_SB_PipeLatencyStats_t;
+
+/**
+** \cfesbtlm SB Latency Telemetry Packet
+**
+** SB pipe latency packet sent in response to #CFE_SB_SEND_LATENCY_STATS_CC
+*/
+typedef struct CFE_SB_LatencyStatsTlm_Payload
+{
+
+    CFE_SB_PipeLatencyStats_t
+        PipeLatencyStats[CFE_MISSION_SB_MAX_PIPES]; /**< \cfetlmmnemonic \SB_PLSTATS
+                                                 \brief Pipe latency statistics #CFE_SB_PipeLatencyStats_t */
+} CFE_SB_LatencyStatsTlm_Payload_t;
+
+typedef struct CFE_SB_LatencyStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t        Hdr;     /**< \brief Telemetry header */
+    CFE_SB_LatencyStatsTlm_Payload_t Payload; /**< \brief Telemetry payload */
+} CFE_SB_LatencyStatsTlm_t;
+
 /**
 ** \brief SB Routing File Entry
 **
@@ -59,6 +59,7 @@
 ** Include Files
 */
 #include "cfe_sb_module_all.h"
+#include "cfe_msg_inline.h"
 
 #include <string.h>
 
@@ -389,6 +390,9 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /* Pending high priority messages are released here, their wake tokens are drained below */
+        CFE_SB_PutHighPrioRing(PipeDscPtr);
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -832,16 +836,26 @@ int32 CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
  */
 int32 CFE_SB_SubscribeEx(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim)
 {
-    return CFE_SB_SubscribeFull(MsgId, PipeId, Quality, MsgLim, (uint8)CFE_SB_MSG_GLOBAL);
+    return CFE_SB_SubscribeFull(MsgId, PipeId, Quality, MsgLim, (uint8)CFE_SB_MSG_GLOBAL, NULL);
 
 } /* end CFE_SB_SubscribeEx */
 
+/*
+ * Function: CFE_SB_SubscribeFiltered - See API and header file for details
+ */
+int32 CFE_SB_SubscribeFiltered(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
+                               const CFE_SB_Filter_t *FilterPtr)
+{
+    return CFE_SB_SubscribeFull(MsgId, PipeId, Quality, MsgLim, (uint8)CFE_SB_MSG_GLOBAL, FilterPtr);
+
+} /* end CFE_SB_SubscribeFiltered */
+
 /*
  * Function: CFE_SB_SubscribeLocal - See API and header file for details
  */
 int32 CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 MsgLim)
 {
-    return CFE_SB_SubscribeFull(MsgId, PipeId, CFE_SB_DEFAULT_QOS, MsgLim, (uint8)CFE_SB_MSG_LOCAL);
+    return CFE_SB_SubscribeFull(MsgId, PipeId, CFE_SB_DEFAULT_QOS, MsgLim, (uint8)CFE_SB_MSG_LOCAL, NULL);
 
 } /* end CFE_SB_SubscribeLocal */
 
@@ -851,7 +865,7 @@ int32 CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16
 int32 CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 {
     return CFE_SB_SubscribeFull(MsgId, PipeId, CFE_SB_DEFAULT_QOS, (uint16)CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT,
-                                (uint8)CFE_SB_MSG_GLOBAL);
+                                (uint8)CFE_SB_MSG_GLOBAL, NULL);
 
 } /* end CFE_SB_Subscribe */
 
@@ -860,8 +874,8 @@ int32 CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 **
 ** Purpose: CFE Internal API used to subscribe to a message. Contains an input
 **          parameter for all possible subscription choices. This function is
-**          called by CFE_SB_SubscribeEx, CFE_SB_Subscribe and
-**          CFE_SB_SubscribeLocal.
+**          called by CFE_SB_SubscribeEx, CFE_SB_SubscribeFiltered,
+**          CFE_SB_Subscribe and CFE_SB_SubscribeLocal.
 **
 ** Assumptions, External Events, and Notes:
 **          Has the same typedef as the message Id
@@ -876,6 +890,7 @@ int32 CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 **          MsgLim  - Max number of messages, with this MsgId, allowed on the
 **                    pipe at any time.
 **          Scope   - Local subscription or broadcasted to peers
+**          FilterPtr - Decimation filter for the new destination, or NULL
 **
 ** Output Arguments:
 **          None
@@ -885,7 +900,7 @@ int32 CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 **
 ******************************************************************************/
 int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
-                           uint8 Scope)
+                           uint8 Scope, const CFE_SB_Filter_t *FilterPtr)
 {
     CFE_SBR_RouteId_t      RouteId;
     CFE_SB_PipeD_t *       PipeDscPtr;
@@ -925,8 +940,9 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
         PendingEventID = CFE_SB_SUB_INV_CALLER_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
     }
-    /* check message id key and scope */
-    else if (!CFE_SB_IsValidMsgId(MsgId) || (Scope > 1))
+    /* check message id key, scope and filter */
+    else if (!CFE_SB_IsValidMsgId(MsgId) || (Scope > 1) ||
+             (FilterPtr != NULL && FilterPtr->Type > CFE_SB_FilterType_NEVER))
     {
         PendingEventID = CFE_SB_SUB_ARG_ERR_EID;
         Status         = CFE_SB_BAD_ARGUMENT;
@@ -984,8 +1000,15 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
             }
         }
 
+        /* High priority delivery needs the pipe's ring, allocated on first use */
+        if (DestPtr == NULL && Quality.Priority != CFE_SB_QosPriority_LOW &&
+            CFE_SB_GetHighPrioRing(PipeDscPtr) != CFE_SUCCESS)
+        {
+            PendingEventID = CFE_SB_DEST_BLK_ERR_EID;
+            Status         = CFE_SB_BUF_ALOC_ERR;
+        }
         /* If no existing dest found, add one now */
-        if (DestPtr == NULL)
+        else if (DestPtr == NULL)
         {
             DestPtr = CFE_SB_GetDestinationBlk();
             if (DestPtr == NULL)
@@ -1002,8 +1025,21 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
                 DestPtr->BuffCount     = 0;
                 DestPtr->DestCnt       = 0;
                 DestPtr->Scope         = Scope;
+                DestPtr->Priority      = (Quality.Priority != CFE_SB_QosPriority_LOW) ? CFE_SB_QosPriority_HIGH
+                                                                                      : CFE_SB_QosPriority_LOW;
                 DestPtr->Prev          = NULL;
                 DestPtr->Next          = NULL;
+                DestPtr->LatestBuf     = NULL;
+                DestPtr->LatestSignal  = NULL;
+
+                if (FilterPtr != NULL)
+                {
+                    DestPtr->Filter = *FilterPtr;
+                }
+                else
+                {
+                    memset(&DestPtr->Filter, 0, sizeof(DestPtr->Filter));
+                }
 
                 /* add destination node */
                 CFE_SB_AddDestNode(RouteId, DestPtr);
@@ -1118,6 +1154,91 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
 
 } /* end CFE_SB_SubscribeFull */
 
+/*
+ * Function: CFE_SB_SetSubscriptionFilter - See API and header file for details
+ */
+int32 CFE_SB_SetSubscriptionFilter(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, const CFE_SB_Filter_t *FilterPtr)
+{
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_ES_AppId_t         AppId;
+    CFE_ES_TaskId_t        TskId;
+    int32                  Status;
+    const char *           ErrText;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
+
+    Status  = CFE_SB_BAD_ARGUMENT;
+    ErrText = NULL;
+    DestPtr = NULL;
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        ErrText = "Invalid Pipe Id";
+    }
+    else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+    {
+        ErrText = "Caller is not the owner of pipe";
+    }
+    else if (FilterPtr == NULL || FilterPtr->Type > CFE_SB_FilterType_NEVER || !CFE_SB_IsValidMsgId(MsgId))
+    {
+        ErrText = "Bad Arg";
+    }
+    else
+    {
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+        if (CFE_SBR_IsValidRouteId(RouteId))
+        {
+            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+        }
+
+        if (DestPtr == NULL)
+        {
+            ErrText = "No subscription";
+        }
+        else
+        {
+            DestPtr->Filter = *FilterPtr;
+            Status          = CFE_SUCCESS;
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SETFILTER_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
+                                   "Subscription filter set:Msg 0x%x on pipe %lu,type %d,N/X/O %d/%d/%d",
+                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                   (int)FilterPtr->Type, (int)FilterPtr->N, (int)FilterPtr->X, (int)FilterPtr->O);
+    }
+    else
+    {
+        /* get TaskId of caller for events */
+        CFE_ES_GetTaskID(&TskId);
+
+        CFE_EVS_SendEventWithAppID(CFE_SB_SETFILTER_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                   "SetSubscriptionFilter Err:%s,MsgId 0x%x,PipeId %lu,app %s", ErrText,
+                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                   CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+
+} /* end CFE_SB_SetSubscriptionFilter */
+
 /*
  * Function: CFE_SB_Unsubscribe - See API and header file for details
  */
@@ -1394,7 +1515,7 @@ int32 CFE_SB_TransmitMsg(CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount)
         BufDscPtr->MsgId        = MsgId;
         BufDscPtr->ContentSize  = Size;
         BufDscPtr->AutoSequence = IncrementSequenceCount;
-        CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+        BufDscPtr->ContentType  = CFE_MSG_FastGetType(MsgPtr);
 
         /*
          * This routine will use best-effort to send to all subscribers,
@@ -1459,7 +1580,7 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
 
     if (Status == CFE_SUCCESS)
     {
-        CFE_MSG_GetMsgId(MsgPtr, MsgIdPtr);
+        *MsgIdPtr = CFE_MSG_FastGetMsgId(MsgPtr);
 
         /* validate the msgid in the message */
         if (!CFE_SB_IsValidMsgId(*MsgIdPtr))
@@ -1471,7 +1592,7 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
 
     if (Status == CFE_SUCCESS)
     {
-        CFE_MSG_GetSize(MsgPtr, SizePtr);
+        *SizePtr = CFE_MSG_FastGetSize(MsgPtr);
 
         /* Verify the size of the pkt is < or = the mission defined max */
         if (*SizePtr > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
@@ -1558,18 +1679,23 @@ int32 CFE_SB_TransmitMsgValidate(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgI
  */
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  Status;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t          AppId;
+    CFE_ES_TaskId_t         TskId;
+    CFE_SB_DestinationD_t * DestPtr;
+    CFE_SB_PipeD_t *        PipeDscPtr;
+    CFE_SB_EventBuf_t       SBSndErr;
+    CFE_SB_PipePrioStats_t *PrioStatsPtr;
+    CFE_SB_BufferD_t *      QueueEntry;
+    int32                   Status;
+    uint32                  i;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+    char                    PipeName[OS_MAX_API_NAME];
 
     SBSndErr.EvtsToSnd = 0;
 
+    /* reference point for the pipe latency statistics */
+    CFE_PSP_GetTime(&BufDscPtr->EnqueueTime);
+
     /* get app id for loopback testing */
     CFE_ES_GetAppID(&AppId);
 
@@ -1615,6 +1741,26 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
                 continue;
             } /* end if */
 
+            /* Decimated messages are never written to the pipe */
+            if (DestPtr->Filter.Type != CFE_SB_FilterType_NONE && CFE_SB_IsMsgFiltered(BufDscPtr, &DestPtr->Filter))
+            {
+                continue;
+            } /* end if */
+
+            /*
+             * Latest-value pipe that already has an unread message of this MsgId
+             * signaled on its queue: swap in the new buffer and release the older one.
+             */
+            if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_LATESTVALUE) != 0 && DestPtr->LatestBuf != NULL)
+            {
+                CFE_SB_IncrBufUseCnt(BufDscPtr);
+                CFE_SB_DecrBufUseCnt(DestPtr->LatestBuf);
+                DestPtr->LatestBuf = BufDscPtr;
+                DestPtr->DestCnt++; /* used for statistics */
+
+                continue;
+            } /* end if */
+
             /* if Msg limit exceeded, log event, increment counter */
             /* and go to next destination */
             if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
@@ -1631,14 +1777,50 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             /*
             ** Write the buffer descriptor to the queue of the pipe.  If the write
             ** failed, log info and increment the pipe's error counter.
+            **
+            ** High priority messages go to the pipe's ring instead and only a
+            ** NULL wake token is written to the queue, unless one is already
+            ** there.  The receiver drains the whole ring before it blocks, so a
+            ** single token is enough and stale tokens cannot fill the queue.
             */
-            Status = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+            if (DestPtr->Priority == CFE_SB_QosPriority_LOW)
+            {
+                QueueEntry = BufDscPtr;
+                Status     = OS_QueuePut(PipeDscPtr->SysQueueId, &QueueEntry, sizeof(QueueEntry), 0);
+            }
+            else if (PipeDscPtr->HighPrioRing == NULL || PipeDscPtr->HighPrioCount >= PipeDscPtr->MaxQueueDepth)
+            {
+                Status = OS_QUEUE_FULL;
+            }
+            else
+            {
+                Status = OS_SUCCESS;
+                if (!PipeDscPtr->HighPrioTokenQueued)
+                {
+                    QueueEntry = NULL;
+                    Status     = OS_QueuePut(PipeDscPtr->SysQueueId, &QueueEntry, sizeof(QueueEntry), 0);
+                    PipeDscPtr->HighPrioTokenQueued = (Status == OS_SUCCESS);
+                }
+
+                if (Status == OS_SUCCESS)
+                {
+                    CFE_SB_HighPrioRingPush(PipeDscPtr, BufDscPtr);
+                }
+            }
 
             if (Status == OS_SUCCESS)
             {
-                /* The queue now holds a ref to the buffer, so increment its ref count. */
+                /* The queue (or ring) now holds a ref to the buffer, so increment its ref count. */
                 CFE_SB_IncrBufUseCnt(BufDscPtr);
 
+                /* Latest-value pipes also hold a ref in the destination's slot */
+                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_LATESTVALUE) != 0)
+                {
+                    CFE_SB_IncrBufUseCnt(BufDscPtr);
+                    DestPtr->LatestBuf    = BufDscPtr;
+                    DestPtr->LatestSignal = BufDscPtr;
+                }
+
                 DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
                 DestPtr->DestCnt++;   /* used for statistics */
                 ++PipeDscPtr->CurrentQueueDepth;
@@ -1646,6 +1828,13 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
                 {
                     PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
                 }
+
+                PrioStatsPtr = &PipeDscPtr->PrioStats[DestPtr->Priority];
+                ++PrioStatsPtr->CurrentQueueDepth;
+                if (PrioStatsPtr->CurrentQueueDepth >= PrioStatsPtr->PeakQueueDepth)
+                {
+                    PrioStatsPtr->PeakQueueDepth = PrioStatsPtr->CurrentQueueDepth;
+                }
             }
             else if (Status == OS_QUEUE_FULL)
             {
@@ -1778,18 +1967,25 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
  */
 int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
 {
-    int32                  Status;
-    int32                  RcvStatus;
-    CFE_SB_BufferD_t *     BufDscPtr;
-    size_t                 BufDscSize;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_ES_TaskId_t        TskId;
-    uint16                 PendingEventID;
-    osal_id_t              SysQueueId;
-    int32                  SysTimeout;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
+    int32                   Status;
+    int32                   RcvStatus;
+    CFE_SB_BufferD_t *      BufDscPtr;
+    CFE_SB_BufferD_t *      LatestBufDscPtr;
+    size_t                  BufDscSize;
+    CFE_SB_PipeD_t *        PipeDscPtr;
+    CFE_SB_DestinationD_t * DestPtr;
+    CFE_SB_PipePrioStats_t *PrioStatsPtr;
+    CFE_SBR_RouteId_t       RouteId;
+    CFE_ES_TaskId_t         TskId;
+    uint16                  PendingEventID;
+    osal_id_t               SysQueueId;
+    int32                   SysTimeout;
+    bool                    IsHighPrio;
+    OS_time_t               RcvTime;
+    OS_time_t               WaitStart;
+    int64                   LatencyUsec;
+    int64                   WaitedMsec;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
@@ -1800,6 +1996,8 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
     DestPtr        = NULL;
     BufDscSize     = 0;
     RcvStatus      = OS_SUCCESS;
+    IsHighPrio     = false;
+    WaitStart      = OS_TimeAssembleFromNanoseconds(0, 0);
 
     /*
      * Check input args and see if any are bad, which require
@@ -1872,20 +2070,70 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
                 CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
                 PipeDscPtr->LastBuffer = NULL;
             }
+
+            /*
+             * High priority messages are delivered ahead of anything on the queue.
+             * A wake token left queued is skipped when it is read later, and no
+             * further token is queued until then.
+             */
+            BufDscPtr  = CFE_SB_HighPrioRingPop(PipeDscPtr);
+            IsHighPrio = (BufDscPtr != NULL);
         }
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
+    /* Start of the caller's timeout, retries after a stale wake token only wait for the rest */
+    if (Status == CFE_SUCCESS && TimeOut > 0)
+    {
+        CFE_PSP_GetTime(&WaitStart);
+    }
+
     /*
      * If everything validated, then proceed to get a buffer from the queue.
      * This must be done OUTSIDE the SB lock, as this call likely blocks.
      */
-    if (Status == CFE_SUCCESS)
+    while (Status == CFE_SUCCESS && BufDscPtr == NULL)
     {
         /* Read the buffer descriptor address from the queue.  */
         RcvStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
 
+        /*
+         * A NULL entry is the wake token of high priority messages.  If the ring
+         * is empty they were already delivered, so wait for the next entry.
+         */
+        if (RcvStatus == OS_SUCCESS && BufDscPtr == NULL && BufDscSize == sizeof(BufDscPtr))
+        {
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+            {
+                PipeDscPtr->HighPrioTokenQueued = false;
+
+                BufDscPtr  = CFE_SB_HighPrioRingPop(PipeDscPtr);
+                IsHighPrio = (BufDscPtr != NULL);
+            }
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+            if (BufDscPtr == NULL && TimeOut <= 0)
+            {
+                continue;
+            }
+
+            if (BufDscPtr == NULL)
+            {
+                CFE_PSP_GetTime(&RcvTime);
+                WaitedMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(RcvTime, WaitStart));
+                if (WaitedMsec < TimeOut)
+                {
+                    SysTimeout = TimeOut - (int32)WaitedMsec;
+                    continue;
+                }
+
+                /* The stale token used up the rest of the caller's timeout */
+                RcvStatus = OS_QUEUE_TIMEOUT;
+            }
+        }
+
         /*
          * translate the return value -
          *
@@ -1912,6 +2160,7 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
             PendingEventID = CFE_SB_Q_RD_ERR_EID;
             Status         = CFE_SB_PIPE_RD_ERR;
         }
+        break;
     }
 
     /* Now re-lock to store the buffer in the pipe descriptor */
@@ -1926,6 +2175,29 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
          */
         if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
         {
+            /* get pointer to destination to be used in decrementing msg limit cnt*/
+            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
+            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+
+            /*
+            ** For a latest-value destination the queue entry only signals that
+            ** a message is pending; deliver the newest buffer held in the slot
+            ** instead.  The slot ref takes the place of the queue ref, which is
+            ** released here for the signaling buffer.
+            **
+            ** Only the entry queued along with the slot is the signal.  Entries
+            ** queued before the pipe became latest-value are delivered as-is,
+            ** otherwise the slot buffer would be delivered once per entry.
+            */
+            if (DestPtr != NULL && DestPtr->LatestBuf != NULL && DestPtr->LatestSignal == BufDscPtr)
+            {
+                LatestBufDscPtr       = DestPtr->LatestBuf;
+                DestPtr->LatestBuf    = NULL;
+                DestPtr->LatestSignal = NULL;
+                CFE_SB_DecrBufUseCnt(BufDscPtr);
+                BufDscPtr = LatestBufDscPtr;
+            }
+
             /*
             ** Load the pipe tables 'CurrentBuff' with the buffer descriptor
             ** ptr corresponding to the message just read. This is done so that
@@ -1942,10 +2214,6 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
              */
             *BufPtr = &BufDscPtr->Content;
 
-            /* get pointer to destination to be used in decrementing msg limit cnt*/
-            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
-            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
-
             /*
             ** DestPtr would be NULL if the msg is unsubscribed to while it is on
             ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
@@ -1961,6 +2229,34 @@ int32 CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int
             {
                 --PipeDscPtr->CurrentQueueDepth;
             }
+
+            /* Per-priority depth and transmit to receive latency */
+            PrioStatsPtr = &PipeDscPtr->PrioStats[IsHighPrio ? CFE_SB_QosPriority_HIGH : CFE_SB_QosPriority_LOW];
+            if (PrioStatsPtr->CurrentQueueDepth > 0)
+            {
+                --PrioStatsPtr->CurrentQueueDepth;
+            }
+
+            RcvTime = BufDscPtr->EnqueueTime; /* reads as zero latency if the clock is unavailable */
+            CFE_PSP_GetTime(&RcvTime);
+            LatencyUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(RcvTime, BufDscPtr->EnqueueTime));
+            if (LatencyUsec < 0)
+            {
+                LatencyUsec = 0;
+            }
+            else if (LatencyUsec > 0xFFFFFFFF)
+            {
+                LatencyUsec = 0xFFFFFFFF;
+            }
+
+            ++PipeDscPtr->LatencyHist[CFE_SB_LatencyHistBin(LatencyUsec)];
+
+            ++PrioStatsPtr->RcvCount;
+            PrioStatsPtr->TotalLatencyUsec += LatencyUsec;
+            if (LatencyUsec > PrioStatsPtr->MaxLatencyUsec)
+            {
+                PrioStatsPtr->MaxLatencyUsec = LatencyUsec;
+            }
         }
         else
         {
@@ -2170,7 +2466,7 @@ int32 CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount
         if (Status == CFE_SUCCESS)
         {
             BufDscPtr->AutoSequence = IncrementSequenceCount;
-            CFE_MSG_GetType(&BufPtr->Msg, &BufDscPtr->ContentType);
+            BufDscPtr->ContentType  = CFE_MSG_FastGetType(&BufPtr->Msg);
 
             /* Now broadcast the message, which consumes the buffer */
             CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
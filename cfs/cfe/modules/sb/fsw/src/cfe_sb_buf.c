@@ -314,4 +314,96 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 
 } /* end CFE_SB_PutDestinationBlk */
 
+/******************************************************************************
+**  Function:   CFE_SB_GetHighPrioRing()
+**
+**  Purpose:
+**    This function allocates the high priority message ring of a pipe from
+**    the SB memory pool, sized to hold the full depth of the pipe.  It does
+**    nothing if the pipe already has a ring.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    CFE_SUCCESS or CFE_SB_BUF_ALOC_ERR
+*/
+int32 CFE_SB_GetHighPrioRing(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    int32 Stat;
+
+    if (PipeDscPtr->HighPrioRing != NULL)
+    {
+        return CFE_SUCCESS;
+    } /* end if */
+
+    Stat = CFE_ES_GetPoolBuf((CFE_ES_MemPoolBuf_t *)&PipeDscPtr->HighPrioRing, CFE_SB_Global.Mem.PoolHdl,
+                             PipeDscPtr->MaxQueueDepth * sizeof(CFE_SB_BufferD_t *));
+    if (Stat < 0)
+    {
+        PipeDscPtr->HighPrioRing = NULL;
+        return CFE_SB_BUF_ALOC_ERR;
+    } /* end if */
+
+    memset(PipeDscPtr->HighPrioRing, 0, PipeDscPtr->MaxQueueDepth * sizeof(CFE_SB_BufferD_t *));
+    PipeDscPtr->HighPrioHead  = 0;
+    PipeDscPtr->HighPrioCount = 0;
+
+    /* Add the size of the ring to the memory-in-use ctr and */
+    /* adjust the high water mark if needed */
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
+    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
+    } /* end if */
+
+    return CFE_SUCCESS;
+
+} /* end CFE_SB_GetHighPrioRing */
+
+/******************************************************************************
+**  Function:   CFE_SB_PutHighPrioRing()
+**
+**  Purpose:
+**    This function releases any buffers still held in the high priority ring
+**    of a pipe and returns the ring to the SB memory pool.
+**
+**  Note:
+**    This must only be invoked while holding the SB global lock
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor
+**
+**  Return:
+**    None
+*/
+void CFE_SB_PutHighPrioRing(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+    int32             Stat;
+
+    if (PipeDscPtr->HighPrioRing == NULL)
+    {
+        return;
+    } /* end if */
+
+    while ((BufDscPtr = CFE_SB_HighPrioRingPop(PipeDscPtr)) != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    }
+
+    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, PipeDscPtr->HighPrioRing);
+    if (Stat > 0)
+    {
+        /* Substract the size of the ring from the Memory in use ctr */
+        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
+    } /* end if */
+
+    PipeDscPtr->HighPrioRing = NULL;
+
+} /* end CFE_SB_PutHighPrioRing */
+
 /*****************************************************************************/
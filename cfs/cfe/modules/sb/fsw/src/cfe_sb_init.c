@@ -98,6 +98,10 @@ int32 CFE_SB_EarlyInit(void)
     CFE_MSG_Init(&CFE_SB_Global.StatTlmMsg.Hdr.Msg, CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID),
                  sizeof(CFE_SB_Global.StatTlmMsg));
 
+    /* Initialize the SB Latency Pkt */
+    CFE_MSG_Init(&CFE_SB_Global.LatencyTlmMsg.Hdr.Msg, CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID),
+                 sizeof(CFE_SB_Global.LatencyTlmMsg));
+
     return Stat;
 
 } /* end CFE_SB_EarlyInit */
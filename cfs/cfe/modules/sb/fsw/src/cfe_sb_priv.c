@@ -298,40 +298,34 @@ bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId)
 **  Return:
 **    Pointer to App.Tsk Name
 **
-**  Note: With taskId, Parent App name and Child Task name can be queried from ES
+**  Note: With taskId, Parent App name and Child Task name can be queried from ES.
+**        This is used when reporting errors, possibly while the system is
+**        overloaded, so it uses the ES lookup which does not take the ES lock.
 **
 */
 char *CFE_SB_GetAppTskName(CFE_ES_TaskId_t TaskId, char *FullName)
 {
+    char AppName[OS_MAX_API_NAME];
+    char TskName[OS_MAX_API_NAME];
 
-    CFE_ES_TaskInfo_t  TaskInfo;
-    CFE_ES_TaskInfo_t *ptr = &TaskInfo;
-    char               AppName[OS_MAX_API_NAME];
-    char               TskName[OS_MAX_API_NAME];
-
-    if (CFE_ES_GetTaskInfo(ptr, TaskId) != CFE_SUCCESS)
+    if (CFE_ES_GetAppAndTaskName(AppName, TskName, TaskId, sizeof(AppName)) != CFE_SUCCESS)
     {
 
         /* unlikely, but possible if TaskId is bogus */
         strncpy(FullName, "Unknown", OS_MAX_API_NAME - 1);
         FullName[OS_MAX_API_NAME - 1] = '\0';
     }
-    else if (strncmp((char *)ptr->AppName, (char *)ptr->TaskName, sizeof(ptr->AppName)) == 0)
+    else if (strncmp(AppName, TskName, sizeof(AppName)) == 0)
     {
 
         /* if app name and task name are the same */
-        strncpy(FullName, (char *)ptr->AppName, OS_MAX_API_NAME - 1);
+        strncpy(FullName, AppName, OS_MAX_API_NAME - 1);
         FullName[OS_MAX_API_NAME - 1] = '\0';
     }
     else
     {
 
-        /* AppName and TskName buffers and strncpy are needed to limit string sizes */
-        strncpy(AppName, (char *)ptr->AppName, sizeof(AppName) - 1);
-        AppName[sizeof(AppName) - 1] = '\0';
-        strncpy(TskName, (char *)ptr->TaskName, sizeof(TskName) - 1);
-        TskName[sizeof(TskName) - 1] = '\0';
-
+        /* AppName and TskName buffers are already limited to OS_MAX_API_NAME */
         sprintf(FullName, "%s.%s", AppName, TskName);
 
     } /* end if */
@@ -449,11 +443,110 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
  */
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
+    /* Release the ref held by a latest-value slot */
+    if (DestPtr->LatestBuf != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(DestPtr->LatestBuf);
+        DestPtr->LatestBuf    = NULL;
+        DestPtr->LatestSignal = NULL;
+    }
+
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
     CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
 }
 
+/******************************************************************************
+ * SB private function to evaluate a subscription filter - see description in header
+ */
+bool CFE_SB_IsMsgFiltered(CFE_SB_BufferD_t *BufDscPtr, const CFE_SB_Filter_t *FilterPtr)
+{
+    CFE_MSG_SequenceCount_t SeqCnt;
+    CFE_TIME_SysTime_t      MsgTime;
+    uint16                  FilterValue;
+
+    if (FilterPtr->Type == CFE_SB_FilterType_NONE || FilterPtr->Type == CFE_SB_FilterType_NEVER)
+    {
+        return false;
+    }
+
+    /* Invalid parameters or an unknown type filter everything */
+    if (FilterPtr->X == 0 || FilterPtr->N == 0 || FilterPtr->N > FilterPtr->X || FilterPtr->O >= FilterPtr->X)
+    {
+        return true;
+    }
+
+    if (FilterPtr->Type == CFE_SB_FilterType_BY_SEQ_CNT)
+    {
+        CFE_MSG_GetSequenceCount(&BufDscPtr->Content.Msg, &SeqCnt);
+        FilterValue = (uint16)SeqCnt;
+    }
+    else if (FilterPtr->Type == CFE_SB_FilterType_BY_TIME)
+    {
+        /* 11 LSBs of seconds followed by the 4 MSBs of subseconds */
+        CFE_MSG_GetMsgTime(&BufDscPtr->Content.Msg, &MsgTime);
+        FilterValue = (uint16)(((MsgTime.Seconds & 0x07FF) << 4) | (MsgTime.Subseconds >> 28));
+    }
+    else
+    {
+        return true;
+    }
+
+    return (FilterValue < FilterPtr->O || ((FilterValue - FilterPtr->O) % FilterPtr->X) >= FilterPtr->N);
+}
+
+/******************************************************************************
+ * SB private function to queue a high priority buffer - see description in header
+ */
+void CFE_SB_HighPrioRingPush(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    uint16 Idx;
+
+    Idx = (PipeDscPtr->HighPrioHead + PipeDscPtr->HighPrioCount) % PipeDscPtr->MaxQueueDepth;
+
+    PipeDscPtr->HighPrioRing[Idx] = BufDscPtr;
+    ++PipeDscPtr->HighPrioCount;
+}
+
+/******************************************************************************
+ * SB private function to dequeue a high priority buffer - see description in header
+ */
+CFE_SB_BufferD_t *CFE_SB_HighPrioRingPop(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    if (PipeDscPtr->HighPrioRing == NULL || PipeDscPtr->HighPrioCount == 0)
+    {
+        return NULL;
+    }
+
+    BufDscPtr = PipeDscPtr->HighPrioRing[PipeDscPtr->HighPrioHead];
+
+    PipeDscPtr->HighPrioRing[PipeDscPtr->HighPrioHead] = NULL;
+    PipeDscPtr->HighPrioHead = (PipeDscPtr->HighPrioHead + 1) % PipeDscPtr->MaxQueueDepth;
+    --PipeDscPtr->HighPrioCount;
+
+    return BufDscPtr;
+}
+
+/******************************************************************************
+ * SB private function to bin a queueing delay - see description in header
+ */
+uint32 CFE_SB_LatencyHistBin(uint32 LatencyUsec)
+{
+    uint32 Bin;
+
+    /* Bin is the bit length of the delay, saturating at the last bin */
+    Bin = 0;
+    while (LatencyUsec != 0 && Bin < (CFE_SB_LATENCY_HIST_BINS - 1))
+    {
+        LatencyUsec >>= 1;
+        ++Bin;
+    }
+
+    return Bin;
+}
+
 /******************************************************************************
  * SB private function to remove a destination node - see description in header
  */
@@ -37,6 +37,7 @@
 */
 #include "cfe_platform_cfg.h"
 #include "common_types.h"
+#include "osapi-clock.h"
 #include "cfe_sb_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
 #include "cfe_sbr_api_typedefs.h"
@@ -153,20 +154,45 @@ typedef struct CFE_SB_BufferD
 
     bool AutoSequence; /**< If message should get its sequence number assigned from the route */
 
+    OS_time_t EnqueueTime; /**< Time the message was broadcast, for pipe latency statistics */
+
     uint16 UseCount; /**< Number of active references to this buffer in the system */
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 
 } CFE_SB_BufferD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_PipePrioStats_t
+**
+**  Purpose:
+**     This structure holds the queueing statistics of one QoS priority
+**     level on a pipe.
+*/
+
+typedef struct
+{
+    uint16 CurrentQueueDepth; /**< Messages of this priority currently on the pipe */
+    uint16 PeakQueueDepth;    /**< High watermark of CurrentQueueDepth */
+    uint32 RcvCount;          /**< Messages of this priority received from the pipe */
+    uint32 MaxLatencyUsec;    /**< Longest transmit to receive time */
+    uint64 TotalLatencyUsec;  /**< Sum of transmit to receive times, for the average */
+} CFE_SB_PipePrioStats_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
 **  Purpose:
 **     This structure defines a pipe descriptor used to specify the
 **     characteristics and status of a pipe.
+**
+**     High priority messages are held in HighPrioRing, which is allocated
+**     from the SB pool on the first high priority subscription.  A NULL wake
+**     token is written to the OS queue so a blocked receiver is woken, the
+**     receiver then takes the ring entries ahead of the queue.  At most one
+**     token is queued at a time (HighPrioTokenQueued), as a receiver may take
+**     ring entries without reading the token that announced them.
 */
-
 typedef struct
 {
     CFE_SB_PipeId_t   PipeId;
@@ -179,6 +205,14 @@ typedef struct
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
     CFE_SB_BufferD_t *LastBuffer;
+
+    CFE_SB_BufferD_t **HighPrioRing;        /* MaxQueueDepth entries, NULL until needed */
+    uint16             HighPrioHead;        /* Index of the oldest entry in HighPrioRing */
+    uint16             HighPrioCount;       /* Number of entries in HighPrioRing */
+    bool               HighPrioTokenQueued; /* A wake token is in the OS queue and not yet read */
+
+    CFE_SB_PipePrioStats_t PrioStats[CFE_SB_QOS_PRIORITY_LEVELS];
+    uint32                 LatencyHist[CFE_SB_LATENCY_HIST_BINS];
 } CFE_SB_PipeD_t;
 
 /******************************************************************************
@@ -246,6 +280,7 @@ typedef struct
     CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
     CFE_SB_HousekeepingTlm_t     HKTlmMsg;
     CFE_SB_StatsTlm_t            StatTlmMsg;
+    CFE_SB_LatencyStatsTlm_t     LatencyTlmMsg;
     CFE_SB_PipeId_t              CmdPipe;
     CFE_SB_MemParams_t           Mem;
     CFE_SB_AllSubscriptionsTlm_t PrevSubMsg;
@@ -308,7 +343,7 @@ char *CFE_SB_GetAppTskName(CFE_ES_TaskId_t TaskId, char *FullName);
 int32 CFE_SB_DeletePipeWithAppId(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId);
 int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId);
 int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
-                           uint8 Scope);
+                           uint8 Scope, const CFE_SB_Filter_t *FilterPtr);
 
 int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId);
 
@@ -327,6 +362,8 @@ uint32 CFE_SB_RequestToSendEvent(CFE_ES_TaskId_t TaskId, uint32 Bit);
 void   CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, uint32 Bit);
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
 int32                  CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
+int32                  CFE_SB_GetHighPrioRing(CFE_SB_PipeD_t *PipeDscPtr);
+void                   CFE_SB_PutHighPrioRing(CFE_SB_PipeD_t *PipeDscPtr);
 
 /**
  * \brief For SB buffer tracking, get first/next position in a list
@@ -467,6 +504,54 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
  */
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
 
+/**
+ * \brief Evaluate a subscription decimation filter
+ *
+ * Private function that checks whether a message is filtered out for a
+ * destination, see #CFE_SB_Filter_t for the algorithm
+ *
+ * \param[in] BufDscPtr Buffer descriptor of the message being sent
+ * \param[in] FilterPtr Filter of the destination
+ *
+ * \returns true if the message must not be delivered, false otherwise
+ */
+bool CFE_SB_IsMsgFiltered(CFE_SB_BufferD_t *BufDscPtr, const CFE_SB_Filter_t *FilterPtr);
+
+/**
+ * \brief Append a buffer to the high priority ring of a pipe
+ *
+ * Private function that stores a high priority message for delivery ahead
+ * of the pipe's OS queue.  The ring entry takes over the caller's ref.
+ *
+ * \note Assumes the ring is allocated and not full
+ *
+ * \param[in] PipeDscPtr Pipe descriptor
+ * \param[in] BufDscPtr  Buffer descriptor of the message
+ */
+void CFE_SB_HighPrioRingPush(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/**
+ * \brief Remove the oldest buffer from the high priority ring of a pipe
+ *
+ * Private function, the ref held by the ring entry is passed to the caller
+ *
+ * \param[in] PipeDscPtr Pipe descriptor
+ *
+ * \returns The buffer descriptor, or NULL if the ring is empty or not allocated
+ */
+CFE_SB_BufferD_t *CFE_SB_HighPrioRingPop(CFE_SB_PipeD_t *PipeDscPtr);
+
+/**
+ * \brief Get the latency histogram bin of a queueing delay
+ *
+ * Private function, see #CFE_SB_LATENCY_HIST_BINS for the bin boundaries
+ *
+ * \param[in] LatencyUsec Queueing delay in microseconds
+ *
+ * \returns Index into a latency histogram
+ */
+uint32 CFE_SB_LatencyHistBin(uint32 LatencyUsec);
+
 /**
  * \brief Get destination pointer for PipeId from RouteId
  *
@@ -516,6 +601,7 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_MSG_CommandHeader_t *data);
 int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data);
 int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data);
 int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data);
+int32 CFE_SB_SendLatencyStatsCmd(const CFE_SB_SendLatencyStatsCmd_t *data);
 int32 CFE_SB_WriteRoutingInfoCmd(const CFE_SB_WriteRoutingInfoCmd_t *data);
 int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data);
 int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data);
@@ -422,6 +422,13 @@ void CFE_SB_ProcessCmdPipePkt(CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_SB_SEND_LATENCY_STATS_CC:
+                    if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendLatencyStatsCmd_t)))
+                    {
+                        CFE_SB_SendLatencyStatsCmd((CFE_SB_SendLatencyStatsCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 case CFE_SB_WRITE_ROUTING_INFO_CC:
                     if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteRoutingInfoCmd_t)))
                     {
@@ -811,6 +818,76 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     return CFE_SUCCESS;
 } /* CFE_SB_SendStatsCmd */
 
+/******************************************************************************
+**  Function:  CFE_SB_SendLatencyStatsCmd()
+**
+**  Purpose:
+**    SB internal function to send the Software Bus pipe latency packet
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+int32 CFE_SB_SendLatencyStatsCmd(const CFE_SB_SendLatencyStatsCmd_t *data)
+{
+    uint32                     PipeDscCount;
+    uint32                     PipeStatCount;
+    uint32                     Prio;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    CFE_SB_PipeLatencyStats_t *PipeStatPtr;
+
+    CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+    /* Collect data on pipes */
+    PipeDscCount  = CFE_PLATFORM_SB_MAX_PIPES;
+    PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
+    PipeDscPtr    = CFE_SB_Global.PipeTbl;
+    PipeStatPtr   = CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats;
+
+    while (PipeDscCount > 0 && PipeStatCount > 0)
+    {
+        if (CFE_SB_PipeDescIsUsed(PipeDscPtr))
+        {
+            PipeStatPtr->PipeId = PipeDscPtr->PipeId;
+
+            PipeStatPtr->RcvCount = 0;
+            for (Prio = 0; Prio < CFE_SB_QOS_PRIORITY_LEVELS; ++Prio)
+            {
+                PipeStatPtr->RcvCount += PipeDscPtr->PrioStats[Prio].RcvCount;
+            }
+
+            memcpy(PipeStatPtr->LatencyHist, PipeDscPtr->LatencyHist, sizeof(PipeStatPtr->LatencyHist));
+
+            ++PipeStatPtr;
+            --PipeStatCount;
+        }
+
+        --PipeDscCount;
+        ++PipeDscPtr;
+    }
+
+    CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+
+    while (PipeStatCount > 0)
+    {
+        memset(PipeStatPtr, 0, sizeof(*PipeStatPtr));
+
+        ++PipeStatPtr;
+        --PipeStatCount;
+    }
+
+    CFE_SB_TimeStampMsg(&CFE_SB_Global.LatencyTlmMsg.Hdr.Msg);
+    CFE_SB_TransmitMsg(&CFE_SB_Global.LatencyTlmMsg.Hdr.Msg, true);
+
+    CFE_EVS_SendEvent(CFE_SB_SND_LATENCY_EID, CFE_EVS_EventType_DEBUG, "Software Bus Latency packet sent");
+
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
+
+    return CFE_SUCCESS;
+} /* CFE_SB_SendLatencyStatsCmd */
+
 /******************************************************************************
  * Local callback helper for writing routing info to a file
  */
@@ -1059,8 +1136,11 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
     CFE_SB_BackgroundFileStateInfo_t *BgFilePtr;
     CFE_SB_PipeInfoEntry_t *          PipeBufferPtr;
     CFE_SB_PipeD_t *                  PipeDscPtr;
+    CFE_SB_PipePrioStats_t *          PrioStatsPtr;
+    CFE_SB_PipePrioInfo_t *           PrioInfoPtr;
     osal_id_t                         SysQueueId = OS_OBJECT_ID_UNDEFINED;
     bool                              PipeIsValid;
+    uint32                            Prio;
 
     BgFilePtr   = (CFE_SB_BackgroundFileStateInfo_t *)Meta;
     PipeDscPtr  = NULL;
@@ -1096,6 +1176,23 @@ bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer,
             PipeBufferPtr->CurrentQueueDepth = PipeDscPtr->CurrentQueueDepth;
             PipeBufferPtr->PeakQueueDepth    = PipeDscPtr->PeakQueueDepth;
 
+            for (Prio = 0; Prio < CFE_SB_QOS_PRIORITY_LEVELS; ++Prio)
+            {
+                PrioStatsPtr = &PipeDscPtr->PrioStats[Prio];
+                PrioInfoPtr  = &PipeBufferPtr->PrioInfo[Prio];
+
+                PrioInfoPtr->CurrentQueueDepth = PrioStatsPtr->CurrentQueueDepth;
+                PrioInfoPtr->PeakQueueDepth    = PrioStatsPtr->PeakQueueDepth;
+                PrioInfoPtr->RcvCount          = PrioStatsPtr->RcvCount;
+                PrioInfoPtr->MaxLatencyUsec    = PrioStatsPtr->MaxLatencyUsec;
+                if (PrioStatsPtr->RcvCount > 0)
+                {
+                    PrioInfoPtr->AvgLatencyUsec = PrioStatsPtr->TotalLatencyUsec / PrioStatsPtr->RcvCount;
+                }
+            }
+
+            memcpy(PipeBufferPtr->LatencyHist, PipeDscPtr->LatencyHist, sizeof(PipeBufferPtr->LatencyHist));
+
             SysQueueId = PipeDscPtr->SysQueueId;
         }
 
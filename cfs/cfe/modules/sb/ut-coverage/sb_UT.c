@@ -212,16 +212,13 @@ void Test_SB_AppInit_EVSRegFail(void)
 */
 void Test_SB_AppInit_EVSSendEvtFail(void)
 {
-    int32             ForcedRtnVal = -1;
-    CFE_ES_TaskInfo_t TestTaskInfo;
+    int32 ForcedRtnVal = -1;
+    char  TestTaskName[] = "test";
 
     /* To get coverage on CFE_SB_GetAppTskName(), this ensures that the
      * path with different app/task names is followed on at least one event.
      */
-    memset(&TestTaskInfo, 0, sizeof(TestTaskInfo));
-    strncpy(TestTaskInfo.TaskName, "test", sizeof(TestTaskInfo.TaskName) - 1);
-    TestTaskInfo.TaskName[sizeof(TestTaskInfo.TaskName) - 1] = '\0';
-    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TestTaskInfo, sizeof(TestTaskInfo), false);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetAppAndTaskName), TestTaskName, sizeof(TestTaskName) - 1, false);
 
     /* There are three events prior to init, pipe created (1) and subscription
      * rcvd (2). Fourth is SB initialized, but it is the first to use SendEvent.
@@ -368,6 +365,7 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Noop);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RstCtrs);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_Stats);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_LatencyStats);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_BackgroundFileWriteEvents);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_RoutingInfoAlreadyPending);
@@ -484,6 +482,77 @@ void Test_SB_Cmds_Stats(void)
 
 } /* end Test_SB_Cmds_Stats */
 
+/*
+** Test send SB latency stats command
+*/
+void Test_SB_Cmds_LatencyStats(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        CFE_SB_SendLatencyStatsCmd_t Cmd;
+    } SendLatencyStats;
+    CFE_SB_PipeId_t            PipeId;
+    SB_UT_Test_Tlm_t           TlmPkt;
+    CFE_SB_Buffer_t *          SBBufPtr;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    CFE_SB_PipeLatencyStats_t *PipeStatPtr;
+    OS_time_t                  Times[2];
+    CFE_MSG_FcnCode_t          FcnCode;
+    CFE_SB_MsgId_t             MsgId;
+    CFE_MSG_Size_t             Size;
+    CFE_MSG_Type_t             Type = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LatencyTestPipe"));
+    SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+
+    /* Message waits 100 usec on the pipe, which falls in bin 7 (64 to 127 usec) */
+    Times[0] = OS_TimeAssembleFromMicroseconds(10, 0);
+    Times[1] = OS_TimeAssembleFromMicroseconds(10, 100);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+
+    MsgId = SB_UT_TLM_MID;
+    Size  = sizeof(TlmPkt);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    SETUP(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    ASSERT_EQ(PipeDscPtr->LatencyHist[7], 1);
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_LOW].MaxLatencyUsec, 100);
+
+    /* For internal TransmitMsg call */
+    MsgId = CFE_SB_ValueToMsgId(CFE_SB_LATENCY_TLM_MID);
+    Size  = sizeof(CFE_SB_Global.LatencyTlmMsg);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    /* For Generic command processing */
+    MsgId   = CFE_SB_ValueToMsgId(CFE_SB_CMD_MID);
+    Size    = sizeof(SendLatencyStats.Cmd);
+    FcnCode = CFE_SB_SEND_LATENCY_STATS_CC;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    CFE_SB_ProcessCmdPipePkt(&SendLatencyStats.SBBuf);
+
+    PipeStatPtr = &CFE_SB_Global.LatencyTlmMsg.Payload.PipeLatencyStats[0];
+    ASSERT_TRUE(CFE_RESOURCEID_TEST_EQUAL(PipeStatPtr->PipeId, PipeId));
+    ASSERT_EQ(PipeStatPtr->RcvCount, 1);
+    ASSERT_EQ(PipeStatPtr->LatencyHist[7], 1);
+
+    /* Pipe creation, subscription, no subs and command processing events */
+    EVTCNT(4);
+
+    EVTSENT(CFE_SB_SND_LATENCY_EID);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_SB_Cmds_LatencyStats */
+
 /*
 ** Test write routing information command using the default file name
 */
@@ -1561,7 +1630,7 @@ void Test_CreatePipe_NullPtr(void)
     uint16 PipeDepth = 10;
 
     /* This provides completion of code coverage in CFE_SB_GetAppTskName() */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppAndTaskName), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
     UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_SUCCESS); /* Avoids creating socket */
     ASSERT_EQ(CFE_SB_CreatePipe(NULL, PipeDepth, "TestPipe"), CFE_SB_BAD_ARGUMENT);
@@ -2075,6 +2144,8 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SubscriptionReporting);
     SB_UT_ADD_SUBTEST(Test_Subscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Filtered);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_SetSubscriptionFilter);
 } /* end Test_Subscribe_API */
 
 /*
@@ -2382,7 +2453,7 @@ void Test_Subscribe_SubscriptionReporting(void)
     SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
 
     /* Subscribe to message: LOCAL */
-    ASSERT(CFE_SB_SubscribeFull(MsgId, PipeId, Quality, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT, CFE_SB_MSG_LOCAL));
+    ASSERT(CFE_SB_SubscribeFull(MsgId, PipeId, Quality, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT, CFE_SB_MSG_LOCAL, NULL));
 
     EVTCNT(6);
 
@@ -2426,6 +2497,95 @@ void Test_Subscribe_InvalidPipeOwner(void)
 
 } /* end Test_Subscribe_InvalidPipeOwner */
 
+/*
+** Test message decimation by a subscription filter
+*/
+void Test_Subscribe_Filtered(void)
+{
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_MsgId_t          MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_Filter_t         Filter = {.Type = CFE_SB_FilterType_BY_SEQ_CNT, .N = 1, .X = 2, .O = 0};
+    CFE_SB_Filter_t         BadFilter = {.Type = CFE_SB_FilterType_NEVER + 1};
+    CFE_MSG_Size_t          Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t          Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_SequenceCount_t SeqCnt;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "FilterTestPipe"));
+
+    ASSERT_EQ(CFE_SB_SubscribeFiltered(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 4, &BadFilter), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SUB_ARG_ERR_EID);
+
+    ASSERT(CFE_SB_SubscribeFiltered(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 4, &Filter));
+
+    /* Only the even sequence counts are delivered */
+    for (SeqCnt = 0; SeqCnt < 4; SeqCnt++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCnt, sizeof(SeqCnt), false);
+        ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, false));
+    }
+
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 2);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_Filtered */
+
+/*
+** Test changing the filter of an existing subscription
+*/
+void Test_Subscribe_SetSubscriptionFilter(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_Filter_t  Filter = {.Type = CFE_SB_FilterType_ALWAYS, .N = 1, .X = 1, .O = 0};
+    CFE_MSG_Size_t   Size   = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type   = CFE_MSG_Type_Tlm;
+    CFE_ES_AppId_t   OrigOwner;
+    CFE_SB_PipeD_t * PipeDscPtr;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, 4, "FilterTestPipe"));
+
+    /* Not subscribed yet */
+    ASSERT_EQ(CFE_SB_SetSubscriptionFilter(MsgId, PipeId, &Filter), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SETFILTER_ERR_EID);
+
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_ClearEventHistory();
+    ASSERT_EQ(CFE_SB_SetSubscriptionFilter(MsgId, SB_UT_ALTERNATE_INVALID_PIPEID, &Filter), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SETFILTER_ERR_EID);
+
+    UT_ClearEventHistory();
+    ASSERT_EQ(CFE_SB_SetSubscriptionFilter(MsgId, PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SETFILTER_ERR_EID);
+
+    PipeDscPtr        = CFE_SB_LocatePipeDescByID(PipeId);
+    OrigOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(OrigOwner, 1);
+    UT_ClearEventHistory();
+    ASSERT_EQ(CFE_SB_SetSubscriptionFilter(MsgId, PipeId, &Filter), CFE_SB_BAD_ARGUMENT);
+    EVTSENT(CFE_SB_SETFILTER_ERR_EID);
+    PipeDscPtr->AppId = OrigOwner;
+
+    ASSERT(CFE_SB_SetSubscriptionFilter(MsgId, PipeId, &Filter));
+    EVTSENT(CFE_SB_SETFILTER_EID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 0);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_Subscribe_SetSubscriptionFilter */
+
 /*
 ** Function for calling SB unsubscribe API test functions
 */
@@ -2729,6 +2889,10 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_QueuePutError);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeFull);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MsgLimitExceeded);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_LatestValue);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_LatestValueOlderEntries);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_HighPriority);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_HighPriorityCycles);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
@@ -2964,6 +3128,242 @@ void Test_TransmitMsg_PipeFull(void)
 
 } /* end Test_TransmitMsg_PipeFull */
 
+/*
+** Test send and receive on a latest-value pipe
+*/
+void Test_TransmitMsg_LatestValue(void)
+{
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_Buffer_t *      SBBufPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_BufferD_t *     LatestBuf;
+    uint16                 BuffersInUse;
+    int32                  PipeDepth = 2;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type      = CFE_MSG_Type_Tlm;
+    uint32                 i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatestValuePipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LATESTVALUE));
+
+    BuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+
+    /* More sends than the pipe depth, none should overflow */
+    for (i = 0; i < 4; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    }
+
+    /* Only the first send is queued, the slot holds the newest buffer */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 1);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+    ASSERT_TRUE(DestPtr != NULL);
+    ASSERT_EQ(DestPtr->BuffCount, 1);
+    ASSERT_EQ(DestPtr->DestCnt, 4);
+    LatestBuf = DestPtr->LatestBuf;
+    ASSERT_TRUE(LatestBuf != NULL);
+
+    /* Queued buffer plus newest buffer, intermediate ones are released */
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse + 2);
+
+    EVTCNT(3);
+
+    /* Receive delivers the newest buffer and releases the queued one */
+    ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    ASSERT_TRUE(SBBufPtr == &LatestBuf->Content);
+    ASSERT_TRUE(DestPtr->LatestBuf == NULL);
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+    ASSERT_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, BuffersInUse + 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsg_LatestValue */
+
+/*
+** Test that entries queued before a pipe becomes latest-value are not
+** replaced by the latest-value slot, so no message is delivered twice
+*/
+void Test_TransmitMsg_LatestValueOlderEntries(void)
+{
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_Buffer_t *      SBBufPtr;
+    CFE_SB_Buffer_t *      Received[3];
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_BufferD_t *     LatestBuf;
+    int32                  PipeDepth = 4;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+    CFE_MSG_Type_t         Type      = CFE_MSG_Type_Tlm;
+    uint32                 i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "LatestValuePipe"));
+    SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    /* Two normal entries, then two sends after the option is set */
+    for (i = 0; i < 4; i++)
+    {
+        if (i == 2)
+        {
+            SETUP(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_LATESTVALUE));
+        }
+
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    }
+
+    /* The third send is the signal for the slot, the fourth replaces it */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 3);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId);
+    ASSERT_TRUE(DestPtr != NULL);
+    LatestBuf = DestPtr->LatestBuf;
+    ASSERT_TRUE(LatestBuf != NULL);
+
+    for (i = 0; i < 3; i++)
+    {
+        ASSERT(CFE_SB_ReceiveBuffer(&Received[i], PipeId, CFE_SB_POLL));
+    }
+
+    /* Older entries come through unchanged, the slot only replaces its own signal */
+    ASSERT_TRUE(Received[0] != &LatestBuf->Content);
+    ASSERT_TRUE(Received[1] != &LatestBuf->Content);
+    ASSERT_TRUE(Received[0] != Received[1]);
+    ASSERT_TRUE(Received[2] == &LatestBuf->Content);
+    ASSERT_TRUE(DestPtr->LatestBuf == NULL);
+    ASSERT_EQ(DestPtr->BuffCount, 0);
+
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsg_LatestValueOlderEntries */
+
+/*
+** Test that high priority messages are received ahead of queued normal priority messages
+*/
+void Test_TransmitMsg_HighPriority(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   LowMsgId  = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t   HighMsgId = SB_UT_TLM_MID1;
+    CFE_SB_Qos_t     Quality   = {CFE_SB_QosPriority_HIGH, 0};
+    SB_UT_Test_Tlm_t LowPkt;
+    SB_UT_Test_Tlm_t HighPkt;
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    int32            PipeDepth = 4;
+    CFE_MSG_Size_t   Size      = sizeof(LowPkt);
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PrioTestPipe"));
+    SETUP(CFE_SB_Subscribe(LowMsgId, PipeId));
+    SETUP(CFE_SB_SubscribeEx(HighMsgId, PipeId, Quality, PipeDepth));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    ASSERT_TRUE(PipeDscPtr->HighPrioRing != NULL);
+
+    /* Normal priority message first, then the high priority one */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &LowMsgId, sizeof(LowMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&LowPkt.Hdr.Msg, true));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &HighMsgId, sizeof(HighMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&HighPkt.Hdr.Msg, true));
+
+    ASSERT_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_LOW].CurrentQueueDepth, 1);
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 1);
+    ASSERT_EQ(PipeDscPtr->HighPrioCount, 1);
+
+    /* High priority message is delivered first */
+    ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    ASSERT_TRUE(SBBufPtr == &PipeDscPtr->LastBuffer->Content);
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(PipeDscPtr->LastBuffer->MsgId, HighMsgId));
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_HIGH].RcvCount, 1);
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 0);
+
+    /* Then the normal priority message, the stale wake token is skipped */
+    ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    ASSERT_TRUE(SBBufPtr == &PipeDscPtr->LastBuffer->Content);
+    ASSERT_TRUE(CFE_SB_MsgId_Equal(PipeDscPtr->LastBuffer->MsgId, LowMsgId));
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_LOW].RcvCount, 1);
+
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+
+    EVTCNT(3);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsg_HighPriority */
+
+/*
+** Test repeated high priority send/receive cycles past the pipe depth
+*/
+void Test_TransmitMsg_HighPriorityCycles(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   HighMsgId = SB_UT_TLM_MID1;
+    CFE_SB_Qos_t     Quality   = {CFE_SB_QosPriority_HIGH, 0};
+    SB_UT_Test_Tlm_t HighPkt;
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    int32            PipeDepth = 4;
+    CFE_MSG_Size_t   Size      = sizeof(HighPkt);
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    int32            i;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "PrioCyclePipe"));
+    SETUP(CFE_SB_SubscribeEx(HighMsgId, PipeId, Quality, PipeDepth));
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* Each receive takes the message from the ring without reading its wake token */
+    for (i = 0; i <= PipeDepth; i++)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &HighMsgId, sizeof(HighMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        ASSERT(CFE_SB_TransmitMsg(&HighPkt.Hdr.Msg, true));
+
+        ASSERT(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+        ASSERT_TRUE(CFE_SB_MsgId_Equal(PipeDscPtr->LastBuffer->MsgId, HighMsgId));
+        ASSERT_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+        ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_HIGH].CurrentQueueDepth, 0);
+    }
+
+    /* Only one wake token was ever queued, so the queue cannot fill with them */
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 1);
+    ASSERT_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter, 0);
+    ASSERT_EQ(PipeDscPtr->SendErrors, 0);
+    ASSERT_EQ(PipeDscPtr->PrioStats[CFE_SB_QosPriority_HIGH].RcvCount, PipeDepth + 1);
+    EVTCNT(2);
+
+    /* Reading the leftover token clears it, the next send queues a new one */
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    ASSERT_TRUE(!PipeDscPtr->HighPrioTokenQueued);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &HighMsgId, sizeof(HighMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    ASSERT(CFE_SB_TransmitMsg(&HighPkt.Hdr.Msg, true));
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueuePut)), 2);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsg_HighPriorityCycles */
+
 /*
 ** Test send message response to too many messages sent to the pipe
 */
@@ -3362,6 +3762,7 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidTimeout);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Poll);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_Timeout);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_StaleWakeToken);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
@@ -3449,6 +3850,76 @@ void Test_ReceiveBuffer_Timeout(void)
 
 } /* end Test_ReceiveBuffer_Timeout */
 
+/* OS_QueueGet hook recording the timeout of the last call */
+static int32 UT_CheckQueueGetTimeout(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    int32 *TimeoutPtr = UserObj;
+
+    *TimeoutPtr = UT_Hook_GetArgValueByName(Context, "timeout", int32);
+
+    return StubRetcode;
+}
+
+/*
+** Test that a stale high priority wake token does not extend a timed receive
+*/
+void Test_ReceiveBuffer_StaleWakeToken(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId   = SB_UT_TLM_MID;
+    CFE_SB_Qos_t     Quality = {CFE_SB_QosPriority_HIGH, 0};
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    OS_time_t        Times[2];
+    int32            QueueTimeout = 0;
+    int32            PipeDepth    = 4;
+    int32            TimeOut      = 100;
+    CFE_MSG_Size_t   Size         = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type         = CFE_MSG_Type_Tlm;
+
+    SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "StaleTokenPipe"));
+    SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, Quality, PipeDepth));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    UT_SetHookFunction(UT_KEY(OS_QueueGet), UT_CheckQueueGetTimeout, &QueueTimeout);
+
+    /* Deliver the message from the ring, leaving its wake token queued */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    SETUP(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    ASSERT_EQ(PipeDscPtr->HighPrioCount, 0);
+
+    /* Token arrives 30 ms into the wait, the retry only waits for the remaining 70 ms */
+    Times[0] = OS_TimeAssembleFromMilliseconds(10, 0);
+    Times[1] = OS_TimeAssembleFromMilliseconds(10, 30);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_QUEUE_TIMEOUT);
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_TIME_OUT);
+    ASSERT_EQ(QueueTimeout, TimeOut - 30);
+
+    /* Token arrives after the timeout expired, no further wait */
+    UT_ResetState(UT_KEY(OS_QueueGet));
+    UT_SetHookFunction(UT_KEY(OS_QueueGet), UT_CheckQueueGetTimeout, &QueueTimeout);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    SETUP(CFE_SB_TransmitMsg(&TlmPkt.Hdr.Msg, true));
+    SETUP(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+
+    Times[0] = OS_TimeAssembleFromMilliseconds(10, 0);
+    Times[1] = OS_TimeAssembleFromMilliseconds(10, 100);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), Times, sizeof(Times), false);
+    ASSERT_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, TimeOut), CFE_SB_TIME_OUT);
+    ASSERT_EQ(QueueTimeout, TimeOut);
+    ASSERT_EQ(UT_GetStubCount(UT_KEY(OS_QueueGet)), 1);
+
+    TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffer_StaleWakeToken */
+
 /*
 ** Test receiving a message response to a pipe read error
 */
@@ -3909,7 +4380,8 @@ void Test_CFE_SB_BadPipeInfo(void)
     PipeDscPtr->PipeId = PipeId;
 
     ASSERT_EQ(
-        CFE_SB_SubscribeFull(SB_UT_FIRST_VALID_MID, PipeId, CFE_SB_DEFAULT_QOS, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT, 2),
+        CFE_SB_SubscribeFull(SB_UT_FIRST_VALID_MID, PipeId, CFE_SB_DEFAULT_QOS, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT, 2,
+                             NULL),
         CFE_SB_BAD_ARGUMENT);
 
     EVTCNT(4);
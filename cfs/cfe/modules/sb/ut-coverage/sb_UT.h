@@ -347,6 +347,22 @@ void Test_SB_Cmds_RstCtrs(void);
 ******************************************************************************/
 void Test_SB_Cmds_Stats(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send SB latency stats command
+**
+** \par Description
+**        This function tests that a pipe's queueing delay is binned in its
+**        latency histogram and reported by the send SB latency stats command.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_LatencyStats(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send routing information command default/nominal path
@@ -1530,6 +1546,38 @@ void Test_Subscribe_SubscriptionReporting(void);
 ******************************************************************************/
 void Test_Subscribe_InvalidPipeOwner(void);
 
+/*****************************************************************************/
+/**
+** \brief Test message decimation by a subscription filter
+**
+** \par Description
+**        This function tests that messages rejected by a subscription filter
+**        are not written to the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_Filtered(void);
+
+/*****************************************************************************/
+/**
+** \brief Test changing the filter of an existing subscription
+**
+** \par Description
+**        This function tests the error and success paths of
+**        CFE_SB_SetSubscriptionFilter.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_SetSubscriptionFilter(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB unsubscribe API test functions
@@ -1870,6 +1918,74 @@ void Test_TransmitMsg_PipeFull(void);
 ******************************************************************************/
 void Test_TransmitMsg_MsgLimitExceeded(void);
 
+/*****************************************************************************/
+/**
+** \brief Test send and receive on a latest-value pipe
+**
+** \par Description
+**        This function tests that a latest-value pipe keeps only the newest
+**        unread message of a MsgId and releases the replaced buffers.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_LatestValue(void);
+
+/*****************************************************************************/
+/**
+** \brief Test a latest-value pipe that still holds older entries
+**
+** \par Description
+**        This function tests that entries queued before the latest-value
+**        option was set are delivered as-is and only the slot's own signal
+**        entry is replaced by the newest buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_LatestValueOlderEntries(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that high priority messages are received ahead of queued
+**        normal priority messages
+**
+** \par Description
+**        This function tests that a message subscribed with a high QoS
+**        priority is delivered before an older normal priority message on
+**        the same pipe, and that the per-priority statistics are updated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_HighPriority(void);
+
+/*****************************************************************************/
+/**
+** \brief Test repeated high priority send/receive cycles
+**
+** \par Description
+**        This function tests that more high priority send/receive cycles
+**        than the pipe depth neither overflow the pipe nor leave wake
+**        tokens behind in its queue.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_HighPriorityCycles(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response to a buffer descriptor allocation failure
@@ -2112,6 +2228,23 @@ void Test_ReceiveBuffer_Poll(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_Timeout(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that a stale wake token does not extend a timed receive
+**
+** \par Description
+**        This function tests that a timed receive which reads the stale
+**        wake token of an already delivered high priority message only
+**        waits for the remainder of its timeout.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_StaleWakeToken(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to a pipe read error
@@ -140,6 +140,25 @@ set(OSAL_CONFIG_INCLUDE_SHELL                   FALSE
 )
 
 
+#
+# OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES
+# ----------------------------------
+#
+# Selects the implementation of binary semaphores, counting semaphores
+# and mutexes in the POSIX OSAL.  This only applies on Linux.
+#
+# If set FALSE, these are built on pthread mutexes, condition variables
+# and POSIX semaphores.
+#
+# If set TRUE, these use Linux futexes directly.  Uncontended operations
+# are a single atomic instruction, and a contended take spins briefly
+# before sleeping in the kernel.  Mutexes use the priority-inheritance
+# futex operations, so priority inheritance is preserved.
+#
+set(OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES          FALSE
+    CACHE BOOL "Use Linux futexes for POSIX semaphores and mutexes"
+)
+
 #
 # OSAL_CONFIG_DEBUG_PERMISSIVE_MODE
 # ----------------------------------
@@ -245,6 +264,16 @@ set(OSAL_CONFIG_MAX_FILE_SYSTEMS        14
     CACHE STRING "Maximum Number of File Systems to support"
 )
 
+# The maximum number of event sets to support
+set(OSAL_CONFIG_MAX_EVENTSETS           4
+    CACHE STRING "Maximum Number of Event Sets to support"
+)
+
+# The maximum number of objects that can be members of one event set
+set(OSAL_CONFIG_MAX_EVENTSET_MEMBERS    16
+    CACHE STRING "Maximum Number of Members in an Event Set"
+)
+
 # The maximum length for a file name, including any extension
 # (This does not include the directory part)
 set(OSAL_CONFIG_MAX_FILE_NAME           20
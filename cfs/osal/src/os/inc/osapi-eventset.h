@@ -0,0 +1,208 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * Declarations and prototypes for event sets
+ */
+
+#ifndef OSAPI_EVENTSET_H
+#define OSAPI_EVENTSET_H
+
+#include "osconfig.h"
+#include "common_types.h"
+#include "osapi-select.h"
+
+/**
+ * @brief An event reported by OS_EventSetWait()
+ *
+ * The events are a combination of #OS_STREAM_STATE_READABLE and
+ * #OS_STREAM_STATE_WRITABLE.
+ */
+typedef struct
+{
+    osal_id_t objid;  /**< The member of the set which is ready */
+    uint32    events; /**< The state(s) the member is in */
+} OS_eventset_event_t;
+
+/** @brief OSAL event set properties */
+typedef struct
+{
+    char      name[OS_MAX_API_NAME];
+    osal_id_t creator;
+    uint32    num_members;
+} OS_eventset_prop_t;
+
+/** @defgroup OSAPIEventSet OSAL Event Set APIs
+ *
+ * An event set is a persistent collection of OSAL IDs that a task can wait on
+ * together, so an application serving several sockets or queues can block
+ * until any of them has work instead of polling each one.
+ *
+ * Unlike OS_SelectMultiple(), the members are registered once rather than on
+ * every wait.  On Linux this is backed by epoll, and both streams (sockets,
+ * pipes, etc.) and message queues may be members.  Other platforms use
+ * select(), and support only streams.
+ *
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates an event set
+ *
+ * The new set has no members.
+ *
+ * @param[out]  set_id will be set to the non-zero ID of the newly-created resource
+ * @param[in]   set_name the name of the new resource to create
+ * @param[in]   flags Reserved for future use, should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if set_id or set_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if all of the event sets are already allocated
+ * @retval #OS_ERR_NAME_TAKEN if this is already the name of an event set
+ * @retval #OS_ERROR if an unspecified/other error occurs
+ */
+int32 OS_EventSetCreate(osal_id_t *set_id, const char *set_name, uint32 flags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes an event set
+ *
+ * The members of the set are not affected.  If a task is waiting on the
+ * set, this waits until that task returns from OS_EventSetWait().
+ *
+ * @param[in] set_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid event set
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_EventSetDelete(osal_id_t set_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds an object to an event set
+ *
+ * The object must be a stream or, where the platform supports it, a queue.
+ * For a queue, #OS_STREAM_STATE_READABLE means a message is waiting and
+ * #OS_STREAM_STATE_WRITABLE means there is room for another message.
+ *
+ * An object should be removed from every set it is in when it is closed or
+ * deleted.  If it is closed first, it stops being waited on, but stays listed
+ * in the set until it is removed using its old ID.
+ *
+ * @param[in] set_id The event set to add to
+ * @param[in] objid  The object to add
+ * @param[in] events The state(s) to wait for, #OS_STREAM_STATE_READABLE
+ *                   and/or #OS_STREAM_STATE_WRITABLE
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if either ID is not valid
+ * @retval #OS_ERR_INVALID_SIZE if events is zero or contains other states
+ * @retval #OS_ERR_NAME_TAKEN if the object is already a member of the set
+ * @retval #OS_ERR_NO_FREE_IDS if the set already has #OS_MAX_EVENTSET_MEMBERS members
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the object cannot be waited on
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_EventSetAdd(osal_id_t set_id, osal_id_t objid, uint32 events);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes an object from an event set
+ *
+ * @param[in] set_id The event set to remove from
+ * @param[in] objid  The object to remove
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the set ID is not valid
+ * @retval #OS_ERR_NAME_NOT_FOUND if the object is not a member of the set
+ */
+int32 OS_EventSetRemove(osal_id_t set_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Waits for any member of an event set to become ready
+ *
+ * Blocks until at least one member is in a state it was added with, or
+ * the timeout elapses.  Readiness is level-triggered: a member which is
+ * still ready is reported again by the next wait.
+ *
+ * If members are added to or removed from the set while a task waits on it,
+ * the change may only take effect on the next wait.
+ *
+ * @param[in]  set_id     The event set to wait on
+ * @param[out] events     Buffer for the members which are ready
+ * @param[in]  max_events Number of entries in the events buffer
+ * @param[out] num_events Set to the number of entries filled in
+ * @param[in]  msecs      Timeout in milliseconds, 0 to poll, or negative to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if events or num_events are NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_events is zero
+ * @retval #OS_ERR_INVALID_ID if the set ID is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the set has no members
+ * @retval #OS_ERROR_TIMEOUT if no member became ready before the timeout,
+ *         or the only members which did were removed during the wait.
+ *         On #OS_SUCCESS, at least one event is reported.
+ * @retval #OS_ERROR if an unspecified error occurs
+ */
+int32 OS_EventSetWait(osal_id_t set_id, OS_eventset_event_t *events, uint32 max_events, uint32 *num_events,
+                      int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing event set ID by name
+ *
+ * @param[out]  set_id will be set to the ID of the existing resource
+ * @param[in]   set_name the name of the existing resource to find
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER is set_id or set_name are NULL pointers
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+ */
+int32 OS_EventSetGetIdByName(osal_id_t *set_id, const char *set_name);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Fill a property object buffer with details regarding the resource
+ *
+ * @param[in]   set_id   The object ID to operate on
+ * @param[out]  set_prop The property object buffer to fill
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if the set_prop pointer is null
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid event set
+ */
+int32 OS_EventSetGetInfo(osal_id_t set_id, OS_eventset_prop_t *set_prop);
+
+/**@}*/
+
+#endif /* OSAPI_EVENTSET_H */
@@ -257,6 +257,36 @@ int32 OS_TimedRead(osal_id_t filedes, void *buffer, size_t nbytes, int32 timeout
  */
 int32 OS_TimedWrite(osal_id_t filedes, const void *buffer, size_t nbytes, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Copy data from one file handle to another
+ *
+ * Copies up to nbytes from the current position of src_fd to the current
+ * position of dest_fd and advances both positions by the amount copied.
+ *
+ * Where the underlying OS supports it the data is copied within the kernel
+ * (e.g. copy_file_range() or sendfile() on Linux) so it never passes through
+ * a user space buffer.  Otherwise it is copied through a block buffer with
+ * read() and write().
+ *
+ * Like OS_read(), this may copy less than the requested amount, so callers
+ * copying a whole file should repeat the call until it returns zero.
+ *
+ * @note This is intended for regular files.  Behavior with sockets, pipes, or
+ * other stream types depends on the underlying OS.
+ *
+ * @param[in] src_fd    The handle ID to copy from
+ * @param[in] dest_fd   The handle ID to copy to
+ * @param[in] nbytes    Maximum number of bytes to copy
+ *
+ * @return Number of bytes copied, zero at the end of the source file, or
+ *         appropriate error code, see @ref OSReturnCodes
+ * @retval #OS_ERROR if OS call failed
+ * @retval #OS_ERR_INVALID_ID if either file descriptor passed in is invalid
+ * @retval #OS_ERR_INVALID_SIZE if nbytes is zero or too large
+ */
+int32 OS_CopyFileData(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Changes the permissions of a file
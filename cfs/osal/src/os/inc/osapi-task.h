@@ -36,6 +36,22 @@
 /** @brief Floating point enabled state for a task */
 #define OS_FP_ENABLED 1
 
+/**
+ * @brief Task creation flag restricting the new task to a set of CPUs
+ *
+ * May be combined with the other flags passed to OS_TaskCreate().  Bit N of
+ * the mask allows the task to run on CPU N, for up to 16 CPUs.  A mask of
+ * zero leaves the task free to run on any CPU.  On platforms without
+ * affinity support the mask is ignored.
+ */
+#define OS_TASK_CPU_AFFINITY(mask) (((uint32)(mask)&0xFFFFU) << 16)
+
+/** @brief Extract the CPU affinity mask from OS_TaskCreate() flags */
+#define OS_TASK_CPU_AFFINITY_GET(flags) (((uint32)(flags) >> 16) & 0xFFFFU)
+
+/** @brief Value of OS_task_prop_t::last_cpu when the CPU is not known */
+#define OS_TASK_CPU_UNKNOWN 0xFFFFFFFFU
+
 /**
  * @brief Type to be used for OSAL task priorities.
  *
@@ -62,6 +78,8 @@ typedef struct
     osal_id_t       creator;
     size_t          stack_size;
     osal_priority_t priority;
+    uint32          cpu_mask; /**< CPUs the task may run on, or 0 if not restricted */
+    uint32          last_cpu; /**< CPU the task last ran on, or #OS_TASK_CPU_UNKNOWN */
 } OS_task_prop_t;
 
 /*
@@ -88,7 +106,8 @@ typedef osal_task((*osal_task_entry)(void)); /**< @brief For task entry point */
  *              to allocate a stack from the system memory heap
  * @param[in]   stack_size the size of the stack, or 0 to use a default stack size.
  * @param[in]   priority initial priority of the new task
- * @param[in]   flags initial options for the new task
+ * @param[in]   flags initial options for the new task, #OS_FP_ENABLED and/or
+ *              an #OS_TASK_CPU_AFFINITY mask
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -172,6 +191,25 @@ int32 OS_TaskDelay(uint32 millisecond);
  */
 int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Restricts the given task to a set of CPUs
+ *
+ * Bit N of the mask allows the task to run on CPU N.  A mask of zero
+ * removes any restriction, allowing the task to run on all CPUs.
+ *
+ * @param[in] task_id        The object ID to operate on
+ *
+ * @param[in] cpu_mask       Set of CPUs the task may run on
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if CPU affinity is not supported on this platform
+ * @retval #OS_ERROR if the OS call to change the affinity fails, e.g. none of the CPUs exist
+ */
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain the task id of the calling task
@@ -204,7 +242,8 @@ int32 OS_TaskGetIdByName(osal_id_t *task_id, const char *task_name);
  * @brief Fill a property object buffer with details regarding the resource
  *
  * This function will pass back a pointer to structure that contains
- * all of the relevant info (creator, stack size, priority, name) about the
+ * all of the relevant info (creator, stack size, priority, name, CPU affinity
+ * and the CPU it last ran on, where the platform can report it) about the
  * specified task.
  *
  * @param[in]   task_id The object ID to operate on
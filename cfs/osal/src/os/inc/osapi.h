@@ -70,6 +70,7 @@ extern "C"
 #include "osapi-countsem.h"
 #include "osapi-dir.h"
 #include "osapi-error.h"
+#include "osapi-eventset.h"
 #include "osapi-file.h"
 #include "osapi-filesys.h"
 #include "osapi-heap.h"
@@ -0,0 +1,196 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file   os-impl-bsd-eventset.c
+ *
+ * Purpose: This file implements event sets on top of the select() wrappers,
+ *          for systems which do not have a persistent readiness API.
+ *
+ * The member list is kept only in the shared layer, and the select() sets
+ * are rebuilt from it on every wait.  Only selectable streams can be members.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include "os-impl-select.h"
+#include "os-shared-select.h"
+#include "os-shared-eventset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                    EVENT SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetCreate_Impl(const OS_object_token_t *token)
+{
+    /* nothing is held in the OS until the set is waited on */
+    return OS_SUCCESS;
+} /* end OS_EventSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+} /* end OS_EventSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot,
+                          uint32 events)
+{
+    OS_impl_file_internal_record_t *stream;
+
+    /* queues are not file descriptors here, so cannot be passed to select() */
+    if (obj_token->obj_type != OS_OBJECT_TYPE_OS_STREAM)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *obj_token);
+    if (!stream->selectable)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_EventSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot)
+{
+    return OS_SUCCESS;
+} /* end OS_EventSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetWait_Impl(const OS_object_token_t *token, OS_eventset_ready_t *ready, uint32 max_ready,
+                           uint32 *num_ready, int32 msecs)
+{
+    OS_eventset_internal_record_t *eventset;
+    OS_object_token_t              lock_token;
+    osal_id_t                      member_id[OS_MAX_EVENTSET_MEMBERS];
+    uint32                         member_events[OS_MAX_EVENTSET_MEMBERS];
+    OS_FdSet                       rd_set;
+    OS_FdSet                       wr_set;
+    uint32                         slot;
+    uint32                         events;
+    int32                          return_code;
+
+    eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, *token);
+
+    /*
+     * Take a copy of the members, so the set is not locked
+     * while waiting.  Any change will apply on the next wait.
+     */
+    lock_token = *token;
+    OS_Lock_Global(&lock_token);
+    memcpy(member_id, eventset->member_id, sizeof(member_id));
+    memcpy(member_events, eventset->member_events, sizeof(member_events));
+    OS_Unlock_Global(&lock_token);
+
+    OS_SelectFdZero(&rd_set);
+    OS_SelectFdZero(&wr_set);
+    for (slot = 0; slot < OS_MAX_EVENTSET_MEMBERS; ++slot)
+    {
+        if (!OS_ObjectIdDefined(member_id[slot]))
+        {
+            continue;
+        }
+        if (member_events[slot] & OS_STREAM_STATE_READABLE)
+        {
+            OS_SelectFdAdd(&rd_set, member_id[slot]);
+        }
+        if (member_events[slot] & OS_STREAM_STATE_WRITABLE)
+        {
+            OS_SelectFdAdd(&wr_set, member_id[slot]);
+        }
+    }
+
+    return_code = OS_SelectMultiple_Impl(&rd_set, &wr_set, msecs);
+    if (return_code == OS_SUCCESS)
+    {
+        *num_ready = 0;
+        for (slot = 0; slot < OS_MAX_EVENTSET_MEMBERS && *num_ready < max_ready; ++slot)
+        {
+            if (!OS_ObjectIdDefined(member_id[slot]))
+            {
+                continue;
+            }
+
+            events = 0;
+            if ((member_events[slot] & OS_STREAM_STATE_READABLE) && OS_SelectFdIsSet(&rd_set, member_id[slot]))
+            {
+                events |= OS_STREAM_STATE_READABLE;
+            }
+            if ((member_events[slot] & OS_STREAM_STATE_WRITABLE) && OS_SelectFdIsSet(&wr_set, member_id[slot]))
+            {
+                events |= OS_STREAM_STATE_WRITABLE;
+            }
+
+            if (events != 0)
+            {
+                ready[*num_ready].slot   = slot;
+                ready[*num_ready].events = events;
+                ++(*num_ready);
+            }
+        }
+    }
+
+    return return_code;
+} /* end OS_EventSetWait_Impl */
@@ -59,6 +59,13 @@
 #define GENERIC_IO_CONST_DATA_CAST
 #endif
 
+/* Block size used to copy file data through a local buffer when the OS cannot
+ * copy it within the kernel.  The includer can define this if needed.
+ */
+#ifndef GENERIC_IO_COPY_BLOCK_SIZE
+#define GENERIC_IO_COPY_BLOCK_SIZE 4096
+#endif
+
 /*----------------------------------------------------------------
  *
  * Function: OS_GenericClose_Impl
@@ -273,3 +280,69 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
 
     return (return_code);
 } /* end OS_GenericWrite_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_GenericCopy_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_GenericCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes)
+{
+    ssize_t                         os_result;
+    ssize_t                         wr_size;
+    ssize_t                         wr_total;
+    uint8                           copyblock[GENERIC_IO_COPY_BLOCK_SIZE];
+    OS_impl_file_internal_record_t *src_impl;
+    OS_impl_file_internal_record_t *dest_impl;
+
+    src_impl  = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *src_token);
+    dest_impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *dest_token);
+
+#ifdef GENERIC_IO_KERNEL_COPY
+    /*
+     * If the OS layer provides an in-kernel copy, try it first.  It sets
+     * errno to ENOSYS when it can't be used on these file handles, in which
+     * case this falls back to the block copy below.
+     */
+    os_result = GENERIC_IO_KERNEL_COPY(src_impl->fd, dest_impl->fd, nbytes);
+    if (os_result >= 0)
+    {
+        return (int32)os_result;
+    }
+    if (errno != ENOSYS)
+    {
+        OS_DEBUG("kernel copy: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+#endif
+
+    if (nbytes > sizeof(copyblock))
+    {
+        nbytes = sizeof(copyblock);
+    }
+
+    os_result = read(src_impl->fd, copyblock, nbytes);
+    if (os_result < 0)
+    {
+        OS_DEBUG("read: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    wr_total = 0;
+    while (wr_total < os_result)
+    {
+        wr_size = write(dest_impl->fd, &copyblock[wr_total], os_result - wr_total);
+        if (wr_size < 0)
+        {
+            OS_DEBUG("write: %s\n", strerror(errno));
+            return OS_ERROR;
+        }
+        wr_total += wr_size;
+    }
+
+    /* type conversion from ssize_t to int32 for return */
+    return (int32)os_result;
+} /* end OS_GenericCopy_Impl */
@@ -29,9 +29,29 @@
 #define OS_IMPL_BINSEM_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <pthread.h>
 #include <signal.h>
 
+#ifdef OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES
+
+/*
+ * Binary Semaphores (futex)
+ *
+ * "wake_seq" is the futex word that takers sleep on.  It is advanced
+ * by every give and flush, so a taker never misses a wakeup that
+ * happens between checking the value and going to sleep.
+ */
+typedef struct
+{
+    uint32 current_value;
+    uint32 flush_request;
+    uint32 wake_seq;
+    uint32 waiters;
+} OS_impl_binsem_internal_record_t;
+
+#else
+
 /* Binary Semaphores */
 typedef struct
 {
@@ -41,6 +61,8 @@ typedef struct
     volatile sig_atomic_t current_value;
 } OS_impl_binsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
 
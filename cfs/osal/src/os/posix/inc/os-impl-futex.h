@@ -0,0 +1,118 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ * Helpers for the futex based semaphore and mutex implementations,
+ * selected by OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES.
+ */
+
+#ifndef OS_IMPL_FUTEX_H
+#define OS_IMPL_FUTEX_H
+
+#include "osconfig.h"
+#include "common_types.h"
+#include <time.h>
+
+/*
+ * Number of times a contended take polls the object before sleeping.
+ *
+ * Most OSAL semaphores are held very briefly, so on a multi-core system
+ * the holder will usually release it within this window, and the taker
+ * avoids the cost of sleeping and being woken by the kernel.
+ */
+#define OS_POSIX_FUTEX_SPIN_COUNT 100
+
+/*
+ * Spin limit actually used, set by OS_Posix_FutexInit().  This is zero on
+ * a single CPU, where the holder cannot run while the taker is spinning.
+ */
+extern uint32 OS_Posix_FutexSpinLimit;
+
+/*
+ * Owner thread ID bits of a priority-inheritance futex word, the rest
+ * are flags maintained by the kernel (same as FUTEX_TID_MASK)
+ */
+#define OS_POSIX_FUTEX_TID_MASK 0x3FFFFFFF
+
+/*
+ * Tell the CPU that this is a spin-wait loop
+ */
+static inline void OS_Posix_FutexSpinPause(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexInit
+ *
+ * Set up the futex helpers, called by each of the semaphore and mutex
+ * Impl_Init routines (repeated calls are harmless)
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexInit(void);
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexWait
+ *
+ * Sleep while *word == expected, until woken or the absolute
+ * CLOCK_REALTIME timeout expires (NULL waits forever).
+ *
+ * The caller's waiter count is held for the duration, so that
+ * OS_Posix_FutexWake() can be skipped when nothing is waiting.
+ * This is a cancellation point, like the pthread and sem waits.
+ *
+ * Returns 0 when woken, or ETIMEDOUT, EAGAIN (value already changed)
+ * or EINTR.  The caller must always recheck its condition.
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexWait(uint32 *word, uint32 expected, uint32 *waiters, const struct timespec *abstime);
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexWake
+ *
+ * Wake up to "count" threads sleeping on the word
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *word, int count);
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexLockPI / OS_Posix_FutexUnlockPI
+ *
+ * Contended lock and unlock of a priority-inheritance futex word,
+ * which holds the owner's thread ID when locked.
+ *
+ * Returns 0 on success or an errno value.
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexLockPI(uint32 *word);
+int OS_Posix_FutexUnlockPI(uint32 *word);
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexThreadId
+ *
+ * Kernel thread ID of the calling thread, as used in PI futex words
+ *-----------------------------------------------------------------*/
+uint32 OS_Posix_FutexThreadId(void);
+
+#endif /* OS_IMPL_FUTEX_H */
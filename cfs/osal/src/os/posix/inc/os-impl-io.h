@@ -48,4 +48,11 @@ typedef struct
  */
 extern OS_impl_file_internal_record_t OS_impl_filehandle_table[OS_MAX_NUM_OPEN_FILES];
 
+/*
+ * Linux can copy file data without passing it through user space.
+ * The portable OS_GenericCopy_Impl() tries this before its block copy.
+ */
+ssize_t OS_Posix_KernelCopy_Impl(int src_fd, int dest_fd, size_t nbytes);
+#define GENERIC_IO_KERNEL_COPY OS_Posix_KernelCopy_Impl
+
 #endif /* OS_IMPL_IO_H */
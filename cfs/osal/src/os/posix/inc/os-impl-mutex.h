@@ -29,14 +29,34 @@
 #define OS_IMPL_MUTEX_H
 
 #include "osconfig.h"
+#include "common_types.h"
 #include <pthread.h>
 
+#ifdef OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES
+
+/*
+ * Mutexes (futex)
+ *
+ * "owner" is a priority-inheritance futex word holding the thread ID of
+ * the owner, so the kernel can boost the owner while others wait.
+ * "depth" is the nesting count, only accessed by the owner.
+ */
+typedef struct
+{
+    uint32 owner;
+    uint32 depth;
+} OS_impl_mutex_internal_record_t;
+
+#else
+
 /* Mutexes */
 typedef struct
 {
     pthread_mutex_t id;
 } OS_impl_mutex_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
 
@@ -37,12 +37,19 @@
 typedef struct
 {
     pthread_t id;
+    pid_t     system_tid; /* Kernel thread ID, for reporting the CPU the task last ran on */
 } OS_impl_task_internal_record_t;
 
 /* Tables where the OS object information is stored */
 extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
 
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz, uint32 cpu_mask,
                                        PthreadFuncPtr_t entry, void *entry_arg);
 
+/* CPU affinity helpers, implemented in os-impl-affinity.c */
+int32  OS_Posix_TaskAttrSetAffinity_Impl(pthread_attr_t *attr, uint32 cpu_mask);
+int32  OS_Posix_TaskSetAffinity_Impl(pthread_t thread, uint32 cpu_mask);
+pid_t  OS_Posix_GetThreadSystemId_Impl(void);
+uint32 OS_Posix_GetThreadLastCpu_Impl(pid_t tid);
+
 #endif /* OS_IMPL_TASKS_H */
@@ -0,0 +1,197 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-affinity.c
+ * \ingroup  posix
+ *
+ * Task CPU affinity and CPU reporting used by the task implementation.
+ *
+ * CPU sets, pthread_setaffinity_np() and gettid are Linux/glibc extensions,
+ * so this file is built with _GNU_SOURCE (see CMakeLists.txt).  No other
+ * file in this OS layer should depend on that.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <sched.h>
+#include <sys/syscall.h>
+
+#include "os-posix.h"
+#include "os-impl-tasks.h"
+
+/*
+ * Field number of the "processor" entry in /proc/<pid>/task/<tid>/stat
+ */
+#define OS_POSIX_STAT_PROCESSOR_FIELD 39
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_CpuMaskToSet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Converts an OSAL CPU mask into a cpu_set_t
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_CpuMaskToSet(uint32 cpu_mask, cpu_set_t *cpu_set)
+{
+    uint32 cpu;
+
+    CPU_ZERO(cpu_set);
+    for (cpu = 0; cpu < 32; ++cpu)
+    {
+        if ((cpu_mask & (1U << cpu)) != 0)
+        {
+            CPU_SET(cpu, cpu_set);
+        }
+    }
+} /* end OS_Posix_CpuMaskToSet */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_TaskAttrSetAffinity_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sets the CPU affinity in the attributes of a task about to be created
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_TaskAttrSetAffinity_Impl(pthread_attr_t *attr, uint32 cpu_mask)
+{
+    cpu_set_t cpu_set;
+    int       ret;
+
+    OS_Posix_CpuMaskToSet(cpu_mask, &cpu_set);
+
+    ret = pthread_attr_setaffinity_np(attr, sizeof(cpu_set), &cpu_set);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_attr_setaffinity_np error in OS_TaskCreate: %s\n", strerror(ret));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_Posix_TaskAttrSetAffinity_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_TaskSetAffinity_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Sets the CPU affinity of a running task.  A mask of zero
+ *           allows the task to run on every CPU.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_TaskSetAffinity_Impl(pthread_t thread, uint32 cpu_mask)
+{
+    cpu_set_t cpu_set;
+    long      cpu;
+    long      num_cpus;
+    int       ret;
+
+    if (cpu_mask == 0)
+    {
+        CPU_ZERO(&cpu_set);
+        num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+        for (cpu = 0; cpu < num_cpus && cpu < CPU_SETSIZE; ++cpu)
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    else
+    {
+        OS_Posix_CpuMaskToSet(cpu_mask, &cpu_set);
+    }
+
+    ret = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_setaffinity_np: mask = 0x%x, err = %s\n", (unsigned int)cpu_mask, strerror(ret));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_Posix_TaskSetAffinity_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_GetThreadSystemId_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the kernel thread ID of the calling task
+ *
+ *-----------------------------------------------------------------*/
+pid_t OS_Posix_GetThreadSystemId_Impl(void)
+{
+    return (pid_t)syscall(SYS_gettid);
+} /* end OS_Posix_GetThreadSystemId_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_GetThreadLastCpu_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the CPU that the given kernel thread last ran on,
+ *           or OS_TASK_CPU_UNKNOWN if it cannot be determined.
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_Posix_GetThreadLastCpu_Impl(pid_t tid)
+{
+    char          path[64];
+    char          buffer[512];
+    char *        field;
+    FILE *        stat_file;
+    unsigned long cpu;
+    uint32        field_num;
+    uint32        result;
+
+    result = OS_TASK_CPU_UNKNOWN;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%ld/stat", (long)tid);
+    stat_file = fopen(path, "r");
+    if (stat_file == NULL)
+    {
+        return result;
+    }
+
+    if (fgets(buffer, sizeof(buffer), stat_file) != NULL)
+    {
+        /*
+         * The second field is the command name in parentheses, which may itself
+         * contain spaces or parentheses, so start counting after the last ')'
+         * which ends field 2.
+         */
+        field = strrchr(buffer, ')');
+        for (field_num = 2; field != NULL && field_num < OS_POSIX_STAT_PROCESSOR_FIELD; ++field_num)
+        {
+            field = strchr(field + 1, ' ');
+        }
+
+        if (field != NULL && sscanf(field, " %lu", &cpu) == 1)
+        {
+            result = cpu;
+        }
+    }
+
+    fclose(stat_file);
+
+    return result;
+} /* end OS_Posix_GetThreadLastCpu_Impl */
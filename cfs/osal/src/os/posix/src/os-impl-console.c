@@ -141,7 +141,7 @@ int32 OS_ConsoleCreate_Impl(const OS_object_token_t *token)
             else
             {
                 local_arg.id = OS_ObjectIdFromToken(token);
-                return_code  = OS_Posix_InternalTaskCreate_Impl(&consoletask, OS_CONSOLE_TASK_PRIORITY, 0,
+                return_code  = OS_Posix_InternalTaskCreate_Impl(&consoletask, OS_CONSOLE_TASK_PRIORITY, 0, 0,
                                                                OS_ConsoleTask_Entry, local_arg.opaque_arg);
 
                 if (return_code != OS_SUCCESS)
@@ -0,0 +1,88 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-copy.c
+ * \ingroup  posix
+ *
+ * In-kernel file copy used by the portable OS_GenericCopy_Impl().
+ *
+ * copy_file_range() is a Linux/glibc extension, so this file is built
+ * with _GNU_SOURCE (see CMakeLists.txt).  No other file in this OS layer
+ * should depend on that.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <errno.h>
+#include <sys/sendfile.h>
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+
+/*
+ * Set once copy_file_range() is found to be missing from the running kernel
+ * so later copies go straight to sendfile().
+ */
+static bool OS_Posix_NoCopyFileRange = false;
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_KernelCopy_Impl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Copies up to nbytes between the current positions of two file
+ *           descriptors without passing the data through user space.
+ *
+ *           Tries copy_file_range() then sendfile().  If neither can be used
+ *           with these file descriptors (e.g. different file system types or
+ *           an older kernel) this returns -1 with errno set to ENOSYS so the
+ *           caller can fall back to read() and write().
+ *
+ *-----------------------------------------------------------------*/
+ssize_t OS_Posix_KernelCopy_Impl(int src_fd, int dest_fd, size_t nbytes)
+{
+    ssize_t result;
+
+    result = -1;
+    errno  = ENOSYS;
+
+    if (!OS_Posix_NoCopyFileRange)
+    {
+        result = copy_file_range(src_fd, NULL, dest_fd, NULL, nbytes, 0);
+        if (result < 0 && errno == ENOSYS)
+        {
+            OS_Posix_NoCopyFileRange = true;
+        }
+    }
+
+    if (result < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP))
+    {
+        result = sendfile(dest_fd, src_fd, NULL, nbytes);
+        if (result < 0 && (errno == EINVAL || errno == EOPNOTSUPP))
+        {
+            errno = ENOSYS;
+        }
+    }
+
+    return result;
+} /* end OS_Posix_KernelCopy_Impl */
@@ -0,0 +1,290 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-eventset.c
+ * \ingroup  posix
+ *
+ * Event sets for Linux, using epoll.  Unlike select(), this supports
+ * message queues as members, because a Linux mqd_t is a file descriptor.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include <sys/epoll.h>
+
+#include "os-impl-eventset.h"
+#include "os-impl-io.h"
+#include "os-impl-queues.h"
+#include "os-shared-eventset.h"
+#include "os-shared-idmap.h"
+
+/* Tables where the OS object information is stored */
+OS_impl_eventset_internal_record_t OS_impl_eventset_table[OS_MAX_EVENTSETS];
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetMemberFd
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the file descriptor to register for a stream or queue,
+ *           or -1 if the object cannot be waited on.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_EventSetMemberFd(const OS_object_token_t *obj_token)
+{
+    OS_impl_file_internal_record_t * stream;
+    OS_impl_queue_internal_record_t *queue;
+
+    if (obj_token->obj_type == OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *obj_token);
+        return (int)queue->id;
+    }
+
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *obj_token);
+    if (!stream->selectable)
+    {
+        return -1;
+    }
+
+    return stream->fd;
+} /* end OS_EventSetMemberFd */
+
+/****************************************************************************************
+                                    EVENT SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetCreate_Impl(const OS_object_token_t *token)
+{
+    OS_impl_eventset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_eventset_table, *token);
+
+    impl->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->epoll_fd < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_EventSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_eventset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_eventset_table, *token);
+
+    /* closing the epoll instance drops all of its registrations */
+    close(impl->epoll_fd);
+    impl->epoll_fd = -1;
+
+    return OS_SUCCESS;
+} /* end OS_EventSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot,
+                          uint32 events)
+{
+    OS_impl_eventset_internal_record_t *impl;
+    struct epoll_event                  ev;
+    int                                 fd;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_eventset_table, *token);
+
+    fd = OS_EventSetMemberFd(obj_token);
+    if (fd < 0)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.data.u32 = slot;
+    if (events & OS_STREAM_STATE_READABLE)
+    {
+        ev.events |= EPOLLIN;
+    }
+    if (events & OS_STREAM_STATE_WRITABLE)
+    {
+        ev.events |= EPOLLOUT;
+    }
+
+    if (epoll_ctl(impl->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+        OS_DEBUG("epoll_ctl(ADD): %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_EventSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot)
+{
+    OS_impl_eventset_internal_record_t *impl;
+    int                                 fd;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_eventset_table, *token);
+
+    /*
+     * A member that was closed has already been dropped from the epoll set
+     * by the kernel.  Its descriptor number may since have been reused by
+     * another object, which could even be a member, so it must not be used.
+     */
+    if (obj_token == NULL)
+    {
+        return OS_SUCCESS;
+    }
+
+    fd = OS_EventSetMemberFd(obj_token);
+    if (fd >= 0 && epoll_ctl(impl->epoll_fd, EPOLL_CTL_DEL, fd, NULL) < 0)
+    {
+        OS_DEBUG("epoll_ctl(DEL): %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_EventSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetWait_Impl(const OS_object_token_t *token, OS_eventset_ready_t *ready, uint32 max_ready,
+                           uint32 *num_ready, int32 msecs)
+{
+    OS_impl_eventset_internal_record_t *impl;
+    struct epoll_event                  ev[OS_MAX_EVENTSET_MEMBERS];
+    struct timespec                     ts_now;
+    struct timespec                     ts_end;
+    int                                 timeout;
+    int                                 os_status;
+    int                                 i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_eventset_table, *token);
+
+    if (max_ready > OS_MAX_EVENTSET_MEMBERS)
+    {
+        max_ready = OS_MAX_EVENTSET_MEMBERS;
+    }
+
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts_end);
+        ts_end.tv_sec += msecs / 1000;
+        ts_end.tv_nsec += 1000000 * (msecs % 1000);
+        if (ts_end.tv_nsec >= 1000000000)
+        {
+            ++ts_end.tv_sec;
+            ts_end.tv_nsec -= 1000000000;
+        }
+    }
+
+    timeout = msecs;
+    while (true)
+    {
+        os_status = epoll_wait(impl->epoll_fd, ev, (int)max_ready, timeout);
+        if (os_status >= 0 || errno != EINTR)
+        {
+            break;
+        }
+
+        /* interrupted by a signal, wait again for whatever time remains */
+        if (msecs > 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &ts_now);
+            timeout = (int)((ts_end.tv_sec - ts_now.tv_sec) * 1000 + (ts_end.tv_nsec - ts_now.tv_nsec) / 1000000);
+            if (timeout < 0)
+            {
+                timeout = 0;
+            }
+        }
+    }
+
+    if (os_status < 0)
+    {
+        OS_DEBUG("epoll_wait: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < os_status; ++i)
+    {
+        ready[i].slot   = ev[i].data.u32;
+        ready[i].events = 0;
+
+        /* a hangup or error is reported as readable, so the reader will see it */
+        if (ev[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        {
+            ready[i].events |= OS_STREAM_STATE_READABLE;
+        }
+        if (ev[i].events & EPOLLOUT)
+        {
+            ready[i].events |= OS_STREAM_STATE_WRITABLE;
+        }
+    }
+
+    *num_ready = (uint32)os_status;
+
+    return OS_SUCCESS;
+} /* end OS_EventSetWait_Impl */
@@ -0,0 +1,294 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-futex-binsem.c
+ * \ingroup  posix
+ *
+ * Binary semaphores built directly on Linux futexes, selected by
+ * OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES in place of os-impl-binsem.c.
+ *
+ * Give, take and flush are plain atomic operations when uncontended, and
+ * only enter the kernel to sleep or to wake a task that is sleeping.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-binsem.h"
+#include "os-impl-futex.h"
+#include "os-shared-binsem.h"
+#include "os-shared-idmap.h"
+
+/* Tables where the OS object information is stored */
+OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+
+/****************************************************************************************
+                                BINARY SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * Unlike the pthread version, giving a futex binary semaphore never takes a
+ * lock, so it does not cause a task switch and may be done from a signal handler.
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_BinSemAPI_Impl_Init
+
+   Purpose: Initialize the Binary Semaphore data structures
+
+---------------------------------------------------------------------------------------*/
+int32 OS_Posix_BinSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
+    OS_Posix_FutexInit();
+    return OS_SUCCESS;
+} /* end OS_Posix_BinSemAPI_Impl_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* same as the pthread version, values above 1 are silently treated as 1 */
+    if (initial_value > 1)
+    {
+        initial_value = 1;
+    }
+
+    memset(sem, 0, sizeof(*sem));
+    __atomic_store_n(&sem->current_value, initial_value, __ATOMIC_SEQ_CST);
+
+    return OS_SUCCESS;
+} /* end OS_BinSemCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* sem is busy if some task is pending on it, like pthread_cond_destroy() */
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_BinSemDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemGive_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* Binary semaphores are always set as "1" when given */
+    __atomic_store_n(&sem->current_value, 1, __ATOMIC_SEQ_CST);
+
+    /*
+     * Advance the sequence so a taker that saw the old value cannot go to
+     * sleep, then only enter the kernel if something is actually sleeping.
+     */
+    __atomic_add_fetch(&sem->wake_seq, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_FutexWake(&sem->wake_seq, 1);
+    }
+
+    return OS_SUCCESS;
+} /* end OS_BinSemGive_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemFlush_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* increment the flush counter.  Any other threads that are
+     * currently pending in SemTake() will see the counter change and
+     * return _without_ modifying the semaphore count.
+     */
+    __atomic_add_fetch(&sem->flush_request, 1, __ATOMIC_SEQ_CST);
+
+    /* unblock all threads that are be waiting on this sem */
+    __atomic_add_fetch(&sem->wake_seq, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_FutexWake(&sem->wake_seq, INT_MAX);
+    }
+
+    return OS_SUCCESS;
+} /* end OS_BinSemFlush_Impl */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericBinSemTake_Impl
+
+   Purpose: Helper function that takes a futex binary semaphore with a "timespec" timeout
+            If the value is zero this will spin briefly and then block until either
+            the value becomes nonzero (via SemGive) or the semaphore gets flushed.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                            flush_count;
+    uint32                            seq;
+    uint32                            expected;
+    uint32                            spin;
+    bool                              timed_out;
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * first take a local snapshot of the flush request counter,
+     * if it changes, we know that someone else called SemFlush.
+     */
+    flush_count = __atomic_load_n(&sem->flush_request, __ATOMIC_SEQ_CST);
+    spin        = OS_Posix_FutexSpinLimit;
+    timed_out   = false;
+
+    while (true)
+    {
+        /* read the sequence before the state, so any later give or flush changes it */
+        seq = __atomic_load_n(&sem->wake_seq, __ATOMIC_SEQ_CST);
+
+        /* a flush releases the task _without_ consuming the value */
+        if (__atomic_load_n(&sem->flush_request, __ATOMIC_SEQ_CST) != flush_count)
+        {
+            break;
+        }
+
+        expected = 1;
+        if (__atomic_compare_exchange_n(&sem->current_value, &expected, 0, false, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_SEQ_CST))
+        {
+            break;
+        }
+
+        /*
+         * The state is checked once more after a timeout, in case a give
+         * woke this task at the same moment, so that wakeup is not lost.
+         */
+        if (timed_out)
+        {
+            return OS_SEM_TIMEOUT;
+        }
+
+        if (spin > 0)
+        {
+            --spin;
+            OS_Posix_FutexSpinPause();
+        }
+        else if (OS_Posix_FutexWait(&sem->wake_seq, seq, &sem->waiters, timeout) == ETIMEDOUT)
+        {
+            timed_out = true;
+        }
+    }
+
+    return OS_SUCCESS;
+} /* end OS_GenericBinSemTake_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemTake_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericBinSemTake_Impl(token, NULL));
+} /* end OS_BinSemTake_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemTimedWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_CompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericBinSemTake_Impl(token, &ts));
+} /* end OS_BinSemTimedWait_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_BinSemGetInfo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *sem_prop)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* put the info into the stucture */
+    sem_prop->value = __atomic_load_n(&sem->current_value, __ATOMIC_SEQ_CST);
+    return OS_SUCCESS;
+} /* end OS_BinSemGetInfo_Impl */
@@ -0,0 +1,266 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-futex-countsem.c
+ * \ingroup  posix
+ *
+ * Counting semaphores built directly on Linux futexes, selected by
+ * OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES in place of os-impl-countsem.c.
+ *
+ * Takers sleep on the count itself, and only after spinning briefly.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-impl-countsem.h"
+#include "os-impl-futex.h"
+#include "os-shared-countsem.h"
+#include "os-shared-idmap.h"
+
+/*
+ * Added SEM_VALUE_MAX Define
+ */
+#ifndef SEM_VALUE_MAX
+#define SEM_VALUE_MAX (UINT32_MAX / 2)
+#endif
+
+/* Tables where the OS object information is stored */
+OS_impl_countsem_internal_record_t OS_impl_count_sem_table[OS_MAX_COUNT_SEMAPHORES];
+
+/****************************************************************************************
+                               COUNTING SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * As with sem_post(), a "give" is a single atomic update plus a wakeup when
+ * a task is pending, so it may be done from a signal / ISR context and never blocks.
+ */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_CountSemAPI_Impl_Init
+
+   Purpose: Initialize the Counting Semaphore data structures
+
+---------------------------------------------------------------------------------------*/
+int32 OS_Posix_CountSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_count_sem_table, 0, sizeof(OS_impl_count_sem_table));
+    OS_Posix_FutexInit();
+    return OS_SUCCESS;
+} /* end OS_Posix_CountSemAPI_Impl_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemCreate_Impl(const OS_object_token_t *token, uint32 sem_initial_value, uint32 options)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    if (sem_initial_value > SEM_VALUE_MAX)
+    {
+        return OS_INVALID_SEM_VALUE;
+    }
+
+    memset(impl, 0, sizeof(*impl));
+    __atomic_store_n(&impl->value, sem_initial_value, __ATOMIC_SEQ_CST);
+
+    return OS_SUCCESS;
+
+} /* end OS_CountSemCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* sem is busy if some task is pending on it */
+    if (__atomic_load_n(&impl->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+
+} /* end OS_CountSemDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemGive_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGive_Impl(const OS_object_token_t *token)
+{
+    uint32                              value;
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    value = __atomic_load_n(&impl->value, __ATOMIC_SEQ_CST);
+    do
+    {
+        /* same as sem_post() failing with EOVERFLOW */
+        if (value >= SEM_VALUE_MAX)
+        {
+            return OS_SEM_FAILURE;
+        }
+    } while (!__atomic_compare_exchange_n(&impl->value, &value, value + 1, false, __ATOMIC_SEQ_CST,
+                                          __ATOMIC_SEQ_CST));
+
+    if (__atomic_load_n(&impl->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_FutexWake(&impl->value, 1);
+    }
+
+    return OS_SUCCESS;
+
+} /* end OS_CountSemGive_Impl */
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericCountSemTake_Impl
+
+   Purpose: Helper function that takes a futex counting semaphore with a "timespec" timeout
+            If the value is zero this will spin briefly and then block until
+            the value becomes nonzero (via SemGive).
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericCountSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                              value;
+    uint32                              spin;
+    bool                                timed_out;
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    spin      = OS_Posix_FutexSpinLimit;
+    timed_out = false;
+
+    while (true)
+    {
+        value = __atomic_load_n(&impl->value, __ATOMIC_SEQ_CST);
+        if (value > 0)
+        {
+            if (__atomic_compare_exchange_n(&impl->value, &value, value - 1, false, __ATOMIC_SEQ_CST,
+                                            __ATOMIC_SEQ_CST))
+            {
+                break;
+            }
+
+            /* lost a race with another taker, try again */
+            continue;
+        }
+
+        /*
+         * The value is checked once more after a timeout, in case a give
+         * woke this task at the same moment, so that wakeup is not lost.
+         */
+        if (timed_out)
+        {
+            return OS_SEM_TIMEOUT;
+        }
+
+        if (spin > 0)
+        {
+            --spin;
+            OS_Posix_FutexSpinPause();
+        }
+        else if (OS_Posix_FutexWait(&impl->value, 0, &impl->waiters, timeout) == ETIMEDOUT)
+        {
+            timed_out = true;
+        }
+    }
+
+    return OS_SUCCESS;
+} /* end OS_GenericCountSemTake_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemTake_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericCountSemTake_Impl(token, NULL));
+} /* end OS_CountSemTake_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemTimedWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_CompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericCountSemTake_Impl(token, &ts));
+} /* end OS_CountSemTimedWait_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CountSemGetInfo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CountSemGetInfo_Impl(const OS_object_token_t *token, OS_count_sem_prop_t *count_prop)
+{
+    OS_impl_countsem_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_count_sem_table, *token);
+
+    /* put the info into the stucture */
+    count_prop->value = __atomic_load_n(&impl->value, __ATOMIC_SEQ_CST);
+    return OS_SUCCESS;
+} /* end OS_CountSemGetInfo_Impl */
@@ -0,0 +1,220 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-futex-mutex.c
+ * \ingroup  posix
+ *
+ * Recursive, priority-inheritance mutexes built directly on Linux PI
+ * futexes, selected by OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES in place of
+ * os-impl-mutex.c.
+ *
+ * An uncontended take or give is a single compare-and-swap of the owner's
+ * thread ID.  A contended take spins briefly, then lets the kernel queue
+ * the task and boost the owner exactly as a PTHREAD_PRIO_INHERIT mutex does.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-shared-mutex.h"
+#include "os-shared-idmap.h"
+#include "os-impl-mutex.h"
+#include "os-impl-futex.h"
+
+/* Tables where the OS object information is stored */
+OS_impl_mutex_internal_record_t OS_impl_mutex_table[OS_MAX_MUTEXES];
+
+/****************************************************************************************
+                                  MUTEX API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_MutexAPI_Impl_Init
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_Posix_MutexAPI_Impl_Init(void)
+{
+    memset(OS_impl_mutex_table, 0, sizeof(OS_impl_mutex_table));
+    OS_Posix_FutexInit();
+    return OS_SUCCESS;
+} /* end OS_Posix_MutexAPI_Impl_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_MutSemCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+
+    /* upon creation the mutex is unlocked */
+    memset(impl, 0, sizeof(*impl));
+
+    return OS_SUCCESS;
+} /* end OS_MutSemCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_MutSemDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+
+    /* a locked mutex cannot be destroyed, same as pthread_mutex_destroy() */
+    if (__atomic_load_n(&impl->owner, __ATOMIC_SEQ_CST) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+
+} /* end OS_MutSemDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_MutSemGive_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemGive_Impl(const OS_object_token_t *token)
+{
+    uint32                           tid;
+    uint32                           expected;
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+    tid  = OS_Posix_FutexThreadId();
+
+    /* only the owner may unlock, as with a recursive pthread mutex */
+    if ((__atomic_load_n(&impl->owner, __ATOMIC_RELAXED) & OS_POSIX_FUTEX_TID_MASK) != tid)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    /* nested give, still held by this task */
+    if (impl->depth > 1)
+    {
+        --impl->depth;
+        return OS_SUCCESS;
+    }
+
+    impl->depth = 0;
+
+    /*
+     * If no task is waiting the word is still exactly this TID.  Otherwise
+     * the kernel has set the waiters bit and must hand the mutex over.
+     */
+    expected = tid;
+    if (!__atomic_compare_exchange_n(&impl->owner, &expected, 0, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED) &&
+        OS_Posix_FutexUnlockPI(&impl->owner) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_MutSemGive_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_MutSemTake_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemTake_Impl(const OS_object_token_t *token)
+{
+    uint32                           tid;
+    uint32                           expected;
+    uint32                           spin;
+    OS_impl_mutex_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_mutex_table, *token);
+    tid  = OS_Posix_FutexThreadId();
+
+    /* nested take by the current owner */
+    if ((__atomic_load_n(&impl->owner, __ATOMIC_RELAXED) & OS_POSIX_FUTEX_TID_MASK) == tid)
+    {
+        ++impl->depth;
+        return OS_SUCCESS;
+    }
+
+    /*
+     * Try to grab it directly, polling for a short while in case the
+     * owner is about to release it on another CPU.
+     */
+    spin     = OS_Posix_FutexSpinLimit;
+    expected = 0;
+    while (!__atomic_compare_exchange_n(&impl->owner, &expected, tid, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        if (spin == 0)
+        {
+            /* still owned by another task, so queue in the kernel with priority inheritance */
+            if (OS_Posix_FutexLockPI(&impl->owner) != 0)
+            {
+                return OS_SEM_FAILURE;
+            }
+            break;
+        }
+
+        --spin;
+        OS_Posix_FutexSpinPause();
+        expected = 0;
+    }
+
+    impl->depth = 1;
+
+    return OS_SUCCESS;
+} /* end OS_MutSemTake_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_MutSemGetInfo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_MutSemGetInfo_Impl(const OS_object_token_t *token, OS_mut_sem_prop_t *mut_prop)
+{
+    return OS_SUCCESS;
+
+} /* end OS_MutSemGetInfo_Impl */
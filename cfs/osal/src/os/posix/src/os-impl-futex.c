@@ -0,0 +1,194 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-futex.c
+ * \ingroup  posix
+ *
+ * Linux futex system call wrappers used by the futex based semaphore
+ * and mutex implementations (OSAL_CONFIG_POSIX_FUTEX_SEMAPHORES).
+ *
+ * There is no C library wrapper for futex(2), so this file is built with
+ * _GNU_SOURCE for syscall() (see CMakeLists.txt).
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "os-posix.h"
+#include "os-impl-futex.h"
+
+/*
+ * Kernel thread ID of the calling thread, looked up on first use.
+ * A PI futex word must hold the owner's TID, not a pthread_t.
+ */
+static __thread uint32 OS_Posix_FutexTid;
+
+uint32 OS_Posix_FutexSpinLimit;
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexInit
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexInit(void)
+{
+    if (sysconf(_SC_NPROCESSORS_ONLN) > 1)
+    {
+        OS_Posix_FutexSpinLimit = OS_POSIX_FUTEX_SPIN_COUNT;
+    }
+    else
+    {
+        OS_Posix_FutexSpinLimit = 0;
+    }
+} /* end OS_Posix_FutexInit */
+
+/*----------------------------------------------------------------
+ * Function: OS_Posix_FutexWaitCleanup
+ *
+ * Cancellation cleanup handler, drops the waiter count if the task
+ * is deleted while sleeping in OS_Posix_FutexWait().
+ *-----------------------------------------------------------------*/
+static void OS_Posix_FutexWaitCleanup(void *arg)
+{
+    __atomic_sub_fetch((uint32 *)arg, 1, __ATOMIC_SEQ_CST);
+} /* end OS_Posix_FutexWaitCleanup */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexWait
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexWait(uint32 *word, uint32 expected, uint32 *waiters, const struct timespec *abstime)
+{
+    int  status;
+    int  old_type;
+    long ret;
+
+    /*
+     * The waiter count must be visible before the kernel checks the word,
+     * a waker that changes the word and then sees no waiters is
+     * guaranteed that the kernel check here will fail with EAGAIN.
+     */
+    __atomic_add_fetch(waiters, 1, __ATOMIC_SEQ_CST);
+
+    /*
+     * OS_TaskDelete() cancels the task, so sleeping here must be a
+     * cancellation point as sem_wait() and pthread_cond_wait() are.
+     * As in the C library, asynchronous cancel is only enabled around
+     * the system call itself.
+     */
+    pthread_cleanup_push(OS_Posix_FutexWaitCleanup, waiters);
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &old_type);
+
+    /* the bitset form takes an absolute time, on CLOCK_REALTIME like the other waits */
+    ret = syscall(SYS_futex, word, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, expected, abstime, NULL,
+                  FUTEX_BITSET_MATCH_ANY);
+    status = (ret < 0) ? errno : 0;
+
+    pthread_setcanceltype(old_type, NULL);
+    pthread_cleanup_pop(1);
+
+    return status;
+} /* end OS_Posix_FutexWait */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexWake
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_Posix_FutexWake(uint32 *word, int count)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+} /* end OS_Posix_FutexWake */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexLockPI
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexLockPI(uint32 *word)
+{
+    long ret;
+
+    /*
+     * The kernel sets the word to this thread's TID once it is free,
+     * boosting the current owner in the meantime.  Like pthread_mutex_lock()
+     * this is not a cancellation point.
+     */
+    do
+    {
+        ret = syscall(SYS_futex, word, FUTEX_LOCK_PI_PRIVATE, 0, NULL, NULL, 0);
+    } while (ret < 0 && (errno == EINTR || errno == EAGAIN));
+
+    return (ret < 0) ? errno : 0;
+} /* end OS_Posix_FutexLockPI */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexUnlockPI
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int OS_Posix_FutexUnlockPI(uint32 *word)
+{
+    if (syscall(SYS_futex, word, FUTEX_UNLOCK_PI_PRIVATE, 0, NULL, NULL, 0) < 0)
+    {
+        return errno;
+    }
+
+    return 0;
+} /* end OS_Posix_FutexUnlockPI */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_FutexThreadId
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_Posix_FutexThreadId(void)
+{
+    if (OS_Posix_FutexTid == 0)
+    {
+        OS_Posix_FutexTid = (uint32)syscall(SYS_gettid);
+    }
+
+    return OS_Posix_FutexTid;
+} /* end OS_Posix_FutexThreadId */
@@ -436,7 +436,7 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
  *  Purpose: Local helper routine, not part of OSAL API.
  *
  *-----------------------------------------------------------------*/
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz, uint32 cpu_mask,
                                        PthreadFuncPtr_t entry, void *entry_arg)
 {
     int                return_code = 0;
@@ -542,6 +542,15 @@ int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority
 
     } /* End if user is root */
 
+    /*
+    ** Restrict the thread to the requested CPUs from the start,
+    ** so it never runs (or migrates) anywhere else
+    */
+    if (cpu_mask != 0 && OS_Posix_TaskAttrSetAffinity_Impl(&custom_attr, cpu_mask) != OS_SUCCESS)
+    {
+        return (OS_ERROR);
+    }
+
     /*
      ** Create thread
      */
@@ -588,8 +597,11 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
     task = OS_OBJECT_TABLE_GET(OS_task_table, *token);
     impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
 
-    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_size, OS_PthreadTaskEntry,
-                                                   arg.opaque_arg);
+    /* Not known until the new task registers itself; never report a prior occupant's */
+    __atomic_store_n(&impl->system_tid, 0, __ATOMIC_RELEASE);
+
+    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_size,
+                                                   OS_TASK_CPU_AFFINITY_GET(flags), OS_PthreadTaskEntry, arg.opaque_arg);
 
     return return_code;
 } /* end OS_TaskCreate_Impl */
@@ -694,6 +706,9 @@ int32 OS_TaskDelete_Impl(const OS_object_token_t *token)
                      OS_ObjectIdToInteger(OS_ObjectIdFromToken(token)), strerror(ret));
         }
     }
+
+    __atomic_store_n(&impl->system_tid, 0, __ATOMIC_RELEASE);
+
     return OS_SUCCESS;
 
 } /* end OS_TaskDelete_Impl */
@@ -787,6 +802,23 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
     return OS_SUCCESS;
 } /* end OS_TaskSetPriority_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+{
+    OS_impl_task_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    return OS_Posix_TaskSetAffinity_Impl(impl->id, cpu_mask);
+} /* end OS_TaskSetAffinity_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskRegister_Impl
@@ -799,6 +831,7 @@ int32 OS_TaskRegister_Impl(osal_id_t global_task_id)
 {
     int32                    return_code;
     OS_VoidPtrValueWrapper_t arg;
+    osal_index_t             local_idx;
     int                      old_state;
     int                      old_type;
 
@@ -811,6 +844,15 @@ int32 OS_TaskRegister_Impl(osal_id_t global_task_id)
     pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &old_state);
     pthread_setcanceltype(PTHREAD_CANCEL_DEFERRED, &old_type);
 
+    /*
+     * Record the kernel thread ID so the CPU this task runs on can be reported
+     */
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, global_task_id, &local_idx) == OS_SUCCESS)
+    {
+        __atomic_store_n(&OS_impl_task_table[local_idx].system_tid, OS_Posix_GetThreadSystemId_Impl(),
+                         __ATOMIC_RELEASE);
+    }
+
     arg.opaque_arg = 0;
     arg.id         = global_task_id;
 
@@ -855,6 +897,23 @@ osal_id_t OS_TaskGetId_Impl(void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop)
 {
+    OS_impl_task_internal_record_t *impl;
+    pid_t                           system_tid;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    /*
+     * This is called without the global lock, as reading /proc is slow.
+     * The held reference keeps the task from being deleted meanwhile, and
+     * the ID is read once so the task registering itself cannot tear it.
+     * The kernel thread ID is only known once the task has started running.
+     */
+    system_tid = __atomic_load_n(&impl->system_tid, __ATOMIC_ACQUIRE);
+    if (system_tid > 0)
+    {
+        task_prop->last_cpu = OS_Posix_GetThreadLastCpu_Impl(system_tid);
+    }
+
     return OS_SUCCESS;
 } /* end OS_TaskGetInfo_Impl */
 
@@ -357,7 +357,7 @@ int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
      */
     arg.opaque_arg = NULL;
     arg.id         = OS_ObjectIdFromToken(token);
-    return_code    = OS_Posix_InternalTaskCreate_Impl(&local->handler_thread, OSAL_PRIORITY_C(0), 0,
+    return_code    = OS_Posix_InternalTaskCreate_Impl(&local->handler_thread, OSAL_PRIORITY_C(0), 0, 0,
                                                    OS_TimeBasePthreadEntry, arg.opaque_arg);
     if (return_code != OS_SUCCESS)
     {
@@ -264,6 +264,21 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
 
 } /* end OS_TaskSetPriority_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  CPU affinity is not supported by this implementation
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_TaskSetAffinity_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskMatch_Impl
@@ -0,0 +1,131 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ */
+
+#ifndef OS_SHARED_EVENTSET_H
+#define OS_SHARED_EVENTSET_H
+
+#include "osapi-eventset.h"
+#include "os-shared-globaldefs.h"
+
+/*
+ * Event sets keep their member list in the shared layer.  A member is
+ * identified to the implementation by its slot number in this list,
+ * which stays the same for as long as the object is a member.
+ */
+typedef struct
+{
+    char      set_name[OS_MAX_API_NAME];
+    uint32    num_members;
+    osal_id_t member_id[OS_MAX_EVENTSET_MEMBERS];
+    uint32    member_events[OS_MAX_EVENTSET_MEMBERS];
+} OS_eventset_internal_record_t;
+
+/*
+ * A member found to be ready by the implementation
+ */
+typedef struct
+{
+    uint32 slot;
+    uint32 events;
+} OS_eventset_ready_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_eventset_internal_record_t OS_eventset_table[OS_MAX_EVENTSETS];
+
+/****************************************************************************************
+                                IMPLEMENTATION FUNCTIONS
+  ***************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_EventSetAPI_Init
+
+   Purpose: Initialize the OS-independent layer for event sets
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_EventSetAPI_Init(void);
+
+/*----------------------------------------------------------------
+   Function: OS_EventSetCreate_Impl
+
+    Purpose: Prepare/allocate OS resources for an event set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_EventSetCreate_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+   Function: OS_EventSetDelete_Impl
+
+    Purpose: Free the OS resources associated with an event set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_EventSetDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+   Function: OS_EventSetAdd_Impl
+
+    Purpose: Start waiting for the given states of an object
+             The object is a stream or a queue, and is added at "slot"
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the object cannot be waited on
+ ------------------------------------------------------------------*/
+int32 OS_EventSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot,
+                          uint32 events);
+
+/*----------------------------------------------------------------
+   Function: OS_EventSetRemove_Impl
+
+    Purpose: Stop waiting for the member at "slot"
+             obj_token refers to the member object, or is NULL if it has
+             already been closed or deleted (so its OS resource may have
+             been reused by another object)
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_EventSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot);
+
+/*----------------------------------------------------------------
+   Function: OS_EventSetWait_Impl
+
+    Purpose: Wait for any member of the set to become ready
+             Up to "max_ready" members are reported by slot number
+             msecs indicates the timeout.  Positive values will wait up to that many milliseconds.
+             Zero will not wait (poll) or negative values will wait forever (pend)
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERROR_TIMEOUT if no member became ready
+ ------------------------------------------------------------------*/
+int32 OS_EventSetWait_Impl(const OS_object_token_t *token, OS_eventset_ready_t *ready, uint32 max_ready,
+                           uint32 *num_ready, int32 msecs);
+
+#endif /* OS_SHARED_EVENTSET_H */
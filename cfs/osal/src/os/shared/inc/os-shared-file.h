@@ -101,6 +101,16 @@ int32 OS_GenericRead_Impl(const OS_object_token_t *token, void *buffer, size_t n
  ------------------------------------------------------------------*/
 int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, size_t nbytes, int32 timeout);
 
+/*----------------------------------------------------------------
+   Function: OS_GenericCopy_Impl
+
+    Purpose: Copy data from one file descriptor to another
+             Both positions are advanced by the amount copied
+
+    Returns: Number of bytes copied (non-negative) on success, or relevant error code (negative)
+ ------------------------------------------------------------------*/
+int32 OS_GenericCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes);
+
 /*----------------------------------------------------------------
    Function: OS_GenericClose_Impl
 
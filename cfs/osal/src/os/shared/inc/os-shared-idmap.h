@@ -131,6 +131,7 @@ extern OS_common_record_t *const OS_global_timecb_table;
 extern OS_common_record_t *const OS_global_module_table;
 extern OS_common_record_t *const OS_global_filesys_table;
 extern OS_common_record_t *const OS_global_console_table;
+extern OS_common_record_t *const OS_global_eventset_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -41,6 +41,7 @@ typedef struct
     osal_task_entry delete_hook_pointer;
     void *          entry_arg;
     osal_stackptr_t stack_pointer;
+    uint32          cpu_mask;
 } OS_task_internal_record_t;
 
 /*
@@ -141,6 +142,15 @@ int32 OS_TaskDelay_Impl(uint32 millisecond);
  ------------------------------------------------------------------*/
 int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t new_priority);
 
+/*----------------------------------------------------------------
+   Function: OS_TaskSetAffinity_Impl
+
+    Purpose: Set the CPU affinity of the specified task
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, uint32 cpu_mask);
+
 /*----------------------------------------------------------------
    Function: OS_TaskGetId_Impl
 
@@ -155,6 +165,9 @@ osal_id_t OS_TaskGetId_Impl(void);
 
     Purpose: Obtain OS-specific information about a task
 
+        NOTE: This is invoked holding a reference to the task, but not
+              the global table lock
+
     Returns: OS_SUCCESS on success, or relevant error code
  ------------------------------------------------------------------*/
 int32 OS_TaskGetInfo_Impl(const OS_object_token_t *token, OS_task_prop_t *task_prop);
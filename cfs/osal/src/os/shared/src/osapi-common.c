@@ -44,6 +44,7 @@
 #include "os-shared-common.h"
 #include "os-shared-countsem.h"
 #include "os-shared-dir.h"
+#include "os-shared-eventset.h"
 #include "os-shared-file.h"
 #include "os-shared-filesys.h"
 #include "os-shared-idmap.h"
@@ -190,6 +191,9 @@ int32 OS_API_Init(void)
             case OS_OBJECT_TYPE_OS_CONSOLE:
                 return_code = OS_ConsoleAPI_Init();
                 break;
+            case OS_OBJECT_TYPE_OS_EVENTSET:
+                return_code = OS_EventSetAPI_Init();
+                break;
             default:
                 break;
         }
@@ -349,6 +353,9 @@ void OS_CleanUpObject(osal_id_t object_id, void *arg)
         case OS_OBJECT_TYPE_OS_DIR:
             OS_DirectoryClose(object_id);
             break;
+        case OS_OBJECT_TYPE_OS_EVENTSET:
+            OS_EventSetDelete(object_id);
+            break;
         default:
             break;
     }
@@ -0,0 +1,458 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     osapi-eventset.c
+ * \ingroup  shared
+ *
+ *         This file  contains some of the OS APIs abstraction layer code
+ *         that is shared/common across all OS-specific implementations.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-eventset.h"
+#include "os-shared-idmap.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevent OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_EVENTSETS) || (OS_MAX_EVENTSETS <= 0)
+#error "osconfig.h must define OS_MAX_EVENTSETS to a valid value"
+#endif
+#if !defined(OS_MAX_EVENTSET_MEMBERS) || (OS_MAX_EVENTSET_MEMBERS <= 0)
+#error "osconfig.h must define OS_MAX_EVENTSET_MEMBERS to a valid value"
+#endif
+
+/*
+ * Global data for the API
+ */
+enum
+{
+    LOCAL_NUM_OBJECTS = OS_MAX_EVENTSETS,
+    LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_EVENTSET
+};
+
+OS_eventset_internal_record_t OS_eventset_table[LOCAL_NUM_OBJECTS];
+
+/****************************************************************************************
+                                  EVENT SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetAPI_Init
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetAPI_Init(void)
+{
+    memset(OS_eventset_table, 0, sizeof(OS_eventset_table));
+    return OS_SUCCESS;
+} /* end OS_EventSetAPI_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetFindMember
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot holding the given object, or OS_MAX_EVENTSET_MEMBERS
+ *           if the object is not a member.  Passing OS_OBJECT_ID_UNDEFINED
+ *           finds the first free slot.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_EventSetFindMember(const OS_eventset_internal_record_t *eventset, osal_id_t objid)
+{
+    uint32 slot;
+
+    for (slot = 0; slot < OS_MAX_EVENTSET_MEMBERS; ++slot)
+    {
+        if (OS_ObjectIdEqual(eventset->member_id[slot], objid))
+        {
+            break;
+        }
+    }
+
+    return slot;
+} /* end OS_EventSetFindMember */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetCreate
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetCreate(osal_id_t *set_id, const char *set_name, uint32 flags)
+{
+    int32                          return_code;
+    OS_object_token_t              token;
+    OS_eventset_internal_record_t *eventset;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(set_id);
+    OS_CHECK_APINAME(set_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, set_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, eventset, set_name, set_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_EventSetCreate_Impl(&token);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, set_id);
+    }
+
+    return return_code;
+} /* end OS_EventSetCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetDelete
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetDelete(osal_id_t set_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, set_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_EventSetDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+} /* end OS_EventSetDelete */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetAdd
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetAdd(osal_id_t set_id, osal_id_t objid, uint32 events)
+{
+    OS_object_token_t              token;
+    OS_object_token_t              obj_token;
+    OS_eventset_internal_record_t *eventset;
+    osal_objtype_t                 objtype;
+    uint32                         slot;
+    int32                          return_code;
+
+    if (events == 0 || (events & ~(OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) != 0)
+    {
+        return OS_ERR_INVALID_SIZE;
+    }
+
+    objtype = OS_IdentifyObject(objid);
+    if (objtype == OS_OBJECT_TYPE_UNDEFINED)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+    if (objtype != OS_OBJECT_TYPE_OS_STREAM && objtype != OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    /*
+     * Hold a reference to the new member so it cannot be closed while being added.
+     * This is taken before locking the event set table, so the tables are always
+     * locked in the same order.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, objtype, objid, &obj_token);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, set_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, token);
+
+        if (OS_EventSetFindMember(eventset, objid) < OS_MAX_EVENTSET_MEMBERS)
+        {
+            return_code = OS_ERR_NAME_TAKEN;
+        }
+        else
+        {
+            slot = OS_EventSetFindMember(eventset, OS_OBJECT_ID_UNDEFINED);
+            if (slot >= OS_MAX_EVENTSET_MEMBERS)
+            {
+                return_code = OS_ERR_NO_FREE_IDS;
+            }
+            else
+            {
+                return_code = OS_EventSetAdd_Impl(&token, &obj_token, slot, events);
+                if (return_code == OS_SUCCESS)
+                {
+                    eventset->member_id[slot]     = objid;
+                    eventset->member_events[slot] = events;
+                    ++eventset->num_members;
+                }
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    OS_ObjectIdRelease(&obj_token);
+
+    return return_code;
+} /* end OS_EventSetAdd */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetRemove
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetRemove(osal_id_t set_id, osal_id_t objid)
+{
+    OS_object_token_t              token;
+    OS_object_token_t              obj_token;
+    OS_eventset_internal_record_t *eventset;
+    osal_objtype_t                 objtype;
+    bool                           obj_open;
+    uint32                         slot;
+    int32                          return_code;
+
+    if (!OS_ObjectIdDefined(objid))
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    /*
+     * The member may have been closed without being removed, in which case
+     * its ID (including the serial number) no longer resolves even if the
+     * table entry was reused.  The implementation is only given the member
+     * while it is still open, so it never acts on a resource that now
+     * belongs to some other object.  As in OS_EventSetAdd(), the member is
+     * referenced before the event set table is locked.
+     */
+    obj_open = false;
+    objtype  = OS_IdentifyObject(objid);
+    if (objtype == OS_OBJECT_TYPE_OS_STREAM || objtype == OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        obj_open = (OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, objtype, objid, &obj_token) == OS_SUCCESS);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, set_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, token);
+
+        slot = OS_EventSetFindMember(eventset, objid);
+        if (slot >= OS_MAX_EVENTSET_MEMBERS)
+        {
+            return_code = OS_ERR_NAME_NOT_FOUND;
+        }
+        else
+        {
+            return_code = OS_EventSetRemove_Impl(&token, obj_open ? &obj_token : NULL, slot);
+
+            /* The member is forgotten regardless, the OS may already have dropped it */
+            eventset->member_id[slot]     = OS_OBJECT_ID_UNDEFINED;
+            eventset->member_events[slot] = 0;
+            --eventset->num_members;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    if (obj_open)
+    {
+        OS_ObjectIdRelease(&obj_token);
+    }
+
+    return return_code;
+} /* end OS_EventSetRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetWait
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetWait(osal_id_t set_id, OS_eventset_event_t *events, uint32 max_events, uint32 *num_events,
+                      int32 msecs)
+{
+    OS_object_token_t              token;
+    OS_eventset_internal_record_t *eventset;
+    OS_eventset_ready_t            ready[OS_MAX_EVENTSET_MEMBERS];
+    uint32                         num_ready;
+    uint32                         i;
+    int32                          return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(events);
+    OS_CHECK_POINTER(num_events);
+    OS_CHECK_SIZE(max_events);
+
+    *num_events = 0;
+
+    if (max_events > OS_MAX_EVENTSET_MEMBERS)
+    {
+        max_events = OS_MAX_EVENTSET_MEMBERS;
+    }
+
+    /*
+     * A reference is held while waiting, rather than the table lock,
+     * so other tasks can still use (but not delete) the set.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, set_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, token);
+
+        if (eventset->num_members == 0)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            num_ready   = 0;
+            return_code = OS_EventSetWait_Impl(&token, ready, max_events, &num_ready, msecs);
+        }
+
+        if (return_code == OS_SUCCESS)
+        {
+            /*
+             * Translate the slots into IDs under lock, skipping any
+             * member that was removed while this task was waiting.
+             */
+            OS_Lock_Global(&token);
+
+            for (i = 0; i < num_ready && i < max_events; ++i)
+            {
+                if (ready[i].slot < OS_MAX_EVENTSET_MEMBERS &&
+                    OS_ObjectIdDefined(eventset->member_id[ready[i].slot]))
+                {
+                    events[*num_events].objid  = eventset->member_id[ready[i].slot];
+                    events[*num_events].events = ready[i].events & eventset->member_events[ready[i].slot];
+                    ++(*num_events);
+                }
+            }
+
+            OS_Unlock_Global(&token);
+
+            /*
+             * If every ready member was removed meanwhile, there is nothing
+             * to report, so this is treated the same as a timeout.
+             */
+            if (*num_events == 0)
+            {
+                return_code = OS_ERROR_TIMEOUT;
+            }
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_EventSetWait */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetGetIdByName
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetGetIdByName(osal_id_t *set_id, const char *set_name)
+{
+    int32 return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(set_id);
+    OS_CHECK_POINTER(set_name);
+
+    return_code = OS_ObjectIdFindByName(LOCAL_OBJID_TYPE, set_name, set_id);
+
+    return return_code;
+} /* end OS_EventSetGetIdByName */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_EventSetGetInfo
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_EventSetGetInfo(osal_id_t set_id, OS_eventset_prop_t *set_prop)
+{
+    OS_common_record_t *           record;
+    OS_eventset_internal_record_t *eventset;
+    OS_object_token_t              token;
+    int32                          return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(set_prop);
+
+    memset(set_prop, 0, sizeof(OS_eventset_prop_t));
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, set_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        record   = OS_OBJECT_TABLE_GET(OS_global_eventset_table, token);
+        eventset = OS_OBJECT_TABLE_GET(OS_eventset_table, token);
+
+        strncpy(set_prop->name, record->name_entry, sizeof(set_prop->name) - 1);
+        set_prop->creator     = record->creator;
+        set_prop->num_members = eventset->num_members;
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_EventSetGetInfo */
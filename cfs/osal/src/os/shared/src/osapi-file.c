@@ -67,12 +67,11 @@ enum
 OS_stream_internal_record_t OS_stream_table[OS_MAX_NUM_OPEN_FILES];
 
 /*
- * OS_cp copyblock size - in theory could be adjusted
- * to match page size for performance so providing a unique
- * define here.  Given a requirement/request could be transitioned
- * to a configuration parameter
+ * OS_cp chunk size - the maximum amount passed to each
+ * OS_CopyFileData() call.  The data does not pass through
+ * a local buffer so this does not consume stack space.
  */
-#define OS_CP_BLOCK_SIZE 512
+#define OS_CP_CHUNK_SIZE (1024 * 1024)
 
 /*----------------------------------------------------------------
  *
@@ -266,6 +265,40 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
     return OS_TimedWrite(filedes, buffer, nbytes, OS_PEND);
 } /* end OS_write */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_CopyFileData
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_CopyFileData(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+{
+    OS_object_token_t src_token;
+    OS_object_token_t dest_token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_SIZE(nbytes);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, src_fd, &src_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, dest_fd, &dest_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_GenericCopy_Impl(&src_token, &dest_token, nbytes);
+
+            OS_ObjectIdRelease(&dest_token);
+        }
+
+        OS_ObjectIdRelease(&src_token);
+    }
+
+    return return_code;
+} /* end OS_CopyFileData */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_chmod
@@ -423,12 +456,9 @@ int32 OS_rename(const char *old, const char *new)
 int32 OS_cp(const char *src, const char *dest)
 {
     int32     return_code;
-    int32     rd_size;
-    int32     wr_size;
-    int32     wr_total;
+    int32     cp_size;
     osal_id_t file1;
     osal_id_t file2;
-    uint8     copyblock[OS_CP_BLOCK_SIZE];
 
     /* Check Parameters */
     OS_CHECK_POINTER(src);
@@ -444,27 +474,16 @@ int32 OS_cp(const char *src, const char *dest)
 
     while (return_code == OS_SUCCESS)
     {
-        rd_size = OS_read(file1, copyblock, sizeof(copyblock));
-        if (rd_size < 0)
+        cp_size = OS_CopyFileData(file1, file2, OS_CP_CHUNK_SIZE);
+        if (cp_size < 0)
         {
-            return_code = rd_size;
+            return_code = cp_size;
             break;
         }
-        if (rd_size == 0)
+        if (cp_size == 0)
         {
             break;
         }
-        wr_total = 0;
-        while (wr_total < rd_size)
-        {
-            wr_size = OS_write(file2, &copyblock[wr_total], rd_size - wr_total);
-            if (wr_size < 0)
-            {
-                return_code = wr_size;
-                break;
-            }
-            wr_total += wr_size;
-        }
     }
 
     if (OS_ObjectIdDefined(file1))
@@ -77,7 +77,8 @@ typedef enum
     OS_MODULE_BASE       = OS_TIMECB_BASE + OS_MAX_TIMERS,
     OS_FILESYS_BASE      = OS_MODULE_BASE + OS_MAX_MODULES,
     OS_CONSOLE_BASE      = OS_FILESYS_BASE + OS_MAX_FILE_SYSTEMS,
-    OS_MAX_TOTAL_RECORDS = OS_CONSOLE_BASE + OS_MAX_CONSOLES
+    OS_EVENTSET_BASE     = OS_CONSOLE_BASE + OS_MAX_CONSOLES,
+    OS_MAX_TOTAL_RECORDS = OS_EVENTSET_BASE + OS_MAX_EVENTSETS
 } OS_ObjectIndex_t;
 
 /*
@@ -125,6 +126,7 @@ OS_common_record_t *const OS_global_timecb_table    = &OS_common_table[OS_TIMECB
 OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE_BASE];
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
+OS_common_record_t *const OS_global_eventset_table  = &OS_common_table[OS_EVENTSET_BASE];
 
 /*
  *********************************************************************************
@@ -182,6 +184,8 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_FILE_SYSTEMS;
         case OS_OBJECT_TYPE_OS_CONSOLE:
             return OS_MAX_CONSOLES;
+        case OS_OBJECT_TYPE_OS_EVENTSET:
+            return OS_MAX_EVENTSETS;
         default:
             return 0;
     }
@@ -222,6 +226,8 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_FILESYS_BASE;
         case OS_OBJECT_TYPE_OS_CONSOLE:
             return OS_CONSOLE_BASE;
+        case OS_OBJECT_TYPE_OS_EVENTSET:
+            return OS_EVENTSET_BASE;
         default:
             return 0;
     }
@@ -201,6 +201,7 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
         task->priority               = priority;
         task->entry_function_pointer = function_pointer;
         task->stack_pointer          = stack_pointer;
+        task->cpu_mask               = OS_TASK_CPU_AFFINITY_GET(flags);
 
         /* Now call the OS-specific implementation.  This reads info from the task table. */
         return_code = OS_TaskCreate_Impl(&token, flags);
@@ -329,6 +330,38 @@ int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority)
     return return_code;
 } /* end OS_TaskSetPriority */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+{
+    int32                      return_code;
+    OS_object_token_t          token;
+    OS_task_internal_record_t *task;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, task_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        task = OS_OBJECT_TABLE_GET(OS_task_table, token);
+
+        return_code = OS_TaskSetAffinity_Impl(&token, cpu_mask);
+
+        if (return_code == OS_SUCCESS)
+        {
+            task->cpu_mask = cpu_mask;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_TaskSetAffinity */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskGetId
@@ -396,12 +429,19 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
 
     memset(task_prop, 0, sizeof(OS_task_prop_t));
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, task_id, &token);
+    /*
+     * A reference is held rather than the table lock, so the OS-specific
+     * query (which may involve file I/O) does not stall other task operations.
+     * The common fields are still copied under lock.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, task_id, &token);
     if (return_code == OS_SUCCESS)
     {
         record = OS_OBJECT_TABLE_GET(OS_global_task_table, token);
         task   = OS_OBJECT_TABLE_GET(OS_task_table, token);
 
+        OS_Lock_Global(&token);
+
         if (record->name_entry != NULL)
         {
             strncpy(task_prop->name, record->name_entry, sizeof(task_prop->name) - 1);
@@ -410,6 +450,10 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
         task_prop->creator    = record->creator;
         task_prop->stack_size = task->stack_size;
         task_prop->priority   = task->priority;
+        task_prop->cpu_mask   = task->cpu_mask;
+        task_prop->last_cpu   = OS_TASK_CPU_UNKNOWN;
+
+        OS_Unlock_Global(&token);
 
         return_code = OS_TaskGetInfo_Impl(&token, task_prop);
 
@@ -59,6 +59,7 @@ VX_MUTEX_SEMAPHORE(OS_timecb_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_module_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_filesys_table_mut_mem);
 VX_MUTEX_SEMAPHORE(OS_console_table_mut_mem);
+VX_MUTEX_SEMAPHORE(OS_eventset_table_mut_mem);
 
 static OS_impl_objtype_lock_t OS_task_table_lock      = {.mem = OS_task_table_mut_mem};
 static OS_impl_objtype_lock_t OS_queue_table_lock     = {.mem = OS_queue_table_mut_mem};
@@ -72,6 +73,7 @@ static OS_impl_objtype_lock_t OS_timecb_table_lock    = {.mem = OS_timecb_table_
 static OS_impl_objtype_lock_t OS_module_table_lock    = {.mem = OS_module_table_mut_mem};
 static OS_impl_objtype_lock_t OS_filesys_table_lock   = {.mem = OS_filesys_table_mut_mem};
 static OS_impl_objtype_lock_t OS_console_table_lock   = {.mem = OS_console_table_mut_mem};
+static OS_impl_objtype_lock_t OS_eventset_table_lock  = {.mem = OS_eventset_table_mut_mem};
 
 OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] = {
     [OS_OBJECT_TYPE_UNDEFINED]   = NULL,
@@ -86,7 +88,8 @@ OS_impl_objtype_lock_t *const OS_impl_objtype_lock_table[OS_OBJECT_TYPE_USER] =
     [OS_OBJECT_TYPE_OS_TIMECB]   = &OS_timecb_table_lock,
     [OS_OBJECT_TYPE_OS_MODULE]   = &OS_module_table_lock,
     [OS_OBJECT_TYPE_OS_FILESYS]  = &OS_filesys_table_lock,
-    [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_table_lock};
+    [OS_OBJECT_TYPE_OS_CONSOLE]  = &OS_console_table_lock,
+    [OS_OBJECT_TYPE_OS_EVENTSET] = &OS_eventset_table_lock};
 
 /*----------------------------------------------------------------
  *
@@ -0,0 +1,263 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: eventset-test.c
+ *
+ * Purpose: This file contains functional tests for "osapi-eventset"
+ * A datagram socket is bound on the loopback address and added to an event set,
+ * which is then waited on before and after another socket sends to it.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#define EVENTSET_TEST_PORT 9996
+
+osal_id_t     set_id;
+osal_id_t     rx_socket_id;
+osal_id_t     tx_socket_id;
+osal_id_t     queue_id;
+OS_SockAddr_t rx_addr;
+bool          networkImplemented = true;
+
+/* *************************************** MAIN ************************************** */
+
+void Setup_EventSet(void)
+{
+    int32 actual;
+
+    actual = OS_EventSetCreate(&set_id, "EventSet", 0);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetCreate() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_SocketOpen(&rx_socket_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (actual == OS_ERR_NOT_IMPLEMENTED)
+    {
+        networkImplemented = false;
+        return;
+    }
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketOpen() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_SocketOpen(&tx_socket_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketOpen() (%ld) == OS_SUCCESS", (long)actual);
+
+    OS_SocketAddrInit(&rx_addr, OS_SocketDomain_INET);
+    OS_SocketAddrSetPort(&rx_addr, EVENTSET_TEST_PORT);
+    OS_SocketAddrFromString(&rx_addr, "127.0.0.1");
+
+    actual = OS_SocketBind(rx_socket_id, &rx_addr);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketBind() (%ld) == OS_SUCCESS", (long)actual);
+}
+
+void Teardown_EventSet(void)
+{
+    int32 actual;
+
+    actual = OS_EventSetDelete(set_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetDelete() (%ld) == OS_SUCCESS", (long)actual);
+
+    if (networkImplemented)
+    {
+        OS_close(rx_socket_id);
+        OS_close(tx_socket_id);
+    }
+}
+
+void TestEventSetSocket(void)
+{
+    OS_eventset_event_t events[2];
+    OS_eventset_prop_t  prop;
+    osal_id_t           id;
+    uint32              num_events;
+    char                buffer[8];
+    int32               actual;
+
+    /* an empty set cannot be waited on */
+    actual = OS_EventSetWait(set_id, events, 2, &num_events, 0);
+    UtAssert_True(actual == OS_ERR_INCORRECT_OBJ_STATE, "OS_EventSetWait() (%ld) == OS_ERR_INCORRECT_OBJ_STATE",
+                  (long)actual);
+
+    actual = OS_EventSetGetIdByName(&id, "EventSet");
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetGetIdByName() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(OS_ObjectIdEqual(id, set_id), "OS_EventSetGetIdByName() found the set");
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    actual = OS_EventSetAdd(set_id, rx_socket_id, OS_STREAM_STATE_READABLE);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetAdd() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_EventSetAdd(set_id, rx_socket_id, OS_STREAM_STATE_READABLE);
+    UtAssert_True(actual == OS_ERR_NAME_TAKEN, "OS_EventSetAdd() (%ld) == OS_ERR_NAME_TAKEN", (long)actual);
+
+    actual = OS_EventSetGetInfo(set_id, &prop);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetGetInfo() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(prop.num_members == 1, "prop.num_members (%lu) == 1", (unsigned long)prop.num_members);
+
+    /* nothing has been sent yet */
+    actual = OS_EventSetWait(set_id, events, 2, &num_events, 10);
+    UtAssert_True(actual == OS_ERROR_TIMEOUT, "OS_EventSetWait() (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+
+    actual = OS_SocketSendTo(tx_socket_id, "test", 4, &rx_addr);
+    UtAssert_True(actual == 4, "OS_SocketSendTo() (%ld) == 4", (long)actual);
+
+    actual = OS_EventSetWait(set_id, events, 2, &num_events, 1000);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetWait() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(num_events == 1, "num_events (%lu) == 1", (unsigned long)num_events);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, rx_socket_id), "event is for the receiving socket");
+    UtAssert_True(events[0].events == OS_STREAM_STATE_READABLE, "events (0x%x) == OS_STREAM_STATE_READABLE",
+                  (unsigned int)events[0].events);
+
+    /* once the data is read, the socket is not ready again */
+    actual = OS_SocketRecvFrom(rx_socket_id, buffer, sizeof(buffer), NULL, OS_CHECK);
+    UtAssert_True(actual == 4, "OS_SocketRecvFrom() (%ld) == 4", (long)actual);
+
+    actual = OS_EventSetWait(set_id, events, 2, &num_events, 0);
+    UtAssert_True(actual == OS_ERROR_TIMEOUT, "OS_EventSetWait() (%ld) == OS_ERROR_TIMEOUT", (long)actual);
+
+    actual = OS_EventSetRemove(set_id, rx_socket_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetRemove() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_EventSetRemove(set_id, rx_socket_id);
+    UtAssert_True(actual == OS_ERR_NAME_NOT_FOUND, "OS_EventSetRemove() (%ld) == OS_ERR_NAME_NOT_FOUND",
+                  (long)actual);
+}
+
+void TestEventSetStaleMember(void)
+{
+    OS_eventset_event_t events[2];
+    OS_SockAddr_t       addr;
+    osal_id_t           closed_id;
+    osal_id_t           new_id;
+    uint32              num_events;
+    int32               actual;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    /*
+     * A member closed without being removed is still listed in the set.
+     * The descriptor it used is typically reused straight away by the next
+     * socket, so removing the stale member must not disturb the new one.
+     */
+    actual = OS_SocketOpen(&closed_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketOpen() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_EventSetAdd(set_id, closed_id, OS_STREAM_STATE_READABLE);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetAdd() (%ld) == OS_SUCCESS", (long)actual);
+
+    OS_close(closed_id);
+
+    actual = OS_SocketOpen(&new_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketOpen() (%ld) == OS_SUCCESS", (long)actual);
+
+    OS_SocketAddrInit(&addr, OS_SocketDomain_INET);
+    OS_SocketAddrSetPort(&addr, EVENTSET_TEST_PORT + 1);
+    OS_SocketAddrFromString(&addr, "127.0.0.1");
+
+    actual = OS_SocketBind(new_id, &addr);
+    UtAssert_True(actual == OS_SUCCESS, "OS_SocketBind() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_EventSetAdd(set_id, new_id, OS_STREAM_STATE_READABLE);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetAdd() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_EventSetRemove(set_id, closed_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetRemove() (%ld) == OS_SUCCESS", (long)actual);
+
+    actual = OS_SocketSendTo(tx_socket_id, "test", 4, &addr);
+    UtAssert_True(actual == 4, "OS_SocketSendTo() (%ld) == 4", (long)actual);
+
+    actual = OS_EventSetWait(set_id, events, 2, &num_events, 1000);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetWait() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(num_events == 1, "num_events (%lu) == 1", (unsigned long)num_events);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, new_id), "event is for the new socket");
+
+    actual = OS_EventSetRemove(set_id, new_id);
+    UtAssert_True(actual == OS_SUCCESS, "OS_EventSetRemove() (%ld) == OS_SUCCESS", (long)actual);
+
+    OS_close(new_id);
+}
+
+void TestEventSetQueue(void)
+{
+    OS_eventset_event_t events[2];
+    uint32              num_events;
+    uint32              data = 1;
+    int32               actual;
+
+    actual = OS_QueueCreate(&queue_id, "EventSetQueue", 4, sizeof(data), 0);
+    UtAssert_True(actual == OS_SUCCESS, "OS_QueueCreate() (%ld) == OS_SUCCESS", (long)actual);
+
+    /* queues can only be members where the implementation supports it */
+    actual = OS_EventSetAdd(set_id, queue_id, OS_STREAM_STATE_READABLE);
+    if (actual == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssert_NA("Queues cannot be event set members on this platform");
+    }
+    else
+    {
+        UtAssert_True(actual == OS_SUCCESS, "OS_EventSetAdd() (%ld) == OS_SUCCESS", (long)actual);
+
+        actual = OS_QueuePut(queue_id, &data, sizeof(data), 0);
+        UtAssert_True(actual == OS_SUCCESS, "OS_QueuePut() (%ld) == OS_SUCCESS", (long)actual);
+
+        actual = OS_EventSetWait(set_id, events, 2, &num_events, 1000);
+        UtAssert_True(actual == OS_SUCCESS, "OS_EventSetWait() (%ld) == OS_SUCCESS", (long)actual);
+        UtAssert_True(num_events == 1, "num_events (%lu) == 1", (unsigned long)num_events);
+        UtAssert_True(OS_ObjectIdEqual(events[0].objid, queue_id), "event is for the queue");
+
+        actual = OS_EventSetRemove(set_id, queue_id);
+        UtAssert_True(actual == OS_SUCCESS, "OS_EventSetRemove() (%ld) == OS_SUCCESS", (long)actual);
+    }
+
+    OS_QueueDelete(queue_id);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+
+    UtTest_Add(TestEventSetSocket, Setup_EventSet, Teardown_EventSet, "TestEventSetSocket");
+    UtTest_Add(TestEventSetStaleMember, Setup_EventSet, Teardown_EventSet, "TestEventSetStaleMember");
+    UtTest_Add(TestEventSetQueue, Setup_EventSet, Teardown_EventSet, "TestEventSetQueue");
+}
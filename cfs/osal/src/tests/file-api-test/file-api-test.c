@@ -38,6 +38,7 @@ void TestReadWriteLseek(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
+void TestCopy(void);
 void TestStat(void);
 void TestOpenFileAPI(void);
 void TestUnmountRemount(void);
@@ -87,6 +88,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenFileAPI, NULL, NULL, "TestOpenFileAPI");
     UtTest_Add(TestUnmountRemount, NULL, NULL, "TestUnmountRemount");
     UtTest_Add(TestRename, NULL, NULL, "TestRename");
+    UtTest_Add(TestCopy, NULL, NULL, "TestCopy");
 }
 
 void TestMkfsMount(void)
@@ -844,6 +846,91 @@ void TestRename(void)
     UtAssert_True(status == OS_SUCCESS, "status after rmdir 1 = %d", (int)status);
 }
 
+/*---------------------------------------------------------------------------------------
+ *  Name TestCopy()
+---------------------------------------------------------------------------------------*/
+void TestCopy(void)
+{
+    int32     status;
+    char      filename1[OS_MAX_PATH_LEN];
+    char      filename2[OS_MAX_PATH_LEN];
+    char      buffer1[10000];
+    char      buffer2[sizeof(buffer1)];
+    osal_id_t fd1;
+    osal_id_t fd2;
+    size_t    i;
+
+    strcpy(filename1, "/drive1/CopySrc");
+    strcpy(filename2, "/drive1/CopyDst");
+
+    /* Larger than the block copy buffer so the copy takes more than one block */
+    for (i = 0; i < sizeof(buffer1); ++i)
+    {
+        buffer1[i] = 'A' + (i % 26);
+    }
+
+    status = OS_OpenCreate(&fd1, filename1, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status >= OS_SUCCESS, "status after creat 1 = %d", (int)status);
+    status = OS_write(fd1, buffer1, sizeof(buffer1));
+    UtAssert_True(status == sizeof(buffer1), "status after write 1 = %d", (int)status);
+    status = OS_close(fd1);
+    UtAssert_True(status == OS_SUCCESS, "status after close 1 = %d", (int)status);
+
+    /* Copy the whole file and read it back */
+    status = OS_cp(filename1, filename2);
+    UtAssert_True(status == OS_SUCCESS, "status after cp = %d", (int)status);
+
+    memset(buffer2, 0, sizeof(buffer2));
+    status = OS_OpenCreate(&fd2, filename2, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    UtAssert_True(status >= OS_SUCCESS, "status after open 2 = %d", (int)status);
+    status = OS_read(fd2, buffer2, sizeof(buffer2));
+    UtAssert_True(status == sizeof(buffer2), "status after read 2 = %d", (int)status);
+    UtAssert_True(memcmp(buffer1, buffer2, sizeof(buffer1)) == 0, "Copied and original data are equal");
+    status = OS_close(fd2);
+    UtAssert_True(status == OS_SUCCESS, "status after close 2 = %d", (int)status);
+
+    /* Copy part of the file from the current source position */
+    status = OS_OpenCreate(&fd1, filename1, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    UtAssert_True(status >= OS_SUCCESS, "status after open 1 = %d", (int)status);
+    status = OS_OpenCreate(&fd2, filename2, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    UtAssert_True(status >= OS_SUCCESS, "status after creat 2 = %d", (int)status);
+
+    status = OS_lseek(fd1, 26, OS_SEEK_SET);
+    UtAssert_True(status == 26, "status after lseek 1 = %d", (int)status);
+    status = OS_CopyFileData(fd1, fd2, 100);
+    UtAssert_True(status == 100, "status after copy = %d", (int)status);
+    status = OS_lseek(fd1, 0, OS_SEEK_CUR);
+    UtAssert_True(status == 126, "source position after copy = %d", (int)status);
+
+    memset(buffer2, 0, sizeof(buffer2));
+    status = OS_lseek(fd2, 0, OS_SEEK_SET);
+    UtAssert_True(status == 0, "status after lseek 2 = %d", (int)status);
+    status = OS_read(fd2, buffer2, sizeof(buffer2));
+    UtAssert_True(status == 100, "status after read 2 = %d", (int)status);
+    UtAssert_True(memcmp(buffer1, buffer2, 100) == 0, "Copied and original data are equal");
+
+    status = OS_lseek(fd1, 0, OS_SEEK_END);
+    UtAssert_True(status == sizeof(buffer1), "status after lseek 1 = %d", (int)status);
+    status = OS_CopyFileData(fd1, fd2, 100);
+    UtAssert_True(status == 0, "status after copy at end of file = %d", (int)status);
+
+    status = OS_CopyFileData(fd1, fd2, 0);
+    UtAssert_True(status == OS_ERR_INVALID_SIZE, "status after copy of zero bytes = %d", (int)status);
+
+    status = OS_close(fd1);
+    UtAssert_True(status == OS_SUCCESS, "status after close 1 = %d", (int)status);
+    status = OS_close(fd2);
+    UtAssert_True(status == OS_SUCCESS, "status after close 2 = %d", (int)status);
+
+    status = OS_CopyFileData(fd1, fd2, 100);
+    UtAssert_True(status == OS_ERR_INVALID_ID, "status after copy with closed file = %d", (int)status);
+
+    status = OS_remove(filename1);
+    UtAssert_True(status == OS_SUCCESS, "status after remove 1 = %d", (int)status);
+    status = OS_remove(filename2);
+    UtAssert_True(status == OS_SUCCESS, "status after remove 2 = %d", (int)status);
+}
+
 /*---------------------------------------------------------------------------------------
  *  Name TestStat()
 ---------------------------------------------------------------------------------------*/
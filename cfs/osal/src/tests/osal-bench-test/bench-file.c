@@ -0,0 +1,139 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-file.c
+ *
+ * Purpose: Benchmarks of OSAL file read and write throughput
+ *
+ * A fixed amount of data is written to a file and then read back,
+ * once for each block size, to show the per-call overhead against
+ * the size of each transfer.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_FILE_PATH       OSAL_BENCH_VIRT_DIR "/osal-bench.dat"
+#define BENCH_FILE_MAX_BLOCK  65536
+#define BENCH_FILE_TOTAL_SIZE (1024 * 1024)
+
+static const uint32 BENCH_FILE_BLOCK_SIZES[] = {512, 4096, BENCH_FILE_MAX_BLOCK};
+
+static uint8 bench_file_buffer[BENCH_FILE_MAX_BLOCK];
+
+/*
+ * Write or read the whole file in blocks of the given size,
+ * returns the number of blocks transferred.
+ */
+static uint32 Bench_FileTransfer(uint32 block_size, uint32 blocks, bool is_write)
+{
+    osal_id_t fd;
+    uint32    i;
+    int32     status;
+
+    if (is_write)
+    {
+        status = OS_OpenCreate(&fd, BENCH_FILE_PATH, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    }
+    else
+    {
+        status = OS_OpenCreate(&fd, BENCH_FILE_PATH, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    }
+    UtAssert_True(status == OS_SUCCESS, "OS_OpenCreate(%s) (%ld) == OS_SUCCESS", BENCH_FILE_PATH, (long)status);
+    if (status != OS_SUCCESS)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < blocks; ++i)
+    {
+        if (is_write)
+        {
+            status = OS_write(fd, bench_file_buffer, block_size);
+        }
+        else
+        {
+            status = OS_read(fd, bench_file_buffer, block_size);
+        }
+        if (status != (int32)block_size)
+        {
+            break;
+        }
+    }
+
+    OS_close(fd);
+
+    return i;
+}
+
+void OSAL_Bench_File(void)
+{
+    char      params[32];
+    OS_time_t start;
+    int64     elapsed_ns;
+    uint32    block_size;
+    uint32    blocks;
+    uint32    done;
+    uint32    j;
+
+    memset(bench_file_buffer, 0x5A, sizeof(bench_file_buffer));
+
+    for (j = 0; j < sizeof(BENCH_FILE_BLOCK_SIZES) / sizeof(BENCH_FILE_BLOCK_SIZES[0]); ++j)
+    {
+        block_size = BENCH_FILE_BLOCK_SIZES[j];
+        blocks     = BENCH_FILE_TOTAL_SIZE / block_size;
+        snprintf(params, sizeof(params), "\"block_size\":%lu", (unsigned long)block_size);
+
+        start      = OSAL_Bench_Now();
+        done       = Bench_FileTransfer(block_size, blocks, true);
+        elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+        UtAssert_True(done == blocks, "file.write {%s} completed %lu of %lu", params, (unsigned long)done,
+                      (unsigned long)blocks);
+        if (done != blocks)
+        {
+            break;
+        }
+        OSAL_Bench_Record("file.write", params, blocks, elapsed_ns, (uint64)blocks * block_size);
+
+        start      = OSAL_Bench_Now();
+        done       = Bench_FileTransfer(block_size, blocks, false);
+        elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+        UtAssert_True(done == blocks, "file.read {%s} completed %lu of %lu", params, (unsigned long)done,
+                      (unsigned long)blocks);
+        if (done != blocks)
+        {
+            break;
+        }
+        OSAL_Bench_Record("file.read", params, blocks, elapsed_ns, (uint64)blocks * block_size);
+    }
+
+    OS_remove(BENCH_FILE_PATH);
+}
@@ -0,0 +1,151 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-idmap.c
+ *
+ * Purpose: Benchmarks of OSAL object ID lookups
+ *
+ * Nearly every OSAL call converts an ID to a table entry, so the cost
+ * of these lookups is part of everything else measured in this suite.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_IDMAP_NUM_OBJECTS 8
+
+void OSAL_Bench_Idmap(void)
+{
+    char                name[OS_MAX_API_NAME];
+    char                params[32];
+    osal_id_t           sem_ids[BENCH_IDMAP_NUM_OBJECTS];
+    osal_id_t           found_id;
+    osal_index_t        index;
+    OS_count_sem_prop_t prop;
+    OS_time_t           start;
+    int64               elapsed_ns;
+    uint32              iterations;
+    uint32              created;
+    uint32              i;
+    int32               status;
+
+    /* look up the last object created, so a search by name walks the table */
+    status = OS_SUCCESS;
+    for (created = 0; created < BENCH_IDMAP_NUM_OBJECTS; ++created)
+    {
+        snprintf(name, sizeof(name), "BenchId%lu", (unsigned long)created);
+        status = OS_CountSemCreate(&sem_ids[created], name, 0, 0);
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    UtAssert_True(status == OS_SUCCESS, "OS_CountSemCreate(%s) (%ld) == OS_SUCCESS", name, (long)status);
+    if (created == 0)
+    {
+        return;
+    }
+
+    snprintf(name, sizeof(name), "BenchId%lu", (unsigned long)(created - 1));
+    snprintf(params, sizeof(params), "\"objects\":%lu", (unsigned long)created);
+    iterations = OSAL_BENCH_ITERATIONS(10000);
+
+    start = OSAL_Bench_Now();
+    for (i = 0; i < iterations; ++i)
+    {
+        status = OS_CountSemGetIdByName(&found_id, name);
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+    UtAssert_True(i == iterations, "idmap.get_id_by_name completed %lu of %lu (status %ld)", (unsigned long)i,
+                  (unsigned long)iterations, (long)status);
+    if (i == iterations)
+    {
+        OSAL_Bench_Record("idmap.get_id_by_name", params, iterations, elapsed_ns, 0);
+    }
+
+    start = OSAL_Bench_Now();
+    for (i = 0; i < iterations; ++i)
+    {
+        status = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_COUNTSEM, sem_ids[created - 1], &index);
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+    UtAssert_True(i == iterations, "idmap.to_array_index completed %lu of %lu (status %ld)", (unsigned long)i,
+                  (unsigned long)iterations, (long)status);
+    if (i == iterations)
+    {
+        OSAL_Bench_Record("idmap.to_array_index", params, iterations, elapsed_ns, 0);
+    }
+
+    start = OSAL_Bench_Now();
+    for (i = 0; i < iterations; ++i)
+    {
+        status = OS_GetResourceName(sem_ids[created - 1], name, sizeof(name));
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+    UtAssert_True(i == iterations, "idmap.get_resource_name completed %lu of %lu (status %ld)", (unsigned long)i,
+                  (unsigned long)iterations, (long)status);
+    if (i == iterations)
+    {
+        OSAL_Bench_Record("idmap.get_resource_name", params, iterations, elapsed_ns, 0);
+    }
+
+    start = OSAL_Bench_Now();
+    for (i = 0; i < iterations; ++i)
+    {
+        status = OS_CountSemGetInfo(sem_ids[created - 1], &prop);
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+    UtAssert_True(i == iterations, "idmap.get_info completed %lu of %lu (status %ld)", (unsigned long)i,
+                  (unsigned long)iterations, (long)status);
+    if (i == iterations)
+    {
+        OSAL_Bench_Record("idmap.get_info", params, iterations, elapsed_ns, 0);
+    }
+
+    for (i = 0; i < created; ++i)
+    {
+        OS_CountSemDelete(sem_ids[i]);
+    }
+}
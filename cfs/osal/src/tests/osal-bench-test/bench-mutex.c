@@ -0,0 +1,155 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-mutex.c
+ *
+ * Purpose: Benchmarks of OSAL mutex contention
+ *
+ * A number of worker tasks each take and give the same mutex a fixed
+ * number of times, updating a shared counter while holding it.  With one
+ * task this is the uncontended cost, with more tasks it includes waiting.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_MUTEX_MAX_TASKS 4
+
+#if BENCH_MUTEX_MAX_TASKS > 99
+#error "BENCH_MUTEX_MAX_TASKS must fit in the two digits allowed in the worker task names"
+#endif
+
+static const uint32 BENCH_MUTEX_TASKS[] = {1, 2, BENCH_MUTEX_MAX_TASKS};
+
+static osal_id_t bench_mutex_id;
+static osal_id_t bench_mutex_start_sem;
+static osal_id_t bench_mutex_done_sem;
+static uint32    bench_mutex_loops;
+static uint32    bench_mutex_counter;
+
+static void Bench_MutexTask(void)
+{
+    uint32 i;
+
+    /* All workers are released together */
+    if (OS_CountSemTake(bench_mutex_start_sem) == OS_SUCCESS)
+    {
+        for (i = 0; i < bench_mutex_loops; ++i)
+        {
+            if (OS_MutSemTake(bench_mutex_id) != OS_SUCCESS)
+            {
+                break;
+            }
+            ++bench_mutex_counter;
+            OS_MutSemGive(bench_mutex_id);
+        }
+    }
+
+    OS_CountSemGive(bench_mutex_done_sem);
+}
+
+static void Bench_MutexContention(uint32 num_tasks)
+{
+    char      params[32];
+    char      task_name[OS_MAX_API_NAME];
+    osal_id_t task_id;
+    OS_time_t start;
+    int64     elapsed_ns;
+    uint32    i;
+    int32     status;
+
+    snprintf(params, sizeof(params), "\"tasks\":%lu", (unsigned long)num_tasks);
+
+    bench_mutex_loops   = OSAL_BENCH_ITERATIONS(20000) / num_tasks;
+    bench_mutex_counter = 0;
+
+    status = OS_MutSemCreate(&bench_mutex_id, "BenchMut", 0);
+    UtAssert_True(status == OS_SUCCESS, "OS_MutSemCreate() (%ld) == OS_SUCCESS", (long)status);
+    status = OS_CountSemCreate(&bench_mutex_start_sem, "BenchMutStart", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "OS_CountSemCreate() (%ld) == OS_SUCCESS", (long)status);
+    status = OS_CountSemCreate(&bench_mutex_done_sem, "BenchMutDone", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "OS_CountSemCreate() (%ld) == OS_SUCCESS", (long)status);
+
+    for (i = 0; i < num_tasks; ++i)
+    {
+        /*
+         * Unique per run, as the workers of the last run may still be exiting.
+         * Two digits each keeps the name well within OS_MAX_API_NAME.
+         */
+        snprintf(task_name, sizeof(task_name), "BenchMut%02u.%02u", (unsigned int)(num_tasks % 100),
+                 (unsigned int)(i % 100));
+        status = OS_TaskCreate(&task_id, task_name, Bench_MutexTask, OSAL_TASK_STACK_ALLOCATE,
+                               OSAL_SIZE_C(OSAL_BENCH_STACK_SIZE), OSAL_PRIORITY_C(OSAL_BENCH_TASK_PRIORITY), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS_TaskCreate(%s) (%ld) == OS_SUCCESS", task_name, (long)status);
+    }
+
+    /* Allow the workers to start and pend on the start semaphore */
+    OS_TaskDelay(10);
+
+    start = OSAL_Bench_Now();
+    for (i = 0; i < num_tasks; ++i)
+    {
+        OS_CountSemGive(bench_mutex_start_sem);
+    }
+    for (i = 0; i < num_tasks; ++i)
+    {
+        status = OS_CountSemTimedWait(bench_mutex_done_sem, 10000);
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+    UtAssert_True(status == OS_SUCCESS, "mutex.contention {%s} all workers done (%ld)", params, (long)status);
+    UtAssert_True(bench_mutex_counter == bench_mutex_loops * num_tasks, "mutex.contention {%s} counter %lu == %lu",
+                  params, (unsigned long)bench_mutex_counter, (unsigned long)(bench_mutex_loops * num_tasks));
+
+    if (status == OS_SUCCESS)
+    {
+        OSAL_Bench_Record("mutex.contention", params, bench_mutex_loops * num_tasks, elapsed_ns, 0);
+    }
+
+    /* Allow the workers to exit before their resources are deleted */
+    OS_TaskDelay(10);
+
+    OS_MutSemDelete(bench_mutex_id);
+    OS_CountSemDelete(bench_mutex_start_sem);
+    OS_CountSemDelete(bench_mutex_done_sem);
+}
+
+void OSAL_Bench_Mutex(void)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(BENCH_MUTEX_TASKS) / sizeof(BENCH_MUTEX_TASKS[0]); ++i)
+    {
+        Bench_MutexContention(BENCH_MUTEX_TASKS[i]);
+    }
+}
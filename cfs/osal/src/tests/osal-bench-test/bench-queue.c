@@ -0,0 +1,223 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-queue.c
+ *
+ * Purpose: Benchmarks of the OSAL message queue calls
+ *
+ * - put_get: a single task puts then gets one message, which times the
+ *   calls themselves without any task switching.
+ * - burst: a single task fills the queue to its depth and then drains it.
+ * - roundtrip: a message is sent to an echo task and back, which
+ *   includes waking the other task each way.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_QUEUE_MAX_SIZE 1024
+
+static const uint32 BENCH_QUEUE_DEPTHS[] = {1, 8, 32};
+static const uint32 BENCH_QUEUE_SIZES[]  = {4, 64, BENCH_QUEUE_MAX_SIZE};
+
+static osal_id_t bench_queue_ping;
+static osal_id_t bench_queue_pong;
+
+/*
+ * Echo task for the round trip benchmark, this
+ * returns each message on the "pong" queue until
+ * a zero-length message is received.
+ */
+static void Bench_QueueEchoTask(void)
+{
+    uint8  buffer[BENCH_QUEUE_MAX_SIZE];
+    size_t size_copied;
+
+    while (OS_QueueGet(bench_queue_ping, buffer, sizeof(buffer), &size_copied, OS_PEND) == OS_SUCCESS)
+    {
+        if (size_copied == 0 || OS_QueuePut(bench_queue_pong, buffer, size_copied, 0) != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+}
+
+static void Bench_QueuePutGet(uint32 depth, uint32 size)
+{
+    uint8     buffer[BENCH_QUEUE_MAX_SIZE];
+    char      params[64];
+    osal_id_t queue_id;
+    size_t    size_copied;
+    OS_time_t start;
+    int64     elapsed_ns;
+    uint32    iterations;
+    uint32    i;
+    uint32    j;
+    int32     status;
+
+    snprintf(params, sizeof(params), "\"depth\":%lu,\"size\":%lu", (unsigned long)depth, (unsigned long)size);
+    memset(buffer, 0xA5, sizeof(buffer));
+
+    status = OS_QueueCreate(&queue_id, "BenchQ", OSAL_BLOCKCOUNT_C(depth), size, 0);
+    if (status != OS_SUCCESS)
+    {
+        /* e.g. the depth is over the limit of the host, see queue-test */
+        UtAssert_NA("OS_QueueCreate(%s) failed (%ld), skipped", params, (long)status);
+        return;
+    }
+
+    iterations = OSAL_BENCH_ITERATIONS(2000);
+    start      = OSAL_Bench_Now();
+    for (i = 0; i < iterations; ++i)
+    {
+        status = OS_QueuePut(queue_id, buffer, size, 0);
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QueueGet(queue_id, buffer, size, &size_copied, OS_CHECK);
+        }
+        if (status != OS_SUCCESS)
+        {
+            break;
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+    UtAssert_True(i == iterations, "queue.put_get {%s} completed %lu of %lu (status %ld)", params, (unsigned long)i,
+                  (unsigned long)iterations, (long)status);
+    if (i == iterations)
+    {
+        OSAL_Bench_Record("queue.put_get", params, iterations, elapsed_ns, (uint64)iterations * size);
+    }
+
+    /* Burst, in units of one full queue */
+    iterations = OSAL_BENCH_ITERATIONS(2000) / depth;
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+    start = OSAL_Bench_Now();
+    for (i = 0; i < iterations && status == OS_SUCCESS; ++i)
+    {
+        for (j = 0; j < depth && status == OS_SUCCESS; ++j)
+        {
+            status = OS_QueuePut(queue_id, buffer, size, 0);
+        }
+        for (j = 0; j < depth && status == OS_SUCCESS; ++j)
+        {
+            status = OS_QueueGet(queue_id, buffer, size, &size_copied, OS_CHECK);
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+    UtAssert_True(status == OS_SUCCESS, "queue.burst {%s} status (%ld) == OS_SUCCESS", params, (long)status);
+    if (status == OS_SUCCESS)
+    {
+        OSAL_Bench_Record("queue.burst", params, iterations * depth, elapsed_ns, (uint64)iterations * depth * size);
+    }
+
+    OS_QueueDelete(queue_id);
+}
+
+static void Bench_QueueRoundTrip(uint32 size)
+{
+    uint8     buffer[BENCH_QUEUE_MAX_SIZE];
+    char      params[64];
+    osal_id_t task_id;
+    size_t    size_copied;
+    OS_time_t start;
+    int64     elapsed_ns;
+    uint32    iterations;
+    uint32    i;
+    int32     status;
+
+    snprintf(params, sizeof(params), "\"size\":%lu", (unsigned long)size);
+    memset(buffer, 0x5A, sizeof(buffer));
+
+    status = OS_QueueCreate(&bench_queue_ping, "BenchPing", OSAL_BLOCKCOUNT_C(1), BENCH_QUEUE_MAX_SIZE, 0);
+    if (status != OS_SUCCESS)
+    {
+        UtAssert_NA("OS_QueueCreate(BenchPing) failed (%ld), skipped", (long)status);
+        return;
+    }
+    status = OS_QueueCreate(&bench_queue_pong, "BenchPong", OSAL_BLOCKCOUNT_C(1), BENCH_QUEUE_MAX_SIZE, 0);
+    if (status != OS_SUCCESS)
+    {
+        UtAssert_NA("OS_QueueCreate(BenchPong) failed (%ld), skipped", (long)status);
+        OS_QueueDelete(bench_queue_ping);
+        return;
+    }
+
+    status = OS_TaskCreate(&task_id, "BenchEcho", Bench_QueueEchoTask, OSAL_TASK_STACK_ALLOCATE,
+                           OSAL_SIZE_C(OSAL_BENCH_STACK_SIZE), OSAL_PRIORITY_C(OSAL_BENCH_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "OS_TaskCreate(BenchEcho) (%ld) == OS_SUCCESS", (long)status);
+
+    iterations = OSAL_BENCH_ITERATIONS(1000);
+    start      = OSAL_Bench_Now();
+    for (i = 0; i < iterations && status == OS_SUCCESS; ++i)
+    {
+        status = OS_QueuePut(bench_queue_ping, buffer, size, 0);
+        if (status == OS_SUCCESS)
+        {
+            status = OS_QueueGet(bench_queue_pong, buffer, sizeof(buffer), &size_copied, 1000);
+        }
+    }
+    elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+    UtAssert_True(status == OS_SUCCESS, "queue.roundtrip {%s} status (%ld) == OS_SUCCESS", params, (long)status);
+    if (status == OS_SUCCESS)
+    {
+        OSAL_Bench_Record("queue.roundtrip", params, iterations, elapsed_ns, (uint64)iterations * size * 2);
+    }
+
+    /* A zero-length message stops the echo task */
+    OS_QueuePut(bench_queue_ping, buffer, 0, 0);
+    OS_TaskDelay(10);
+
+    OS_QueueDelete(bench_queue_ping);
+    OS_QueueDelete(bench_queue_pong);
+}
+
+void OSAL_Bench_Queue(void)
+{
+    uint32 d;
+    uint32 s;
+
+    for (d = 0; d < sizeof(BENCH_QUEUE_DEPTHS) / sizeof(BENCH_QUEUE_DEPTHS[0]); ++d)
+    {
+        for (s = 0; s < sizeof(BENCH_QUEUE_SIZES) / sizeof(BENCH_QUEUE_SIZES[0]); ++s)
+        {
+            Bench_QueuePutGet(BENCH_QUEUE_DEPTHS[d], BENCH_QUEUE_SIZES[s]);
+        }
+    }
+
+    for (s = 0; s < sizeof(BENCH_QUEUE_SIZES) / sizeof(BENCH_QUEUE_SIZES[0]); ++s)
+    {
+        Bench_QueueRoundTrip(BENCH_QUEUE_SIZES[s]);
+    }
+}
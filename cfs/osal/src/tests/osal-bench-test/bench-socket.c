@@ -0,0 +1,152 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-socket.c
+ *
+ * Purpose: Benchmarks of OSAL socket throughput over the loopback interface
+ *
+ * A single task sends a datagram from one UDP socket to another and
+ * receives it again, so the result is the cost of one send plus one
+ * receive through the local network stack.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_SOCKET_MAX_SIZE  8192
+#define BENCH_SOCKET_SEND_PORT 9990
+#define BENCH_SOCKET_RECV_PORT 9991
+
+static const uint32 BENCH_SOCKET_SIZES[] = {64, 1024, BENCH_SOCKET_MAX_SIZE};
+
+static uint8 bench_socket_buffer[BENCH_SOCKET_MAX_SIZE];
+
+static int32 Bench_SocketOpenBound(osal_id_t *sock_id, OS_SockAddr_t *addr, uint16 port)
+{
+    int32 status;
+
+    status = OS_SocketOpen(sock_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (status == OS_SUCCESS)
+    {
+        status = OS_SocketAddrInit(addr, OS_SocketDomain_INET);
+    }
+    if (status == OS_SUCCESS)
+    {
+        status = OS_SocketAddrFromString(addr, "127.0.0.1");
+    }
+    if (status == OS_SUCCESS)
+    {
+        status = OS_SocketAddrSetPort(addr, port);
+    }
+    if (status == OS_SUCCESS)
+    {
+        status = OS_SocketBind(*sock_id, addr);
+    }
+
+    return status;
+}
+
+void OSAL_Bench_Socket(void)
+{
+    char          params[32];
+    osal_id_t     send_id;
+    osal_id_t     recv_id;
+    OS_SockAddr_t send_addr;
+    OS_SockAddr_t recv_addr;
+    OS_SockAddr_t from_addr;
+    OS_time_t     start;
+    int64         elapsed_ns;
+    uint32        iterations;
+    uint32        size;
+    uint32        j;
+    uint32        i;
+    int32         status;
+
+    memset(bench_socket_buffer, 0xA5, sizeof(bench_socket_buffer));
+
+    send_id = OS_OBJECT_ID_UNDEFINED;
+    recv_id = OS_OBJECT_ID_UNDEFINED;
+
+    status = Bench_SocketOpenBound(&send_id, &send_addr, BENCH_SOCKET_SEND_PORT);
+    if (status == OS_SUCCESS)
+    {
+        status = Bench_SocketOpenBound(&recv_id, &recv_addr, BENCH_SOCKET_RECV_PORT);
+    }
+
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Network API not implemented");
+    }
+    else
+    {
+        UtAssert_True(status == OS_SUCCESS, "UDP loopback socket setup (%ld) == OS_SUCCESS", (long)status);
+    }
+
+    for (j = 0; status == OS_SUCCESS && j < sizeof(BENCH_SOCKET_SIZES) / sizeof(BENCH_SOCKET_SIZES[0]); ++j)
+    {
+        size = BENCH_SOCKET_SIZES[j];
+        snprintf(params, sizeof(params), "\"size\":%lu", (unsigned long)size);
+
+        iterations = OSAL_BENCH_ITERATIONS(2000);
+        start      = OSAL_Bench_Now();
+        for (i = 0; i < iterations; ++i)
+        {
+            status = OS_SocketSendTo(send_id, bench_socket_buffer, size, &recv_addr);
+            if (status == (int32)size)
+            {
+                status = OS_SocketRecvFrom(recv_id, bench_socket_buffer, sizeof(bench_socket_buffer), &from_addr,
+                                           1000);
+            }
+            if (status != (int32)size)
+            {
+                break;
+            }
+        }
+        elapsed_ns = OSAL_Bench_ElapsedNs(start);
+
+        UtAssert_True(i == iterations, "socket.udp_loopback {%s} completed %lu of %lu (status %ld)", params,
+                      (unsigned long)i, (unsigned long)iterations, (long)status);
+        if (i != iterations)
+        {
+            break;
+        }
+
+        OSAL_Bench_Record("socket.udp_loopback", params, iterations, elapsed_ns, (uint64)iterations * size);
+        status = OS_SUCCESS;
+    }
+
+    if (OS_ObjectIdDefined(send_id))
+    {
+        OS_close(send_id);
+    }
+    if (OS_ObjectIdDefined(recv_id))
+    {
+        OS_close(recv_id);
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: bench-timebase.c
+ *
+ * Purpose: Benchmarks of OSAL timebase callback jitter
+ *
+ * A timer callback is attached to a timebase running at a fixed period,
+ * and the time of each callback is recorded.  The spread of the intervals
+ * between callbacks shows how closely the period is kept.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+#define BENCH_TIMEBASE_MAX_SAMPLES 200
+
+typedef struct
+{
+    uint32 period_us;
+    uint32 samples;
+} Bench_TimeBaseConfig_t;
+
+static const Bench_TimeBaseConfig_t BENCH_TIMEBASE_CONFIGS[] = {{1000, BENCH_TIMEBASE_MAX_SAMPLES}, {10000, 50}};
+
+static OS_time_t bench_timebase_stamps[BENCH_TIMEBASE_MAX_SAMPLES + 1];
+static uint32    bench_timebase_count;
+static uint32    bench_timebase_limit;
+static osal_id_t bench_timebase_done_sem;
+
+static void Bench_TimeBaseCallback(osal_id_t timer_id, void *arg)
+{
+    if (bench_timebase_count < bench_timebase_limit)
+    {
+        bench_timebase_stamps[bench_timebase_count] = OSAL_Bench_Now();
+        ++bench_timebase_count;
+        if (bench_timebase_count == bench_timebase_limit)
+        {
+            OS_BinSemGive(bench_timebase_done_sem);
+        }
+    }
+}
+
+static void Bench_TimeBaseJitter(const Bench_TimeBaseConfig_t *config)
+{
+    char      params[32];
+    osal_id_t timebase_id;
+    osal_id_t timer_id;
+    int64     interval_ns;
+    int64     min_ns;
+    int64     max_ns;
+    int64     total_ns;
+    uint32    i;
+    int32     status;
+
+    snprintf(params, sizeof(params), "\"period_us\":%lu", (unsigned long)config->period_us);
+
+    /* one more stamp than intervals */
+    bench_timebase_count = 0;
+    bench_timebase_limit = config->samples + 1;
+
+    status = OS_BinSemCreate(&bench_timebase_done_sem, "BenchTBDone", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "OS_BinSemCreate() (%ld) == OS_SUCCESS", (long)status);
+
+    status = OS_TimeBaseCreate(&timebase_id, "BenchTB", NULL);
+    UtAssert_True(status == OS_SUCCESS, "OS_TimeBaseCreate() (%ld) == OS_SUCCESS", (long)status);
+    if (status != OS_SUCCESS)
+    {
+        OS_BinSemDelete(bench_timebase_done_sem);
+        return;
+    }
+
+    status = OS_TimerAdd(&timer_id, "BenchTimer", timebase_id, Bench_TimeBaseCallback, NULL);
+    UtAssert_True(status == OS_SUCCESS, "OS_TimerAdd() (%ld) == OS_SUCCESS", (long)status);
+
+    /* the timer fires on every tick of the timebase */
+    status = OS_TimerSet(timer_id, config->period_us, config->period_us);
+    UtAssert_True(status == OS_SUCCESS, "OS_TimerSet() (%ld) == OS_SUCCESS", (long)status);
+
+    status = OS_TimeBaseSet(timebase_id, config->period_us, config->period_us);
+    UtAssert_True(status == OS_SUCCESS, "OS_TimeBaseSet() (%ld) == OS_SUCCESS", (long)status);
+
+    status = OS_BinSemTimedWait(bench_timebase_done_sem, (config->period_us * bench_timebase_limit) / 1000 + 5000);
+    UtAssert_True(status == OS_SUCCESS, "timebase.interval {%s} got %lu of %lu callbacks", params,
+                  (unsigned long)bench_timebase_count, (unsigned long)bench_timebase_limit);
+
+    OS_TimerDelete(timer_id);
+    OS_TimeBaseDelete(timebase_id);
+    OS_BinSemDelete(bench_timebase_done_sem);
+
+    if (status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    min_ns   = 0;
+    max_ns   = 0;
+    total_ns = 0;
+    for (i = 1; i < bench_timebase_limit; ++i)
+    {
+        interval_ns =
+            OS_TimeGetTotalNanoseconds(OS_TimeSubtract(bench_timebase_stamps[i], bench_timebase_stamps[i - 1]));
+        if (i == 1 || interval_ns < min_ns)
+        {
+            min_ns = interval_ns;
+        }
+        if (i == 1 || interval_ns > max_ns)
+        {
+            max_ns = interval_ns;
+        }
+        total_ns += interval_ns;
+    }
+
+    OSAL_Bench_RecordLatency("timebase.interval", params, config->samples, min_ns, total_ns / config->samples,
+                             max_ns);
+}
+
+void OSAL_Bench_TimeBase(void)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(BENCH_TIMEBASE_CONFIGS) / sizeof(BENCH_TIMEBASE_CONFIGS[0]); ++i)
+    {
+        Bench_TimeBaseJitter(&BENCH_TIMEBASE_CONFIGS[i]);
+    }
+}
@@ -0,0 +1,236 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: osal-bench-test.c
+ *
+ * Purpose: Microbenchmarks of the OSAL API
+ *
+ * Each benchmark measures one group of OSAL calls against the real
+ * implementation, and records its results in a table.  At the end of
+ * the run the table is written out as JSON, so results can be compared
+ * between builds to catch performance regressions.
+ *
+ * The results are only as meaningful as the host allows.  In particular
+ * on a shared or non-realtime host the timing can vary between runs, so
+ * the assertions here check only that each benchmark ran, not its speed.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#include "osal-bench.h"
+
+typedef struct
+{
+    char   name[48];
+    char   params[96];
+    uint32 iterations;
+    int64  elapsed_ns;
+    uint64 bytes;
+    bool   is_latency;
+    int64  min_ns;
+    int64  mean_ns;
+    int64  max_ns;
+} OSAL_Bench_Result_t;
+
+OSAL_Bench_Result_t OSAL_Bench_Results[OSAL_BENCH_MAX_RESULTS];
+uint32              OSAL_Bench_NumResults;
+osal_id_t           OSAL_Bench_FsId;
+
+/* *************************************** HELPERS ************************************** */
+
+OS_time_t OSAL_Bench_Now(void)
+{
+    OS_time_t now;
+
+    OS_GetLocalTime(&now);
+
+    return now;
+}
+
+int64 OSAL_Bench_ElapsedNs(OS_time_t start)
+{
+    return OS_TimeGetTotalNanoseconds(OS_TimeSubtract(OSAL_Bench_Now(), start));
+}
+
+static OSAL_Bench_Result_t *OSAL_Bench_NewResult(const char *name, const char *params)
+{
+    OSAL_Bench_Result_t *result;
+
+    if (OSAL_Bench_NumResults >= OSAL_BENCH_MAX_RESULTS)
+    {
+        UtAssert_Failed("Benchmark result table full, %s dropped", name);
+        return NULL;
+    }
+
+    result = &OSAL_Bench_Results[OSAL_Bench_NumResults];
+    ++OSAL_Bench_NumResults;
+
+    memset(result, 0, sizeof(*result));
+    strncpy(result->name, name, sizeof(result->name) - 1);
+    strncpy(result->params, params, sizeof(result->params) - 1);
+
+    return result;
+}
+
+void OSAL_Bench_Record(const char *name, const char *params, uint32 iterations, int64 elapsed_ns, uint64 bytes)
+{
+    OSAL_Bench_Result_t *result;
+
+    result = OSAL_Bench_NewResult(name, params);
+    if (result == NULL)
+    {
+        return;
+    }
+
+    /* a zero time would not be a valid measurement, and would divide by zero below */
+    if (elapsed_ns <= 0)
+    {
+        elapsed_ns = 1;
+    }
+
+    result->iterations = iterations;
+    result->elapsed_ns = elapsed_ns;
+    result->bytes      = bytes;
+
+    UtPrintf("%s {%s}: %lu ops in %lld ns, %.1f ns/op, %.0f ops/s\n", name, params, (unsigned long)iterations,
+             (long long)elapsed_ns, (double)elapsed_ns / iterations, (1e9 * iterations) / elapsed_ns);
+}
+
+void OSAL_Bench_RecordLatency(const char *name, const char *params, uint32 samples, int64 min_ns, int64 mean_ns,
+                              int64 max_ns)
+{
+    OSAL_Bench_Result_t *result;
+
+    result = OSAL_Bench_NewResult(name, params);
+    if (result == NULL)
+    {
+        return;
+    }
+
+    result->iterations = samples;
+    result->is_latency = true;
+    result->min_ns     = min_ns;
+    result->mean_ns    = mean_ns;
+    result->max_ns     = max_ns;
+
+    UtPrintf("%s {%s}: %lu samples, min %lld ns, mean %lld ns, max %lld ns\n", name, params, (unsigned long)samples,
+             (long long)min_ns, (long long)mean_ns, (long long)max_ns);
+}
+
+/*
+ * Writes one formatted line to the results file
+ */
+static void OSAL_Bench_WriteLine(osal_id_t fd, const char *line)
+{
+    OS_write(fd, line, strlen(line));
+}
+
+/* *************************************** TESTS ************************************** */
+
+void OSAL_Bench_WriteResults(void)
+{
+    OSAL_Bench_Result_t *result;
+    osal_id_t            fd;
+    char                 line[512];
+    uint32               i;
+    int32                status;
+
+    UtAssert_True(OSAL_Bench_NumResults > 0, "Benchmarks recorded %lu results", (unsigned long)OSAL_Bench_NumResults);
+
+    status = OS_OpenCreate(&fd, OSAL_BENCH_RESULTS_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    UtAssert_True(status == OS_SUCCESS, "OS_OpenCreate(%s) (%ld) == OS_SUCCESS", OSAL_BENCH_RESULTS_FILE,
+                  (long)status);
+    if (status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    snprintf(line, sizeof(line), "{\n  \"suite\": \"osal-bench\",\n  \"osal_version\": \"%s\",\n  \"scale\": %d,\n",
+             OS_GetVersionString(), OSAL_BENCH_SCALE);
+    OSAL_Bench_WriteLine(fd, line);
+    OSAL_Bench_WriteLine(fd, "  \"results\": [\n");
+
+    for (i = 0; i < OSAL_Bench_NumResults; ++i)
+    {
+        result = &OSAL_Bench_Results[i];
+
+        if (result->is_latency)
+        {
+            snprintf(line, sizeof(line),
+                     "    {\"name\": \"%s\", \"params\": {%s}, \"samples\": %lu, "
+                     "\"min_ns\": %lld, \"mean_ns\": %lld, \"max_ns\": %lld}",
+                     result->name, result->params, (unsigned long)result->iterations, (long long)result->min_ns,
+                     (long long)result->mean_ns, (long long)result->max_ns);
+        }
+        else
+        {
+            snprintf(line, sizeof(line),
+                     "    {\"name\": \"%s\", \"params\": {%s}, \"iterations\": %lu, \"elapsed_ns\": %lld, "
+                     "\"ns_per_op\": %.1f, \"ops_per_sec\": %.0f, \"bytes_per_sec\": %.0f}",
+                     result->name, result->params, (unsigned long)result->iterations, (long long)result->elapsed_ns,
+                     (double)result->elapsed_ns / result->iterations,
+                     (1e9 * result->iterations) / result->elapsed_ns, (1e9 * result->bytes) / result->elapsed_ns);
+        }
+        OSAL_Bench_WriteLine(fd, line);
+        OSAL_Bench_WriteLine(fd, (i + 1 < OSAL_Bench_NumResults) ? ",\n" : "\n");
+    }
+
+    OSAL_Bench_WriteLine(fd, "  ]\n}\n");
+    OS_close(fd);
+
+    UtPrintf("Benchmark results written to %s\n", OSAL_BENCH_RESULTS_FILE);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /* The results file, and the files for the file benchmark, go in the current directory */
+    if (OS_FileSysAddFixedMap(&OSAL_Bench_FsId, "./", OSAL_BENCH_VIRT_DIR) != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_FileSysAddFixedMap() failed");
+    }
+
+    /*
+     * Register the benchmarks in UT assert
+     */
+    UtTest_Add(OSAL_Bench_Queue, NULL, NULL, "QueueBenchmark");
+    UtTest_Add(OSAL_Bench_Mutex, NULL, NULL, "MutexBenchmark");
+    UtTest_Add(OSAL_Bench_TimeBase, NULL, NULL, "TimeBaseBenchmark");
+    UtTest_Add(OSAL_Bench_Socket, NULL, NULL, "SocketBenchmark");
+    UtTest_Add(OSAL_Bench_File, NULL, NULL, "FileBenchmark");
+    UtTest_Add(OSAL_Bench_Idmap, NULL, NULL, "IdmapBenchmark");
+    UtTest_Add(OSAL_Bench_WriteResults, NULL, NULL, "WriteResults");
+}
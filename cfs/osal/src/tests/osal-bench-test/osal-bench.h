@@ -0,0 +1,93 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: osal-bench.h
+ *
+ * Purpose: Shared definitions for the OSAL benchmark suite
+ *
+ */
+
+#ifndef OSAL_BENCH_H
+#define OSAL_BENCH_H
+
+#include "common_types.h"
+#include "osapi.h"
+
+/*
+ * Multiplier for the iteration counts of every benchmark.
+ *
+ * The default keeps the whole suite to a few seconds so it can run with
+ * the other tests.  Build with a larger value for more stable numbers.
+ */
+#ifndef OSAL_BENCH_SCALE
+#define OSAL_BENCH_SCALE 1
+#endif
+
+#define OSAL_BENCH_ITERATIONS(n) ((uint32)(n)*OSAL_BENCH_SCALE)
+
+/*
+ * Worker tasks run below the test task, so the test task
+ * can always stop them.  See also sem-speed-test.
+ */
+#define OSAL_BENCH_TASK_PRIORITY 150
+#define OSAL_BENCH_STACK_SIZE    16384
+
+/*
+ * The results are written here, as JSON, when the suite completes.
+ * The virtual path is mapped to the current directory.
+ */
+#define OSAL_BENCH_VIRT_DIR     "/bench"
+#define OSAL_BENCH_RESULTS_FILE OSAL_BENCH_VIRT_DIR "/bench-results.json"
+
+#define OSAL_BENCH_MAX_RESULTS 64
+
+/*
+ * Record a throughput result
+ *
+ * "params" is the body of a JSON object describing the configuration,
+ * for example "\"depth\":8,\"size\":64", or an empty string.
+ * "bytes" is the total data moved, or 0 if not meaningful.
+ */
+void OSAL_Bench_Record(const char *name, const char *params, uint32 iterations, int64 elapsed_ns, uint64 bytes);
+
+/*
+ * Record a latency distribution, in nanoseconds
+ */
+void OSAL_Bench_RecordLatency(const char *name, const char *params, uint32 samples, int64 min_ns, int64 mean_ns,
+                              int64 max_ns);
+
+/*
+ * Get the current time, and the nanoseconds elapsed since a given time
+ */
+OS_time_t OSAL_Bench_Now(void);
+int64     OSAL_Bench_ElapsedNs(OS_time_t start);
+
+/*
+ * The benchmarks, each registered as a UT assert test case
+ */
+void OSAL_Bench_Queue(void);
+void OSAL_Bench_Mutex(void);
+void OSAL_Bench_TimeBase(void);
+void OSAL_Bench_Socket(void);
+void OSAL_Bench_File(void);
+void OSAL_Bench_Idmap(void);
+
+#endif /* OSAL_BENCH_H */
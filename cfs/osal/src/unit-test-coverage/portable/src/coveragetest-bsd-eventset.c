@@ -0,0 +1,174 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     coveragetest-bsd-eventset.c
+ *
+ */
+#include "os-portable-coveragetest.h"
+#include "ut-adaptor-portable-posix-io.h"
+#include "os-shared-eventset.h"
+#include "os-shared-select.h"
+#include "os-shared-idmap.h"
+
+void Test_OS_EventSetCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_EventSetCreate_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetCreate_Impl, (&token), OS_SUCCESS);
+} /* end OS_EventSetCreate_Impl */
+
+void Test_OS_EventSetDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_EventSetDelete_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetDelete_Impl, (&token), OS_SUCCESS);
+} /* end OS_EventSetDelete_Impl */
+
+void Test_OS_EventSetAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_EventSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot,
+     *                           uint32 events)
+     */
+    OS_object_token_t token;
+    OS_object_token_t obj_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&obj_token, 0, sizeof(obj_token));
+
+    /* queues are not supported by select() */
+    obj_token.obj_type = OS_OBJECT_TYPE_OS_QUEUE;
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd_Impl, (&token, &obj_token, 0, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    obj_token.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, false);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd_Impl, (&token, &obj_token, 0, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_0, true);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd_Impl, (&token, &obj_token, 0, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+} /* end OS_EventSetAdd_Impl */
+
+void Test_OS_EventSetRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_EventSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot)
+     */
+    OS_object_token_t token;
+    OS_object_token_t obj_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&obj_token, 0, sizeof(obj_token));
+    obj_token.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove_Impl, (&token, &obj_token, 0), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove_Impl, (&token, NULL, 0), OS_SUCCESS);
+} /* end OS_EventSetRemove_Impl */
+
+void Test_OS_EventSetWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_EventSetWait_Impl(const OS_object_token_t *token, OS_eventset_ready_t *ready, uint32 max_ready,
+     *                            uint32 *num_ready, int32 msecs)
+     */
+    OS_object_token_t   token;
+    OS_eventset_ready_t ready[OS_MAX_EVENTSET_MEMBERS];
+    uint32              num_ready;
+
+    memset(&token, 0, sizeof(token));
+    memset(OS_eventset_table, 0, sizeof(OS_eventset_table));
+
+    OS_eventset_table[0].member_id[0]     = OS_ObjectIdFromInteger(1);
+    OS_eventset_table[0].member_events[0] = OS_STREAM_STATE_READABLE;
+    OS_eventset_table[0].member_id[2]     = OS_ObjectIdFromInteger(2);
+    OS_eventset_table[0].member_events[2] = OS_STREAM_STATE_WRITABLE;
+    OS_eventset_table[0].num_members      = 2;
+
+    /* the select stub reports everything as ready */
+    num_ready = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait_Impl, (&token, ready, OS_MAX_EVENTSET_MEMBERS, &num_ready, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_ready, 2);
+    UtAssert_UINT32_EQ(ready[0].slot, 0);
+    UtAssert_UINT32_EQ(ready[1].slot, 2);
+    UtAssert_STUB_COUNT(OS_SelectFdAdd, 2);
+
+    /* only as many as requested are reported */
+    num_ready = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait_Impl, (&token, ready, 1, &num_ready, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_ready, 1);
+
+    /* a member which is not ready is not reported */
+    UT_SetDeferredRetcode(UT_KEY(OS_SelectFdIsSet), 1, 1);
+    num_ready = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait_Impl, (&token, ready, OS_MAX_EVENTSET_MEMBERS, &num_ready, 0), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_ready, 1);
+    UtAssert_UINT32_EQ(ready[0].slot, 2);
+    UtAssert_UINT32_EQ(ready[0].events, OS_STREAM_STATE_WRITABLE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SelectMultiple_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait_Impl, (&token, ready, OS_MAX_EVENTSET_MEMBERS, &num_ready, 1),
+                           OS_ERROR_TIMEOUT);
+} /* end OS_EventSetWait_Impl */
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_EventSetCreate_Impl);
+    ADD_TEST(OS_EventSetDelete_Impl);
+    ADD_TEST(OS_EventSetAdd_Impl);
+    ADD_TEST(OS_EventSetRemove_Impl);
+    ADD_TEST(OS_EventSetWait_Impl);
+}
@@ -145,6 +145,50 @@ void Test_OS_GenericWrite_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_GenericWrite_Impl, (&token, DestData, sizeof(DestData), 0), OS_ERROR);
 }
 
+void Test_OS_GenericCopy_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_GenericCopy_Impl(const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes)
+     */
+    char              SrcData[]                 = "ABCDEFGHIJKLM";
+    char              DestData[sizeof(SrcData)] = {0};
+    OS_object_token_t src_token;
+    OS_object_token_t dest_token;
+
+    memset(&src_token, 0, sizeof(src_token));
+    memset(&dest_token, 0, sizeof(dest_token));
+    dest_token.obj_idx = UT_INDEX_1;
+
+    UT_SetDataBuffer(UT_KEY(OCS_read), SrcData, sizeof(SrcData), false);
+    UT_SetDataBuffer(UT_KEY(OCS_write), DestData, sizeof(DestData), false);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopy_Impl, (&src_token, &dest_token, sizeof(SrcData)), sizeof(SrcData));
+    UtAssert_MemCmp(SrcData, DestData, sizeof(SrcData), "copied data valid");
+
+    /* short write() is completed by another write() */
+    UT_ResetState(UT_KEY(OCS_read));
+    UT_ResetState(UT_KEY(OCS_write));
+    memset(DestData, 0, sizeof(DestData));
+    UT_SetDataBuffer(UT_KEY(OCS_read), SrcData, sizeof(SrcData), false);
+    UT_SetDataBuffer(UT_KEY(OCS_write), DestData, sizeof(DestData), false);
+    UT_SetDeferredRetcode(UT_KEY(OCS_write), 1, 4);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopy_Impl, (&src_token, &dest_token, sizeof(SrcData)), sizeof(SrcData));
+    UtAssert_True(UT_GetStubCount(UT_KEY(OCS_write)) == 2, "write() called twice");
+
+    /* end of file */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_read), 0);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopy_Impl, (&src_token, &dest_token, sizeof(SrcData)), 0);
+
+    /* write() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_read), 4);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_write), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopy_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+
+    /* read() failure */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_read), -1);
+    OSAPI_TEST_FUNCTION_RC(OS_GenericCopy_Impl, (&src_token, &dest_token, sizeof(SrcData)), OS_ERROR);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -180,4 +224,5 @@ void UtTest_Setup(void)
     ADD_TEST(OS_GenericSeek_Impl);
     ADD_TEST(OS_GenericRead_Impl);
     ADD_TEST(OS_GenericWrite_Impl);
+    ADD_TEST(OS_GenericCopy_Impl);
 }
@@ -205,6 +205,9 @@ void Test_OS_CleanUpObject(void)
             case OS_OBJECT_TYPE_OS_DIR:
                 delhandler = UT_KEY(OS_DirectoryClose);
                 break;
+            case OS_OBJECT_TYPE_OS_EVENTSET:
+                delhandler = UT_KEY(OS_EventSetDelete);
+                break;
             default:
                 delhandler = 0;
                 break;
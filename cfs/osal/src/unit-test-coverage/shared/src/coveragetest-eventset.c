@@ -0,0 +1,326 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     coveragetest-eventset.c
+ * \ingroup  shared
+ *
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-eventset.h"
+
+#include "OCS_string.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_EventSetAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetAPI_Init(void)
+     */
+    int32 expected = OS_SUCCESS;
+    int32 actual   = OS_EventSetAPI_Init();
+
+    UtAssert_True(actual == expected, "OS_EventSetAPI_Init() (%ld) == OS_SUCCESS", (long)actual);
+}
+
+void Test_OS_EventSetCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetCreate(osal_id_t *set_id, const char *set_name, uint32 flags)
+     */
+    int32     expected = OS_SUCCESS;
+    osal_id_t objid;
+    int32     actual = OS_EventSetCreate(&objid, "UT", 0);
+
+    UtAssert_True(actual == expected, "OS_EventSetCreate() (%ld) == OS_SUCCESS", (long)actual);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetCreate(NULL, "UT", 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetCreate(&objid, NULL, 0), OS_INVALID_POINTER);
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetCreate(&objid, "UT", 0), OS_ERR_NAME_TOO_LONG);
+}
+
+void Test_OS_EventSetDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetDelete(osal_id_t set_id)
+     */
+    int32 expected = OS_SUCCESS;
+    int32 actual   = ~OS_SUCCESS;
+
+    actual = OS_EventSetDelete(UT_OBJID_1);
+
+    UtAssert_True(actual == expected, "OS_EventSetDelete() (%ld) == OS_SUCCESS", (long)actual);
+}
+
+void Test_OS_EventSetAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetAdd(osal_id_t set_id, osal_id_t objid, uint32 events)
+     */
+    OS_eventset_internal_record_t *eventset = &OS_eventset_table[UT_INDEX_1];
+    uint32                         slot;
+
+    /* bad event masks */
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, 0x100), OS_ERR_INVALID_SIZE);
+
+    /* member is not a valid object, or is of a type that cannot be waited on */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_UNDEFINED);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_MUTEX);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    /* nominal, a stream and a queue */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_UINT32_EQ(eventset->num_members, 1);
+    OSAPI_TEST_OBJID(eventset->member_id[0], ==, UT_OBJID_2);
+    UtAssert_UINT32_EQ(eventset->member_events[0], OS_STREAM_STATE_READABLE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    OSAPI_TEST_FUNCTION_RC(
+        OS_EventSetAdd(UT_OBJID_1, UT_OBJID_OTHER, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_UINT32_EQ(eventset->num_members, 2);
+    OSAPI_TEST_OBJID(eventset->member_id[1], ==, UT_OBJID_OTHER);
+
+    /* already a member */
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_NAME_TAKEN);
+    UtAssert_UINT32_EQ(eventset->num_members, 2);
+
+    /* implementation failure does not add the member */
+    UT_SetDeferredRetcode(UT_KEY(OS_EventSetAdd_Impl), 1, OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_MAX, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UtAssert_UINT32_EQ(eventset->num_members, 2);
+
+    /* set is full */
+    for (slot = 0; slot < OS_MAX_EVENTSET_MEMBERS; ++slot)
+    {
+        eventset->member_id[slot] = UT_OBJID_OTHER;
+    }
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_NO_FREE_IDS);
+
+    /* failure to get either object */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_EventSetRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetRemove(osal_id_t set_id, osal_id_t objid)
+     */
+    OS_eventset_internal_record_t *eventset = &OS_eventset_table[UT_INDEX_1];
+
+    eventset->member_id[3]     = UT_OBJID_2;
+    eventset->member_events[3] = OS_STREAM_STATE_READABLE;
+    eventset->num_members      = 1;
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, OS_OBJECT_ID_UNDEFINED), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, UT_OBJID_OTHER), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_UINT32_EQ(eventset->num_members, 0);
+    OSAPI_TEST_OBJID(eventset->member_id[3], ==, OS_OBJECT_ID_UNDEFINED);
+    UtAssert_STUB_COUNT(OS_EventSetRemove_Impl, 1);
+
+    /* a member that is still open is referenced while it is removed */
+    eventset->member_id[3] = UT_OBJID_2;
+    eventset->num_members  = 1;
+    UT_ResetState(UT_KEY(OS_ObjectIdRelease));
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_UINT32_EQ(eventset->num_members, 0);
+    UtAssert_STUB_COUNT(OS_EventSetRemove_Impl, 2);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 2);
+
+    /* a member that was closed (its ID is stale) is still forgotten, without a reference */
+    eventset->member_id[3] = UT_OBJID_2;
+    eventset->num_members  = 1;
+    UT_ResetState(UT_KEY(OS_ObjectIdRelease));
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_UINT32_EQ(eventset->num_members, 0);
+    UtAssert_STUB_COUNT(OS_EventSetRemove_Impl, 3);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+
+    /* invalid set, the member reference is still released */
+    UT_ResetState(UT_KEY(OS_ObjectIdRelease));
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
+}
+
+void Test_OS_EventSetWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetWait(osal_id_t set_id, OS_eventset_event_t *events, uint32 max_events, uint32 *num_events,
+     *                       int32 msecs)
+     */
+    OS_eventset_internal_record_t *eventset = &OS_eventset_table[UT_INDEX_1];
+    OS_eventset_event_t            events[2];
+    OS_eventset_ready_t            ready[3];
+    uint32                         num_events;
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, NULL, 2, &num_events, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 0, &num_events, 0), OS_ERR_INVALID_SIZE);
+
+    /* empty set */
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERR_INCORRECT_OBJ_STATE);
+    UtAssert_STUB_COUNT(OS_EventSetWait_Impl, 0);
+
+    eventset->member_id[0]     = UT_OBJID_2;
+    eventset->member_events[0] = OS_STREAM_STATE_READABLE;
+    eventset->member_id[1]     = UT_OBJID_OTHER;
+    eventset->member_events[1] = OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE;
+    eventset->num_members      = 2;
+
+    /* timeout */
+    UT_SetDeferredRetcode(UT_KEY(OS_EventSetWait_Impl), 1, OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    /*
+     * The implementation reports both members and an emptied slot,
+     * the emptied slot is skipped and the events are masked to those requested
+     */
+    memset(ready, 0, sizeof(ready));
+    ready[0].slot   = 0;
+    ready[0].events = OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE;
+    ready[1].slot   = 5;
+    ready[1].events = OS_STREAM_STATE_READABLE;
+    ready[2].slot   = 1;
+    ready[2].events = OS_STREAM_STATE_WRITABLE;
+    UT_SetDataBuffer(UT_KEY(OS_EventSetWait_Impl), ready, sizeof(ready), false);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 4, &num_events, -1), OS_SUCCESS);
+    UtAssert_UINT32_EQ(num_events, 2);
+    OSAPI_TEST_OBJID(events[0].objid, ==, UT_OBJID_2);
+    UtAssert_UINT32_EQ(events[0].events, OS_STREAM_STATE_READABLE);
+    OSAPI_TEST_OBJID(events[1].objid, ==, UT_OBJID_OTHER);
+    UtAssert_UINT32_EQ(events[1].events, OS_STREAM_STATE_WRITABLE);
+
+    /* the only ready member was removed during the wait, nothing is reported */
+    memset(ready, 0, sizeof(ready));
+    ready[0].slot   = 5;
+    ready[0].events = OS_STREAM_STATE_READABLE;
+    UT_SetDataBuffer(UT_KEY(OS_EventSetWait_Impl), ready, sizeof(ready[0]), false);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 2, &num_events, -1), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(num_events, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetWait(UT_OBJID_1, events, 2, &num_events, 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_EventSetGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetGetIdByName(osal_id_t *set_id, const char *set_name)
+     */
+    int32     expected = OS_SUCCESS;
+    int32     actual   = ~OS_SUCCESS;
+    osal_id_t objid;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    actual = OS_EventSetGetIdByName(&objid, "UT");
+    UtAssert_True(actual == expected, "OS_EventSetGetIdByName() (%ld) == OS_SUCCESS", (long)actual);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    expected = OS_ERR_NAME_NOT_FOUND;
+    actual   = OS_EventSetGetIdByName(&objid, "NF");
+    UtAssert_True(actual == expected, "OS_EventSetGetIdByName() (%ld) == %ld", (long)actual, (long)expected);
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetGetIdByName(NULL, NULL), OS_INVALID_POINTER);
+}
+
+void Test_OS_EventSetGetInfo(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_EventSetGetInfo(osal_id_t set_id, OS_eventset_prop_t *set_prop)
+     */
+    int32              expected = OS_SUCCESS;
+    int32              actual   = ~OS_SUCCESS;
+    OS_eventset_prop_t prop;
+
+    OS_UT_SetupBasicInfoTest(OS_OBJECT_TYPE_OS_EVENTSET, UT_INDEX_1, "ABC", UT_OBJID_OTHER);
+    OS_eventset_table[UT_INDEX_1].num_members = 3;
+
+    actual = OS_EventSetGetInfo(UT_OBJID_1, &prop);
+
+    UtAssert_True(actual == expected, "OS_EventSetGetInfo() (%ld) == OS_SUCCESS", (long)actual);
+    OSAPI_TEST_OBJID(prop.creator, ==, UT_OBJID_OTHER);
+    UtAssert_True(strcmp(prop.name, "ABC") == 0, "prop.name (%s) == ABC", prop.name);
+    UtAssert_UINT32_EQ(prop.num_members, 3);
+
+    OSAPI_TEST_FUNCTION_RC(OS_EventSetGetInfo(UT_OBJID_1, NULL), OS_INVALID_POINTER);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_eventset_table, 0, sizeof(OS_eventset_table));
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_EventSetAPI_Init);
+    ADD_TEST(OS_EventSetCreate);
+    ADD_TEST(OS_EventSetDelete);
+    ADD_TEST(OS_EventSetAdd);
+    ADD_TEST(OS_EventSetRemove);
+    ADD_TEST(OS_EventSetWait);
+    ADD_TEST(OS_EventSetGetIdByName);
+    ADD_TEST(OS_EventSetGetInfo);
+}
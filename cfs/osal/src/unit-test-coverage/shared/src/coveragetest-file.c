@@ -175,6 +175,36 @@ void Test_OS_write(void)
     UtAssert_True(memcmp(Buf, DstBuf, actual) == 0, "buffer content match");
 }
 
+void Test_OS_CopyFileData(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_CopyFileData(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+     */
+    int32 expected = 8;
+    int32 actual   = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericCopy_Impl), 8);
+    actual = OS_CopyFileData(UT_OBJID_1, UT_OBJID_2, 16);
+    UtAssert_True(actual == expected, "OS_CopyFileData() (%ld) == %ld", (long)actual, (long)expected);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericCopy_Impl));
+
+    expected = OS_ERR_INVALID_SIZE;
+    actual   = OS_CopyFileData(UT_OBJID_1, UT_OBJID_2, 0);
+    UtAssert_True(actual == expected, "OS_CopyFileData() (%ld) == OS_ERR_INVALID_SIZE", (long)actual);
+
+    /* Bad source ID, then bad destination ID */
+    expected = OS_ERR_INVALID_ID;
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    actual = OS_CopyFileData(UT_OBJID_1, UT_OBJID_2, 16);
+    UtAssert_True(actual == expected, "OS_CopyFileData() (%ld) == OS_ERR_INVALID_ID", (long)actual);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    actual = OS_CopyFileData(UT_OBJID_1, UT_OBJID_2, 16);
+    UtAssert_True(actual == expected, "OS_CopyFileData() (%ld) == OS_ERR_INVALID_ID", (long)actual);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_GenericCopy_Impl)) == 1, "OS_GenericCopy_Impl() called once");
+}
+
 void Test_OS_chmod(void)
 {
     /*
@@ -252,32 +282,24 @@ void Test_OS_cp(void)
      * Test Case For:
      * int32 OS_cp (const char *src, const char *dest)
      */
-    int32 expected                  = OS_INVALID_POINTER;
-    int32 actual                    = OS_cp(NULL, NULL);
-    char  ReadBuf[]                 = "cpcpcpcp";
-    char  WriteBuf[sizeof(ReadBuf)] = "";
+    int32 expected = OS_INVALID_POINTER;
+    int32 actual   = OS_cp(NULL, NULL);
 
     UtAssert_True(actual == expected, "OS_cp() (%ld) == OS_INVALID_POINTER", (long)actual);
 
     /* setup to make internal copy loop execute at least once */
     expected = OS_SUCCESS;
-    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
-    UT_SetDataBuffer(UT_KEY(OS_GenericWrite_Impl), WriteBuf, sizeof(WriteBuf), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_GenericCopy_Impl), 1, 8);
     actual = OS_cp("/cf/file1", "/cf/file2");
 
     UtAssert_True(actual == expected, "OS_cp() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_GenericCopy_Impl)) == 2, "OS_GenericCopy_Impl() called twice");
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_GenericRead_Impl), -444);
+    UT_SetDefaultReturnValue(UT_KEY(OS_GenericCopy_Impl), -444);
     expected = -444;
     actual   = OS_cp("/cf/file1", "/cf/file2");
     UtAssert_True(actual == expected, "OS_cp() (%ld) == -444", (long)actual);
-    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericRead_Impl));
-
-    UT_SetDataBuffer(UT_KEY(OS_GenericRead_Impl), ReadBuf, sizeof(ReadBuf), false);
-    UT_SetDefaultReturnValue(UT_KEY(OS_GenericWrite_Impl), -555);
-    expected = -555;
-    actual   = OS_cp("/cf/file1", "/cf/file2");
-    UtAssert_True(actual == expected, "OS_cp() (%ld) == -555", (long)actual);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_GenericCopy_Impl));
 
     UT_SetDefaultReturnValue(UT_KEY(OS_TranslatePath), OS_INVALID_POINTER);
     expected = OS_INVALID_POINTER;
@@ -427,6 +449,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimedWrite);
     ADD_TEST(OS_read);
     ADD_TEST(OS_write);
+    ADD_TEST(OS_CopyFileData);
     ADD_TEST(OS_chmod);
     ADD_TEST(OS_stat);
     ADD_TEST(OS_lseek);
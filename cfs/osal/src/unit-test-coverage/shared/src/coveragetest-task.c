@@ -125,6 +125,16 @@ void Test_OS_TaskCreate(void)
     OSAPI_TEST_FUNCTION_RC(
         OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128), OSAL_PRIORITY_C(0), 0),
         OS_ERR_NAME_TOO_LONG);
+    UT_ResetState(UT_KEY(OCS_memchr));
+
+    /* the affinity mask carried in the flags is recorded with the task */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128),
+                                         OSAL_PRIORITY_C(0), OS_FP_ENABLED | OS_TASK_CPU_AFFINITY(0x6)),
+                           OS_SUCCESS);
+    /* the stub allocates the table entry at the index of the call count */
+    UtAssert_UINT32_EQ(OS_task_table[UT_GetStubCount(UT_KEY(OS_ObjectIdAllocateNew))].cpu_mask, 0x6);
+    OS_task_table[UT_GetStubCount(UT_KEY(OS_ObjectIdAllocateNew))].cpu_mask = 0;
+    UtAssert_UINT32_EQ(OS_TASK_CPU_AFFINITY_GET(OS_FP_ENABLED | OS_TASK_CPU_AFFINITY(0x6)), 0x6);
 }
 
 void Test_OS_TaskDelete(void)
@@ -184,6 +194,25 @@ void Test_OS_TaskSetPriority(void)
 
     UtAssert_True(actual == expected, "OS_TaskSetPriority() (%ld) == OS_SUCCESS", (long)actual);
 }
+void Test_OS_TaskSetAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 0x3), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_task_table[1].cpu_mask, 0x3);
+
+    /* a failed implementation call must not change the recorded mask */
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskSetAffinity_Impl), OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 0x4), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(OS_task_table[1].cpu_mask, 0x3);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, 0x3), OS_ERR_INVALID_ID);
+
+    OS_task_table[1].cpu_mask = 0;
+}
 void Test_OS_TaskGetId(void)
 {
     /*
@@ -239,6 +268,7 @@ void Test_OS_TaskGetInfo(void)
     OS_UT_SetupBasicInfoTest(OS_OBJECT_TYPE_OS_TASK, UT_INDEX_1, "ABC", UT_OBJID_OTHER);
     OS_task_table[1].stack_size = OSAL_SIZE_C(222);
     OS_task_table[1].priority   = OSAL_PRIORITY_C(133);
+    OS_task_table[1].cpu_mask   = 0x5;
 
     actual = OS_TaskGetInfo(UT_OBJID_1, &task_prop);
 
@@ -248,9 +278,18 @@ void Test_OS_TaskGetInfo(void)
     UtAssert_True(task_prop.stack_size == 222, "task_prop.stack_size (%lu) == 222",
                   (unsigned long)task_prop.stack_size);
     UtAssert_True(task_prop.priority == 133, "task_prop.priority (%lu) == 133", (unsigned long)task_prop.priority);
+    UtAssert_UINT32_EQ(task_prop.cpu_mask, 0x5);
+    UtAssert_UINT32_EQ(task_prop.last_cpu, OS_TASK_CPU_UNKNOWN);
+
+    /* the OS-specific query runs holding only a reference, after the lock is released */
+    UtAssert_STUB_COUNT(OS_Lock_Global, 1);
+    UtAssert_STUB_COUNT(OS_Unlock_Global, 1);
+    UtAssert_STUB_COUNT(OS_TaskGetInfo_Impl, 1);
+    UtAssert_STUB_COUNT(OS_ObjectIdRelease, 1);
 
     OS_task_table[1].stack_size = OSAL_SIZE_C(0);
     OS_task_table[1].priority   = OSAL_PRIORITY_C(0);
+    OS_task_table[1].cpu_mask   = 0;
 
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(OS_OBJECT_ID_UNDEFINED, NULL), OS_INVALID_POINTER);
 }
@@ -349,6 +388,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit);
     ADD_TEST(OS_TaskDelay);
     ADD_TEST(OS_TaskSetPriority);
+    ADD_TEST(OS_TaskSetAffinity);
     ADD_TEST(OS_TaskGetId);
     ADD_TEST(OS_TaskGetIdByName);
     ADD_TEST(OS_TaskGetInfo);
@@ -82,6 +82,9 @@ void OS_UT_SetupBasicInfoTest(osal_objtype_t obj_type, osal_index_t test_idx, co
         case OS_OBJECT_TYPE_OS_CONSOLE:
             rptr = OS_global_console_table;
             break;
+        case OS_OBJECT_TYPE_OS_EVENTSET:
+            rptr = OS_global_eventset_table;
+            break;
         case OS_OBJECT_TYPE_OS_MODULE:
             rptr = OS_global_module_table;
             break;
@@ -0,0 +1,64 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     osapi-eventset-impl-stubs.c
+ * \ingroup  ut-stubs
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "utstubs.h"
+
+#include "os-shared-eventset.h"
+
+/*
+** Event Set API
+*/
+
+UT_DEFAULT_STUB(OS_EventSetCreate_Impl, (const OS_object_token_t *token))
+UT_DEFAULT_STUB(OS_EventSetDelete_Impl, (const OS_object_token_t *token))
+UT_DEFAULT_STUB(OS_EventSetAdd_Impl,
+                (const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot, uint32 events))
+UT_DEFAULT_STUB(OS_EventSetRemove_Impl,
+                (const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 slot))
+
+/*
+ * The ready members are taken from any buffer the test has set with UT_SetDataBuffer()
+ */
+int32 OS_EventSetWait_Impl(const OS_object_token_t *token, OS_eventset_ready_t *ready, uint32 max_ready,
+                           uint32 *num_ready, int32 msecs)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetWait_Impl);
+
+    if (status == OS_SUCCESS)
+    {
+        *num_ready = UT_Stub_CopyToLocal(UT_KEY(OS_EventSetWait_Impl), ready, max_ready * sizeof(*ready)) /
+                     sizeof(*ready);
+    }
+
+    return status;
+}
@@ -83,5 +83,7 @@ int32 OS_GenericWrite_Impl(const OS_object_token_t *token, const void *buffer, s
     return Status;
 }
 
+UT_DEFAULT_STUB(OS_GenericCopy_Impl,
+                (const OS_object_token_t *src_token, const OS_object_token_t *dest_token, size_t nbytes))
 UT_DEFAULT_STUB(OS_GenericSeek_Impl, (const OS_object_token_t *token, int32 offset, uint32 whence))
 UT_DEFAULT_STUB(OS_GenericClose_Impl, (const OS_object_token_t *token))
@@ -42,6 +42,7 @@ OS_common_record_t OS_stub_timebase_table[OS_MAX_TIMEBASES];
 OS_common_record_t OS_stub_timecb_table[OS_MAX_TIMERS];
 OS_common_record_t OS_stub_stream_table[OS_MAX_NUM_OPEN_FILES];
 OS_common_record_t OS_stub_dir_table[OS_MAX_NUM_OPEN_DIRS];
+OS_common_record_t OS_stub_eventset_table[OS_MAX_EVENTSETS];
 
 OS_common_record_t *const OS_global_task_table      = OS_stub_task_table;
 OS_common_record_t *const OS_global_queue_table     = OS_stub_queue_table;
@@ -55,3 +56,4 @@ OS_common_record_t *const OS_global_timecb_table    = OS_stub_timecb_table;
 OS_common_record_t *const OS_global_module_table    = OS_stub_module_table;
 OS_common_record_t *const OS_global_filesys_table   = OS_stub_filesys_table;
 OS_common_record_t *const OS_global_console_table   = OS_stub_console_table;
+OS_common_record_t *const OS_global_eventset_table  = OS_stub_eventset_table;
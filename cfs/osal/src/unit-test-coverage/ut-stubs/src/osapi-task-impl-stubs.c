@@ -49,6 +49,7 @@ void OS_TaskExit_Impl(void)
 
 UT_DEFAULT_STUB(OS_TaskDelay_Impl, (uint32 millisecond))
 UT_DEFAULT_STUB(OS_TaskSetPriority_Impl, (const OS_object_token_t *token, osal_priority_t new_priority))
+UT_DEFAULT_STUB(OS_TaskSetAffinity_Impl, (const OS_object_token_t *token, uint32 cpu_mask))
 osal_id_t OS_TaskGetId_Impl(void)
 {
     int32     status;
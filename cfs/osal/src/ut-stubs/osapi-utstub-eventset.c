@@ -0,0 +1,197 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file osapi-utstub-eventset.c
+ *
+ * Stub implementations for the functions defined in the OSAL API
+ *
+ * The stub implementation can be used for unit testing applications built
+ * on top of OSAL.  The stubs do not do any real function, but allow
+ * the return code to be crafted such that error paths in the application
+ * can be executed.
+ */
+
+#include "osapi-eventset.h" /* OSAL public API for this subsystem */
+#include "utstub-helpers.h"
+
+UT_DEFAULT_STUB(OS_EventSetAPI_Init, (void))
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetCreate()
+ *
+ *****************************************************************************/
+int32 OS_EventSetCreate(osal_id_t *set_id, const char *set_name, uint32 flags)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetCreate), set_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetCreate), set_name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetCreate), flags);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetCreate);
+
+    if (status == OS_SUCCESS)
+    {
+        *set_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_EVENTSET);
+    }
+    else
+    {
+        *set_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetDelete()
+ *
+ *****************************************************************************/
+int32 OS_EventSetDelete(osal_id_t set_id)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetDelete), set_id);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetDelete);
+
+    if (status == OS_SUCCESS)
+    {
+        UT_DeleteStubObjId(OS_OBJECT_TYPE_OS_EVENTSET, set_id);
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetAdd()
+ *
+ *****************************************************************************/
+int32 OS_EventSetAdd(osal_id_t set_id, osal_id_t objid, uint32 events)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetAdd), set_id);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetAdd), objid);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetAdd), events);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetAdd);
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetRemove()
+ *
+ *****************************************************************************/
+int32 OS_EventSetRemove(osal_id_t set_id, osal_id_t objid)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetRemove), set_id);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetRemove), objid);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetRemove);
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetWait()
+ *
+ * On success the events are filled from any buffer the test has set with
+ * UT_SetDataBuffer(), otherwise no events are reported.
+ *
+ *****************************************************************************/
+int32 OS_EventSetWait(osal_id_t set_id, OS_eventset_event_t *events, uint32 max_events, uint32 *num_events,
+                      int32 msecs)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetWait), set_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetWait), events);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetWait), max_events);
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetWait), num_events);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetWait), msecs);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetWait);
+
+    *num_events = 0;
+    if (status == OS_SUCCESS)
+    {
+        *num_events = UT_Stub_CopyToLocal(UT_KEY(OS_EventSetWait), events, max_events * sizeof(*events)) /
+                      sizeof(*events);
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetGetIdByName()
+ *
+ *****************************************************************************/
+int32 OS_EventSetGetIdByName(osal_id_t *set_id, const char *set_name)
+{
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetGetIdByName), set_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetGetIdByName), set_name);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetGetIdByName);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_EventSetGetIdByName), set_id, sizeof(*set_id)) < sizeof(*set_id))
+    {
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_EVENTSET, set_id);
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ *
+ * Stub function for OS_EventSetGetInfo()
+ *
+ *****************************************************************************/
+int32 OS_EventSetGetInfo(osal_id_t set_id, OS_eventset_prop_t *set_prop)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_EventSetGetInfo), set_id);
+    UT_Stub_RegisterContext(UT_KEY(OS_EventSetGetInfo), set_prop);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_EventSetGetInfo);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_EventSetGetInfo), set_prop, sizeof(*set_prop)) < sizeof(*set_prop))
+    {
+        memset(set_prop, 0, sizeof(*set_prop));
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_TASK, &set_prop->creator);
+        strncpy(set_prop->name, "Name", sizeof(set_prop->name) - 1);
+    }
+
+    return status;
+}
@@ -203,6 +203,24 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
     return UT_GenericWriteStub(__func__, UT_KEY(OS_write), buffer, nbytes);
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_CopyFileData()
+ *
+ *****************************************************************************/
+int32 OS_CopyFileData(osal_id_t src_fd, osal_id_t dest_fd, size_t nbytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_CopyFileData), src_fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_CopyFileData), dest_fd);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_CopyFileData), nbytes);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_CopyFileData);
+
+    return status;
+}
+
 /*****************************************************************************
  *
  * Stub function for OS_TimedRead()
@@ -178,6 +178,23 @@ int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority)
     return status;
 }
 
+/*****************************************************************************
+ *
+ * Stub function for OS_TaskSetAffinity()
+ *
+ *****************************************************************************/
+int32 OS_TaskSetAffinity(osal_id_t task_id, uint32 cpu_mask)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TaskSetAffinity), task_id);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(OS_TaskSetAffinity), cpu_mask);
+
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskSetAffinity);
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief OS_TaskGetId stub function
@@ -259,6 +276,8 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
         UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_TASK, &task_prop->creator);
         task_prop->stack_size = OSAL_SIZE_C(100);
         task_prop->priority   = OSAL_PRIORITY_C(150);
+        task_prop->cpu_mask   = 0;
+        task_prop->last_cpu   = OS_TASK_CPU_UNKNOWN;
         strncpy(task_prop->name, "UnitTest", sizeof(task_prop->name) - 1);
         task_prop->name[sizeof(task_prop->name) - 1] = '\0';
     }
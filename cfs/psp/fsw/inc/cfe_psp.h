@@ -66,6 +66,7 @@
 #define CFE_PSP_INVALID_MODULE_NAME      (-28)
 #define CFE_PSP_INVALID_MODULE_ID        (-29)
 #define CFE_PSP_NO_EXCEPTION_DATA        (-30)
+#define CFE_PSP_INVALID_CODEC_DATA       (-31)
 
 /*
 ** Definitions for PSP PANIC types
@@ -369,6 +370,18 @@ extern int32 CFE_PSP_InitSSR(uint32 bus, uint32 device, char *DeviceName);
 ** CFE_PSP_InitSSR will initialize the Solid state recorder memory for a particular platform
 */
 
+/*
+** Compression level passed to CFE_PSP_CompressFile() to select the codec's
+** default, which favors speed over compression ratio
+*/
+#define CFE_PSP_COMPRESS_LEVEL_DEFAULT (-1)
+
+typedef void (*CFE_PSP_CodecYieldFunc_t)(void *YieldArg);
+/*
+** CFE_PSP_CodecYieldFunc_t is called by the file codec after each block of
+** input so a caller can pace a long compression with task delays
+*/
+
 extern int32 CFE_PSP_Decompress(char *srcFileName, char *dstFileName);
 /*
 ** CFE_PSP_Decompress will uncompress the source file to the file specified in the
@@ -376,6 +389,32 @@ extern int32 CFE_PSP_Decompress(char *srcFileName, char *dstFileName);
 ** be compressed using the "gzip" program available on almost all host platforms.
 */
 
+extern int32 CFE_PSP_Compress(char *srcFileName, char *dstFileName);
+/*
+** CFE_PSP_Compress will compress the source file to the file specified in the
+** destination file name using the "gzip" format at the default level. Files can
+** be decompressed using the "gzip" program available on almost all host platforms.
+*/
+
+extern int32 CFE_PSP_DecompressFile(const char *srcFileName, const char *dstFileName,
+                                    CFE_PSP_CodecYieldFunc_t YieldFunc, void *YieldArg);
+/*
+** CFE_PSP_DecompressFile is CFE_PSP_Decompress with an optional YieldFunc called
+** between input blocks. Concatenated gzip members are decompressed in order and,
+** as with gzip, bytes after a member that don't start another member are ignored.
+** Returns CFE_PSP_INVALID_CODEC_DATA if the source is corrupt or truncated. The
+** destination file is removed if decompression fails.
+*/
+
+extern int32 CFE_PSP_CompressFile(const char *srcFileName, const char *dstFileName, int32 Level,
+                                  CFE_PSP_CodecYieldFunc_t YieldFunc, void *YieldArg);
+/*
+** CFE_PSP_CompressFile is CFE_PSP_Compress with a compression level (1 fastest
+** to 9 smallest, or CFE_PSP_COMPRESS_LEVEL_DEFAULT) and an optional YieldFunc
+** called between input blocks. The destination file is removed if compression
+** fails.
+*/
+
 extern void CFE_PSP_AttachExceptions(void);
 /*
 ** CFE_PSP_AttachExceptions will setup the exception environment for the chosen platform
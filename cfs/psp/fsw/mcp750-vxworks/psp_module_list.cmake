@@ -6,3 +6,4 @@ timebase_vxworks
 eeprom_direct
 ram_direct
 port_direct
+compress_notimpl
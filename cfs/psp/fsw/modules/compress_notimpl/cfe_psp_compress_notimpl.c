@@ -0,0 +1,73 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * \file cfe_psp_compress_notimpl.c
+ *
+ * A PSP module to satisfy the file compression API on systems which
+ * do not provide a codec.
+ *
+ * All functions return CFE_PSP_ERROR_NOT_IMPLEMENTED
+ *
+ * Codec modules also build this file under their own module name, set with
+ * CFE_PSP_COMPRESS_MODULE, when their codec library is not available.
+ */
+
+#include "cfe_psp.h"
+#include "cfe_psp_module.h"
+
+#ifndef CFE_PSP_COMPRESS_MODULE
+#define CFE_PSP_COMPRESS_MODULE compress_notimpl
+#endif
+
+/* Expand CFE_PSP_COMPRESS_MODULE before it is pasted into the API and init names */
+#define CFE_PSP_COMPRESS_DECLARE(name)   CFE_PSP_MODULE_DECLARE_SIMPLE(name)
+#define CFE_PSP_COMPRESS_INIT(name)      CFE_PSP_COMPRESS_INIT_NAME(name)
+#define CFE_PSP_COMPRESS_INIT_NAME(name) name##_Init
+
+CFE_PSP_COMPRESS_DECLARE(CFE_PSP_COMPRESS_MODULE);
+
+void CFE_PSP_COMPRESS_INIT(CFE_PSP_COMPRESS_MODULE)(uint32 PspModuleId)
+{
+    /* Inform the user that this module is in use */
+    printf("CFE_PSP: File compression not implemented\n");
+}
+
+int32 CFE_PSP_Decompress(char *srcFileName, char *dstFileName)
+{
+    return (CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
+
+int32 CFE_PSP_Compress(char *srcFileName, char *dstFileName)
+{
+    return (CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
+
+int32 CFE_PSP_DecompressFile(const char *srcFileName, const char *dstFileName, CFE_PSP_CodecYieldFunc_t YieldFunc,
+                             void *YieldArg)
+{
+    return (CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
+
+int32 CFE_PSP_CompressFile(const char *srcFileName, const char *dstFileName, int32 Level,
+                           CFE_PSP_CodecYieldFunc_t YieldFunc, void *YieldArg)
+{
+    return (CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
@@ -0,0 +1,331 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * \file cfe_psp_compress_zlib.c
+ *
+ * A PSP module that implements gzip file compression and decompression
+ * with zlib.
+ *
+ * Files are processed in CFE_PSP_CODEC_BLOCK_SIZE blocks through OSAL file
+ * calls so paths are OSAL virtual paths. Memory use is fixed for any file
+ * size: two block buffers plus the zlib state, about 320KB to compress and
+ * 110KB to decompress with the settings below. The caller's yield function
+ * runs after every input block.
+ *
+ * The default level is Z_BEST_SPEED because the main use is compressing
+ * recorded data for downlink, which must keep up with storage throughput.
+ */
+
+#include <stdlib.h>
+#include <zlib.h>
+
+#include "cfe_psp.h"
+#include "cfe_psp_module.h"
+
+/*
+** Defines
+*/
+#define CFE_PSP_CODEC_BLOCK_SIZE    (32 * 1024)
+#define CFE_PSP_CODEC_DEFAULT_LEVEL Z_BEST_SPEED
+#define CFE_PSP_CODEC_MEM_LEVEL     8
+#define CFE_PSP_CODEC_GZIP_WBITS    (MAX_WBITS + 16) /* Write a gzip header/trailer */
+#define CFE_PSP_CODEC_AUTO_WBITS    (MAX_WBITS + 32) /* Accept a gzip or zlib header */
+#define CFE_PSP_CODEC_GZIP_ID1      0x1F             /* First byte of a gzip member header */
+
+/*
+** Per-call state, allocated for the duration of one file operation
+*/
+typedef struct
+{
+    osal_id_t SrcFd;
+    osal_id_t DstFd;
+    z_stream  Stream;
+    uint8     InBuf[CFE_PSP_CODEC_BLOCK_SIZE];
+    uint8     OutBuf[CFE_PSP_CODEC_BLOCK_SIZE];
+} CFE_PSP_CodecState_t;
+
+CFE_PSP_MODULE_DECLARE_SIMPLE(compress_zlib);
+
+void compress_zlib_Init(uint32 PspModuleId)
+{
+    /* Inform the user that this module is in use */
+    printf("CFE_PSP: gzip file codec using zlib %s\n", zlibVersion());
+}
+
+/*
+** Open the source and destination files and allocate the codec state
+*/
+static CFE_PSP_CodecState_t *CFE_PSP_CodecOpen(const char *srcFileName, const char *dstFileName)
+{
+    CFE_PSP_CodecState_t *State;
+
+    State = calloc(1, sizeof(CFE_PSP_CodecState_t));
+    if (State != NULL)
+    {
+        if (OS_OpenCreate(&State->SrcFd, srcFileName, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+        {
+            free(State);
+            State = NULL;
+        }
+        else if (OS_OpenCreate(&State->DstFd, dstFileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                               OS_WRITE_ONLY) != OS_SUCCESS)
+        {
+            OS_close(State->SrcFd);
+            free(State);
+            State = NULL;
+        }
+    }
+
+    return State;
+}
+
+/*
+** Close both files, removing a partial destination, and free the state
+*/
+static void CFE_PSP_CodecClose(CFE_PSP_CodecState_t *State, const char *dstFileName, int32 Status)
+{
+    OS_close(State->SrcFd);
+    OS_close(State->DstFd);
+
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        OS_remove(dstFileName);
+    }
+
+    free(State);
+}
+
+/*
+** Write everything the last zlib call produced in OutBuf
+*/
+static int32 CFE_PSP_CodecWriteOut(CFE_PSP_CodecState_t *State)
+{
+    size_t BytesOut = CFE_PSP_CODEC_BLOCK_SIZE - State->Stream.avail_out;
+    size_t Written  = 0;
+    int32  Status   = CFE_PSP_SUCCESS;
+    int32  OsStatus;
+
+    while (Written < BytesOut && Status == CFE_PSP_SUCCESS)
+    {
+        OsStatus = OS_write(State->DstFd, &State->OutBuf[Written], BytesOut - Written);
+        if (OsStatus <= 0)
+        {
+            Status = CFE_PSP_ERROR;
+        }
+        else
+        {
+            Written += OsStatus;
+        }
+    }
+
+    return Status;
+}
+
+/*
+** Compress the rest of the source file into a gzip stream
+*/
+static int32 CFE_PSP_CodecDeflate(CFE_PSP_CodecState_t *State, int Level, CFE_PSP_CodecYieldFunc_t YieldFunc,
+                                  void *YieldArg)
+{
+    int32 Status = CFE_PSP_SUCCESS;
+    int32 BytesIn;
+    int   Flush;
+
+    if (deflateInit2(&State->Stream, Level, Z_DEFLATED, CFE_PSP_CODEC_GZIP_WBITS, CFE_PSP_CODEC_MEM_LEVEL,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    do
+    {
+        BytesIn = OS_read(State->SrcFd, State->InBuf, sizeof(State->InBuf));
+        if (BytesIn < 0)
+        {
+            Status = CFE_PSP_ERROR;
+            break;
+        }
+
+        Flush                  = (BytesIn == 0) ? Z_FINISH : Z_NO_FLUSH;
+        State->Stream.next_in  = State->InBuf;
+        State->Stream.avail_in = BytesIn;
+
+        /* Drain all output for this block, deflate() can't fail with a valid stream */
+        do
+        {
+            State->Stream.next_out  = State->OutBuf;
+            State->Stream.avail_out = sizeof(State->OutBuf);
+            deflate(&State->Stream, Flush);
+            Status = CFE_PSP_CodecWriteOut(State);
+        } while (State->Stream.avail_out == 0 && Status == CFE_PSP_SUCCESS);
+
+        if (YieldFunc != NULL && Flush != Z_FINISH)
+        {
+            YieldFunc(YieldArg);
+        }
+
+    } while (Flush != Z_FINISH && Status == CFE_PSP_SUCCESS);
+
+    deflateEnd(&State->Stream);
+
+    return Status;
+}
+
+/*
+** Decompress the rest of the source file, which may hold several gzip members.
+** Like gzip, bytes after a member that can't start another member, such as
+** block padding, end the stream and are ignored.
+*/
+static int32 CFE_PSP_CodecInflate(CFE_PSP_CodecState_t *State, CFE_PSP_CodecYieldFunc_t YieldFunc, void *YieldArg)
+{
+    int32 Status      = CFE_PSP_SUCCESS;
+    bool  MemberEnded = false;
+    bool  Trailing    = false;
+    int32 BytesIn;
+    int   ZStatus;
+
+    if (inflateInit2(&State->Stream, CFE_PSP_CODEC_AUTO_WBITS) != Z_OK)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    while (Status == CFE_PSP_SUCCESS && !Trailing)
+    {
+        BytesIn = OS_read(State->SrcFd, State->InBuf, sizeof(State->InBuf));
+        if (BytesIn <= 0)
+        {
+            if (BytesIn < 0)
+            {
+                Status = CFE_PSP_ERROR;
+            }
+            break;
+        }
+
+        State->Stream.next_in  = State->InBuf;
+        State->Stream.avail_in = BytesIn;
+
+        while (State->Stream.avail_in > 0 && Status == CFE_PSP_SUCCESS)
+        {
+            if (MemberEnded && *State->Stream.next_in != CFE_PSP_CODEC_GZIP_ID1)
+            {
+                Trailing = true;
+                break;
+            }
+
+            if (MemberEnded)
+            {
+                /* More input after a member trailer starts another member */
+                inflateReset(&State->Stream);
+                MemberEnded = false;
+            }
+
+            do
+            {
+                State->Stream.next_out  = State->OutBuf;
+                State->Stream.avail_out = sizeof(State->OutBuf);
+                ZStatus                 = inflate(&State->Stream, Z_NO_FLUSH);
+
+                if (ZStatus != Z_OK && ZStatus != Z_STREAM_END && ZStatus != Z_BUF_ERROR)
+                {
+                    Status = CFE_PSP_INVALID_CODEC_DATA;
+                }
+                else
+                {
+                    Status = CFE_PSP_CodecWriteOut(State);
+                }
+            } while (State->Stream.avail_out == 0 && ZStatus != Z_STREAM_END && Status == CFE_PSP_SUCCESS);
+
+            MemberEnded = (ZStatus == Z_STREAM_END);
+        }
+
+        if (YieldFunc != NULL)
+        {
+            YieldFunc(YieldArg);
+        }
+    }
+
+    /* An empty source or a missing trailer is a truncated stream */
+    if (Status == CFE_PSP_SUCCESS && !MemberEnded)
+    {
+        Status = CFE_PSP_INVALID_CODEC_DATA;
+    }
+
+    inflateEnd(&State->Stream);
+
+    return Status;
+}
+
+int32 CFE_PSP_DecompressFile(const char *srcFileName, const char *dstFileName, CFE_PSP_CodecYieldFunc_t YieldFunc,
+                             void *YieldArg)
+{
+    CFE_PSP_CodecState_t *State;
+    int32                 Status;
+
+    State = CFE_PSP_CodecOpen(srcFileName, dstFileName);
+    if (State == NULL)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    Status = CFE_PSP_CodecInflate(State, YieldFunc, YieldArg);
+
+    CFE_PSP_CodecClose(State, dstFileName, Status);
+
+    return Status;
+}
+
+int32 CFE_PSP_CompressFile(const char *srcFileName, const char *dstFileName, int32 Level,
+                           CFE_PSP_CodecYieldFunc_t YieldFunc, void *YieldArg)
+{
+    CFE_PSP_CodecState_t *State;
+    int32                 Status;
+
+    if (Level == CFE_PSP_COMPRESS_LEVEL_DEFAULT)
+    {
+        Level = CFE_PSP_CODEC_DEFAULT_LEVEL;
+    }
+    else if (Level < Z_BEST_SPEED || Level > Z_BEST_COMPRESSION)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    State = CFE_PSP_CodecOpen(srcFileName, dstFileName);
+    if (State == NULL)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    Status = CFE_PSP_CodecDeflate(State, Level, YieldFunc, YieldArg);
+
+    CFE_PSP_CodecClose(State, dstFileName, Status);
+
+    return Status;
+}
+
+int32 CFE_PSP_Decompress(char *srcFileName, char *dstFileName)
+{
+    return CFE_PSP_DecompressFile(srcFileName, dstFileName, NULL, NULL);
+}
+
+int32 CFE_PSP_Compress(char *srcFileName, char *dstFileName)
+{
+    return CFE_PSP_CompressFile(srcFileName, dstFileName, CFE_PSP_COMPRESS_LEVEL_DEFAULT, NULL, NULL);
+}
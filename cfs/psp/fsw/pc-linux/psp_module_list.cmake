@@ -4,5 +4,6 @@
 soft_timebase
 timebase_posix_clock
 eeprom_mmap_file
+compress_zlib
 ram_notimpl
 port_notimpl
@@ -5,4 +5,5 @@ soft_timebase
 timebase_posix_clock
 eeprom_notimpl
 ram_direct
+compress_notimpl
 port_notimpl
@@ -129,5 +129,6 @@
 #define CFE_SB_ALLSUBS_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ALLSUBS_TLM_MSG      /* 0x080D */
 #define CFE_SB_ONESUB_TLM_MID       CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_ONESUB_TLM_MSG       /* 0x080E */
 #define CFE_ES_MEMSTATS_TLM_MID     CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_ES_MEMSTATS_TLM_MSG     /* 0x0810 */
+#define CFE_SB_LATENCY_TLM_MID      CFE_PLATFORM_TLM_MID_BASE + CFE_MISSION_SB_LATENCY_TLM_MSG      /* 0x0811 */
 
 #endif /* CPU1_MSGIDS_H */
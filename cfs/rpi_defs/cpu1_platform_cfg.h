@@ -542,9 +542,10 @@
 **       character.
 **
 **  \par Limits
-**       There is a lower limit of 512.  There are no restrictions on the upper limit
-**       however, the maximum system log size is system dependent and should be
-**       verified.
+**       There is a lower limit of 512 and an upper limit of 65535, since the
+**       write and end indices are packed into a single 32 bit word that is
+**       updated atomically.  The maximum system log size is also system
+**       dependent and should be verified.
 */
 #define CFE_PLATFORM_ES_SYSTEM_LOG_SIZE 3072
 
@@ -1708,4 +1709,43 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Startup script loader tasks
+**
+**  \par Description:
+**      The number of additional tasks that CFE ES starts to load the entries of
+**      the startup script concurrently.  Entries are still loaded in the order
+**      given by the optional phase and dependency fields of the startup script,
+**      and by default every entry waits for all of the libraries listed before it.
+**
+**      Loading modules concurrently can shorten startup considerably when module
+**      loading is dominated by slow file system access.  The loader tasks exit
+**      once all startup script entries have been processed.
+**
+**      A value of 0 loads all entries sequentially in script order.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero, and no more than 8.
+*/
+#define CFE_PLATFORM_ES_STARTUP_WORKERS 2
+
+/**
+**  \cfeescfg CPU Affinity of the cFE Core Tasks
+**
+**  \par Description:
+**      Restricts the main tasks of the cFE core applications (ES, EVS, SB, TIME
+**      and TBL) to a set of CPUs.  Bit N of the mask allows the tasks to run on
+**      CPU N.  Application main tasks are configured in the startup script, and
+**      child tasks inherit the CPUs of their application's main task unless
+**      CFE_ES_CreateChildTask is given a CFE_ES_TASK_CPU_AFFINITY flag.
+**
+**      A value of 0 leaves the core tasks free to run on any CPU.  The mask is
+**      ignored on platforms that do not support CPU affinity.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero, and no more than 0xFFFF.
+*/
+#define CFE_PLATFORM_ES_CORE_TASK_CPU_AFFINITY 0
+
 #endif /* CPU1_PLATFORM_CFG_H */
@@ -154,6 +154,12 @@ set(OSAL_CONFIG_MAX_NUM_OPEN_DIRS       4)
 # The maximum number of file systems that can be managed by OSAL
 set(OSAL_CONFIG_MAX_FILE_SYSTEMS        14)
 
+# The maximum number of event sets to support
+set(OSAL_CONFIG_MAX_EVENTSETS           4)
+
+# The maximum number of objects that can be members of one event set
+set(OSAL_CONFIG_MAX_EVENTSET_MEMBERS    16)
+
 # The maximum length for a file name, including any extension
 # (This does not include the directory part)
 # This length must include an extra character for NULL termination.
@@ -101,10 +101,10 @@ SET(FT_INSTALL_SUBDIR "host/functional-test")
 SET(MISSION_CPUNAMES cpu1)
 
 SET(cpu1_PROCESSORID 1)
-SET(cpu1_APPLIST osk_c_fw mipea kit_ci kit_to kit_sch gpio_demo)
+SET(cpu1_APPLIST osk_c_fw mipea kit_ci kit_to kit_sch gpio_demo sb_bridge sb_rec sb_replay)
 # filemgr, tftp
 
-SET(cpu1_FILELIST cfe_es_startup.scr osk_to_pkt_tbl.json osk_sch_msgtbl.json osk_sch_schtbl.json filemgr_ini.json gpio_demo_ini.json)
+SET(cpu1_FILELIST cfe_es_startup.scr osk_to_pkt_tbl.json osk_sch_msgtbl.json osk_sch_schtbl.json filemgr_ini.json gpio_demo_ini.json sb_bridge_ini.json sb_bridge_fwd_tbl.json sb_rec_ini.json sb_rec_tbl.json sb_replay_ini.json)
 
 # CPU2 example.  This is not built by default anymore but
 # serves as an example of how one would configure multiple cpus.